@@ -28,7 +28,17 @@
 # NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
 # SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import sys
 import numpy
+
+# the filters run on the thread pool of scipy.sparse.sparsetools, see
+# scipy.sparse.sparsetools.set_num_threads; on IronPython they are serial
+import _nd_image
+if sys.platform != 'cli':
+    from scipy.sparse.sparsetools import _parallel
+    _nd_image._set_parallel_api(_parallel._C_API)
+    del _parallel
+
 from filters import *
 from fourier import *
 from interpolation import *
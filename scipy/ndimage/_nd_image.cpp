@@ -387,114 +387,117 @@ static __Pyx_TypeInfo __Pyx_TypeInfo_nn_npy_intp = { "npy_intp", NULL, sizeof(np
 namespace clr__nd_image {
   public ref class module__nd_image sealed abstract {
 /* Cython code section 'global_var' */
-static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_AddReference_767_3;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_767_16;
-static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_Array_187_40;
-static  CallSite< System::Func< CallSite^, System::Object^, PY_LONG_LONG >^ >^ __site_cvt_cvt_PY_LONG_LONG_187_40;
-static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_Dtype_193_16;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_204_25;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_328_51;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_330_51;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_332_54;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_334_53;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_353_24;
-static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_ndarray_362_31;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_362_21;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_362_21;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_363_23;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_367_23;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_396_0;
-static  CallSite< System::Func< CallSite^, System::Object^, long >^ >^ __site_cvt_cvt_long_396_0;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_396_0;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_396_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_405_0;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_405_0;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_411_24;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_418_0;
+static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_AddReference_802_3;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_802_16;
+static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_Array_190_40;
+static  CallSite< System::Func< CallSite^, System::Object^, PY_LONG_LONG >^ >^ __site_cvt_cvt_PY_LONG_LONG_190_40;
+static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_Dtype_196_16;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_207_25;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_335_51;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_337_51;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_339_54;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_341_53;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_360_24;
+static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_ndarray_369_31;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_369_21;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_369_21;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_370_23;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_374_23;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_409_0;
+static  CallSite< System::Func< CallSite^, System::Object^, long >^ >^ __site_cvt_cvt_long_409_0;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_409_0;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_409_0;
 static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_418_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_418_0_1;
 static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_418_0;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_418_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_427_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_427_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_427_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_427_0;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_427_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_427_0_2;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_437_0;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_437_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_437_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_455_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_455_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_455_0;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_477_26;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_478_30;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_479_25;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_479_25;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_480_30;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_481_25;
-static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_481_25;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_482_30;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_ARGS_KWARGS_492_17;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_495_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_495_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_495_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_495_0;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_495_0_1;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_508_27;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_ARGS_KWARGS_521_22;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_522_18;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_525_0;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_525_0;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_538_27;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_547_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_547_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_547_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_556_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_556_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_565_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_565_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_append_577_32;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_577_39;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_578_17;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_ARGS_KWARGS_579_23;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_getindex_581_22;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_581_22;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_584_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_584_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_584_0;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_603_31;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_618_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_618_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_618_0;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_639_0;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >^ __site_call0_653_27;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_658_24;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_659_23;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >^ __site_get_iterator_659_8;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_660_27;
-static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_660_18;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_662_29;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_663_31;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >^ __site_get_iterator_663_16;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_664_44;
-static  CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >^ __site_cvt_cvt_Py_ssize_t_664_44;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_664_63;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_664_68;
-static  CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >^ __site_cvt_cvt_Py_ssize_t_664_68;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_664_31;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_665_23;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_666_34;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_666_22;
-static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_668_22;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_682_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_718_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_718_0_1;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_718_0_2;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_718_0_3;
-static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >^ __site_call0_740_46;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_746_0;
-static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_746_0_1;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_424_24;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_431_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_431_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_431_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_431_0;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_431_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_440_0;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_440_0;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_453_24;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_462_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_462_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_462_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_462_0;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_462_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_462_0_2;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_472_0;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_472_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_472_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_490_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_490_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_490_0;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_512_26;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_513_30;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_514_25;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_514_25;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_515_30;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_516_25;
+static  CallSite< System::Func< CallSite^, System::Object^, bool >^ >^ __site_istrue_516_25;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_517_30;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call2_ARGS_KWARGS_527_17;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_530_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_530_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_530_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_530_0;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_530_0_1;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_543_27;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_ARGS_KWARGS_556_22;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_557_18;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_560_0;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_560_0;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_573_27;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_582_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_582_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_582_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_591_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_591_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_600_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_600_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_append_612_32;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_612_39;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_613_17;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_ARGS_KWARGS_614_23;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_getindex_616_22;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_616_22;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_619_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_619_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_619_0;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_638_31;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_653_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_653_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, double >^ >^ __site_cvt_cvt_double_653_0;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_674_0;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >^ __site_call0_688_27;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_693_24;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_694_23;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >^ __site_get_iterator_694_8;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_695_27;
+static  CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >^ __site_cvt_cvt_npy_intp_695_18;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_mul_697_29;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_698_31;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >^ __site_get_iterator_698_16;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_699_44;
+static  CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >^ __site_cvt_cvt_Py_ssize_t_699_44;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_699_63;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >^ __site_op_add_699_68;
+static  CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >^ __site_cvt_cvt_Py_ssize_t_699_68;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call3_699_31;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_700_23;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_701_34;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_701_22;
+static  CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >^ __site_setindex_703_22;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_717_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_753_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_753_0_1;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_753_0_2;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_753_0_3;
+static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >^ __site_call0_775_46;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_781_0;
+static  CallSite< System::Func< CallSite^, System::Object^, int >^ >^ __site_cvt_cvt_int_781_0_1;
 static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_append_243_18;
 static  CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >^ __site_call1_243_25;
 static  CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >^ __site_get_zeros_245_16;
@@ -535,7 +538,7 @@ static CodeContext^ __pyx_context;
 public:
 static System::String^ __module__ = __Pyx_MODULE_NAME;
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":186
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":189
  *         object PythonOps__MemoryError "PythonOps::MemoryError"(str e)
  * 
  *     cdef inline NpyArray* ARRAY(ndarray a):             # <<<<<<<<<<<<<<
@@ -548,15 +551,15 @@ static CYTHON_INLINE NpyArray *ARRAY(NumpyDotNet::ndarray^ __pyx_v_a) {
   System::Object^ __pyx_t_1 = nullptr;
   PY_LONG_LONG __pyx_t_2;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":187
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":190
  * 
  *     cdef inline NpyArray* ARRAY(ndarray a):
  *         return <NpyArray*> <long long> a.Array             # <<<<<<<<<<<<<<
  * 
  *     cdef inline dtype DescrFromType(int typenum):
  */
-  __pyx_t_1 = __site_get_Array_187_40->Target(__site_get_Array_187_40, ((System::Object^)__pyx_v_a), __pyx_context);
-  __pyx_t_2 = __site_cvt_cvt_PY_LONG_LONG_187_40->Target(__site_cvt_cvt_PY_LONG_LONG_187_40, __pyx_t_1);
+  __pyx_t_1 = __site_get_Array_190_40->Target(__site_get_Array_190_40, ((System::Object^)__pyx_v_a), __pyx_context);
+  __pyx_t_2 = __site_cvt_cvt_PY_LONG_LONG_190_40->Target(__site_cvt_cvt_PY_LONG_LONG_190_40, __pyx_t_1);
   __pyx_t_1 = nullptr;
   __pyx_r = ((NpyArray *)((PY_LONG_LONG)__pyx_t_2));
   goto __pyx_L0;
@@ -566,7 +569,7 @@ static CYTHON_INLINE NpyArray *ARRAY(NumpyDotNet::ndarray^ __pyx_v_a) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":189
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":192
  *         return <NpyArray*> <long long> a.Array
  * 
  *     cdef inline dtype DescrFromType(int typenum):             # <<<<<<<<<<<<<<
@@ -578,7 +581,7 @@ static CYTHON_INLINE NumpyDotNet::dtype^ DescrFromType(int __pyx_v_typenum) {
   NumpyDotNet::dtype^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":190
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":193
  * 
  *     cdef inline dtype DescrFromType(int typenum):
  *         return Npy_INTERFACE_descr(NpyArray_DescrFromType(typenum))             # <<<<<<<<<<<<<<
@@ -598,7 +601,7 @@ static CYTHON_INLINE NumpyDotNet::dtype^ DescrFromType(int __pyx_v_typenum) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":192
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":195
  *         return Npy_INTERFACE_descr(NpyArray_DescrFromType(typenum))
  * 
  *     cdef inline dtype DESCR(ndarray x):             # <<<<<<<<<<<<<<
@@ -610,14 +613,14 @@ static CYTHON_INLINE NumpyDotNet::dtype^ DESCR(NumpyDotNet::ndarray^ __pyx_v_x)
   NumpyDotNet::dtype^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":193
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":196
  * 
  *     cdef inline dtype DESCR(ndarray x):
  *         return x.Dtype             # <<<<<<<<<<<<<<
  * 
  *     def raise_no_memory():
  */
-  __pyx_t_1 = __site_get_Dtype_193_16->Target(__site_get_Dtype_193_16, ((System::Object^)__pyx_v_x), __pyx_context);
+  __pyx_t_1 = __site_get_Dtype_196_16->Target(__site_get_Dtype_196_16, ((System::Object^)__pyx_v_x), __pyx_context);
   if (__pyx_t_1 != nullptr && dynamic_cast<NumpyDotNet::dtype^>(__pyx_t_1) == nullptr) {
     throw PythonOps::MakeException(__pyx_context, PythonOps::GetGlobal(__pyx_context, "TypeError"), "type error", nullptr);
   }
@@ -630,7 +633,7 @@ static CYTHON_INLINE NumpyDotNet::dtype^ DESCR(NumpyDotNet::ndarray^ __pyx_v_x)
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":195
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":198
  *         return x.Dtype
  * 
  *     def raise_no_memory():             # <<<<<<<<<<<<<<
@@ -642,7 +645,7 @@ static System::Object^ raise_no_memory() {
   System::Object^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":196
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":199
  * 
  *     def raise_no_memory():
  *         raise PythonOps__MemoryError("Out of memory")             # <<<<<<<<<<<<<<
@@ -657,7 +660,7 @@ static System::Object^ raise_no_memory() {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":198
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":201
  *         raise PythonOps__MemoryError("Out of memory")
  * 
  *     cdef inline incref(x):             # <<<<<<<<<<<<<<
@@ -672,7 +675,7 @@ static CYTHON_INLINE System::Object^ incref(System::Object^ __pyx_v_x) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":201
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":204
  *         pass
  * 
  *     cdef inline is_callable(f):             # <<<<<<<<<<<<<<
@@ -689,7 +692,7 @@ static CYTHON_INLINE System::Object^ is_callable(System::Object^ __pyx_v_f) {
   __pyx_v_clr = nullptr;
   __pyx_v_IsCallable = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":202
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":205
  * 
  *     cdef inline is_callable(f):
  *         import clr             # <<<<<<<<<<<<<<
@@ -700,7 +703,7 @@ static CYTHON_INLINE System::Object^ is_callable(System::Object^ __pyx_v_f) {
   __pyx_v_clr = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":203
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":206
  *     cdef inline is_callable(f):
  *         import clr
  *         from IronPython.Runtime.Operations.PythonOps import IsCallable             # <<<<<<<<<<<<<<
@@ -713,14 +716,14 @@ static CYTHON_INLINE System::Object^ is_callable(System::Object^ __pyx_v_f) {
   __pyx_t_2 = nullptr;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":204
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":207
  *         import clr
  *         from IronPython.Runtime.Operations.PythonOps import IsCallable
  *         return IsCallable(f)             # <<<<<<<<<<<<<<
  * 
  *     cdef inline CheckFromAny(object op, dtype newtype, int min_depth, int max_depth,
  */
-  __pyx_t_1 = __site_call1_204_25->Target(__site_call1_204_25, __pyx_context, __pyx_v_IsCallable, __pyx_v_f);
+  __pyx_t_1 = __site_call1_207_25->Target(__site_call1_207_25, __pyx_context, __pyx_v_IsCallable, __pyx_v_f);
   __pyx_r = __pyx_t_1;
   __pyx_t_1 = nullptr;
   goto __pyx_L0;
@@ -730,7 +733,7 @@ static CYTHON_INLINE System::Object^ is_callable(System::Object^ __pyx_v_f) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":206
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":209
  *         return IsCallable(f)
  * 
  *     cdef inline CheckFromAny(object op, dtype newtype, int min_depth, int max_depth,             # <<<<<<<<<<<<<<
@@ -745,7 +748,7 @@ static CYTHON_INLINE System::Object^ CheckFromAny(System::Object^ __pyx_v_op, Nu
   System::Object^ __pyx_t_3 = nullptr;
   System::Object^ __pyx_t_4 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":208
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":211
  *     cdef inline CheckFromAny(object op, dtype newtype, int min_depth, int max_depth,
  *                              int flags, object context):
  *         return PyArray_CheckFromAny(op, newtype, min_depth, max_depth, flags, context)             # <<<<<<<<<<<<<<
@@ -768,7 +771,7 @@ static CYTHON_INLINE System::Object^ CheckFromAny(System::Object^ __pyx_v_op, Nu
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":222
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":225
  * from numpy cimport PyArray_New, PyArray_Empty, import_array, NpyArray_INCREF, PyArray_ARRAY
  * 
  * cdef inline ndarray Empty(int nd, npy_intp * dims, dtype descr, int fortran):             # <<<<<<<<<<<<<<
@@ -780,7 +783,7 @@ static CYTHON_INLINE NumpyDotNet::ndarray^ Empty(int __pyx_v_nd, npy_intp *__pyx
   NumpyDotNet::ndarray^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":223
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":226
  * 
  * cdef inline ndarray Empty(int nd, npy_intp * dims, dtype descr, int fortran):
  *     return PyArray_Empty(nd, dims, descr, fortran)             # <<<<<<<<<<<<<<
@@ -800,7 +803,7 @@ static CYTHON_INLINE NumpyDotNet::ndarray^ Empty(int __pyx_v_nd, npy_intp *__pyx
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":225
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":228
  *     return PyArray_Empty(nd, dims, descr, fortran)
  * 
  * cdef inline ndarray array_New(int ndim, npy_intp *shape, int typenum, npy_intp *strides,             # <<<<<<<<<<<<<<
@@ -812,7 +815,7 @@ static CYTHON_INLINE NumpyDotNet::ndarray^ array_New(int __pyx_v_ndim, npy_intp
   NumpyDotNet::ndarray^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":228
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":231
  *                               char *data, int itemsize, int flags):
  *     return PyArray_New(NULL, ndim, shape, typenum, strides, data,
  *                        itemsize, flags, NULL)             # <<<<<<<<<<<<<<
@@ -832,7 +835,7 @@ static CYTHON_INLINE NumpyDotNet::ndarray^ array_New(int __pyx_v_ndim, npy_intp
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":323
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":330
  * #
  * 
  * cdef bint satisfies(NpyArray *a, int requirements, int typenum):             # <<<<<<<<<<<<<<
@@ -849,7 +852,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   System::Object^ __pyx_t_4 = nullptr;
   int __pyx_t_5;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":325
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":332
  * cdef bint satisfies(NpyArray *a, int requirements, int typenum):
  *     cdef bint type_ok
  *     type_ok = (typenum == -1) or (NpyArray_TYPE(a) == typenum)             # <<<<<<<<<<<<<<
@@ -865,7 +868,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_v_type_ok = __pyx_t_3;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":326
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":333
  *     cdef bint type_ok
  *     type_ok = (typenum == -1) or (NpyArray_TYPE(a) == typenum)
  *     if NpyArray_ISCARRAY(a):             # <<<<<<<<<<<<<<
@@ -875,7 +878,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_3 = NpyArray_ISCARRAY(__pyx_v_a);
   if (__pyx_t_3) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":327
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":334
  *     type_ok = (typenum == -1) or (NpyArray_TYPE(a) == typenum)
  *     if NpyArray_ISCARRAY(a):
  *         return type_ok             # <<<<<<<<<<<<<<
@@ -888,7 +891,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L3:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":328
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":335
  *     if NpyArray_ISCARRAY(a):
  *         return type_ok
  *     if NpyArray_ISBYTESWAPPED(a) and (requirements & NPY_NOTSWAPPED):             # <<<<<<<<<<<<<<
@@ -898,7 +901,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_3 = NpyArray_ISBYTESWAPPED(__pyx_v_a);
   if (__pyx_t_3) {
     __pyx_t_4 = (__pyx_v_requirements & NPY_NOTSWAPPED);
-    __pyx_t_1 = __site_istrue_328_51->Target(__site_istrue_328_51, __pyx_t_4);
+    __pyx_t_1 = __site_istrue_335_51->Target(__site_istrue_335_51, __pyx_t_4);
     __pyx_t_4 = nullptr;
     __pyx_t_2 = __pyx_t_1;
   } else {
@@ -906,7 +909,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":329
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":336
  *         return type_ok
  *     if NpyArray_ISBYTESWAPPED(a) and (requirements & NPY_NOTSWAPPED):
  *         return False             # <<<<<<<<<<<<<<
@@ -919,7 +922,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L4:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":330
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":337
  *     if NpyArray_ISBYTESWAPPED(a) and (requirements & NPY_NOTSWAPPED):
  *         return False
  *     if not NpyArray_ISALIGNED(a) and (requirements & NPY_ALIGNED):             # <<<<<<<<<<<<<<
@@ -929,7 +932,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_2 = (!NpyArray_ISALIGNED(__pyx_v_a));
   if (__pyx_t_2) {
     __pyx_t_4 = (__pyx_v_requirements & NPY_ALIGNED);
-    __pyx_t_3 = __site_istrue_330_51->Target(__site_istrue_330_51, __pyx_t_4);
+    __pyx_t_3 = __site_istrue_337_51->Target(__site_istrue_337_51, __pyx_t_4);
     __pyx_t_4 = nullptr;
     __pyx_t_1 = __pyx_t_3;
   } else {
@@ -937,7 +940,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   if (__pyx_t_1) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":331
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":338
  *         return False
  *     if not NpyArray_ISALIGNED(a) and (requirements & NPY_ALIGNED):
  *         return False             # <<<<<<<<<<<<<<
@@ -950,7 +953,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L5:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":332
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":339
  *     if not NpyArray_ISALIGNED(a) and (requirements & NPY_ALIGNED):
  *         return False
  *     if not NpyArray_ISCONTIGUOUS(a) and (requirements & NPY_CONTIGUOUS):             # <<<<<<<<<<<<<<
@@ -960,7 +963,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_1 = (!NpyArray_ISCONTIGUOUS(__pyx_v_a));
   if (__pyx_t_1) {
     __pyx_t_4 = (__pyx_v_requirements & NPY_CONTIGUOUS);
-    __pyx_t_2 = __site_istrue_332_54->Target(__site_istrue_332_54, __pyx_t_4);
+    __pyx_t_2 = __site_istrue_339_54->Target(__site_istrue_339_54, __pyx_t_4);
     __pyx_t_4 = nullptr;
     __pyx_t_3 = __pyx_t_2;
   } else {
@@ -968,7 +971,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   if (__pyx_t_3) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":333
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":340
  *         return False
  *     if not NpyArray_ISCONTIGUOUS(a) and (requirements & NPY_CONTIGUOUS):
  *         return False             # <<<<<<<<<<<<<<
@@ -981,7 +984,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L6:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":334
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":341
  *     if not NpyArray_ISCONTIGUOUS(a) and (requirements & NPY_CONTIGUOUS):
  *         return False
  *     if not NpyArray_ISWRITEABLE(a) and (requirements & NPY_WRITEABLE):             # <<<<<<<<<<<<<<
@@ -991,7 +994,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_3 = (!NpyArray_ISWRITEABLE(__pyx_v_a));
   if (__pyx_t_3) {
     __pyx_t_4 = (__pyx_v_requirements & NPY_WRITEABLE);
-    __pyx_t_1 = __site_istrue_334_53->Target(__site_istrue_334_53, __pyx_t_4);
+    __pyx_t_1 = __site_istrue_341_53->Target(__site_istrue_341_53, __pyx_t_4);
     __pyx_t_4 = nullptr;
     __pyx_t_2 = __pyx_t_1;
   } else {
@@ -999,7 +1002,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":335
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":342
  *         return False
  *     if not NpyArray_ISWRITEABLE(a) and (requirements & NPY_WRITEABLE):
  *         return False             # <<<<<<<<<<<<<<
@@ -1012,7 +1015,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L7:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":336
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":343
  *     if not NpyArray_ISWRITEABLE(a) and (requirements & NPY_WRITEABLE):
  *         return False
  *     if requirements & NPY_ENSURECOPY:             # <<<<<<<<<<<<<<
@@ -1022,7 +1025,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   __pyx_t_5 = (__pyx_v_requirements & NPY_ENSURECOPY);
   if (__pyx_t_5) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":337
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":344
  *         return False
  *     if requirements & NPY_ENSURECOPY:
  *         return False             # <<<<<<<<<<<<<<
@@ -1035,7 +1038,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   }
   __pyx_L8:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":338
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":345
  *     if requirements & NPY_ENSURECOPY:
  *         return False
  *     return type_ok             # <<<<<<<<<<<<<<
@@ -1050,7 +1053,7 @@ static  int satisfies(NpyArray *__pyx_v_a, int __pyx_v_requirements, int __pyx_v
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":341
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":348
  * 
  * # typenum is either a NumPy type number, *or* -1 for "any type"
  * cdef ndarray NA_InputArray(object a, int typenum, int requires):             # <<<<<<<<<<<<<<
@@ -1065,7 +1068,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   System::Object^ __pyx_t_2 = nullptr;
   __pyx_v_descr = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":343
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":350
  * cdef ndarray NA_InputArray(object a, int typenum, int requires):
  *     cdef dtype descr
  *     if typenum == -1:             # <<<<<<<<<<<<<<
@@ -1075,7 +1078,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   __pyx_t_1 = (__pyx_v_typenum == -1);
   if (__pyx_t_1) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":344
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":351
  *     cdef dtype descr
  *     if typenum == -1:
  *         descr = None             # <<<<<<<<<<<<<<
@@ -1087,7 +1090,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   }
   /*else*/ {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":346
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":353
  *         descr = None
  *     else:
  *         descr = DescrFromType(typenum)             # <<<<<<<<<<<<<<
@@ -1100,7 +1103,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   }
   __pyx_L3:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":347
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":354
  *     else:
  *         descr = DescrFromType(typenum)
  *     incref(descr) # CheckFromAny steals reference             # <<<<<<<<<<<<<<
@@ -1110,7 +1113,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   __pyx_t_2 = incref(((System::Object^)__pyx_v_descr)); 
   __pyx_t_2 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":348
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":355
  *         descr = DescrFromType(typenum)
  *     incref(descr) # CheckFromAny steals reference
  *     return CheckFromAny(a, descr, 0, 0, requires, None)             # <<<<<<<<<<<<<<
@@ -1130,7 +1133,7 @@ static  NumpyDotNet::ndarray^ NA_InputArray(System::Object^ __pyx_v_a, int __pyx
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":350
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":357
  *     return CheckFromAny(a, descr, 0, 0, requires, None)
  * 
  * cdef ndarray NA_IoArray(object a, int typenum, int requires):             # <<<<<<<<<<<<<<
@@ -1145,7 +1148,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
   int __pyx_t_2;
   System::Object^ __pyx_t_3 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":351
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":358
  * 
  * cdef ndarray NA_IoArray(object a, int typenum, int requires):
  *     cdef ndarray shadow = NA_InputArray(a, typenum, requires | NPY_UPDATEIFCOPY)             # <<<<<<<<<<<<<<
@@ -1156,7 +1159,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
   __pyx_v_shadow = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":352
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":359
  * cdef ndarray NA_IoArray(object a, int typenum, int requires):
  *     cdef ndarray shadow = NA_InputArray(a, typenum, requires | NPY_UPDATEIFCOPY)
  *     if not NpyArray_ISWRITEABLE(ARRAY(shadow)):             # <<<<<<<<<<<<<<
@@ -1166,7 +1169,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
   __pyx_t_2 = (!NpyArray_ISWRITEABLE(ARRAY(__pyx_v_shadow)));
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":353
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":360
  *     cdef ndarray shadow = NA_InputArray(a, typenum, requires | NPY_UPDATEIFCOPY)
  *     if not NpyArray_ISWRITEABLE(ARRAY(shadow)):
  *         raise ValueError("NA_IoArray: I/O array must be writable array")             # <<<<<<<<<<<<<<
@@ -1174,7 +1177,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
  * 
  */
     __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "ValueError");
-    __pyx_t_3 = __site_call1_353_24->Target(__site_call1_353_24, __pyx_context, __pyx_t_1, ((System::Object^)"NA_IoArray: I/O array must be writable array"));
+    __pyx_t_3 = __site_call1_360_24->Target(__site_call1_360_24, __pyx_context, __pyx_t_1, ((System::Object^)"NA_IoArray: I/O array must be writable array"));
     __pyx_t_1 = nullptr;
     throw PythonOps::MakeException(__pyx_context, __pyx_t_3, nullptr, nullptr);
     __pyx_t_3 = nullptr;
@@ -1182,7 +1185,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
   }
   __pyx_L3:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":354
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":361
  *     if not NpyArray_ISWRITEABLE(ARRAY(shadow)):
  *         raise ValueError("NA_IoArray: I/O array must be writable array")
  *     return shadow             # <<<<<<<<<<<<<<
@@ -1197,7 +1200,7 @@ static  NumpyDotNet::ndarray^ NA_IoArray(System::Object^ __pyx_v_a, int __pyx_v_
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":356
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":363
  *     return shadow
  * 
  * cdef ndarray NA_OutputArray(object a_obj, int typenum, int requires):             # <<<<<<<<<<<<<<
@@ -1220,7 +1223,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_v_descr = nullptr;
   __pyx_v_ret_obj = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":362
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":369
  *     cdef ndarray ret_obj
  * 
  *     if not isinstance(a_obj, np.ndarray):             # <<<<<<<<<<<<<<
@@ -1229,17 +1232,17 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  */
   __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "isinstance");
   __pyx_t_2 = PythonOps::GetGlobal(__pyx_context, "np");
-  __pyx_t_3 = __site_get_ndarray_362_31->Target(__site_get_ndarray_362_31, __pyx_t_2, __pyx_context);
+  __pyx_t_3 = __site_get_ndarray_369_31->Target(__site_get_ndarray_369_31, __pyx_t_2, __pyx_context);
   __pyx_t_2 = nullptr;
-  __pyx_t_2 = __site_call2_362_21->Target(__site_call2_362_21, __pyx_context, __pyx_t_1, __pyx_v_a_obj, __pyx_t_3);
+  __pyx_t_2 = __site_call2_369_21->Target(__site_call2_369_21, __pyx_context, __pyx_t_1, __pyx_v_a_obj, __pyx_t_3);
   __pyx_t_1 = nullptr;
   __pyx_t_3 = nullptr;
-  __pyx_t_4 = __site_istrue_362_21->Target(__site_istrue_362_21, __pyx_t_2);
+  __pyx_t_4 = __site_istrue_369_21->Target(__site_istrue_369_21, __pyx_t_2);
   __pyx_t_2 = nullptr;
   __pyx_t_5 = (!__pyx_t_4);
   if (__pyx_t_5) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":363
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":370
  * 
  *     if not isinstance(a_obj, np.ndarray):
  *         raise TypeError('NA_OutputArray: ndarray instance expected')             # <<<<<<<<<<<<<<
@@ -1247,7 +1250,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  *     a = ARRAY(a_obj)
  */
     __pyx_t_2 = PythonOps::GetGlobal(__pyx_context, "TypeError");
-    __pyx_t_3 = __site_call1_363_23->Target(__site_call1_363_23, __pyx_context, __pyx_t_2, ((System::Object^)"NA_OutputArray: ndarray instance expected"));
+    __pyx_t_3 = __site_call1_370_23->Target(__site_call1_370_23, __pyx_context, __pyx_t_2, ((System::Object^)"NA_OutputArray: ndarray instance expected"));
     __pyx_t_2 = nullptr;
     throw PythonOps::MakeException(__pyx_context, __pyx_t_3, nullptr, nullptr);
     __pyx_t_3 = nullptr;
@@ -1255,7 +1258,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_L3:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":365
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":372
  *         raise TypeError('NA_OutputArray: ndarray instance expected')
  * 
  *     a = ARRAY(a_obj)             # <<<<<<<<<<<<<<
@@ -1267,7 +1270,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_v_a = ARRAY(((NumpyDotNet::ndarray^)__pyx_v_a_obj));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":366
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":373
  * 
  *     a = ARRAY(a_obj)
  *     if not NpyArray_ISWRITEABLE(a):             # <<<<<<<<<<<<<<
@@ -1277,7 +1280,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_t_5 = (!NpyArray_ISWRITEABLE(__pyx_v_a));
   if (__pyx_t_5) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":367
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":374
  *     a = ARRAY(a_obj)
  *     if not NpyArray_ISWRITEABLE(a):
  *         raise TypeError('NA_OutputArray: only writeable arrays work for output.')             # <<<<<<<<<<<<<<
@@ -1285,7 +1288,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  *         return a_obj
  */
     __pyx_t_3 = PythonOps::GetGlobal(__pyx_context, "TypeError");
-    __pyx_t_2 = __site_call1_367_23->Target(__site_call1_367_23, __pyx_context, __pyx_t_3, ((System::Object^)"NA_OutputArray: only writeable arrays work for output."));
+    __pyx_t_2 = __site_call1_374_23->Target(__site_call1_374_23, __pyx_context, __pyx_t_3, ((System::Object^)"NA_OutputArray: only writeable arrays work for output."));
     __pyx_t_3 = nullptr;
     throw PythonOps::MakeException(__pyx_context, __pyx_t_2, nullptr, nullptr);
     __pyx_t_2 = nullptr;
@@ -1293,7 +1296,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_L4:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":368
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":375
  *     if not NpyArray_ISWRITEABLE(a):
  *         raise TypeError('NA_OutputArray: only writeable arrays work for output.')
  *     if satisfies(a, requires, typenum):             # <<<<<<<<<<<<<<
@@ -1303,7 +1306,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_t_5 = satisfies(__pyx_v_a, __pyx_v_requires, __pyx_v_typenum);
   if (__pyx_t_5) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":369
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":376
  *         raise TypeError('NA_OutputArray: only writeable arrays work for output.')
  *     if satisfies(a, requires, typenum):
  *         return a_obj             # <<<<<<<<<<<<<<
@@ -1319,7 +1322,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_L5:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":370
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":377
  *     if satisfies(a, requires, typenum):
  *         return a_obj
  *     if typenum == -1:             # <<<<<<<<<<<<<<
@@ -1329,7 +1332,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_t_5 = (__pyx_v_typenum == -1);
   if (__pyx_t_5) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":371
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":378
  *         return a_obj
  *     if typenum == -1:
  *         descr = DESCR(a_obj)             # <<<<<<<<<<<<<<
@@ -1346,7 +1349,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   /*else*/ {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":373
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":380
  *         descr = DESCR(a_obj)
  *     else:
  *         descr = DescrFromType(typenum)             # <<<<<<<<<<<<<<
@@ -1359,7 +1362,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_L6:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":374
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":381
  *     else:
  *         descr = DescrFromType(typenum)
  *     incref(descr) # Empty steals reference             # <<<<<<<<<<<<<<
@@ -1369,7 +1372,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_t_2 = incref(((System::Object^)__pyx_v_descr)); 
   __pyx_t_2 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":375
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":382
  *         descr = DescrFromType(typenum)
  *     incref(descr) # Empty steals reference
  *     ret_obj = Empty(NpyArray_NDIM(a), NpyArray_DIMS(a), descr, 0)             # <<<<<<<<<<<<<<
@@ -1380,7 +1383,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   __pyx_v_ret_obj = ((NumpyDotNet::ndarray^)__pyx_t_2);
   __pyx_t_2 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":376
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":383
  *     incref(descr) # Empty steals reference
  *     ret_obj = Empty(NpyArray_NDIM(a), NpyArray_DIMS(a), descr, 0)
  *     ret = ARRAY(ret_obj)             # <<<<<<<<<<<<<<
@@ -1389,7 +1392,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  */
   __pyx_v_ret = ARRAY(__pyx_v_ret_obj);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":377
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":384
  *     ret_obj = Empty(NpyArray_NDIM(a), NpyArray_DIMS(a), descr, 0)
  *     ret = ARRAY(ret_obj)
  *     NpyArray_SETFLAGS(ret, (NpyArray_FLAGS(ret) | NPY_UPDATEIFCOPY) & ~NPY_WRITEABLE)             # <<<<<<<<<<<<<<
@@ -1398,7 +1401,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  */
   NpyArray_SETFLAGS(__pyx_v_ret, ((NpyArray_FLAGS(__pyx_v_ret) | NPY_UPDATEIFCOPY) & (~NPY_WRITEABLE)));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":378
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":385
  *     ret = ARRAY(ret_obj)
  *     NpyArray_SETFLAGS(ret, (NpyArray_FLAGS(ret) | NPY_UPDATEIFCOPY) & ~NPY_WRITEABLE)
  *     cdef NpyArray* a_npy = PyArray_ARRAY(a_obj)             # <<<<<<<<<<<<<<
@@ -1410,7 +1413,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   }
   __pyx_v_a_npy = PyArray_ARRAY(((NumpyDotNet::ndarray^)__pyx_v_a_obj));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":379
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":386
  *     NpyArray_SETFLAGS(ret, (NpyArray_FLAGS(ret) | NPY_UPDATEIFCOPY) & ~NPY_WRITEABLE)
  *     cdef NpyArray* a_npy = PyArray_ARRAY(a_obj)
  *     NpyArray_INCREF(a_npy)             # <<<<<<<<<<<<<<
@@ -1419,7 +1422,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  */
   NpyArray_INCREF(__pyx_v_a_npy);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":380
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":387
  *     cdef NpyArray* a_npy = PyArray_ARRAY(a_obj)
  *     NpyArray_INCREF(a_npy)
  *     NpyArray_SETBASE(ret, a_npy)             # <<<<<<<<<<<<<<
@@ -1428,7 +1431,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
  */
   NpyArray_SETBASE(__pyx_v_ret, __pyx_v_a_npy);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":381
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":388
  *     NpyArray_INCREF(a_npy)
  *     NpyArray_SETBASE(ret, a_npy)
  *     return ret_obj             # <<<<<<<<<<<<<<
@@ -1443,7 +1446,7 @@ static  NumpyDotNet::ndarray^ NA_OutputArray(System::Object^ __pyx_v_a_obj, int
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":383
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":390
  *     return ret_obj
  * 
  * cdef ndarray NI_ObjectToInputArray(object a):             # <<<<<<<<<<<<<<
@@ -1455,7 +1458,7 @@ static  NumpyDotNet::ndarray^ NI_ObjectToInputArray(System::Object^ __pyx_v_a) {
   NumpyDotNet::ndarray^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":384
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":391
  * 
  * cdef ndarray NI_ObjectToInputArray(object a):
  *     return NA_InputArray(a, -1, NPY_ALIGNED | NPY_NOTSWAPPED)             # <<<<<<<<<<<<<<
@@ -1472,7 +1475,7 @@ static  NumpyDotNet::ndarray^ NI_ObjectToInputArray(System::Object^ __pyx_v_a) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":386
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":393
  *     return NA_InputArray(a, -1, NPY_ALIGNED | NPY_NOTSWAPPED)
  * 
  * cdef ndarray NI_ObjectToOutputArray(object a):             # <<<<<<<<<<<<<<
@@ -1484,7 +1487,7 @@ static  NumpyDotNet::ndarray^ NI_ObjectToOutputArray(System::Object^ __pyx_v_a)
   NumpyDotNet::ndarray^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":387
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":394
  * 
  * cdef ndarray NI_ObjectToOutputArray(object a):
  *     return NA_OutputArray(a, -1, NPY_ALIGNED | NPY_NOTSWAPPED)             # <<<<<<<<<<<<<<
@@ -1501,7 +1504,7 @@ static  NumpyDotNet::ndarray^ NI_ObjectToOutputArray(System::Object^ __pyx_v_a)
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":389
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":396
  *     return NA_OutputArray(a, -1, NPY_ALIGNED | NPY_NOTSWAPPED)
  * 
  * cdef ndarray NI_ObjectToIoArray(object a):             # <<<<<<<<<<<<<<
@@ -1513,7 +1516,7 @@ static  NumpyDotNet::ndarray^ NI_ObjectToIoArray(System::Object^ __pyx_v_a) {
   NumpyDotNet::ndarray^ __pyx_r = nullptr;
   System::Object^ __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":390
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":397
  * 
  * cdef ndarray NI_ObjectToIoArray(object a):
  *     return NA_IoArray(a, -1, NPY_ALIGNED | NPY_NOTSWAPPED)             # <<<<<<<<<<<<<<
@@ -1530,9 +1533,9 @@ static  NumpyDotNet::ndarray^ NI_ObjectToIoArray(System::Object^ __pyx_v_a) {
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":396
- * # Wrappers
- * #
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":409
+ *             raise ImportError("scipy.sparse.sparsetools._parallel has the wrong version")
+ * 
  * def correlate1d(input, weights, int axis, output, NI_ExtendMode mode, double cval,             # <<<<<<<<<<<<<<
  *                 npy_intp origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
@@ -1554,13 +1557,13 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
   int __pyx_t_2;
   __pyx_v_input = input;
   __pyx_v_weights = weights;
-  __pyx_v_axis = __site_cvt_cvt_int_396_0->Target(__site_cvt_cvt_int_396_0, axis);
+  __pyx_v_axis = __site_cvt_cvt_int_409_0->Target(__site_cvt_cvt_int_409_0, axis);
   __pyx_v_output = output;
-  __pyx_v_mode = ((NI_ExtendMode)__site_cvt_cvt_long_396_0->Target(__site_cvt_cvt_long_396_0, mode));
-  __pyx_v_cval = __site_cvt_cvt_double_396_0->Target(__site_cvt_cvt_double_396_0, cval);
-  __pyx_v_origin = __site_cvt_cvt_npy_intp_396_0->Target(__site_cvt_cvt_npy_intp_396_0, origin);
+  __pyx_v_mode = ((NI_ExtendMode)__site_cvt_cvt_long_409_0->Target(__site_cvt_cvt_long_409_0, mode));
+  __pyx_v_cval = __site_cvt_cvt_double_409_0->Target(__site_cvt_cvt_double_409_0, cval);
+  __pyx_v_origin = __site_cvt_cvt_npy_intp_409_0->Target(__site_cvt_cvt_npy_intp_409_0, origin);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":398
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":411
  * def correlate1d(input, weights, int axis, output, NI_ExtendMode mode, double cval,
  *                 npy_intp origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -1571,7 +1574,7 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":399
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":412
  *                 npy_intp origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray weights_ = NI_ObjectToInputArray(weights)             # <<<<<<<<<<<<<<
@@ -1582,7 +1585,7 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
   __pyx_v_weights_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":400
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":413
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray weights_ = NI_ObjectToInputArray(weights)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -1593,7 +1596,7 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":402
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":415
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_Correlate1D(ARRAY(input_), ARRAY(weights_), axis,
  *                    ARRAY(output_), <NI_ExtendMode>mode, cval, origin)             # <<<<<<<<<<<<<<
@@ -1602,7 +1605,7 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
  */
   __pyx_t_2 = NI_Correlate1D(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_weights_), __pyx_v_axis, ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, __pyx_v_origin); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":403
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":416
  *     NI_Correlate1D(ARRAY(input_), ARRAY(weights_), axis,
  *                    ARRAY(output_), <NI_ExtendMode>mode, cval, origin)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -1615,7 +1618,7 @@ static System::Object^ correlate1d(System::Object^ input, System::Object^ weight
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":405
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":418
  *     CheckError()
  * 
  * def correlate(input, weights, output, int mode, double cval, origin):             # <<<<<<<<<<<<<<
@@ -1642,11 +1645,11 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_v_input = input;
   __pyx_v_weights = weights;
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_405_0->Target(__site_cvt_cvt_int_405_0, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_405_0->Target(__site_cvt_cvt_double_405_0, cval);
+  __pyx_v_mode = __site_cvt_cvt_int_418_0->Target(__site_cvt_cvt_int_418_0, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_418_0->Target(__site_cvt_cvt_double_418_0, cval);
   __pyx_v_origin = origin;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":406
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":419
  * 
  * def correlate(input, weights, output, int mode, double cval, origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -1657,7 +1660,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":407
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":420
  * def correlate(input, weights, output, int mode, double cval, origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray weights_ = NI_ObjectToInputArray(weights)             # <<<<<<<<<<<<<<
@@ -1668,7 +1671,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_v_weights_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":408
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":421
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray weights_ = NI_ObjectToInputArray(weights)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -1679,7 +1682,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":409
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":422
  *     cdef ndarray weights_ = NI_ObjectToInputArray(weights)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -1690,7 +1693,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_v_origin_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":410
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":423
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)
  *     if NpyArray_DIMS(ARRAY(origin_))[0] != NpyArray_NDIM(ARRAY(input_)):             # <<<<<<<<<<<<<<
@@ -1700,7 +1703,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   __pyx_t_2 = ((NpyArray_DIMS(ARRAY(__pyx_v_origin_))[0]) != NpyArray_NDIM(ARRAY(__pyx_v_input_)));
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":411
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":424
  *     cdef ndarray origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)
  *     if NpyArray_DIMS(ARRAY(origin_))[0] != NpyArray_NDIM(ARRAY(input_)):
  *         raise ValueError('origin.shape[0] != input.ndim')             # <<<<<<<<<<<<<<
@@ -1708,7 +1711,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
  *                  ARRAY(output_), <NI_ExtendMode>mode, cval,
  */
     __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "ValueError");
-    __pyx_t_3 = __site_call1_411_24->Target(__site_call1_411_24, __pyx_context, __pyx_t_1, ((System::Object^)"origin.shape[0] != input.ndim"));
+    __pyx_t_3 = __site_call1_424_24->Target(__site_call1_424_24, __pyx_context, __pyx_t_1, ((System::Object^)"origin.shape[0] != input.ndim"));
     __pyx_t_1 = nullptr;
     throw PythonOps::MakeException(__pyx_context, __pyx_t_3, nullptr, nullptr);
     __pyx_t_3 = nullptr;
@@ -1716,7 +1719,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   }
   __pyx_L5:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":414
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":427
  *     NI_Correlate(ARRAY(input_), ARRAY(weights_),
  *                  ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                  <npy_intp*>NpyArray_DATA(ARRAY(origin_)))             # <<<<<<<<<<<<<<
@@ -1725,7 +1728,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
  */
   __pyx_t_4 = NI_Correlate(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_weights_), ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origin_)))); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":415
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":428
  *                  ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                  <npy_intp*>NpyArray_DATA(ARRAY(origin_)))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -1738,7 +1741,7 @@ static System::Object^ correlate(System::Object^ input, System::Object^ weights,
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":418
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":431
  * 
  * 
  * def uniform_filter1d(object input, npy_intp filter_size, int axis,             # <<<<<<<<<<<<<<
@@ -1760,14 +1763,14 @@ static System::Object^ uniform_filter1d(System::Object^ input, System::Object^ f
   System::Object^ __pyx_t_1 = nullptr;
   int __pyx_t_2;
   __pyx_v_input = input;
-  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_418_0->Target(__site_cvt_cvt_npy_intp_418_0, filter_size);
-  __pyx_v_axis = __site_cvt_cvt_int_418_0->Target(__site_cvt_cvt_int_418_0, axis);
+  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_431_0->Target(__site_cvt_cvt_npy_intp_431_0, filter_size);
+  __pyx_v_axis = __site_cvt_cvt_int_431_0->Target(__site_cvt_cvt_int_431_0, axis);
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_418_0_1->Target(__site_cvt_cvt_int_418_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_418_0->Target(__site_cvt_cvt_double_418_0, cval);
-  __pyx_v_origin = __site_cvt_cvt_npy_intp_418_0_1->Target(__site_cvt_cvt_npy_intp_418_0_1, origin);
+  __pyx_v_mode = __site_cvt_cvt_int_431_0_1->Target(__site_cvt_cvt_int_431_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_431_0->Target(__site_cvt_cvt_double_431_0, cval);
+  __pyx_v_origin = __site_cvt_cvt_npy_intp_431_0_1->Target(__site_cvt_cvt_npy_intp_431_0_1, origin);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":421
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":434
  *                      object output, int mode, double cval,
  *                      npy_intp origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -1778,7 +1781,7 @@ static System::Object^ uniform_filter1d(System::Object^ input, System::Object^ f
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":422
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":435
  *                      npy_intp origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -1789,7 +1792,7 @@ static System::Object^ uniform_filter1d(System::Object^ input, System::Object^ f
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":424
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":437
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_UniformFilter1D(ARRAY(input_), filter_size, axis,
  *                        ARRAY(output_), <NI_ExtendMode>mode, cval, origin)             # <<<<<<<<<<<<<<
@@ -1798,9 +1801,203 @@ static System::Object^ uniform_filter1d(System::Object^ input, System::Object^ f
  */
   __pyx_t_2 = NI_UniformFilter1D(ARRAY(__pyx_v_input_), __pyx_v_filter_size, __pyx_v_axis, ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, __pyx_v_origin); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":425
- *     NI_UniformFilter1D(ARRAY(input_), filter_size, axis,
- *                        ARRAY(output_), <NI_ExtendMode>mode, cval, origin)
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":460
+ *                        <npy_intp*>NpyArray_DATA(ARRAY(origins_)),
+ *                        ARRAY(output_), <NI_ExtendMode>mode, cval)
+ *     CheckError()             # <<<<<<<<<<<<<<
+ * 
+ * def min_or_max_filter1d(object input, npy_intp filter_size, int axis,
+ */
+  NumpyDotNet::NpyCoreApi::CheckError();
+
+  __pyx_r = nullptr;
+  return __pyx_r;
+}
+
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":440
+ *     CheckError()
+ * 
+ * def separable_filter(object input, object weights, object axes,             # <<<<<<<<<<<<<<
+ *                      object sizes, object origins, object output, int mode,
+ *                      double cval):
+ */
+
+static System::Object^ separable_filter(System::Object^ input, System::Object^ weights, System::Object^ axes, System::Object^ sizes, System::Object^ origins, System::Object^ output, System::Object^ mode, System::Object^ cval) {
+  System::Object^ __pyx_v_input = nullptr;
+  System::Object^ __pyx_v_weights = nullptr;
+  System::Object^ __pyx_v_axes = nullptr;
+  System::Object^ __pyx_v_sizes = nullptr;
+  System::Object^ __pyx_v_origins = nullptr;
+  System::Object^ __pyx_v_output = nullptr;
+  int __pyx_v_mode;
+  double __pyx_v_cval;
+  NumpyDotNet::ndarray^ __pyx_v_input_ = nullptr;
+  NumpyDotNet::ndarray^ __pyx_v_weights_ = nullptr;
+  NumpyDotNet::ndarray^ __pyx_v_output_ = nullptr;
+  NumpyDotNet::ndarray^ __pyx_v_axes_ = nullptr;
+  NumpyDotNet::ndarray^ __pyx_v_sizes_ = nullptr;
+  NumpyDotNet::ndarray^ __pyx_v_origins_ = nullptr;
+  int __pyx_v_n_axes;
+  System::Object^ __pyx_r = nullptr;
+  System::Object^ __pyx_t_1 = nullptr;
+  int __pyx_t_2;
+  System::Object^ __pyx_t_3 = nullptr;
+  int __pyx_t_4;
+  int __pyx_t_5;
+  NpyArray *__pyx_t_6;
+  int __pyx_t_7;
+  __pyx_v_input = input;
+  __pyx_v_weights = weights;
+  __pyx_v_axes = axes;
+  __pyx_v_sizes = sizes;
+  __pyx_v_origins = origins;
+  __pyx_v_output = output;
+  __pyx_v_mode = __site_cvt_cvt_int_440_0->Target(__site_cvt_cvt_int_440_0, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_440_0->Target(__site_cvt_cvt_double_440_0, cval);
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":443
+ *                      object sizes, object origins, object output, int mode,
+ *                      double cval):
+ *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
+ *     cdef ndarray weights_ = None if weights is None else \
+ *                             NA_InputArray(weights, NPY_DOUBLE, NPY_CARRAY)
+ */
+  __pyx_t_1 = ((System::Object^)NI_ObjectToInputArray(__pyx_v_input)); 
+  __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":444
+ *                      double cval):
+ *     cdef ndarray input_ = NI_ObjectToInputArray(input)
+ *     cdef ndarray weights_ = None if weights is None else \             # <<<<<<<<<<<<<<
+ *                             NA_InputArray(weights, NPY_DOUBLE, NPY_CARRAY)
+ *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
+ */
+  __pyx_t_2 = (__pyx_v_weights == nullptr);
+  if (__pyx_t_2) {
+    __pyx_t_1 = nullptr;
+  } else {
+    __pyx_t_3 = ((System::Object^)NA_InputArray(__pyx_v_weights, NPY_DOUBLE, NPY_CARRAY)); 
+    __pyx_t_1 = __pyx_t_3;
+    __pyx_t_3 = nullptr;
+  }
+  if (__pyx_t_1 != nullptr && dynamic_cast<NumpyDotNet::ndarray^>(__pyx_t_1) == nullptr) {
+    throw PythonOps::MakeException(__pyx_context, PythonOps::GetGlobal(__pyx_context, "TypeError"), "type error", nullptr);
+  }
+  __pyx_v_weights_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":446
+ *     cdef ndarray weights_ = None if weights is None else \
+ *                             NA_InputArray(weights, NPY_DOUBLE, NPY_CARRAY)
+ *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
+ *     cdef ndarray axes_ = NA_InputArray(axes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)
+ */
+  __pyx_t_1 = ((System::Object^)NI_ObjectToOutputArray(__pyx_v_output)); 
+  __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":447
+ *                             NA_InputArray(weights, NPY_DOUBLE, NPY_CARRAY)
+ *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
+ *     cdef ndarray axes_ = NA_InputArray(axes, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
+ *     cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
+ */
+  __pyx_t_1 = ((System::Object^)NA_InputArray(__pyx_v_axes, NPY_INTP, NPY_CARRAY)); 
+  __pyx_v_axes_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":448
+ *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
+ *     cdef ndarray axes_ = NA_InputArray(axes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
+ *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
+ *     cdef int n_axes = NpyArray_SIZE(ARRAY(axes_))
+ */
+  __pyx_t_1 = ((System::Object^)NA_InputArray(__pyx_v_sizes, NPY_INTP, NPY_CARRAY)); 
+  __pyx_v_sizes_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":449
+ *     cdef ndarray axes_ = NA_InputArray(axes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
+ *     cdef int n_axes = NpyArray_SIZE(ARRAY(axes_))
+ *     if (NpyArray_SIZE(ARRAY(sizes_)) != n_axes or
+ */
+  __pyx_t_1 = ((System::Object^)NA_InputArray(__pyx_v_origins, NPY_INTP, NPY_CARRAY)); 
+  __pyx_v_origins_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
+  __pyx_t_1 = nullptr;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":450
+ *     cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)
+ *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
+ *     cdef int n_axes = NpyArray_SIZE(ARRAY(axes_))             # <<<<<<<<<<<<<<
+ *     if (NpyArray_SIZE(ARRAY(sizes_)) != n_axes or
+ *         NpyArray_SIZE(ARRAY(origins_)) != n_axes):
+ */
+  __pyx_v_n_axes = NpyArray_SIZE(ARRAY(__pyx_v_axes_));
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":451
+ *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
+ *     cdef int n_axes = NpyArray_SIZE(ARRAY(axes_))
+ *     if (NpyArray_SIZE(ARRAY(sizes_)) != n_axes or             # <<<<<<<<<<<<<<
+ *         NpyArray_SIZE(ARRAY(origins_)) != n_axes):
+ *         raise ValueError('axes, sizes and origins differ in length')
+ */
+  __pyx_t_2 = (NpyArray_SIZE(ARRAY(__pyx_v_sizes_)) != __pyx_v_n_axes);
+  if (!__pyx_t_2) {
+    __pyx_t_4 = (NpyArray_SIZE(ARRAY(__pyx_v_origins_)) != __pyx_v_n_axes);
+    __pyx_t_5 = __pyx_t_4;
+  } else {
+    __pyx_t_5 = __pyx_t_2;
+  }
+  if (__pyx_t_5) {
+
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":453
+ *     if (NpyArray_SIZE(ARRAY(sizes_)) != n_axes or
+ *         NpyArray_SIZE(ARRAY(origins_)) != n_axes):
+ *         raise ValueError('axes, sizes and origins differ in length')             # <<<<<<<<<<<<<<
+ *     NI_SeparableFilter(ARRAY(input_),
+ *                        <NpyArray*>NULL if weights_ is None else ARRAY(weights_),
+ */
+    __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "ValueError");
+    __pyx_t_3 = __site_call1_453_24->Target(__site_call1_453_24, __pyx_context, __pyx_t_1, ((System::Object^)"axes, sizes and origins differ in length"));
+    __pyx_t_1 = nullptr;
+    throw PythonOps::MakeException(__pyx_context, __pyx_t_3, nullptr, nullptr);
+    __pyx_t_3 = nullptr;
+    goto __pyx_L5;
+  }
+  __pyx_L5:;
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":455
+ *         raise ValueError('axes, sizes and origins differ in length')
+ *     NI_SeparableFilter(ARRAY(input_),
+ *                        <NpyArray*>NULL if weights_ is None else ARRAY(weights_),             # <<<<<<<<<<<<<<
+ *                        n_axes, <npy_intp*>NpyArray_DATA(ARRAY(axes_)),
+ *                        <npy_intp*>NpyArray_DATA(ARRAY(sizes_)),
+ */
+  __pyx_t_5 = (((System::Object^)__pyx_v_weights_) == nullptr);
+  if (__pyx_t_5) {
+    __pyx_t_6 = ((NpyArray *)NULL);
+  } else {
+    __pyx_t_6 = ARRAY(__pyx_v_weights_);
+  }
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":459
+ *                        <npy_intp*>NpyArray_DATA(ARRAY(sizes_)),
+ *                        <npy_intp*>NpyArray_DATA(ARRAY(origins_)),
+ *                        ARRAY(output_), <NI_ExtendMode>mode, cval)             # <<<<<<<<<<<<<<
+ *     CheckError()
+ * 
+ */
+  __pyx_t_7 = NI_SeparableFilter(ARRAY(__pyx_v_input_), __pyx_t_6, __pyx_v_n_axes, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_axes_))), ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_sizes_))), ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origins_))), ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval); 
+
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":460
+ *                        <npy_intp*>NpyArray_DATA(ARRAY(origins_)),
+ *                        ARRAY(output_), <NI_ExtendMode>mode, cval)
  *     CheckError()             # <<<<<<<<<<<<<<
  * 
  * def min_or_max_filter1d(object input, npy_intp filter_size, int axis,
@@ -1811,7 +2008,7 @@ static System::Object^ uniform_filter1d(System::Object^ input, System::Object^ f
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":427
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":462
  *     CheckError()
  * 
  * def min_or_max_filter1d(object input, npy_intp filter_size, int axis,             # <<<<<<<<<<<<<<
@@ -1834,15 +2031,15 @@ static System::Object^ min_or_max_filter1d(System::Object^ input, System::Object
   System::Object^ __pyx_t_1 = nullptr;
   int __pyx_t_2;
   __pyx_v_input = input;
-  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_427_0->Target(__site_cvt_cvt_npy_intp_427_0, filter_size);
-  __pyx_v_axis = __site_cvt_cvt_int_427_0->Target(__site_cvt_cvt_int_427_0, axis);
+  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_462_0->Target(__site_cvt_cvt_npy_intp_462_0, filter_size);
+  __pyx_v_axis = __site_cvt_cvt_int_462_0->Target(__site_cvt_cvt_int_462_0, axis);
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_427_0_1->Target(__site_cvt_cvt_int_427_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_427_0->Target(__site_cvt_cvt_double_427_0, cval);
-  __pyx_v_origin = __site_cvt_cvt_npy_intp_427_0_1->Target(__site_cvt_cvt_npy_intp_427_0_1, origin);
-  __pyx_v_minimum = __site_cvt_cvt_int_427_0_2->Target(__site_cvt_cvt_int_427_0_2, minimum);
+  __pyx_v_mode = __site_cvt_cvt_int_462_0_1->Target(__site_cvt_cvt_int_462_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_462_0->Target(__site_cvt_cvt_double_462_0, cval);
+  __pyx_v_origin = __site_cvt_cvt_npy_intp_462_0_1->Target(__site_cvt_cvt_npy_intp_462_0_1, origin);
+  __pyx_v_minimum = __site_cvt_cvt_int_462_0_2->Target(__site_cvt_cvt_int_462_0_2, minimum);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":430
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":465
  *                         object output, int mode, double cval,
  *                         npy_intp origin, int minimum):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -1853,7 +2050,7 @@ static System::Object^ min_or_max_filter1d(System::Object^ input, System::Object
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":431
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":466
  *                         npy_intp origin, int minimum):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -1864,7 +2061,7 @@ static System::Object^ min_or_max_filter1d(System::Object^ input, System::Object
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":434
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":469
  *     NI_MinOrMaxFilter1D(ARRAY(input_), filter_size, axis,
  *                         ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                         origin, minimum)             # <<<<<<<<<<<<<<
@@ -1873,7 +2070,7 @@ static System::Object^ min_or_max_filter1d(System::Object^ input, System::Object
  */
   __pyx_t_2 = NI_MinOrMaxFilter1D(ARRAY(__pyx_v_input_), __pyx_v_filter_size, __pyx_v_axis, ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, __pyx_v_origin, __pyx_v_minimum); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":435
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":470
  *                         ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                         origin, minimum)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -1886,7 +2083,7 @@ static System::Object^ min_or_max_filter1d(System::Object^ input, System::Object
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":437
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":472
  *     CheckError()
  * 
  * def min_or_max_filter(object input, object footprint, object structure,             # <<<<<<<<<<<<<<
@@ -1921,13 +2118,13 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_footprint = footprint;
   __pyx_v_structure = structure;
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_437_0->Target(__site_cvt_cvt_int_437_0, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_437_0->Target(__site_cvt_cvt_double_437_0, cval);
+  __pyx_v_mode = __site_cvt_cvt_int_472_0->Target(__site_cvt_cvt_int_472_0, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_472_0->Target(__site_cvt_cvt_double_472_0, cval);
   __pyx_v_origin = origin;
-  __pyx_v_minimum = __site_cvt_cvt_int_437_0_1->Target(__site_cvt_cvt_int_437_0_1, minimum);
+  __pyx_v_minimum = __site_cvt_cvt_int_472_0_1->Target(__site_cvt_cvt_int_472_0_1, minimum);
   __pyx_bstruct_origin_ = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":440
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":475
  *                       object output, int mode, double cval, object origin,
  *                       int minimum):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -1938,7 +2135,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":441
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":476
  *                       int minimum):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)             # <<<<<<<<<<<<<<
@@ -1949,7 +2146,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_footprint_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":442
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":477
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray structure_ = None if structure is None else NI_ObjectToInputArray(structure)             # <<<<<<<<<<<<<<
@@ -1970,7 +2167,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_structure_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":443
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":478
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray structure_ = None if structure is None else NI_ObjectToInputArray(structure)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -1981,7 +2178,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":444
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":479
  *     cdef ndarray structure_ = None if structure is None else NI_ObjectToInputArray(structure)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray[npy_intp, mode='c'] origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -1998,7 +2195,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   __pyx_v_origin_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":447
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":482
  *     NI_MinOrMaxFilter(ARRAY(input_),
  *                       ARRAY(footprint_),
  *                       <NpyArray*>NULL if structure_ is None else ARRAY(structure_),             # <<<<<<<<<<<<<<
@@ -2012,7 +2209,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
     __pyx_t_4 = ARRAY(__pyx_v_structure_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":452
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":487
  *                       cval,
  *                       <npy_intp*>NpyArray_DATA(ARRAY(origin_)),
  *                       minimum)             # <<<<<<<<<<<<<<
@@ -2021,7 +2218,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
  */
   __pyx_t_5 = NI_MinOrMaxFilter(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_footprint_), __pyx_t_4, ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, ((npy_intp *)NpyArray_DATA(ARRAY(((NumpyDotNet::ndarray^)__pyx_v_origin_)))), __pyx_v_minimum); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":453
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":488
  *                       <npy_intp*>NpyArray_DATA(ARRAY(origin_)),
  *                       minimum)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2035,7 +2232,7 @@ static System::Object^ min_or_max_filter(System::Object^ input, System::Object^
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":455
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":490
  *     CheckError()
  * 
  * def rank_filter(object input, int rank, object footprint,             # <<<<<<<<<<<<<<
@@ -2059,14 +2256,14 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   System::Object^ __pyx_t_1 = nullptr;
   int __pyx_t_2;
   __pyx_v_input = input;
-  __pyx_v_rank = __site_cvt_cvt_int_455_0->Target(__site_cvt_cvt_int_455_0, rank);
+  __pyx_v_rank = __site_cvt_cvt_int_490_0->Target(__site_cvt_cvt_int_490_0, rank);
   __pyx_v_footprint = footprint;
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_455_0_1->Target(__site_cvt_cvt_int_455_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_455_0->Target(__site_cvt_cvt_double_455_0, cval);
+  __pyx_v_mode = __site_cvt_cvt_int_490_0_1->Target(__site_cvt_cvt_int_490_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_490_0->Target(__site_cvt_cvt_double_490_0, cval);
   __pyx_v_origin = origin;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":457
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":492
  * def rank_filter(object input, int rank, object footprint,
  *                 object output, int mode, double cval, object origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2077,7 +2274,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":458
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":493
  *                 object output, int mode, double cval, object origin):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)             # <<<<<<<<<<<<<<
@@ -2088,7 +2285,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   __pyx_v_footprint_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":459
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":494
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2099,7 +2296,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":460
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":495
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -2110,7 +2307,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   __pyx_v_origin_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":467
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":502
  *                   <NI_ExtendMode>mode,
  *                   cval,
  *                   <npy_intp*>NpyArray_DATA(ARRAY(origin_)))             # <<<<<<<<<<<<<<
@@ -2119,7 +2316,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
  */
   __pyx_t_2 = NI_RankFilter(ARRAY(__pyx_v_input_), __pyx_v_rank, ARRAY(__pyx_v_footprint_), ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origin_)))); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":468
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":503
  *                   cval,
  *                   <npy_intp*>NpyArray_DATA(ARRAY(origin_)))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2132,7 +2329,7 @@ static System::Object^ rank_filter(System::Object^ input, System::Object^ rank,
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":474
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":509
  * # Callback wrappers
  * #
  * cdef class CallbackInfo:             # <<<<<<<<<<<<<<
@@ -2145,7 +2342,7 @@ ref struct CallbackInfo {
   System::Object^ args;
   System::Object^ kwargs;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":476
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":511
  * cdef class CallbackInfo:
  *     cdef object function, args, kwargs
  *     def __init__(self, function, args, kwargs):             # <<<<<<<<<<<<<<
@@ -2169,7 +2366,7 @@ ref struct CallbackInfo {
     __pyx_v_args = args;
     __pyx_v_kwargs = kwargs;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":477
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":512
  *     cdef object function, args, kwargs
  *     def __init__(self, function, args, kwargs):
  *         if not is_callable(function):             # <<<<<<<<<<<<<<
@@ -2177,12 +2374,12 @@ ref struct CallbackInfo {
  *         if not isinstance(args, tuple):
  */
     __pyx_t_1 = is_callable(__pyx_v_function); 
-    __pyx_t_2 = __site_istrue_477_26->Target(__site_istrue_477_26, __pyx_t_1);
+    __pyx_t_2 = __site_istrue_512_26->Target(__site_istrue_512_26, __pyx_t_1);
     __pyx_t_1 = nullptr;
     __pyx_t_3 = (!__pyx_t_2);
     if (__pyx_t_3) {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":478
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":513
  *     def __init__(self, function, args, kwargs):
  *         if not is_callable(function):
  *             raise RuntimeError("function parameter is not callable")             # <<<<<<<<<<<<<<
@@ -2190,7 +2387,7 @@ ref struct CallbackInfo {
  *             raise RuntimeError("extra_arguments must be a tuple")
  */
       __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "RuntimeError");
-      __pyx_t_4 = __site_call1_478_30->Target(__site_call1_478_30, __pyx_context, __pyx_t_1, ((System::Object^)"function parameter is not callable"));
+      __pyx_t_4 = __site_call1_513_30->Target(__site_call1_513_30, __pyx_context, __pyx_t_1, ((System::Object^)"function parameter is not callable"));
       __pyx_t_1 = nullptr;
       throw PythonOps::MakeException(__pyx_context, __pyx_t_4, nullptr, nullptr);
       __pyx_t_4 = nullptr;
@@ -2198,7 +2395,7 @@ ref struct CallbackInfo {
     }
     __pyx_L5:;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":479
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":514
  *         if not is_callable(function):
  *             raise RuntimeError("function parameter is not callable")
  *         if not isinstance(args, tuple):             # <<<<<<<<<<<<<<
@@ -2207,15 +2404,15 @@ ref struct CallbackInfo {
  */
     __pyx_t_4 = PythonOps::GetGlobal(__pyx_context, "isinstance");
     __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "tuple");
-    __pyx_t_5 = __site_call2_479_25->Target(__site_call2_479_25, __pyx_context, __pyx_t_4, __pyx_v_args, ((System::Object^)__pyx_t_1));
+    __pyx_t_5 = __site_call2_514_25->Target(__site_call2_514_25, __pyx_context, __pyx_t_4, __pyx_v_args, ((System::Object^)__pyx_t_1));
     __pyx_t_4 = nullptr;
     __pyx_t_1 = nullptr;
-    __pyx_t_3 = __site_istrue_479_25->Target(__site_istrue_479_25, __pyx_t_5);
+    __pyx_t_3 = __site_istrue_514_25->Target(__site_istrue_514_25, __pyx_t_5);
     __pyx_t_5 = nullptr;
     __pyx_t_2 = (!__pyx_t_3);
     if (__pyx_t_2) {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":480
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":515
  *             raise RuntimeError("function parameter is not callable")
  *         if not isinstance(args, tuple):
  *             raise RuntimeError("extra_arguments must be a tuple")             # <<<<<<<<<<<<<<
@@ -2223,7 +2420,7 @@ ref struct CallbackInfo {
  *             raise RuntimeError("extra_keywords must be a dictionary")
  */
       __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "RuntimeError");
-      __pyx_t_1 = __site_call1_480_30->Target(__site_call1_480_30, __pyx_context, __pyx_t_5, ((System::Object^)"extra_arguments must be a tuple"));
+      __pyx_t_1 = __site_call1_515_30->Target(__site_call1_515_30, __pyx_context, __pyx_t_5, ((System::Object^)"extra_arguments must be a tuple"));
       __pyx_t_5 = nullptr;
       throw PythonOps::MakeException(__pyx_context, __pyx_t_1, nullptr, nullptr);
       __pyx_t_1 = nullptr;
@@ -2231,7 +2428,7 @@ ref struct CallbackInfo {
     }
     __pyx_L6:;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":481
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":516
  *         if not isinstance(args, tuple):
  *             raise RuntimeError("extra_arguments must be a tuple")
  *         if not isinstance(kwargs, dict):             # <<<<<<<<<<<<<<
@@ -2240,15 +2437,15 @@ ref struct CallbackInfo {
  */
     __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "isinstance");
     __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "dict");
-    __pyx_t_4 = __site_call2_481_25->Target(__site_call2_481_25, __pyx_context, __pyx_t_1, __pyx_v_kwargs, ((System::Object^)__pyx_t_5));
+    __pyx_t_4 = __site_call2_516_25->Target(__site_call2_516_25, __pyx_context, __pyx_t_1, __pyx_v_kwargs, ((System::Object^)__pyx_t_5));
     __pyx_t_1 = nullptr;
     __pyx_t_5 = nullptr;
-    __pyx_t_2 = __site_istrue_481_25->Target(__site_istrue_481_25, __pyx_t_4);
+    __pyx_t_2 = __site_istrue_516_25->Target(__site_istrue_516_25, __pyx_t_4);
     __pyx_t_4 = nullptr;
     __pyx_t_3 = (!__pyx_t_2);
     if (__pyx_t_3) {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":482
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":517
  *             raise RuntimeError("extra_arguments must be a tuple")
  *         if not isinstance(kwargs, dict):
  *             raise RuntimeError("extra_keywords must be a dictionary")             # <<<<<<<<<<<<<<
@@ -2256,7 +2453,7 @@ ref struct CallbackInfo {
  *         self.args = args
  */
       __pyx_t_4 = PythonOps::GetGlobal(__pyx_context, "RuntimeError");
-      __pyx_t_5 = __site_call1_482_30->Target(__site_call1_482_30, __pyx_context, __pyx_t_4, ((System::Object^)"extra_keywords must be a dictionary"));
+      __pyx_t_5 = __site_call1_517_30->Target(__site_call1_517_30, __pyx_context, __pyx_t_4, ((System::Object^)"extra_keywords must be a dictionary"));
       __pyx_t_4 = nullptr;
       throw PythonOps::MakeException(__pyx_context, __pyx_t_5, nullptr, nullptr);
       __pyx_t_5 = nullptr;
@@ -2264,7 +2461,7 @@ ref struct CallbackInfo {
     }
     __pyx_L7:;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":483
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":518
  *         if not isinstance(kwargs, dict):
  *             raise RuntimeError("extra_keywords must be a dictionary")
  *         self.function = function             # <<<<<<<<<<<<<<
@@ -2273,7 +2470,7 @@ ref struct CallbackInfo {
  */
     ((CallbackInfo^)__pyx_v_self)->function = __pyx_v_function;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":484
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":519
  *             raise RuntimeError("extra_keywords must be a dictionary")
  *         self.function = function
  *         self.args = args             # <<<<<<<<<<<<<<
@@ -2282,7 +2479,7 @@ ref struct CallbackInfo {
  */
     ((CallbackInfo^)__pyx_v_self)->args = __pyx_v_args;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":485
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":520
  *         self.function = function
  *         self.args = args
  *         self.kwargs = kwargs             # <<<<<<<<<<<<<<
@@ -2296,7 +2493,7 @@ ref struct CallbackInfo {
   }
 };
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":487
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":522
  *         self.kwargs = kwargs
  * 
  * cdef int cbwrapper_filter_1d(double *iline, npy_intp ilen, double *oline, npy_intp olen,             # <<<<<<<<<<<<<<
@@ -2320,7 +2517,7 @@ static  int cbwrapper_filter_1d(double *__pyx_v_iline, npy_intp __pyx_v_ilen, do
   __pyx_v_iarr = nullptr;
   __pyx_v_oarr = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":489
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":524
  * cdef int cbwrapper_filter_1d(double *iline, npy_intp ilen, double *oline, npy_intp olen,
  *                              void* ctx) except 0:
  *     cdef CallbackInfo info = object_from_cookie(ctx)             # <<<<<<<<<<<<<<
@@ -2334,7 +2531,7 @@ static  int cbwrapper_filter_1d(double *__pyx_v_iline, npy_intp __pyx_v_ilen, do
   __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":490
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":525
  *                              void* ctx) except 0:
  *     cdef CallbackInfo info = object_from_cookie(ctx)
  *     iarr = array_New(1, [ilen], NPY_DOUBLE, [sizeof(double)], <char*>iline, 0, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -2347,7 +2544,7 @@ static  int cbwrapper_filter_1d(double *__pyx_v_iline, npy_intp __pyx_v_ilen, do
   __pyx_v_iarr = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":491
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":526
  *     cdef CallbackInfo info = object_from_cookie(ctx)
  *     iarr = array_New(1, [ilen], NPY_DOUBLE, [sizeof(double)], <char*>iline, 0, NPY_CARRAY)
  *     oarr = array_New(1, [olen], NPY_DOUBLE, [sizeof(double)], <char*>oline, 0, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -2360,17 +2557,17 @@ static  int cbwrapper_filter_1d(double *__pyx_v_iline, npy_intp __pyx_v_ilen, do
   __pyx_v_oarr = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":492
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":527
  *     iarr = array_New(1, [ilen], NPY_DOUBLE, [sizeof(double)], <char*>iline, 0, NPY_CARRAY)
  *     oarr = array_New(1, [olen], NPY_DOUBLE, [sizeof(double)], <char*>oline, 0, NPY_CARRAY)
  *     info.function(iarr, oarr, *info.args, **info.kwargs)             # <<<<<<<<<<<<<<
  *     return 1
  * 
  */
-  __pyx_t_1 = __site_call2_ARGS_KWARGS_492_17->Target(__site_call2_ARGS_KWARGS_492_17, __pyx_context, __pyx_v_info->function, __pyx_v_iarr, __pyx_v_oarr, __pyx_v_info->args, __pyx_v_info->kwargs);
+  __pyx_t_1 = __site_call2_ARGS_KWARGS_527_17->Target(__site_call2_ARGS_KWARGS_527_17, __pyx_context, __pyx_v_info->function, __pyx_v_iarr, __pyx_v_oarr, __pyx_v_info->args, __pyx_v_info->kwargs);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":493
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":528
  *     oarr = array_New(1, [olen], NPY_DOUBLE, [sizeof(double)], <char*>oline, 0, NPY_CARRAY)
  *     info.function(iarr, oarr, *info.args, **info.kwargs)
  *     return 1             # <<<<<<<<<<<<<<
@@ -2385,7 +2582,7 @@ static  int cbwrapper_filter_1d(double *__pyx_v_iline, npy_intp __pyx_v_ilen, do
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":495
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":530
  *     return 1
  * 
  * def generic_filter1d(object input, object callback, npy_intp filter_size,             # <<<<<<<<<<<<<<
@@ -2415,17 +2612,17 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
   int __pyx_t_2;
   __pyx_v_input = input;
   __pyx_v_callback = callback;
-  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_495_0->Target(__site_cvt_cvt_npy_intp_495_0, filter_size);
-  __pyx_v_axis = __site_cvt_cvt_int_495_0->Target(__site_cvt_cvt_int_495_0, axis);
+  __pyx_v_filter_size = __site_cvt_cvt_npy_intp_530_0->Target(__site_cvt_cvt_npy_intp_530_0, filter_size);
+  __pyx_v_axis = __site_cvt_cvt_int_530_0->Target(__site_cvt_cvt_int_530_0, axis);
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_495_0_1->Target(__site_cvt_cvt_int_495_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_495_0->Target(__site_cvt_cvt_double_495_0, cval);
-  __pyx_v_origin = __site_cvt_cvt_npy_intp_495_0_1->Target(__site_cvt_cvt_npy_intp_495_0_1, origin);
+  __pyx_v_mode = __site_cvt_cvt_int_530_0_1->Target(__site_cvt_cvt_int_530_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_530_0->Target(__site_cvt_cvt_double_530_0, cval);
+  __pyx_v_origin = __site_cvt_cvt_npy_intp_530_0_1->Target(__site_cvt_cvt_npy_intp_530_0_1, origin);
   __pyx_v_extra_arguments = extra_arguments;
   __pyx_v_extra_keywords = extra_keywords;
   __pyx_v_info = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":501
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":536
  *     cdef void *ctx
  *     cdef int (*funcptr)(double*, npy_intp, double*, npy_intp, void*) except 0
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2436,7 +2633,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":502
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":537
  *     cdef int (*funcptr)(double*, npy_intp, double*, npy_intp, void*) except 0
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2447,7 +2644,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":507
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":542
  * ##         ctx = capsule_getdesc(callback)
  *     if True:
  *         funcptr = &cbwrapper_filter_1d             # <<<<<<<<<<<<<<
@@ -2456,18 +2653,18 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
  */
   __pyx_v_funcptr = __pyx_function_pointer_cbwrapper_filter_1d;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":508
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":543
  *     if True:
  *         funcptr = &cbwrapper_filter_1d
  *         info = CallbackInfo(callback, extra_arguments, extra_keywords)             # <<<<<<<<<<<<<<
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)
  */
-  __pyx_t_1 = __site_call3_508_27->Target(__site_call3_508_27, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
+  __pyx_t_1 = __site_call3_543_27->Target(__site_call3_543_27, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
   __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":510
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":545
  *         info = CallbackInfo(callback, extra_arguments, extra_keywords)
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)             # <<<<<<<<<<<<<<
@@ -2476,7 +2673,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
  */
   set_callback_holder(__pyx_v_info_holder, ((System::Object^)__pyx_v_info));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":511
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":546
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)
  *     ctx = cookie_from_callback(info_holder)             # <<<<<<<<<<<<<<
@@ -2485,7 +2682,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
  */
   __pyx_v_ctx = cookie_from_callback(__pyx_v_info_holder);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":513
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":548
  *     ctx = cookie_from_callback(info_holder)
  *     NI_GenericFilter1D(ARRAY(input_), funcptr, ctx, filter_size, axis,
  *                        ARRAY(output_), <NI_ExtendMode>mode, cval, origin)             # <<<<<<<<<<<<<<
@@ -2494,7 +2691,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
  */
   __pyx_t_2 = NI_GenericFilter1D(ARRAY(__pyx_v_input_), __pyx_v_funcptr, __pyx_v_ctx, __pyx_v_filter_size, __pyx_v_axis, ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, __pyx_v_origin); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":514
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":549
  *     NI_GenericFilter1D(ARRAY(input_), funcptr, ctx, filter_size, axis,
  *                        ARRAY(output_), <NI_ExtendMode>mode, cval, origin)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2507,7 +2704,7 @@ static System::Object^ generic_filter1d(System::Object^ input, System::Object^ c
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":516
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":551
  *     CheckError()
  * 
  * cdef int cbwrapper_filter(double *buffer, npy_intp filter_size,             # <<<<<<<<<<<<<<
@@ -2530,7 +2727,7 @@ static  int cbwrapper_filter(double *__pyx_v_buffer, npy_intp __pyx_v_filter_siz
   __pyx_v_pybuf = nullptr;
   __pyx_v_rv = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":518
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":553
  * cdef int cbwrapper_filter(double *buffer, npy_intp filter_size,
  *                           double *output, void *ctx) except 0:
  *     cdef CallbackInfo info = object_from_cookie(ctx)             # <<<<<<<<<<<<<<
@@ -2544,7 +2741,7 @@ static  int cbwrapper_filter(double *__pyx_v_buffer, npy_intp __pyx_v_filter_siz
   __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":519
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":554
  *                           double *output, void *ctx) except 0:
  *     cdef CallbackInfo info = object_from_cookie(ctx)
  *     pybuf = array_New(1, [filter_size], NPY_DOUBLE, [sizeof(double)],             # <<<<<<<<<<<<<<
@@ -2554,7 +2751,7 @@ static  int cbwrapper_filter(double *__pyx_v_buffer, npy_intp __pyx_v_filter_siz
   __pyx_t_2[0] = __pyx_v_filter_size;
   __pyx_t_3[0] = (sizeof(double));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":520
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":555
  *     cdef CallbackInfo info = object_from_cookie(ctx)
  *     pybuf = array_New(1, [filter_size], NPY_DOUBLE, [sizeof(double)],
  *                       <char*>buffer, 0, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -2565,28 +2762,28 @@ static  int cbwrapper_filter(double *__pyx_v_buffer, npy_intp __pyx_v_filter_siz
   __pyx_v_pybuf = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":521
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":556
  *     pybuf = array_New(1, [filter_size], NPY_DOUBLE, [sizeof(double)],
  *                       <char*>buffer, 0, NPY_CARRAY)
  *     rv = info.function(pybuf, *info.args, **info.kwargs)             # <<<<<<<<<<<<<<
  *     output[0] = rv
  *     return 1
  */
-  __pyx_t_1 = __site_call1_ARGS_KWARGS_521_22->Target(__site_call1_ARGS_KWARGS_521_22, __pyx_context, __pyx_v_info->function, __pyx_v_pybuf, __pyx_v_info->args, __pyx_v_info->kwargs);
+  __pyx_t_1 = __site_call1_ARGS_KWARGS_556_22->Target(__site_call1_ARGS_KWARGS_556_22, __pyx_context, __pyx_v_info->function, __pyx_v_pybuf, __pyx_v_info->args, __pyx_v_info->kwargs);
   __pyx_v_rv = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":522
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":557
  *                       <char*>buffer, 0, NPY_CARRAY)
  *     rv = info.function(pybuf, *info.args, **info.kwargs)
  *     output[0] = rv             # <<<<<<<<<<<<<<
  *     return 1
  * 
  */
-  __pyx_t_4 = __site_cvt_cvt_double_522_18->Target(__site_cvt_cvt_double_522_18, __pyx_v_rv);
+  __pyx_t_4 = __site_cvt_cvt_double_557_18->Target(__site_cvt_cvt_double_557_18, __pyx_v_rv);
   (__pyx_v_output[0]) = __pyx_t_4;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":523
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":558
  *     rv = info.function(pybuf, *info.args, **info.kwargs)
  *     output[0] = rv
  *     return 1             # <<<<<<<<<<<<<<
@@ -2601,7 +2798,7 @@ static  int cbwrapper_filter(double *__pyx_v_buffer, npy_intp __pyx_v_filter_siz
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":525
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":560
  *     return 1
  * 
  * def generic_filter(object input, object callback, object footprint, object output,             # <<<<<<<<<<<<<<
@@ -2633,14 +2830,14 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   __pyx_v_callback = callback;
   __pyx_v_footprint = footprint;
   __pyx_v_output = output;
-  __pyx_v_mode = __site_cvt_cvt_int_525_0->Target(__site_cvt_cvt_int_525_0, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_525_0->Target(__site_cvt_cvt_double_525_0, cval);
+  __pyx_v_mode = __site_cvt_cvt_int_560_0->Target(__site_cvt_cvt_int_560_0, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_560_0->Target(__site_cvt_cvt_double_560_0, cval);
   __pyx_v_origin = origin;
   __pyx_v_extra_arguments = extra_arguments;
   __pyx_v_extra_keywords = extra_keywords;
   __pyx_v_info = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":529
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":564
  *                    object extra_keywords):
  *     cdef int (*funcptr)(double*, npy_intp, double*, void*) except 0
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2651,7 +2848,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":530
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":565
  *     cdef int (*funcptr)(double*, npy_intp, double*, void*) except 0
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)             # <<<<<<<<<<<<<<
@@ -2662,7 +2859,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   __pyx_v_footprint_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":531
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":566
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2673,7 +2870,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":532
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":567
  *     cdef ndarray footprint_ = NI_ObjectToInputArray(footprint)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray origin_ = NA_InputArray(origin, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -2684,7 +2881,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   __pyx_v_origin_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":537
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":572
  * ##        ctx = capsule_getdesc(callback)
  *     if True:
  *         funcptr = &cbwrapper_filter             # <<<<<<<<<<<<<<
@@ -2693,18 +2890,18 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
  */
   __pyx_v_funcptr = __pyx_function_pointer_cbwrapper_filter;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":538
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":573
  *     if True:
  *         funcptr = &cbwrapper_filter
  *         info = CallbackInfo(callback, extra_arguments, extra_keywords)             # <<<<<<<<<<<<<<
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)
  */
-  __pyx_t_1 = __site_call3_538_27->Target(__site_call3_538_27, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
+  __pyx_t_1 = __site_call3_573_27->Target(__site_call3_573_27, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
   __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":540
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":575
  *         info = CallbackInfo(callback, extra_arguments, extra_keywords)
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)             # <<<<<<<<<<<<<<
@@ -2713,7 +2910,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
  */
   set_callback_holder(__pyx_v_info_holder, ((System::Object^)__pyx_v_info));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":541
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":576
  *     cdef callback_holder info_holder
  *     set_callback_holder(info_holder, info)
  *     ctx = cookie_from_callback(info_holder)             # <<<<<<<<<<<<<<
@@ -2722,7 +2919,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
  */
   __pyx_v_ctx = cookie_from_callback(__pyx_v_info_holder);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":544
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":579
  *     NI_GenericFilter(ARRAY(input_), funcptr, ctx, ARRAY(footprint_),
  *                      ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                      <npy_intp*>NpyArray_DATA(ARRAY(origin_)))             # <<<<<<<<<<<<<<
@@ -2731,7 +2928,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
  */
   NI_GenericFilter(ARRAY(__pyx_v_input_), __pyx_v_funcptr, __pyx_v_ctx, ARRAY(__pyx_v_footprint_), ARRAY(__pyx_v_output_), ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origin_))));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":545
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":580
  *                      ARRAY(output_), <NI_ExtendMode>mode, cval,
  *                      <npy_intp*>NpyArray_DATA(ARRAY(origin_)))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2744,7 +2941,7 @@ static System::Object^ generic_filter(System::Object^ input, System::Object^ cal
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":547
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":582
  *     CheckError()
  * 
  * def fourier_filter(object input, object parameters, npy_intp n, int axis,             # <<<<<<<<<<<<<<
@@ -2767,12 +2964,12 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
   int __pyx_t_2;
   __pyx_v_input = input;
   __pyx_v_parameters = parameters;
-  __pyx_v_n = __site_cvt_cvt_npy_intp_547_0->Target(__site_cvt_cvt_npy_intp_547_0, n);
-  __pyx_v_axis = __site_cvt_cvt_int_547_0->Target(__site_cvt_cvt_int_547_0, axis);
+  __pyx_v_n = __site_cvt_cvt_npy_intp_582_0->Target(__site_cvt_cvt_npy_intp_582_0, n);
+  __pyx_v_axis = __site_cvt_cvt_int_582_0->Target(__site_cvt_cvt_int_582_0, axis);
   __pyx_v_output = output;
-  __pyx_v_filter_type = __site_cvt_cvt_int_547_0_1->Target(__site_cvt_cvt_int_547_0_1, filter_type);
+  __pyx_v_filter_type = __site_cvt_cvt_int_582_0_1->Target(__site_cvt_cvt_int_582_0_1, filter_type);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":549
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":584
  * def fourier_filter(object input, object parameters, npy_intp n, int axis,
  *                    object output, int filter_type):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2783,7 +2980,7 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":550
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":585
  *                    object output, int filter_type):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray parameters_ = NI_ObjectToInputArray(parameters)             # <<<<<<<<<<<<<<
@@ -2794,7 +2991,7 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
   __pyx_v_parameters_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":551
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":586
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray parameters_ = NI_ObjectToInputArray(parameters)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2805,7 +3002,7 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":553
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":588
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_FourierFilter(ARRAY(input_), ARRAY(parameters_), n, axis,
  *                      ARRAY(output_), filter_type)             # <<<<<<<<<<<<<<
@@ -2814,7 +3011,7 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
  */
   __pyx_t_2 = NI_FourierFilter(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_parameters_), __pyx_v_n, __pyx_v_axis, ARRAY(__pyx_v_output_), __pyx_v_filter_type); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":554
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":589
  *     NI_FourierFilter(ARRAY(input_), ARRAY(parameters_), n, axis,
  *                      ARRAY(output_), filter_type)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2827,7 +3024,7 @@ static System::Object^ fourier_filter(System::Object^ input, System::Object^ par
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":556
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":591
  *     CheckError()
  * 
  * def fourier_shift(object input, object shifts, npy_intp n, int axis,             # <<<<<<<<<<<<<<
@@ -2849,11 +3046,11 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
   int __pyx_t_2;
   __pyx_v_input = input;
   __pyx_v_shifts = shifts;
-  __pyx_v_n = __site_cvt_cvt_npy_intp_556_0->Target(__site_cvt_cvt_npy_intp_556_0, n);
-  __pyx_v_axis = __site_cvt_cvt_int_556_0->Target(__site_cvt_cvt_int_556_0, axis);
+  __pyx_v_n = __site_cvt_cvt_npy_intp_591_0->Target(__site_cvt_cvt_npy_intp_591_0, n);
+  __pyx_v_axis = __site_cvt_cvt_int_591_0->Target(__site_cvt_cvt_int_591_0, axis);
   __pyx_v_output = output;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":558
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":593
  * def fourier_shift(object input, object shifts, npy_intp n, int axis,
  *                   object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2864,7 +3061,7 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":559
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":594
  *                   object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray shifts_ = NI_ObjectToInputArray(shifts)             # <<<<<<<<<<<<<<
@@ -2875,7 +3072,7 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
   __pyx_v_shifts_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":560
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":595
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray shifts_ = NI_ObjectToInputArray(shifts)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2886,7 +3083,7 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":562
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":597
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_FourierShift(ARRAY(input_), ARRAY(shifts_), n, axis,
  *                     ARRAY(output_))             # <<<<<<<<<<<<<<
@@ -2895,7 +3092,7 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
  */
   __pyx_t_2 = NI_FourierShift(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_shifts_), __pyx_v_n, __pyx_v_axis, ARRAY(__pyx_v_output_)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":563
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":598
  *     NI_FourierShift(ARRAY(input_), ARRAY(shifts_), n, axis,
  *                     ARRAY(output_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2908,7 +3105,7 @@ static System::Object^ fourier_shift(System::Object^ input, System::Object^ shif
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":565
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":600
  *     CheckError()
  * 
  * def spline_filter1d(object input, int order, int axis, object output):             # <<<<<<<<<<<<<<
@@ -2927,11 +3124,11 @@ static System::Object^ spline_filter1d(System::Object^ input, System::Object^ or
   System::Object^ __pyx_t_1 = nullptr;
   int __pyx_t_2;
   __pyx_v_input = input;
-  __pyx_v_order = __site_cvt_cvt_int_565_0->Target(__site_cvt_cvt_int_565_0, order);
-  __pyx_v_axis = __site_cvt_cvt_int_565_0_1->Target(__site_cvt_cvt_int_565_0_1, axis);
+  __pyx_v_order = __site_cvt_cvt_int_600_0->Target(__site_cvt_cvt_int_600_0, order);
+  __pyx_v_axis = __site_cvt_cvt_int_600_0_1->Target(__site_cvt_cvt_int_600_0_1, axis);
   __pyx_v_output = output;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":566
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":601
  * 
  * def spline_filter1d(object input, int order, int axis, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -2942,7 +3139,7 @@ static System::Object^ spline_filter1d(System::Object^ input, System::Object^ or
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":567
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":602
  * def spline_filter1d(object input, int order, int axis, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -2953,7 +3150,7 @@ static System::Object^ spline_filter1d(System::Object^ input, System::Object^ or
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":568
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":603
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_SplineFilter1D(ARRAY(input_), order, axis, ARRAY(output_))             # <<<<<<<<<<<<<<
@@ -2962,7 +3159,7 @@ static System::Object^ spline_filter1d(System::Object^ input, System::Object^ or
  */
   __pyx_t_2 = NI_SplineFilter1D(ARRAY(__pyx_v_input_), __pyx_v_order, __pyx_v_axis, ARRAY(__pyx_v_output_)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":569
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":604
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_SplineFilter1D(ARRAY(input_), order, axis, ARRAY(output_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -2975,7 +3172,7 @@ static System::Object^ spline_filter1d(System::Object^ input, System::Object^ or
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":571
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":606
  *     CheckError()
  * 
  * cdef int cbwrapper_map(npy_intp *ocoor, double *icoor,             # <<<<<<<<<<<<<<
@@ -3003,7 +3200,7 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   __pyx_v_cList = nullptr;
   __pyx_v_coors = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":573
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":608
  * cdef int cbwrapper_map(npy_intp *ocoor, double *icoor,
  *                        int orank, int irank, void *ctx) except 0:
  *     cdef CallbackInfo info = object_from_cookie(ctx)             # <<<<<<<<<<<<<<
@@ -3017,7 +3214,7 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":576
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":611
  *     cdef npy_intp i
  *     cdef tuple ret
  *     cList = []             # <<<<<<<<<<<<<<
@@ -3028,7 +3225,7 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   __pyx_v_cList = __pyx_t_1;
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":577
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":612
  *     cdef tuple ret
  *     cList = []
  *     for i in range(orank): cList.append(ocoor[i])             # <<<<<<<<<<<<<<
@@ -3038,15 +3235,15 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   __pyx_t_2 = __pyx_v_orank;
   for (__pyx_t_3 = 0; __pyx_t_3 < __pyx_t_2; __pyx_t_3+=1) {
     __pyx_v_i = __pyx_t_3;
-    __pyx_t_1 = __site_get_append_577_32->Target(__site_get_append_577_32, ((System::Object^)__pyx_v_cList), __pyx_context);
+    __pyx_t_1 = __site_get_append_612_32->Target(__site_get_append_612_32, ((System::Object^)__pyx_v_cList), __pyx_context);
     __pyx_t_4 = (__pyx_v_ocoor[__pyx_v_i]);
-    __pyx_t_5 = __site_call1_577_39->Target(__site_call1_577_39, __pyx_context, __pyx_t_1, __pyx_t_4);
+    __pyx_t_5 = __site_call1_612_39->Target(__site_call1_612_39, __pyx_context, __pyx_t_1, __pyx_t_4);
     __pyx_t_1 = nullptr;
     __pyx_t_4 = nullptr;
     __pyx_t_5 = nullptr;
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":578
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":613
  *     cList = []
  *     for i in range(orank): cList.append(ocoor[i])
  *     coors = tuple(cList)             # <<<<<<<<<<<<<<
@@ -3054,26 +3251,26 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
  *     for i in range(irank):
  */
   __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "tuple");
-  __pyx_t_4 = __site_call1_578_17->Target(__site_call1_578_17, __pyx_context, ((System::Object^)__pyx_t_5), ((System::Object^)__pyx_v_cList));
+  __pyx_t_4 = __site_call1_613_17->Target(__site_call1_613_17, __pyx_context, ((System::Object^)__pyx_t_5), ((System::Object^)__pyx_v_cList));
   __pyx_t_5 = nullptr;
   __pyx_v_coors = ((System::Object^)__pyx_t_4);
   __pyx_t_4 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":579
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":614
  *     for i in range(orank): cList.append(ocoor[i])
  *     coors = tuple(cList)
  *     ret = info.function(coors, *info.args, **info.kwargs)             # <<<<<<<<<<<<<<
  *     for i in range(irank):
  *         icoor[i] = ret[i]
  */
-  __pyx_t_4 = __site_call1_ARGS_KWARGS_579_23->Target(__site_call1_ARGS_KWARGS_579_23, __pyx_context, __pyx_v_info->function, ((System::Object^)__pyx_v_coors), __pyx_v_info->args, __pyx_v_info->kwargs);
+  __pyx_t_4 = __site_call1_ARGS_KWARGS_614_23->Target(__site_call1_ARGS_KWARGS_614_23, __pyx_context, __pyx_v_info->function, ((System::Object^)__pyx_v_coors), __pyx_v_info->args, __pyx_v_info->kwargs);
   if (__pyx_t_4 != nullptr && dynamic_cast<IronPython::Runtime::PythonTuple^>(__pyx_t_4) == nullptr) {
     throw PythonOps::MakeException(__pyx_context, PythonOps::GetGlobal(__pyx_context, "TypeError"), "type error", nullptr);
   }
   __pyx_v_ret = ((System::Object^)__pyx_t_4);
   __pyx_t_4 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":580
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":615
  *     coors = tuple(cList)
  *     ret = info.function(coors, *info.args, **info.kwargs)
  *     for i in range(irank):             # <<<<<<<<<<<<<<
@@ -3084,20 +3281,20 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   for (__pyx_t_3 = 0; __pyx_t_3 < __pyx_t_2; __pyx_t_3+=1) {
     __pyx_v_i = __pyx_t_3;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":581
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":616
  *     ret = info.function(coors, *info.args, **info.kwargs)
  *     for i in range(irank):
  *         icoor[i] = ret[i]             # <<<<<<<<<<<<<<
  *     return 1
  * 
  */
-    __pyx_t_4 = __site_getindex_581_22->Target(__site_getindex_581_22, ((System::Object^)__pyx_v_ret), ((System::Object^)__pyx_v_i));
-    __pyx_t_6 = __site_cvt_cvt_double_581_22->Target(__site_cvt_cvt_double_581_22, __pyx_t_4);
+    __pyx_t_4 = __site_getindex_616_22->Target(__site_getindex_616_22, ((System::Object^)__pyx_v_ret), ((System::Object^)__pyx_v_i));
+    __pyx_t_6 = __site_cvt_cvt_double_616_22->Target(__site_cvt_cvt_double_616_22, __pyx_t_4);
     __pyx_t_4 = nullptr;
     (__pyx_v_icoor[__pyx_v_i]) = __pyx_t_6;
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":582
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":617
  *     for i in range(irank):
  *         icoor[i] = ret[i]
  *     return 1             # <<<<<<<<<<<<<<
@@ -3112,7 +3309,7 @@ static  int cbwrapper_map(npy_intp *__pyx_v_ocoor, double *__pyx_v_icoor, int __
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":584
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":619
  *     return 1
  * 
  * def geometric_transform(object input, object map_callback, object coordinates,             # <<<<<<<<<<<<<<
@@ -3155,14 +3352,14 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_matrix = matrix;
   __pyx_v_shift = shift;
   __pyx_v_output = output;
-  __pyx_v_order = __site_cvt_cvt_int_584_0->Target(__site_cvt_cvt_int_584_0, order);
-  __pyx_v_mode = __site_cvt_cvt_int_584_0_1->Target(__site_cvt_cvt_int_584_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_584_0->Target(__site_cvt_cvt_double_584_0, cval);
+  __pyx_v_order = __site_cvt_cvt_int_619_0->Target(__site_cvt_cvt_int_619_0, order);
+  __pyx_v_mode = __site_cvt_cvt_int_619_0_1->Target(__site_cvt_cvt_int_619_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_619_0->Target(__site_cvt_cvt_double_619_0, cval);
   __pyx_v_extra_arguments = extra_arguments;
   __pyx_v_extra_keywords = extra_keywords;
   __pyx_v_info = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":588
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":623
  *                         int order, int mode, double cval, object extra_arguments,
  *                         object extra_keywords):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -3173,7 +3370,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":589
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":624
  *                         object extra_keywords):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray coordinates_ = None if coordinates is None else NI_ObjectToInputArray(coordinates)             # <<<<<<<<<<<<<<
@@ -3194,7 +3391,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_coordinates_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":590
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":625
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray coordinates_ = None if coordinates is None else NI_ObjectToInputArray(coordinates)
  *     cdef ndarray matrix_ = None if matrix is None else NI_ObjectToInputArray(matrix)             # <<<<<<<<<<<<<<
@@ -3215,7 +3412,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_matrix_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":591
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":626
  *     cdef ndarray coordinates_ = None if coordinates is None else NI_ObjectToInputArray(coordinates)
  *     cdef ndarray matrix_ = None if matrix is None else NI_ObjectToInputArray(matrix)
  *     cdef ndarray shift_ = None if shift is None else NI_ObjectToInputArray(shift)             # <<<<<<<<<<<<<<
@@ -3236,7 +3433,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_shift_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":592
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":627
  *     cdef ndarray matrix_ = None if matrix is None else NI_ObjectToInputArray(matrix)
  *     cdef ndarray shift_ = None if shift is None else NI_ObjectToInputArray(shift)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -3247,7 +3444,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":599
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":634
  *     cdef callback_holder info_holder
  * 
  *     if map_callback is not None:             # <<<<<<<<<<<<<<
@@ -3257,7 +3454,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   __pyx_t_2 = (__pyx_v_map_callback != nullptr);
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":602
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":637
  *         # TODO: Capsule support
  *         if True:
  *             funcptr = &cbwrapper_map             # <<<<<<<<<<<<<<
@@ -3266,18 +3463,18 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
  */
     __pyx_v_funcptr = __pyx_function_pointer_cbwrapper_map;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":603
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":638
  *         if True:
  *             funcptr = &cbwrapper_map
  *             info = CallbackInfo(map_callback, extra_arguments, extra_keywords)             # <<<<<<<<<<<<<<
  *             set_callback_holder(info_holder, info)
  *             ctx = cookie_from_callback(info_holder)
  */
-    __pyx_t_1 = __site_call3_603_31->Target(__site_call3_603_31, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_map_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
+    __pyx_t_1 = __site_call3_638_31->Target(__site_call3_638_31, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CallbackInfo)), __pyx_v_map_callback, __pyx_v_extra_arguments, __pyx_v_extra_keywords);
     __pyx_v_info = ((CallbackInfo^)__pyx_t_1);
     __pyx_t_1 = nullptr;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":604
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":639
  *             funcptr = &cbwrapper_map
  *             info = CallbackInfo(map_callback, extra_arguments, extra_keywords)
  *             set_callback_holder(info_holder, info)             # <<<<<<<<<<<<<<
@@ -3286,7 +3483,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
  */
     set_callback_holder(__pyx_v_info_holder, ((System::Object^)__pyx_v_info));
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":605
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":640
  *             info = CallbackInfo(map_callback, extra_arguments, extra_keywords)
  *             set_callback_holder(info_holder, info)
  *             ctx = cookie_from_callback(info_holder)             # <<<<<<<<<<<<<<
@@ -3298,7 +3495,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   }
   /*else*/ {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":608
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":643
  * 
  *     else:
  *         funcptr = ctx = NULL             # <<<<<<<<<<<<<<
@@ -3310,7 +3507,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   }
   __pyx_L5:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":611
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":646
  * 
  *     NI_GeometricTransform(ARRAY(input_), funcptr, ctx,
  *                           <NpyArray*>NULL if matrix_ is None else ARRAY(matrix_),             # <<<<<<<<<<<<<<
@@ -3324,7 +3521,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
     __pyx_t_4 = ARRAY(__pyx_v_matrix_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":612
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":647
  *     NI_GeometricTransform(ARRAY(input_), funcptr, ctx,
  *                           <NpyArray*>NULL if matrix_ is None else ARRAY(matrix_),
  *                           <NpyArray*>NULL if shift_ is None else ARRAY(shift_),             # <<<<<<<<<<<<<<
@@ -3338,7 +3535,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
     __pyx_t_5 = ARRAY(__pyx_v_shift_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":613
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":648
  *                           <NpyArray*>NULL if matrix_ is None else ARRAY(matrix_),
  *                           <NpyArray*>NULL if shift_ is None else ARRAY(shift_),
  *                           <NpyArray*>NULL if coordinates_ is None else ARRAY(coordinates_),             # <<<<<<<<<<<<<<
@@ -3352,7 +3549,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
     __pyx_t_6 = ARRAY(__pyx_v_coordinates_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":614
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":649
  *                           <NpyArray*>NULL if shift_ is None else ARRAY(shift_),
  *                           <NpyArray*>NULL if coordinates_ is None else ARRAY(coordinates_),
  *                           ARRAY(output_), order, <NI_ExtendMode>mode, cval)             # <<<<<<<<<<<<<<
@@ -3361,7 +3558,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
  */
   __pyx_t_7 = NI_GeometricTransform(ARRAY(__pyx_v_input_), __pyx_v_funcptr, __pyx_v_ctx, __pyx_t_4, __pyx_t_5, __pyx_t_6, ARRAY(__pyx_v_output_), __pyx_v_order, ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":615
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":650
  *                           <NpyArray*>NULL if coordinates_ is None else ARRAY(coordinates_),
  *                           ARRAY(output_), order, <NI_ExtendMode>mode, cval)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -3374,7 +3571,7 @@ static System::Object^ geometric_transform(System::Object^ input, System::Object
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":618
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":653
  * 
  * 
  * def zoom_shift(object input, object zoom, object shift, object output,             # <<<<<<<<<<<<<<
@@ -3405,11 +3602,11 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   __pyx_v_zoom = zoom;
   __pyx_v_shift = shift;
   __pyx_v_output = output;
-  __pyx_v_order = __site_cvt_cvt_int_618_0->Target(__site_cvt_cvt_int_618_0, order);
-  __pyx_v_mode = __site_cvt_cvt_int_618_0_1->Target(__site_cvt_cvt_int_618_0_1, mode);
-  __pyx_v_cval = __site_cvt_cvt_double_618_0->Target(__site_cvt_cvt_double_618_0, cval);
+  __pyx_v_order = __site_cvt_cvt_int_653_0->Target(__site_cvt_cvt_int_653_0, order);
+  __pyx_v_mode = __site_cvt_cvt_int_653_0_1->Target(__site_cvt_cvt_int_653_0_1, mode);
+  __pyx_v_cval = __site_cvt_cvt_double_653_0->Target(__site_cvt_cvt_double_653_0, cval);
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":620
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":655
  * def zoom_shift(object input, object zoom, object shift, object output,
  *                int order, int mode, double cval):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -3420,7 +3617,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":621
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":656
  *                int order, int mode, double cval):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray zoom_ = None if zoom is None else NI_ObjectToInputArray(zoom)             # <<<<<<<<<<<<<<
@@ -3441,7 +3638,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   __pyx_v_zoom_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":622
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":657
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray zoom_ = None if zoom is None else NI_ObjectToInputArray(zoom)
  *     cdef ndarray shift_ = None if shift is None else NI_ObjectToInputArray(shift)             # <<<<<<<<<<<<<<
@@ -3462,7 +3659,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   __pyx_v_shift_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":623
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":658
  *     cdef ndarray zoom_ = None if zoom is None else NI_ObjectToInputArray(zoom)
  *     cdef ndarray shift_ = None if shift is None else NI_ObjectToInputArray(shift)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -3473,7 +3670,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":625
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":660
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_ZoomShift(ARRAY(input_),
  *                  <NpyArray*>NULL if zoom_ is None else ARRAY(zoom_),             # <<<<<<<<<<<<<<
@@ -3487,7 +3684,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
     __pyx_t_4 = ARRAY(__pyx_v_zoom_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":626
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":661
  *     NI_ZoomShift(ARRAY(input_),
  *                  <NpyArray*>NULL if zoom_ is None else ARRAY(zoom_),
  *                  <NpyArray*>NULL if shift_ is None else ARRAY(shift_),             # <<<<<<<<<<<<<<
@@ -3501,7 +3698,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
     __pyx_t_5 = ARRAY(__pyx_v_shift_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":627
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":662
  *                  <NpyArray*>NULL if zoom_ is None else ARRAY(zoom_),
  *                  <NpyArray*>NULL if shift_ is None else ARRAY(shift_),
  *                  ARRAY(output_), order, <NI_ExtendMode>mode, cval)             # <<<<<<<<<<<<<<
@@ -3510,7 +3707,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
  */
   __pyx_t_6 = NI_ZoomShift(ARRAY(__pyx_v_input_), __pyx_t_4, __pyx_t_5, ARRAY(__pyx_v_output_), __pyx_v_order, ((NI_ExtendMode)__pyx_v_mode), __pyx_v_cval); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":628
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":663
  *                  <NpyArray*>NULL if shift_ is None else ARRAY(shift_),
  *                  ARRAY(output_), order, <NI_ExtendMode>mode, cval)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -3523,7 +3720,7 @@ static System::Object^ zoom_shift(System::Object^ input, System::Object^ zoom, S
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":630
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":665
  *     CheckError()
  * 
  * def label(object input, object strct, object output):             # <<<<<<<<<<<<<<
@@ -3546,7 +3743,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
   __pyx_v_strct = strct;
   __pyx_v_output = output;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":631
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":666
  * 
  * def label(object input, object strct, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -3557,7 +3754,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":632
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":667
  * def label(object input, object strct, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)             # <<<<<<<<<<<<<<
@@ -3568,7 +3765,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
   __pyx_v_strct_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":633
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":668
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -3579,7 +3776,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":635
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":670
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef npy_intp max_label
  *     NI_Label(ARRAY(input_), ARRAY(strct_), &max_label, ARRAY(output_))             # <<<<<<<<<<<<<<
@@ -3588,7 +3785,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
  */
   __pyx_t_2 = NI_Label(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_strct_), (&__pyx_v_max_label), ARRAY(__pyx_v_output_)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":636
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":671
  *     cdef npy_intp max_label
  *     NI_Label(ARRAY(input_), ARRAY(strct_), &max_label, ARRAY(output_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -3597,7 +3794,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
  */
   NumpyDotNet::NpyCoreApi::CheckError();
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":637
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":672
  *     NI_Label(ARRAY(input_), ARRAY(strct_), &max_label, ARRAY(output_))
  *     CheckError()
  *     return max_label             # <<<<<<<<<<<<<<
@@ -3614,7 +3811,7 @@ static System::Object^ label(System::Object^ input, System::Object^ strct, Syste
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":639
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":674
  *     return max_label
  * 
  * def find_objects(object input, npy_intp max_label):             # <<<<<<<<<<<<<<
@@ -3650,14 +3847,14 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   System::Object^ __pyx_t_13 = nullptr;
   Py_ssize_t __pyx_t_14;
   __pyx_v_input = input;
-  __pyx_v_max_label = __site_cvt_cvt_npy_intp_639_0->Target(__site_cvt_cvt_npy_intp_639_0, max_label);
+  __pyx_v_max_label = __site_cvt_cvt_npy_intp_674_0->Target(__site_cvt_cvt_npy_intp_674_0, max_label);
   __pyx_v_result = nullptr;
   __pyx_v_ii = nullptr;
   __pyx_v_tup = nullptr;
   __pyx_v_jj = nullptr;
   __pyx_v_slc = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":640
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":675
  * 
  * def find_objects(object input, npy_intp max_label):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -3668,7 +3865,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":641
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":676
  * def find_objects(object input, npy_intp max_label):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef npy_intp *regions = NULL             # <<<<<<<<<<<<<<
@@ -3677,7 +3874,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
   __pyx_v_regions = NULL;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":642
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":677
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef npy_intp *regions = NULL
  *     cdef int ndim = NpyArray_NDIM(ARRAY(input_))             # <<<<<<<<<<<<<<
@@ -3686,7 +3883,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
   __pyx_v_ndim = NpyArray_NDIM(ARRAY(__pyx_v_input_));
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":645
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":680
  *     cdef list result
  *     cdef npy_intp i, idx
  *     if max_label < 0:             # <<<<<<<<<<<<<<
@@ -3696,7 +3893,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   __pyx_t_2 = (__pyx_v_max_label < 0);
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":646
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":681
  *     cdef npy_intp i, idx
  *     if max_label < 0:
  *         max_label = 0             # <<<<<<<<<<<<<<
@@ -3708,7 +3905,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   }
   __pyx_L5:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":647
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":682
  *     if max_label < 0:
  *         max_label = 0
  *     if max_label > 0:             # <<<<<<<<<<<<<<
@@ -3718,7 +3915,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   __pyx_t_2 = (__pyx_v_max_label > 0);
   if (__pyx_t_2) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":648
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":683
  *         max_label = 0
  *     if max_label > 0:
  *         if ndim > 0:             # <<<<<<<<<<<<<<
@@ -3728,7 +3925,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     __pyx_t_2 = (__pyx_v_ndim > 0);
     if (__pyx_t_2) {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":649
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":684
  *     if max_label > 0:
  *         if ndim > 0:
  *             regions = <npy_intp*>malloc(2 * max_label * ndim * sizeof(npy_intp))             # <<<<<<<<<<<<<<
@@ -3740,7 +3937,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     }
     /*else*/ {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":651
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":686
  *             regions = <npy_intp*>malloc(2 * max_label * ndim * sizeof(npy_intp))
  *         else:
  *             regions = <npy_intp*>malloc(max_label * sizeof(npy_intp))             # <<<<<<<<<<<<<<
@@ -3751,7 +3948,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     }
     __pyx_L7:;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":652
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":687
  *         else:
  *             regions = <npy_intp*>malloc(max_label * sizeof(npy_intp))
  *         if regions == NULL:             # <<<<<<<<<<<<<<
@@ -3761,7 +3958,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     __pyx_t_2 = (__pyx_v_regions == NULL);
     if (__pyx_t_2) {
 
-      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":653
+      /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":688
  *             regions = <npy_intp*>malloc(max_label * sizeof(npy_intp))
  *         if regions == NULL:
  *             raise_no_memory()             # <<<<<<<<<<<<<<
@@ -3769,7 +3966,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  *     try:
  */
       __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "raise_no_memory");
-      __pyx_t_3 = __site_call0_653_27->Target(__site_call0_653_27, __pyx_context, __pyx_t_1);
+      __pyx_t_3 = __site_call0_688_27->Target(__site_call0_688_27, __pyx_context, __pyx_t_1);
       __pyx_t_1 = nullptr;
       __pyx_t_3 = nullptr;
       goto __pyx_L8;
@@ -3779,7 +3976,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   }
   __pyx_L6:;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":655
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":690
  *             raise_no_memory()
  * 
  *     try:             # <<<<<<<<<<<<<<
@@ -3788,7 +3985,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
   try {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":656
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":691
  * 
  *     try:
  *         NI_FindObjects(ARRAY(input_), max_label, regions)             # <<<<<<<<<<<<<<
@@ -3797,7 +3994,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
     __pyx_t_4 = NI_FindObjects(ARRAY(__pyx_v_input_), __pyx_v_max_label, __pyx_v_regions); 
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":657
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":692
  *     try:
  *         NI_FindObjects(ARRAY(input_), max_label, regions)
  *         CheckError()             # <<<<<<<<<<<<<<
@@ -3806,7 +4003,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
     NumpyDotNet::NpyCoreApi::CheckError();
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":658
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":693
  *         NI_FindObjects(ARRAY(input_), max_label, regions)
  *         CheckError()
  *         result = [None] * max_label             # <<<<<<<<<<<<<<
@@ -3815,7 +4012,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
     __pyx_t_3 = PythonOps::MakeListNoCopy(gcnew array<System::Object^>{nullptr});
     __pyx_t_1 = __pyx_v_max_label;
-    __pyx_t_5 = __site_op_mul_658_24->Target(__site_op_mul_658_24, ((System::Object^)__pyx_t_3), __pyx_t_1);
+    __pyx_t_5 = __site_op_mul_693_24->Target(__site_op_mul_693_24, ((System::Object^)__pyx_t_3), __pyx_t_1);
     __pyx_t_3 = nullptr;
     __pyx_t_1 = nullptr;
     if (__pyx_t_5 != nullptr && dynamic_cast<IronPython::Runtime::List^>(__pyx_t_5) == nullptr) {
@@ -3824,7 +4021,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     __pyx_v_result = ((System::Object^)__pyx_t_5);
     __pyx_t_5 = nullptr;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":659
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":694
  *         CheckError()
  *         result = [None] * max_label
  *         for ii in range(max_label):             # <<<<<<<<<<<<<<
@@ -3833,15 +4030,15 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
     __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "range");
     __pyx_t_1 = __pyx_v_max_label;
-    __pyx_t_3 = __site_call1_659_23->Target(__site_call1_659_23, __pyx_context, __pyx_t_5, __pyx_t_1);
+    __pyx_t_3 = __site_call1_694_23->Target(__site_call1_694_23, __pyx_context, __pyx_t_5, __pyx_t_1);
     __pyx_t_5 = nullptr;
     __pyx_t_1 = nullptr;
-    __pyx_t_6 = __site_get_iterator_659_8->Target(__site_get_iterator_659_8, __pyx_t_3);
+    __pyx_t_6 = __site_get_iterator_694_8->Target(__site_get_iterator_694_8, __pyx_t_3);
     try {
       while (__pyx_t_6.Key->MoveNext()) {
         __pyx_v_ii = ((System::Object^)__pyx_t_6.Key->Current);
 
-        /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":660
+        /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":695
  *         result = [None] * max_label
  *         for ii in range(max_label):
  *             idx = 2 * ndim * ii if ndim > 0 else ii             # <<<<<<<<<<<<<<
@@ -3850,18 +4047,18 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
         if ((__pyx_v_ndim > 0)) {
           __pyx_t_5 = (2 * __pyx_v_ndim);
-          __pyx_t_7 = __site_op_mul_660_27->Target(__site_op_mul_660_27, __pyx_t_5, __pyx_v_ii);
+          __pyx_t_7 = __site_op_mul_695_27->Target(__site_op_mul_695_27, __pyx_t_5, __pyx_v_ii);
           __pyx_t_5 = nullptr;
           __pyx_t_1 = __pyx_t_7;
           __pyx_t_7 = nullptr;
         } else {
           __pyx_t_1 = __pyx_v_ii;
         }
-        __pyx_t_8 = __site_cvt_cvt_npy_intp_660_18->Target(__site_cvt_cvt_npy_intp_660_18, __pyx_t_1);
+        __pyx_t_8 = __site_cvt_cvt_npy_intp_695_18->Target(__site_cvt_cvt_npy_intp_695_18, __pyx_t_1);
         __pyx_t_1 = nullptr;
         __pyx_v_idx = __pyx_t_8;
 
-        /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":661
+        /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":696
  *         for ii in range(max_label):
  *             idx = 2 * ndim * ii if ndim > 0 else ii
  *             if regions[idx] >= 0:             # <<<<<<<<<<<<<<
@@ -3871,7 +4068,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
         __pyx_t_2 = ((__pyx_v_regions[__pyx_v_idx]) >= 0);
         if (__pyx_t_2) {
 
-          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":662
+          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":697
  *             idx = 2 * ndim * ii if ndim > 0 else ii
  *             if regions[idx] >= 0:
  *                 tup = [None] * ndim             # <<<<<<<<<<<<<<
@@ -3880,7 +4077,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
           __pyx_t_1 = PythonOps::MakeListNoCopy(gcnew array<System::Object^>{nullptr});
           __pyx_t_7 = __pyx_v_ndim;
-          __pyx_t_5 = __site_op_mul_662_29->Target(__site_op_mul_662_29, ((System::Object^)__pyx_t_1), __pyx_t_7);
+          __pyx_t_5 = __site_op_mul_697_29->Target(__site_op_mul_697_29, ((System::Object^)__pyx_t_1), __pyx_t_7);
           __pyx_t_1 = nullptr;
           __pyx_t_7 = nullptr;
           if (__pyx_t_5 != nullptr && dynamic_cast<IronPython::Runtime::List^>(__pyx_t_5) == nullptr) {
@@ -3889,7 +4086,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
           __pyx_v_tup = ((System::Object^)__pyx_t_5);
           __pyx_t_5 = nullptr;
 
-          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":663
+          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":698
  *             if regions[idx] >= 0:
  *                 tup = [None] * ndim
  *                 for jj in range(ndim):             # <<<<<<<<<<<<<<
@@ -3898,15 +4095,15 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
           __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "range");
           __pyx_t_7 = __pyx_v_ndim;
-          __pyx_t_1 = __site_call1_663_31->Target(__site_call1_663_31, __pyx_context, __pyx_t_5, __pyx_t_7);
+          __pyx_t_1 = __site_call1_698_31->Target(__site_call1_698_31, __pyx_context, __pyx_t_5, __pyx_t_7);
           __pyx_t_5 = nullptr;
           __pyx_t_7 = nullptr;
-          __pyx_t_9 = __site_get_iterator_663_16->Target(__site_get_iterator_663_16, __pyx_t_1);
+          __pyx_t_9 = __site_get_iterator_698_16->Target(__site_get_iterator_698_16, __pyx_t_1);
           try {
             while (__pyx_t_9.Key->MoveNext()) {
               __pyx_v_jj = ((System::Object^)__pyx_t_9.Key->Current);
 
-              /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":664
+              /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":699
  *                 tup = [None] * ndim
  *                 for jj in range(ndim):
  *                     slc = slice(regions[idx + jj], regions[idx + jj + ndim], None)             # <<<<<<<<<<<<<<
@@ -3915,43 +4112,43 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  */
               __pyx_t_7 = PythonOps::GetGlobal(__pyx_context, "slice");
               __pyx_t_5 = __pyx_v_idx;
-              __pyx_t_10 = __site_op_add_664_44->Target(__site_op_add_664_44, __pyx_t_5, __pyx_v_jj);
+              __pyx_t_10 = __site_op_add_699_44->Target(__site_op_add_699_44, __pyx_t_5, __pyx_v_jj);
               __pyx_t_5 = nullptr;
-              __pyx_t_11 = __site_cvt_cvt_Py_ssize_t_664_44->Target(__site_cvt_cvt_Py_ssize_t_664_44, __pyx_t_10);
+              __pyx_t_11 = __site_cvt_cvt_Py_ssize_t_699_44->Target(__site_cvt_cvt_Py_ssize_t_699_44, __pyx_t_10);
               __pyx_t_10 = nullptr;
               __pyx_t_10 = (__pyx_v_regions[__pyx_t_11]);
               __pyx_t_5 = __pyx_v_idx;
-              __pyx_t_12 = __site_op_add_664_63->Target(__site_op_add_664_63, __pyx_t_5, __pyx_v_jj);
+              __pyx_t_12 = __site_op_add_699_63->Target(__site_op_add_699_63, __pyx_t_5, __pyx_v_jj);
               __pyx_t_5 = nullptr;
               __pyx_t_5 = __pyx_v_ndim;
-              __pyx_t_13 = __site_op_add_664_68->Target(__site_op_add_664_68, __pyx_t_12, __pyx_t_5);
+              __pyx_t_13 = __site_op_add_699_68->Target(__site_op_add_699_68, __pyx_t_12, __pyx_t_5);
               __pyx_t_12 = nullptr;
               __pyx_t_5 = nullptr;
-              __pyx_t_14 = __site_cvt_cvt_Py_ssize_t_664_68->Target(__site_cvt_cvt_Py_ssize_t_664_68, __pyx_t_13);
+              __pyx_t_14 = __site_cvt_cvt_Py_ssize_t_699_68->Target(__site_cvt_cvt_Py_ssize_t_699_68, __pyx_t_13);
               __pyx_t_13 = nullptr;
               __pyx_t_13 = (__pyx_v_regions[__pyx_t_14]);
-              __pyx_t_5 = __site_call3_664_31->Target(__site_call3_664_31, __pyx_context, ((System::Object^)__pyx_t_7), __pyx_t_10, __pyx_t_13, nullptr);
+              __pyx_t_5 = __site_call3_699_31->Target(__site_call3_699_31, __pyx_context, ((System::Object^)__pyx_t_7), __pyx_t_10, __pyx_t_13, nullptr);
               __pyx_t_7 = nullptr;
               __pyx_t_10 = nullptr;
               __pyx_t_13 = nullptr;
               __pyx_v_slc = __pyx_t_5;
               __pyx_t_5 = nullptr;
 
-              /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":665
+              /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":700
  *                 for jj in range(ndim):
  *                     slc = slice(regions[idx + jj], regions[idx + jj + ndim], None)
  *                     tup[jj] = slc             # <<<<<<<<<<<<<<
  *                 result[ii] = tuple(tup)
  *             else:
  */
-              __site_setindex_665_23->Target(__site_setindex_665_23, ((System::Object^)__pyx_v_tup), __pyx_v_jj, __pyx_v_slc);
+              __site_setindex_700_23->Target(__site_setindex_700_23, ((System::Object^)__pyx_v_tup), __pyx_v_jj, __pyx_v_slc);
             }
           }
           finally {
             PythonOps::ForLoopDispose(__pyx_t_9);
           }
 
-          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":666
+          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":701
  *                     slc = slice(regions[idx + jj], regions[idx + jj + ndim], None)
  *                     tup[jj] = slc
  *                 result[ii] = tuple(tup)             # <<<<<<<<<<<<<<
@@ -3959,22 +4156,22 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
  *                 result[ii] = None
  */
           __pyx_t_5 = PythonOps::GetGlobal(__pyx_context, "tuple");
-          __pyx_t_13 = __site_call1_666_34->Target(__site_call1_666_34, __pyx_context, ((System::Object^)__pyx_t_5), ((System::Object^)__pyx_v_tup));
+          __pyx_t_13 = __site_call1_701_34->Target(__site_call1_701_34, __pyx_context, ((System::Object^)__pyx_t_5), ((System::Object^)__pyx_v_tup));
           __pyx_t_5 = nullptr;
-          __site_setindex_666_22->Target(__site_setindex_666_22, ((System::Object^)__pyx_v_result), __pyx_v_ii, __pyx_t_13);
+          __site_setindex_701_22->Target(__site_setindex_701_22, ((System::Object^)__pyx_v_result), __pyx_v_ii, __pyx_t_13);
           __pyx_t_13 = nullptr;
           goto __pyx_L9;
         }
         /*else*/ {
 
-          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":668
+          /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":703
  *                 result[ii] = tuple(tup)
  *             else:
  *                 result[ii] = None             # <<<<<<<<<<<<<<
  *     finally:
  *         free(regions)
  */
-          __site_setindex_668_22->Target(__site_setindex_668_22, ((System::Object^)__pyx_v_result), __pyx_v_ii, nullptr);
+          __site_setindex_703_22->Target(__site_setindex_703_22, ((System::Object^)__pyx_v_result), __pyx_v_ii, nullptr);
         }
         __pyx_L9:;
       }
@@ -3984,7 +4181,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     }
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":670
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":705
  *                 result[ii] = None
  *     finally:
  *         free(regions)             # <<<<<<<<<<<<<<
@@ -3995,7 +4192,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
     free(__pyx_v_regions);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":672
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":707
  *         free(regions)
  * 
  *     return result             # <<<<<<<<<<<<<<
@@ -4012,7 +4209,7 @@ static System::Object^ find_objects(System::Object^ input, System::Object^ max_l
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":674
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":709
  *     return result
  * 
  * def watershed_ift(object input, object markers, object strct, object output):             # <<<<<<<<<<<<<<
@@ -4037,7 +4234,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   __pyx_v_strct = strct;
   __pyx_v_output = output;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":675
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":710
  * 
  * def watershed_ift(object input, object markers, object strct, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -4048,7 +4245,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":676
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":711
  * def watershed_ift(object input, object markers, object strct, object output):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray markers_ = NI_ObjectToInputArray(markers)             # <<<<<<<<<<<<<<
@@ -4059,7 +4256,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   __pyx_v_markers_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":677
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":712
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray markers_ = NI_ObjectToInputArray(markers)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)             # <<<<<<<<<<<<<<
@@ -4070,7 +4267,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   __pyx_v_strct_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":678
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":713
  *     cdef ndarray markers_ = NI_ObjectToInputArray(markers)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -4081,7 +4278,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":679
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":714
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_WatershedIFT(ARRAY(input_), ARRAY(markers_), ARRAY(strct_), ARRAY(output_))             # <<<<<<<<<<<<<<
@@ -4090,7 +4287,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
  */
   __pyx_t_2 = NI_WatershedIFT(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_markers_), ARRAY(__pyx_v_strct_), ARRAY(__pyx_v_output_)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":680
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":715
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     NI_WatershedIFT(ARRAY(input_), ARRAY(markers_), ARRAY(strct_), ARRAY(output_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -4103,7 +4300,7 @@ static System::Object^ watershed_ift(System::Object^ input, System::Object^ mark
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":682
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":717
  *     CheckError()
  * 
  * def distance_transform_bf(object input, int metric, object sampling, object output,             # <<<<<<<<<<<<<<
@@ -4130,12 +4327,12 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   NpyArray *__pyx_t_6;
   int __pyx_t_7;
   __pyx_v_input = input;
-  __pyx_v_metric = __site_cvt_cvt_int_682_0->Target(__site_cvt_cvt_int_682_0, metric);
+  __pyx_v_metric = __site_cvt_cvt_int_717_0->Target(__site_cvt_cvt_int_717_0, metric);
   __pyx_v_sampling = sampling;
   __pyx_v_output = output;
   __pyx_v_features = features;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":684
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":719
  * def distance_transform_bf(object input, int metric, object sampling, object output,
  *                           object features):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -4146,7 +4343,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":685
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":720
  *                           object features):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray sampling_ = None if sampling is None else NI_ObjectToInputArray(sampling)             # <<<<<<<<<<<<<<
@@ -4167,7 +4364,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   __pyx_v_sampling_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":686
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":721
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray sampling_ = None if sampling is None else NI_ObjectToInputArray(sampling)
  *     cdef ndarray output_ = None if output is None else NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -4188,7 +4385,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":687
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":722
  *     cdef ndarray sampling_ = None if sampling is None else NI_ObjectToInputArray(sampling)
  *     cdef ndarray output_ = None if output is None else NI_ObjectToOutputArray(output)
  *     cdef ndarray features_ = None if features is None else NI_ObjectToOutputArray(features)             # <<<<<<<<<<<<<<
@@ -4209,7 +4406,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   __pyx_v_features_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":689
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":724
  *     cdef ndarray features_ = None if features is None else NI_ObjectToOutputArray(features)
  *     NI_DistanceTransformBruteForce(ARRAY(input_), metric,
  *                                    <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),             # <<<<<<<<<<<<<<
@@ -4223,7 +4420,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
     __pyx_t_4 = ARRAY(__pyx_v_sampling_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":690
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":725
  *     NI_DistanceTransformBruteForce(ARRAY(input_), metric,
  *                                    <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),
  *                                    <NpyArray*>NULL if output_ is None else ARRAY(output_),             # <<<<<<<<<<<<<<
@@ -4237,7 +4434,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
     __pyx_t_5 = ARRAY(__pyx_v_output_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":691
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":726
  *                                    <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),
  *                                    <NpyArray*>NULL if output_ is None else ARRAY(output_),
  *                                    <NpyArray*>NULL if features_ is None else ARRAY(features_))             # <<<<<<<<<<<<<<
@@ -4252,7 +4449,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   }
   __pyx_t_7 = NI_DistanceTransformBruteForce(ARRAY(__pyx_v_input_), __pyx_v_metric, __pyx_t_4, __pyx_t_5, __pyx_t_6); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":692
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":727
  *                                    <NpyArray*>NULL if output_ is None else ARRAY(output_),
  *                                    <NpyArray*>NULL if features_ is None else ARRAY(features_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -4265,7 +4462,7 @@ static System::Object^ distance_transform_bf(System::Object^ input, System::Obje
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":694
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":729
  *     CheckError()
  * 
  * def distance_transform_op(object strct, object distances, object features):             # <<<<<<<<<<<<<<
@@ -4290,7 +4487,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   __pyx_v_distances = distances;
   __pyx_v_features = features;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":695
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":730
  * 
  * def distance_transform_op(object strct, object distances, object features):
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)             # <<<<<<<<<<<<<<
@@ -4301,7 +4498,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   __pyx_v_strct_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":696
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":731
  * def distance_transform_op(object strct, object distances, object features):
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray distances_ = NI_ObjectToIoArray(distances)             # <<<<<<<<<<<<<<
@@ -4312,7 +4509,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   __pyx_v_distances_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":697
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":732
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray distances_ = NI_ObjectToIoArray(distances)
  *     cdef ndarray features_ = None if features is None else NI_ObjectToOutputArray(features)             # <<<<<<<<<<<<<<
@@ -4333,7 +4530,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   __pyx_v_features_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":699
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":734
  *     cdef ndarray features_ = None if features is None else NI_ObjectToOutputArray(features)
  *     NI_DistanceTransformOnePass(ARRAY(strct_), ARRAY(distances_),
  *                                 <NpyArray*>NULL if features_ is None else ARRAY(features_))             # <<<<<<<<<<<<<<
@@ -4348,7 +4545,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   }
   __pyx_t_5 = NI_DistanceTransformOnePass(ARRAY(__pyx_v_strct_), ARRAY(__pyx_v_distances_), __pyx_t_4); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":700
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":735
  *     NI_DistanceTransformOnePass(ARRAY(strct_), ARRAY(distances_),
  *                                 <NpyArray*>NULL if features_ is None else ARRAY(features_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -4361,7 +4558,7 @@ static System::Object^ distance_transform_op(System::Object^ strct, System::Obje
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":702
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":737
  *     CheckError()
  * 
  * def euclidean_feature_transform(object input, object sampling, object features):             # <<<<<<<<<<<<<<
@@ -4386,7 +4583,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
   __pyx_v_sampling = sampling;
   __pyx_v_features = features;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":703
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":738
  * 
  * def euclidean_feature_transform(object input, object sampling, object features):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -4397,7 +4594,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":704
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":739
  * def euclidean_feature_transform(object input, object sampling, object features):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray sampling_ = None if sampling is None else NI_ObjectToInputArray(sampling)             # <<<<<<<<<<<<<<
@@ -4418,7 +4615,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
   __pyx_v_sampling_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":705
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":740
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray sampling_ = None if sampling is None else NI_ObjectToInputArray(sampling)
  *     cdef ndarray features_ = NI_ObjectToOutputArray(features)             # <<<<<<<<<<<<<<
@@ -4429,7 +4626,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
   __pyx_v_features_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":707
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":742
  *     cdef ndarray features_ = NI_ObjectToOutputArray(features)
  *     NI_EuclideanFeatureTransform(ARRAY(input_),
  *                                  <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),             # <<<<<<<<<<<<<<
@@ -4443,7 +4640,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
     __pyx_t_4 = ARRAY(__pyx_v_sampling_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":708
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":743
  *     NI_EuclideanFeatureTransform(ARRAY(input_),
  *                                  <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),
  *                                  ARRAY(features_))             # <<<<<<<<<<<<<<
@@ -4452,7 +4649,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
  */
   __pyx_t_5 = NI_EuclideanFeatureTransform(ARRAY(__pyx_v_input_), __pyx_t_4, ARRAY(__pyx_v_features_)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":709
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":744
  *                                  <NpyArray*>NULL if sampling_ is None else ARRAY(sampling_),
  *                                  ARRAY(features_))
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -4465,7 +4662,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":711
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":746
  *     CheckError()
  * 
  * cdef class CoordinateListWrapper:             # <<<<<<<<<<<<<<
@@ -4476,7 +4673,7 @@ static System::Object^ euclidean_feature_transform(System::Object^ input, System
 ref struct CoordinateListWrapper {
   NI_CoordinateList *ptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":713
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":748
  * cdef class CoordinateListWrapper:
  *     cdef NI_CoordinateList *ptr
  *     def __cinit__(self):             # <<<<<<<<<<<<<<
@@ -4488,7 +4685,7 @@ ref struct CoordinateListWrapper {
     int __pyx_r;
     System::Object^ __pyx_v_self = this;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":714
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":749
  *     cdef NI_CoordinateList *ptr
  *     def __cinit__(self):
  *         self.ptr = NULL             # <<<<<<<<<<<<<<
@@ -4500,7 +4697,7 @@ ref struct CoordinateListWrapper {
     __pyx_r = 0;
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":715
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":750
  *     def __cinit__(self):
  *         self.ptr = NULL
  *     def __dealloc__(self):             # <<<<<<<<<<<<<<
@@ -4511,7 +4708,7 @@ ref struct CoordinateListWrapper {
   !CoordinateListWrapper() {
     System::Object^ __pyx_v_self = this;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":716
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":751
  *         self.ptr = NULL
  *     def __dealloc__(self):
  *         NI_FreeCoordinateList(self.ptr)             # <<<<<<<<<<<<<<
@@ -4524,7 +4721,7 @@ ref struct CoordinateListWrapper {
   ~CoordinateListWrapper() { this->!CoordinateListWrapper(); }
 };
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":718
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":753
  *         NI_FreeCoordinateList(self.ptr)
  * 
  * def binary_erosion(object input, object strct, object mask, object output,             # <<<<<<<<<<<<<<
@@ -4561,14 +4758,14 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_strct = strct;
   __pyx_v_mask = mask;
   __pyx_v_output = output;
-  __pyx_v_border_value = __site_cvt_cvt_int_718_0->Target(__site_cvt_cvt_int_718_0, border_value);
+  __pyx_v_border_value = __site_cvt_cvt_int_753_0->Target(__site_cvt_cvt_int_753_0, border_value);
   __pyx_v_origins = origins;
-  __pyx_v_invert = __site_cvt_cvt_int_718_0_1->Target(__site_cvt_cvt_int_718_0_1, invert);
-  __pyx_v_center_is_true = __site_cvt_cvt_int_718_0_2->Target(__site_cvt_cvt_int_718_0_2, center_is_true);
-  __pyx_v_return_coordinates = __site_cvt_cvt_int_718_0_3->Target(__site_cvt_cvt_int_718_0_3, return_coordinates);
+  __pyx_v_invert = __site_cvt_cvt_int_753_0_1->Target(__site_cvt_cvt_int_753_0_1, invert);
+  __pyx_v_center_is_true = __site_cvt_cvt_int_753_0_2->Target(__site_cvt_cvt_int_753_0_2, center_is_true);
+  __pyx_v_return_coordinates = __site_cvt_cvt_int_753_0_3->Target(__site_cvt_cvt_int_753_0_3, return_coordinates);
   __pyx_v_colist_wrapper = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":721
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":756
  *                    int border_value, object origins, int invert,
  *                    int center_is_true, int return_coordinates):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)             # <<<<<<<<<<<<<<
@@ -4579,7 +4776,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_input_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":722
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":757
  *                    int center_is_true, int return_coordinates):
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)             # <<<<<<<<<<<<<<
@@ -4590,7 +4787,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_strct_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":723
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":758
  *     cdef ndarray input_ = NI_ObjectToInputArray(input)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)             # <<<<<<<<<<<<<<
@@ -4611,7 +4808,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_mask_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":724
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":759
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)             # <<<<<<<<<<<<<<
@@ -4622,7 +4819,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_output_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":725
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":760
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)
  *     cdef ndarray output_ = NI_ObjectToOutputArray(output)
  *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -4633,7 +4830,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   __pyx_v_origins_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":727
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":762
  *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
  *     cdef int changed
  *     cdef NI_CoordinateList *coordinate_list = NULL             # <<<<<<<<<<<<<<
@@ -4642,7 +4839,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
  */
   __pyx_v_coordinate_list = NULL;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":730
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":765
  *     NI_BinaryErosion(ARRAY(input_),
  *                      ARRAY(strct_),
  *                      <NpyArray*>NULL if mask_ is None else ARRAY(mask_),             # <<<<<<<<<<<<<<
@@ -4656,7 +4853,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
     __pyx_t_4 = ARRAY(__pyx_v_mask_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":737
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":772
  *                      center_is_true,
  *                      &changed,
  *                      &coordinate_list if return_coordinates else NULL)             # <<<<<<<<<<<<<<
@@ -4670,7 +4867,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   }
   __pyx_t_6 = NI_BinaryErosion(ARRAY(__pyx_v_input_), ARRAY(__pyx_v_strct_), __pyx_t_4, ARRAY(__pyx_v_output_), __pyx_v_border_value, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origins_))), __pyx_v_invert, __pyx_v_center_is_true, (&__pyx_v_changed), __pyx_t_5); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":738
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":773
  *                      &changed,
  *                      &coordinate_list if return_coordinates else NULL)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -4679,7 +4876,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
  */
   NumpyDotNet::NpyCoreApi::CheckError();
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":739
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":774
  *                      &coordinate_list if return_coordinates else NULL)
  *     CheckError()
  *     if return_coordinates:             # <<<<<<<<<<<<<<
@@ -4688,18 +4885,18 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
  */
   if (__pyx_v_return_coordinates) {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":740
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":775
  *     CheckError()
  *     if return_coordinates:
  *         colist_wrapper = CoordinateListWrapper()             # <<<<<<<<<<<<<<
  *         colist_wrapper.ptr = coordinate_list
  *         return changed, colist_wrapper
  */
-    __pyx_t_1 = __site_call0_740_46->Target(__site_call0_740_46, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CoordinateListWrapper)));
+    __pyx_t_1 = __site_call0_775_46->Target(__site_call0_775_46, __pyx_context, ((System::Object^)((System::Object^)__pyx_ptype_5scipy_7ndimage_9_nd_image_CoordinateListWrapper)));
     __pyx_v_colist_wrapper = ((CoordinateListWrapper^)__pyx_t_1);
     __pyx_t_1 = nullptr;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":741
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":776
  *     if return_coordinates:
  *         colist_wrapper = CoordinateListWrapper()
  *         colist_wrapper.ptr = coordinate_list             # <<<<<<<<<<<<<<
@@ -4708,7 +4905,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
  */
     __pyx_v_colist_wrapper->ptr = __pyx_v_coordinate_list;
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":742
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":777
  *         colist_wrapper = CoordinateListWrapper()
  *         colist_wrapper.ptr = coordinate_list
  *         return changed, colist_wrapper             # <<<<<<<<<<<<<<
@@ -4725,7 +4922,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   }
   /*else*/ {
 
-    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":744
+    /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":779
  *         return changed, colist_wrapper
  *     else:
  *         return changed             # <<<<<<<<<<<<<<
@@ -4744,7 +4941,7 @@ static System::Object^ binary_erosion(System::Object^ input, System::Object^ str
   return __pyx_r;
 }
 
-/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":746
+/* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":781
  *         return changed
  * 
  * def binary_erosion2(object array, object strct, object mask, int niter,             # <<<<<<<<<<<<<<
@@ -4774,15 +4971,15 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
   __pyx_v_array = array;
   __pyx_v_strct = strct;
   __pyx_v_mask = mask;
-  __pyx_v_niter = __site_cvt_cvt_int_746_0->Target(__site_cvt_cvt_int_746_0, niter);
+  __pyx_v_niter = __site_cvt_cvt_int_781_0->Target(__site_cvt_cvt_int_781_0, niter);
   __pyx_v_origins = origins;
-  __pyx_v_invert = __site_cvt_cvt_int_746_0_1->Target(__site_cvt_cvt_int_746_0_1, invert);
+  __pyx_v_invert = __site_cvt_cvt_int_781_0_1->Target(__site_cvt_cvt_int_781_0_1, invert);
   __pyx_v_colist_wrapper = ((CoordinateListWrapper^)colist_wrapper);
   if (unlikely(dynamic_cast<CoordinateListWrapper^>(__pyx_v_colist_wrapper) == nullptr)) {
     throw PythonOps::TypeError("Argument 'colist_wrapper' has incorrect type");
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":749
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":784
  *                     object origins, int invert,
  *                     CoordinateListWrapper colist_wrapper):
  *     cdef ndarray array_ = NI_ObjectToIoArray(array)             # <<<<<<<<<<<<<<
@@ -4793,7 +4990,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
   __pyx_v_array_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":750
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":785
  *                     CoordinateListWrapper colist_wrapper):
  *     cdef ndarray array_ = NI_ObjectToIoArray(array)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)             # <<<<<<<<<<<<<<
@@ -4804,7 +5001,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
   __pyx_v_strct_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":751
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":786
  *     cdef ndarray array_ = NI_ObjectToIoArray(array)
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)             # <<<<<<<<<<<<<<
@@ -4825,7 +5022,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
   __pyx_v_mask_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":752
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":787
  *     cdef ndarray strct_ = NI_ObjectToInputArray(strct)
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)
  *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)             # <<<<<<<<<<<<<<
@@ -4836,7 +5033,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
   __pyx_v_origins_ = ((NumpyDotNet::ndarray^)__pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":753
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":788
  *     cdef ndarray mask_ = None if mask is None else NI_ObjectToInputArray(mask)
  *     cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
  *     cdef NI_CoordinateList *ptr = colist_wrapper.ptr             # <<<<<<<<<<<<<<
@@ -4845,7 +5042,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
  */
   __pyx_v_ptr = __pyx_v_colist_wrapper->ptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":756
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":791
  *     NI_BinaryErosion2(ARRAY(array_),
  *                       ARRAY(strct_),
  *                       <NpyArray*>NULL if mask_ is None else ARRAY(mask_),             # <<<<<<<<<<<<<<
@@ -4859,7 +5056,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
     __pyx_t_4 = ARRAY(__pyx_v_mask_);
   }
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":760
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":795
  *                       <npy_intp*>NpyArray_DATA(ARRAY(origins_)),
  *                       invert,
  *                       &ptr)             # <<<<<<<<<<<<<<
@@ -4868,7 +5065,7 @@ static System::Object^ binary_erosion2(System::Object^ array, System::Object^ st
  */
   __pyx_t_5 = NI_BinaryErosion2(ARRAY(__pyx_v_array_), ARRAY(__pyx_v_strct_), __pyx_t_4, __pyx_v_niter, ((npy_intp *)NpyArray_DATA(ARRAY(__pyx_v_origins_))), __pyx_v_invert, (&__pyx_v_ptr)); 
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":761
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":796
  *                       invert,
  *                       &ptr)
  *     CheckError()             # <<<<<<<<<<<<<<
@@ -5681,114 +5878,117 @@ static void __Pyx_InitSites(CodeContext^ __pyx_context) {
   const int PythonOperationKind_TrueDivide = 25;
   const int PythonOperationKind_InPlaceFloorDivide = 0x20000000 | 23;
   const int PythonOperationKind_InPlaceTrueDivide = 0x20000000 | 25;
-  __site_get_AddReference_767_3 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "AddReference", false));
-  __site_call1_767_16 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_get_Array_187_40 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "Array", false));
-  __site_cvt_cvt_PY_LONG_LONG_187_40 = CallSite< System::Func< CallSite^, System::Object^, PY_LONG_LONG >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, PY_LONG_LONG::typeid, ConversionResultKind::ExplicitCast));
-  __site_get_Dtype_193_16 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "Dtype", false));
-  __site_call1_204_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_istrue_328_51 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_istrue_330_51 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_istrue_332_54 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_istrue_334_53 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_353_24 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_get_ndarray_362_31 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "ndarray", false));
-  __site_call2_362_21 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
-  __site_istrue_362_21 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_363_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call1_367_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_cvt_cvt_int_396_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_long_396_0 = CallSite< System::Func< CallSite^, System::Object^, long >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, long::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_396_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_396_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_405_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_405_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_411_24 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_cvt_cvt_npy_intp_418_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_get_AddReference_802_3 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "AddReference", false));
+  __site_call1_802_16 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_get_Array_190_40 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "Array", false));
+  __site_cvt_cvt_PY_LONG_LONG_190_40 = CallSite< System::Func< CallSite^, System::Object^, PY_LONG_LONG >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, PY_LONG_LONG::typeid, ConversionResultKind::ExplicitCast));
+  __site_get_Dtype_196_16 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "Dtype", false));
+  __site_call1_207_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_istrue_335_51 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_istrue_337_51 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_istrue_339_54 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_istrue_341_53 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_360_24 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_get_ndarray_369_31 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "ndarray", false));
+  __site_call2_369_21 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
+  __site_istrue_369_21 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_370_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call1_374_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_cvt_cvt_int_409_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_long_409_0 = CallSite< System::Func< CallSite^, System::Object^, long >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, long::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_409_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_409_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
   __site_cvt_cvt_int_418_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_418_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
   __site_cvt_cvt_double_418_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_418_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_427_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_427_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_427_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_427_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_427_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_427_0_2 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_437_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_437_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_437_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_455_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_455_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_455_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_istrue_477_26 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_478_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call2_479_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
-  __site_istrue_479_25 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_480_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call2_481_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
-  __site_istrue_481_25 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
-  __site_call1_482_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call2_ARGS_KWARGS_492_17 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
-  __site_cvt_cvt_npy_intp_495_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_495_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_495_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_495_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_495_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_call3_508_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
-  __site_call1_ARGS_KWARGS_521_22 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
-  __site_cvt_cvt_double_522_18 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_525_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_525_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_call3_538_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
-  __site_cvt_cvt_npy_intp_547_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_547_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_547_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_556_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_556_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_565_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_565_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_get_append_577_32 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "append", false));
-  __site_call1_577_39 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call1_578_17 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_call1_ARGS_KWARGS_579_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
-  __site_getindex_581_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeGetIndexAction(__pyx_context, 2));
-  __site_cvt_cvt_double_581_22 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_584_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_584_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_584_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_call3_603_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
-  __site_cvt_cvt_int_618_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_618_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_double_618_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_npy_intp_639_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_call0_653_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(0)));
-  __site_op_mul_658_24 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
-  __site_call1_659_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_get_iterator_659_8 = CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >::Create(PythonOps::MakeOperationAction(__pyx_context, PythonOperationKind_GetEnumeratorForIteration));
-  __site_op_mul_660_27 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
-  __site_cvt_cvt_npy_intp_660_18 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
-  __site_op_mul_662_29 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
-  __site_call1_663_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_get_iterator_663_16 = CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >::Create(PythonOps::MakeOperationAction(__pyx_context, PythonOperationKind_GetEnumeratorForIteration));
-  __site_op_add_664_44 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
-  __site_cvt_cvt_Py_ssize_t_664_44 = CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, Py_ssize_t::typeid, ConversionResultKind::ExplicitCast));
-  __site_op_add_664_63 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
-  __site_op_add_664_68 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
-  __site_cvt_cvt_Py_ssize_t_664_68 = CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, Py_ssize_t::typeid, ConversionResultKind::ExplicitCast));
-  __site_call3_664_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
-  __site_setindex_665_23 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
-  __site_call1_666_34 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
-  __site_setindex_666_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
-  __site_setindex_668_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
-  __site_cvt_cvt_int_682_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_718_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_718_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_718_0_2 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_718_0_3 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_call0_740_46 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(0)));
-  __site_cvt_cvt_int_746_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
-  __site_cvt_cvt_int_746_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_424_24 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_cvt_cvt_npy_intp_431_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_431_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_431_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_431_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_431_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_440_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_440_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_453_24 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_cvt_cvt_npy_intp_462_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_462_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_462_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_462_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_462_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_462_0_2 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_472_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_472_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_472_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_490_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_490_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_490_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_istrue_512_26 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_513_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call2_514_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
+  __site_istrue_514_25 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_515_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call2_516_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(2)));
+  __site_istrue_516_25 = CallSite< System::Func< CallSite^, System::Object^, bool >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, bool::typeid, ConversionResultKind::ExplicitCast));
+  __site_call1_517_30 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call2_ARGS_KWARGS_527_17 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
+  __site_cvt_cvt_npy_intp_530_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_530_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_530_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_530_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_530_0_1 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_call3_543_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
+  __site_call1_ARGS_KWARGS_556_22 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
+  __site_cvt_cvt_double_557_18 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_560_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_560_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_call3_573_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
+  __site_cvt_cvt_npy_intp_582_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_582_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_582_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_591_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_591_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_600_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_600_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_get_append_612_32 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "append", false));
+  __site_call1_612_39 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call1_613_17 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_call1_ARGS_KWARGS_614_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(gcnew array<Argument>{Argument::Simple, Argument(ArgumentType::List), Argument(ArgumentType::Dictionary)})));
+  __site_getindex_616_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeGetIndexAction(__pyx_context, 2));
+  __site_cvt_cvt_double_616_22 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_619_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_619_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_619_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_call3_638_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
+  __site_cvt_cvt_int_653_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_653_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_double_653_0 = CallSite< System::Func< CallSite^, System::Object^, double >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, double::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_npy_intp_674_0 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_call0_688_27 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(0)));
+  __site_op_mul_693_24 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
+  __site_call1_694_23 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_get_iterator_694_8 = CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >::Create(PythonOps::MakeOperationAction(__pyx_context, PythonOperationKind_GetEnumeratorForIteration));
+  __site_op_mul_695_27 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
+  __site_cvt_cvt_npy_intp_695_18 = CallSite< System::Func< CallSite^, System::Object^, npy_intp >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, npy_intp::typeid, ConversionResultKind::ExplicitCast));
+  __site_op_mul_697_29 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Multiply));
+  __site_call1_698_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_get_iterator_698_16 = CallSite< System::Func< CallSite^, System::Object^, System::Collections::Generic::KeyValuePair<System::Collections::IEnumerator^, System::IDisposable^> >^ >::Create(PythonOps::MakeOperationAction(__pyx_context, PythonOperationKind_GetEnumeratorForIteration));
+  __site_op_add_699_44 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
+  __site_cvt_cvt_Py_ssize_t_699_44 = CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, Py_ssize_t::typeid, ConversionResultKind::ExplicitCast));
+  __site_op_add_699_63 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
+  __site_op_add_699_68 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeBinaryOperationAction(__pyx_context, ExpressionType::Add));
+  __site_cvt_cvt_Py_ssize_t_699_68 = CallSite< System::Func< CallSite^, System::Object^, Py_ssize_t >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, Py_ssize_t::typeid, ConversionResultKind::ExplicitCast));
+  __site_call3_699_31 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(3)));
+  __site_setindex_700_23 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
+  __site_call1_701_34 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
+  __site_setindex_701_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
+  __site_setindex_703_22 = CallSite< System::Func< CallSite^, System::Object^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeSetIndexAction(__pyx_context, 2));
+  __site_cvt_cvt_int_717_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_753_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_753_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_753_0_2 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_753_0_3 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_call0_775_46 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(0)));
+  __site_cvt_cvt_int_781_0 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
+  __site_cvt_cvt_int_781_0_1 = CallSite< System::Func< CallSite^, System::Object^, int >^ >::Create(PythonOps::MakeConversionAction(__pyx_context, int::typeid, ConversionResultKind::ExplicitCast));
   __site_get_append_243_18 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "append", false));
   __site_call1_243_25 = CallSite< System::Func< CallSite^, CodeContext^, System::Object^, System::Object^, System::Object^ >^ >::Create(PythonOps::MakeInvokeAction(__pyx_context, CallSignature(1)));
   __site_get_zeros_245_16 = CallSite< System::Func< CallSite^, System::Object^, CodeContext^, System::Object^ >^ >::Create(PythonOps::MakeGetAction(__pyx_context, "zeros", false));
@@ -5859,7 +6059,7 @@ static void PerformModuleReload(PythonContext^ context, PythonDictionary^ dict)
   PythonOps::SetGlobal(__pyx_context, "np", __pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":230
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":233
  *                        itemsize, flags, NULL)
  * 
  * import_array()             # <<<<<<<<<<<<<<
@@ -5868,7 +6068,7 @@ static void PerformModuleReload(PythonContext^ context, PythonDictionary^ dict)
  */
   import_array();
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":766
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":801
  * # capsule not implemented yet (npy3_compat.h versions)
  * 
  * import clr             # <<<<<<<<<<<<<<
@@ -5878,15 +6078,15 @@ static void PerformModuleReload(PythonContext^ context, PythonDictionary^ dict)
   PythonOps::SetGlobal(__pyx_context, "clr", __pyx_t_1);
   __pyx_t_1 = nullptr;
 
-  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":767
+  /* "/home/cwitty/git-scipy/scipy-refactor/scipy/ndimage/_nd_image.pyx":802
  * 
  * import clr
  * clr.AddReference('IronPython')             # <<<<<<<<<<<<<<
  */
   __pyx_t_1 = PythonOps::GetGlobal(__pyx_context, "clr");
-  __pyx_t_2 = __site_get_AddReference_767_3->Target(__site_get_AddReference_767_3, __pyx_t_1, __pyx_context);
+  __pyx_t_2 = __site_get_AddReference_802_3->Target(__site_get_AddReference_802_3, __pyx_t_1, __pyx_context);
   __pyx_t_1 = nullptr;
-  __pyx_t_1 = __site_call1_767_16->Target(__site_call1_767_16, __pyx_context, __pyx_t_2, ((System::Object^)"IronPython"));
+  __pyx_t_1 = __site_call1_802_16->Target(__site_call1_802_16, __pyx_context, __pyx_t_2, ((System::Object^)"IronPython"));
   __pyx_t_2 = nullptr;
   __pyx_t_1 = nullptr;
 
@@ -163,6 +163,9 @@ IF not DOTNET:
             
     cdef inline void CheckError():
         pass
+
+    cdef extern from "parallel_api.h":
+        void *PARALLEL_API_FROM_C_API(object c_api) except? NULL
     
 
 ##     cdef inline bint is_capsule(obj):
@@ -250,6 +253,8 @@ cdef extern from "src/ni_support.h":
     NI_CoordinateList* NI_InitCoordinateList(int, int) except NULL
     int NI_CoordinateListStealBlocks(NI_CoordinateList*, NI_CoordinateList*) except 1
     void NI_FreeCoordinateList(NI_CoordinateList*)
+
+    int NI_SetParallelAPI(void*)
     
 cdef extern from "src/ni_filters.h":
     int NI_Correlate1D(NpyArray*, NpyArray*, int, NpyArray*,
@@ -258,6 +263,8 @@ cdef extern from "src/ni_filters.h":
                      NI_ExtendMode, double, npy_intp*) except 0
     int NI_UniformFilter1D(NpyArray*, npy_intp, int, NpyArray*,
                            NI_ExtendMode, double, npy_intp) except 0
+    int NI_SeparableFilter(NpyArray*, NpyArray*, int, npy_intp*, npy_intp*,
+                           npy_intp*, NpyArray*, NI_ExtendMode, double) except 0
     int NI_MinOrMaxFilter1D(NpyArray*, npy_intp, int, NpyArray*,
                             NI_ExtendMode, double, npy_intp, int) except 0
     int NI_MinOrMaxFilter(NpyArray*, NpyArray*, NpyArray*,
@@ -393,6 +400,12 @@ cdef ndarray NI_ObjectToIoArray(object a):
 #
 # Wrappers
 #
+IF not DOTNET:
+    def _set_parallel_api(c_api):
+        # c_api is the capsule _C_API of scipy.sparse.sparsetools._parallel
+        if not NI_SetParallelAPI(PARALLEL_API_FROM_C_API(c_api)):
+            raise ImportError("scipy.sparse.sparsetools._parallel has the wrong version")
+
 def correlate1d(input, weights, int axis, output, NI_ExtendMode mode, double cval,
                 npy_intp origin):
     cdef ndarray input_ = NI_ObjectToInputArray(input)
@@ -424,6 +437,28 @@ def uniform_filter1d(object input, npy_intp filter_size, int axis,
                        ARRAY(output_), <NI_ExtendMode>mode, cval, origin)
     CheckError()
 
+def separable_filter(object input, object weights, object axes,
+                     object sizes, object origins, object output, int mode,
+                     double cval):
+    cdef ndarray input_ = NI_ObjectToInputArray(input)
+    cdef ndarray weights_ = None if weights is None else \
+                            NA_InputArray(weights, NPY_DOUBLE, NPY_CARRAY)
+    cdef ndarray output_ = NI_ObjectToOutputArray(output)
+    cdef ndarray axes_ = NA_InputArray(axes, NPY_INTP, NPY_CARRAY)
+    cdef ndarray sizes_ = NA_InputArray(sizes, NPY_INTP, NPY_CARRAY)
+    cdef ndarray origins_ = NA_InputArray(origins, NPY_INTP, NPY_CARRAY)
+    cdef int n_axes = NpyArray_SIZE(ARRAY(axes_))
+    if (NpyArray_SIZE(ARRAY(sizes_)) != n_axes or
+        NpyArray_SIZE(ARRAY(origins_)) != n_axes):
+        raise ValueError('axes, sizes and origins differ in length')
+    NI_SeparableFilter(ARRAY(input_),
+                       <NpyArray*>NULL if weights_ is None else ARRAY(weights_),
+                       n_axes, <npy_intp*>NpyArray_DATA(ARRAY(axes_)),
+                       <npy_intp*>NpyArray_DATA(ARRAY(sizes_)),
+                       <npy_intp*>NpyArray_DATA(ARRAY(origins_)),
+                       ARRAY(output_), <NI_ExtendMode>mode, cval)
+    CheckError()
+
 def min_or_max_filter1d(object input, npy_intp filter_size, int axis,
                         object output, int mode, double cval,
                         npy_intp origin, int minimum):
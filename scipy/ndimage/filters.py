@@ -92,6 +92,16 @@ docdict = {
 
 docfiller = doccer.filldoc(docdict)
 
+def _separable_filter_ok(input, output):
+    """Test if a sequence of one-dimensional filters can be applied in
+    one go by _nd_image.separable_filter. It keeps intermediate results
+    in double precision, which only floating point outputs can hold,
+    and it needs an output that does not overlap the input."""
+    return (output.dtype.type in (numpy.float32, numpy.float64) and
+            not numpy.iscomplexobj(input) and
+            not numpy.may_share_memory(input, output))
+
+
 @docfiller
 def correlate1d(input, weights, axis = -1, output = None, mode = "reflect",
                 cval = 0.0, origin = 0):
@@ -156,26 +166,9 @@ def convolve1d(input, weights, axis = -1, output = None, mode = "reflect",
     return correlate1d(input, weights, axis, output, mode, cval, origin)
 
 
-@docfiller
-def gaussian_filter1d(input, sigma, axis = -1, order = 0, output = None,
-                      mode = "reflect", cval = 0.0):
-    """One-dimensional Gaussian filter.
-
-    Parameters
-    ----------
-    %(input)s
-    sigma : scalar
-        standard deviation for Gaussian kernel
-    %(axis)s
-    order : {0, 1, 2, 3}, optional
-        An order of 0 corresponds to convolution with a Gaussian
-        kernel. An order of 1, 2, or 3 corresponds to convolution with
-        the first, second or third derivatives of a Gaussian. Higher
-        order derivatives are not implemented
-    %(output)s
-    %(mode)s
-    %(cval)s
-    """
+def _gaussian_kernel1d(sigma, order):
+    """Weights of a one-dimensional Gaussian filter, or of one of its
+    first three derivatives."""
     if order not in range(4):
         raise ValueError('Order outside 0..3 not implemented')
     sd = float(sigma)
@@ -217,6 +210,30 @@ def gaussian_filter1d(input, sigma, axis = -1, order = 0, output = None,
             tmp = (3.0 - x * x / sd) * x * weights[lw + ii] / sd2
             weights[lw + ii] = -tmp
             weights[lw - ii] = tmp
+    return weights
+
+
+@docfiller
+def gaussian_filter1d(input, sigma, axis = -1, order = 0, output = None,
+                      mode = "reflect", cval = 0.0):
+    """One-dimensional Gaussian filter.
+
+    Parameters
+    ----------
+    %(input)s
+    sigma : scalar
+        standard deviation for Gaussian kernel
+    %(axis)s
+    order : {0, 1, 2, 3}, optional
+        An order of 0 corresponds to convolution with a Gaussian
+        kernel. An order of 1, 2, or 3 corresponds to convolution with
+        the first, second or third derivatives of a Gaussian. Higher
+        order derivatives are not implemented
+    %(output)s
+    %(mode)s
+    %(cval)s
+    """
+    weights = _gaussian_kernel1d(sigma, order)
     return correlate1d(input, weights, axis, output, mode, cval, 0)
 
 
@@ -247,11 +264,13 @@ def gaussian_filter(input, sigma, order = 0, output = None,
     Notes
     -----
     The multi-dimensional filter is implemented as a sequence of
-    one-dimensional convolution filters. The intermediate arrays are
-    stored in the same data type as the output. Therefore, for output
-    types with a limited precision, the results may be imprecise
-    because intermediate results may be stored with insufficient
-    precision.
+    one-dimensional convolution filters. For floating point outputs,
+    the filters are applied together to one tile of the array at a time
+    and the intermediate results are kept in double precision.
+    Otherwise the intermediate arrays are stored in the same data type
+    as the output. Therefore, for output types with a limited
+    precision, the results may be imprecise because intermediate
+    results may be stored with insufficient precision.
     """
     input = numpy.asarray(input)
     output, return_value = _ni_support._get_output(output, input)
@@ -262,7 +281,15 @@ def gaussian_filter(input, sigma, order = 0, output = None,
     axes = range(input.ndim)
     axes = [(axes[ii], sigmas[ii], orders[ii])
                         for ii in range(len(axes)) if sigmas[ii] > 1e-15]
-    if len(axes) > 0:
+    if len(axes) > 0 and _separable_filter_ok(input, output):
+        weights = [_gaussian_kernel1d(sigma, order)
+                   for axis, sigma, order in axes]
+        mode = _ni_support._extend_mode_to_code(mode)
+        _nd_image.separable_filter(input, numpy.concatenate(weights),
+                                   [axis for axis, sigma, order in axes],
+                                   [len(w) for w in weights],
+                                   [0] * len(axes), output, mode, cval)
+    elif len(axes) > 0:
         for axis, sigma, order in axes:
             gaussian_filter1d(input, sigma, axis, order, output,
                               mode, cval)
@@ -700,10 +727,13 @@ def uniform_filter(input, size = 3, output = None, mode = "reflect",
     Notes
     -----
     The multi-dimensional filter is implemented as a sequence of
-    one-dimensional uniform filters. The intermediate arrays are stored
-    in the same data type as the output. Therefore, for output types
-    with a limited precision, the results may be imprecise because
-    intermediate results may be stored with insufficient precision.
+    one-dimensional uniform filters. For floating point outputs, the
+    filters are applied together to one tile of the array at a time and
+    the intermediate results are kept in double precision. Otherwise
+    the intermediate arrays are stored in the same data type as the
+    output. Therefore, for output types with a limited precision, the
+    results may be imprecise because intermediate results may be stored
+    with insufficient precision.
     """
     input = numpy.asarray(input)
     output, return_value = _ni_support._get_output(output, input)
@@ -712,7 +742,17 @@ def uniform_filter(input, size = 3, output = None, mode = "reflect",
     axes = range(input.ndim)
     axes = [(axes[ii], sizes[ii], origins[ii])
                            for ii in range(len(axes)) if sizes[ii] > 1]
-    if len(axes) > 0:
+    if len(axes) > 0 and _separable_filter_ok(input, output):
+        for axis, size, origin in axes:
+            if (size // 2 + origin < 0) or (size // 2 + origin > size):
+                raise ValueError('invalid origin')
+        mode = _ni_support._extend_mode_to_code(mode)
+        _nd_image.separable_filter(input, None,
+                                   [axis for axis, size, origin in axes],
+                                   [int(size) for axis, size, origin in axes],
+                                   [origin for axis, size, origin in axes],
+                                   output, mode, cval)
+    elif len(axes) > 0:
         for axis, size, origin in axes:
             uniform_filter1d(input, int(size), axis, output, mode,
                              cval, origin)
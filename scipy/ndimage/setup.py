@@ -3,15 +3,21 @@ from numpy.distutils.misc_util import Configuration
 from numpy import get_include
 
 def configuration(parent_package='', top_path=None):
+    from os.path import join
 
     config = Configuration('ndimage', parent_package, top_path)
 
+    # the filters run on the thread pool of scipy.sparse.sparsetools,
+    # described by parallel_api.h
+    sparsetools_dir = join('..', 'sparse', 'sparsetools')
+
     config.add_extension("_nd_image",
         sources=["_nd_image.c","src/ni_filters.c",
                  "src/ni_fourier.c","src/ni_interpolation.c",
                  "src/ni_measure.c",
                  "src/ni_morphology.c","src/ni_support.c"],
-        include_dirs=['src']+[get_include()],
+        include_dirs=['src', sparsetools_dir]+[get_include()],
+        depends=[join(sparsetools_dir, 'parallel_api.h')],
     )
 
     config.add_data_dir('tests')
@@ -32,9 +32,9 @@
 #include "ni_support.h"
 #include "ni_filters.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
-#define BUFFER_SIZE 256000
 
 static void NpyErr_NoMemory(void)
 {
@@ -42,21 +42,130 @@ static void NpyErr_NoMemory(void)
 }
 
 
-int NI_Correlate1D(NpyArray *input, NpyArray *weights,
-                                     int axis, NpyArray *output, NI_ExtendMode mode,
-                   double cval, npy_intp origin)
-{
-    int symmetric = 0, more;
-    npy_intp ii, jj, ll, lines, length, size1, size2, filter_size;
-    double *ibuffer = NULL, *obuffer = NULL;
+/* parameters of the line function of NI_Correlate1D: */
+typedef struct {
     npy_float64 *fw;
-    NI_LineBuffer iline_buffer, oline_buffer;
+    npy_intp size1, size2;
+    int symmetric;
+} NI_Correlate1DData;
+
+/* Define a correlation kernel for lines of the given type. iline points
+     to the extended input line, fw to the center of the weights. The
+     outer loops run over the weights and the inner loops over the output
+     elements, so that the compiler can vectorize them, and every output
+     element is summed in the same order as one weight after another: */
+#define NI_CORRELATE1D_KERNEL(_name, _type)                             \
+static void _name(_type *iline, _type *oline, npy_intp length,          \
+                  _type *fw, npy_intp size1, npy_intp size2,            \
+                  int symmetric)                                        \
+{                                                                       \
+    npy_intp jj, ll;                                                    \
+                                                                        \
+    iline += size1;                                                     \
+    if (symmetric > 0) {                                                \
+        for(ll = 0; ll < length; ll++)                                  \
+            oline[ll] = iline[ll] * fw[0];                              \
+        for(jj = -size1; jj < 0; jj++) {                                \
+            _type w = fw[jj], *p1 = iline + jj, *p2 = iline - jj;       \
+            for(ll = 0; ll < length; ll++)                              \
+                oline[ll] += (p1[ll] + p2[ll]) * w;                     \
+        }                                                               \
+    } else if (symmetric < 0) {                                         \
+        for(ll = 0; ll < length; ll++)                                  \
+            oline[ll] = iline[ll] * fw[0];                              \
+        for(jj = -size1; jj < 0; jj++) {                                \
+            _type w = fw[jj], *p1 = iline + jj, *p2 = iline - jj;       \
+            for(ll = 0; ll < length; ll++)                              \
+                oline[ll] += (p1[ll] - p2[ll]) * w;                     \
+        }                                                               \
+    } else {                                                            \
+        _type w = fw[size2], *p1 = iline + size2;                       \
+        for(ll = 0; ll < length; ll++)                                  \
+            oline[ll] = p1[ll] * w;                                     \
+        for(jj = -size1; jj < size2; jj++) {                            \
+            w = fw[jj];                                                 \
+            p1 = iline + jj;                                            \
+            for(ll = 0; ll < length; ll++)                              \
+                oline[ll] += p1[ll] * w;                                \
+        }                                                               \
+    }                                                                   \
+}
+
+NI_CORRELATE1D_KERNEL(NI_Correlate1DFloat64, npy_float64)
+NI_CORRELATE1D_KERNEL(NI_Correlate1DFloat32, npy_float32)
+NI_CORRELATE1D_KERNEL(NI_Correlate1DInt32, npy_int32)
+
+/* Define a kernel that correlates nb interleaved lines at once: element
+     ll of line kk is stored at ll * nb + kk. The inner loops run over the
+     lines: */
+#define NI_CORRELATE1D_ROWS_KERNEL(_name, _type)                        \
+static void _name(_type *iline, _type *oline, npy_intp length,          \
+                  npy_intp nb, _type *fw, npy_intp size1,               \
+                  npy_intp size2, int symmetric)                        \
+{                                                                       \
+    npy_intp jj, kk, ll;                                                \
+                                                                        \
+    iline += size1 * nb;                                                \
+    for(ll = 0; ll < length; ll++) {                                    \
+        _type *pc = iline + ll * nb, *po = oline + ll * nb, *p1, *p2;   \
+        if (symmetric > 0) {                                            \
+            for(kk = 0; kk < nb; kk++)                                  \
+                po[kk] = pc[kk] * fw[0];                                \
+            for(jj = -size1; jj < 0; jj++) {                            \
+                _type w = fw[jj];                                       \
+                p1 = pc + jj * nb;                                      \
+                p2 = pc - jj * nb;                                      \
+                for(kk = 0; kk < nb; kk++)                              \
+                    po[kk] += (p1[kk] + p2[kk]) * w;                    \
+            }                                                           \
+        } else if (symmetric < 0) {                                     \
+            for(kk = 0; kk < nb; kk++)                                  \
+                po[kk] = pc[kk] * fw[0];                                \
+            for(jj = -size1; jj < 0; jj++) {                            \
+                _type w = fw[jj];                                       \
+                p1 = pc + jj * nb;                                      \
+                p2 = pc - jj * nb;                                      \
+                for(kk = 0; kk < nb; kk++)                              \
+                    po[kk] += (p1[kk] - p2[kk]) * w;                    \
+            }                                                           \
+        } else {                                                        \
+            _type w = fw[size2];                                        \
+            p1 = pc + size2 * nb;                                       \
+            for(kk = 0; kk < nb; kk++)                                  \
+                po[kk] = p1[kk] * w;                                    \
+            for(jj = -size1; jj < size2; jj++) {                        \
+                w = fw[jj];                                             \
+                p1 = pc + jj * nb;                                      \
+                for(kk = 0; kk < nb; kk++)                              \
+                    po[kk] += p1[kk] * w;                               \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+}
+
+NI_CORRELATE1D_ROWS_KERNEL(NI_Correlate1DRowsFloat32, npy_float32)
+NI_CORRELATE1D_ROWS_KERNEL(NI_Correlate1DRowsInt32, npy_int32)
+
+static int NI_Correlate1DLine(double *iline, npy_intp ilen, double *oline,
+                              npy_intp length, void *data)
+{
+    NI_Correlate1DData *cd = (NI_Correlate1DData*)data;
+
+    NI_Correlate1DFloat64(iline, oline, length, cd->fw, cd->size1,
+                          cd->size2, cd->symmetric);
+    return 1;
+}
+
+/* Initialize the line function parameters of a correlation, testing
+     the weights for symmetry or anti-symmetry: */
+static void NI_InitCorrelate1DData(npy_float64 *fw, npy_intp filter_size,
+                                   NI_Correlate1DData *cd)
+{
+    int symmetric = 0;
+    npy_intp ii, size1, size2;
 
-    /* test for symmetry or anti-symmetry: */
-    filter_size = NpyArray_DIM(weights, 0);
     size1 = filter_size / 2;
     size2 = filter_size - size1 - 1;
-    fw = (void *)NpyArray_DATA(weights);
     if (filter_size & 0x1) {
         symmetric = 1;
         for(ii = 1; ii <= filter_size / 2; ii++) {
@@ -75,81 +184,383 @@ int NI_Correlate1D(NpyArray *input, NpyArray *weights,
             }
         }
     }
-    /* allocate and initialize the line buffers: */
-    lines = -1;
-    if (!NI_AllocateLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                         &lines, BUFFER_SIZE, &ibuffer))
+    cd->fw = fw + size1;
+    cd->size1 = size1;
+    cd->size2 = size2;
+    cd->symmetric = symmetric;
+}
+
+/* Map a position on a line of length len onto the line, as NI_ExtendLine
+     does for the boundary mode. -1 stands for the constant value: */
+static npy_intp NI_ExtendIndex(npy_intp in, npy_intp len, NI_ExtendMode mode)
+{
+    npy_intp period;
+
+    if (in >= 0 && in < len)
+        return in;
+    switch (mode) {
+    case NI_EXTEND_NEAREST:
+        return in < 0 ? 0 : len - 1;
+    case NI_EXTEND_WRAP:
+        in %= len;
+        return in < 0 ? in + len : in;
+    case NI_EXTEND_REFLECT:
+        period = 2 * len;
+        in %= period;
+        if (in < 0)
+            in += period;
+        return in < len ? in : period - 1 - in;
+    case NI_EXTEND_MIRROR:
+        if (len == 1)
+            return 0;
+        period = 2 * len - 2;
+        in %= period;
+        if (in < 0)
+            in += period;
+        return in < len ? in : period - in;
+    default:
+        return -1;
+    }
+}
+
+/* the largest number of lines correlated at once by the typed
+     correlation of NI_Correlate1D: */
+#define NI_CORRELATE1D_BLOCK 32
+
+/* parameters of the typed correlation of NI_Correlate1D, which filters
+     8- and 16-bit integer arrays with integral weights in 32-bit integer
+     arithmetic, and float32 arrays in single precision, without
+     converting the lines to double. Unless the lines run along the last
+     axis, up to block lines that are adjacent along the last axis are
+     filtered at once: */
+typedef struct {
+    NI_Iterator ii, io;
+    char *pi, *po;
+    npy_intp *index;
+    npy_intp length, size1, size2, istride, ostride, block;
+    int type, symmetric;
+    npy_int32 *iw, icval;
+    npy_float32 *fw, fcval;
+} NI_TypedCorrelate1DData;
+
+/* the lines filtered by one thread: */
+typedef struct {
+    NI_TypedCorrelate1DData *filter;
+    npy_intp start, end;
+    int status;
+} NI_TypedCorrelate1DTask;
+
+/* Copy nb adjacent lines, extended according to the index table, to an
+     interleaved buffer: */
+#define CASE_GATHER_LINES(_pi, _po, _index, _length, _stride, _bstride, \
+                          _nb, _cval, _type)                            \
+case t ## _type:                                                        \
+{                                                                       \
+    npy_intp _ii, _kk;                                                   \
+    for(_ii = 0; _ii < _length; _ii++) {                                  \
+        if (_index[_ii] < 0) {                                              \
+            for(_kk = 0; _kk < _nb; _kk++)                                    \
+                _po[_ii * _nb + _kk] = _cval;                                   \
+        } else {                                                            \
+            char *_p = _pi + _index[_ii] * _stride;                           \
+            for(_kk = 0; _kk < _nb; _kk++)                                    \
+                _po[_ii * _nb + _kk] = *(_type*)(_p + _kk * _bstride);          \
+        }                                                                   \
+    }                                                                     \
+}                                                                       \
+break
+
+#define CASE_SCATTER_LINES(_pi, _po, _length, _stride, _bstride, _nb, \
+                           _type)                                     \
+case t ## _type:                                                      \
+{                                                                     \
+    npy_intp _ii, _kk;                                                 \
+    for(_ii = 0; _ii < _length; _ii++) {                                \
+        char *_p = _po + _ii * _stride;                                   \
+        for(_kk = 0; _kk < _nb; _kk++)                                    \
+            *(_type*)(_p + _kk * _bstride) = (_type)_pi[_ii * _nb + _kk];   \
+    }                                                                   \
+}                                                                     \
+break
+
+static void NI_RunTypedCorrelate1DTask(void *ptask)
+{
+    NI_TypedCorrelate1DTask *task = (NI_TypedCorrelate1DTask*)ptask;
+    NI_TypedCorrelate1DData *fd = task->filter;
+    NI_Iterator ii = fd->ii, io = fd->io;
+    npy_intp line = task->start, length = fd->length, nb, block = fd->block;
+    npy_intp coordinates[NI_MAXDIM], ibstride = 0, obstride = 0;
+    npy_intp istride = fd->istride, ostride = fd->ostride;
+    npy_intp ext_length = length + fd->size1 + fd->size2;
+    char *pi, *po;
+    npy_int32 *il = NULL, *ol = NULL;
+    npy_float32 *fl, *gl;
+    int kk, last = ii.rank_m1;
+
+    task->status = 0;
+    /* the extended input lines and the output lines, in the type of the
+         accumulation, which is 32 bits wide in both cases: */
+    il = (npy_int32*)malloc(ext_length * block * sizeof(npy_int32));
+    ol = (npy_int32*)malloc(length * block * sizeof(npy_int32));
+    if (!il || !ol)
         goto exit;
-    if (!NI_AllocateLineBuffer(output, axis, 0, 0, &lines, BUFFER_SIZE,
-                                                         &obuffer))
+    fl = (npy_float32*)il;
+    gl = (npy_float32*)ol;
+    if (block > 1) {
+        ibstride = ii.strides[last];
+        obstride = io.strides[last];
+    }
+    for(kk = last; kk >= 0; kk--) {
+        coordinates[kk] = line % (ii.dimensions[kk] + 1);
+        line /= ii.dimensions[kk] + 1;
+    }
+    NI_ITERATOR_GOTO(ii, coordinates, fd->pi, pi);
+    NI_ITERATOR_GOTO(io, coordinates, fd->po, po);
+    for(line = task->start; line < task->end; line += nb) {
+        nb = 1;
+        if (block > 1) {
+            nb = ii.dimensions[last] + 1 - ii.coordinates[last];
+            if (nb > block)
+                nb = block;
+            if (nb > task->end - line)
+                nb = task->end - line;
+        }
+        switch (fd->type) {
+            CASE_GATHER_LINES(pi, il, fd->index, ext_length, istride,
+                              ibstride, nb, fd->icval, npy_uint8);
+            CASE_GATHER_LINES(pi, il, fd->index, ext_length, istride,
+                              ibstride, nb, fd->icval, npy_int8);
+            CASE_GATHER_LINES(pi, il, fd->index, ext_length, istride,
+                              ibstride, nb, fd->icval, npy_uint16);
+            CASE_GATHER_LINES(pi, il, fd->index, ext_length, istride,
+                              ibstride, nb, fd->icval, npy_int16);
+            CASE_GATHER_LINES(pi, fl, fd->index, ext_length, istride,
+                              ibstride, nb, fd->fcval, npy_float32);
+        default:
+            break;
+        }
+        if (fd->type == tnpy_float32) {
+            if (nb > 1)
+                NI_Correlate1DRowsFloat32(fl, gl, length, nb,
+                                          fd->fw + fd->size1, fd->size1,
+                                          fd->size2, fd->symmetric);
+            else
+                NI_Correlate1DFloat32(fl, gl, length, fd->fw + fd->size1,
+                                      fd->size1, fd->size2, fd->symmetric);
+        } else {
+            if (nb > 1)
+                NI_Correlate1DRowsInt32(il, ol, length, nb,
+                                        fd->iw + fd->size1, fd->size1,
+                                        fd->size2, fd->symmetric);
+            else
+                NI_Correlate1DInt32(il, ol, length, fd->iw + fd->size1,
+                                    fd->size1, fd->size2, fd->symmetric);
+        }
+        switch (fd->type) {
+            CASE_SCATTER_LINES(ol, po, length, ostride, obstride, nb,
+                               npy_uint8);
+            CASE_SCATTER_LINES(ol, po, length, ostride, obstride, nb,
+                               npy_int8);
+            CASE_SCATTER_LINES(ol, po, length, ostride, obstride, nb,
+                               npy_uint16);
+            CASE_SCATTER_LINES(ol, po, length, ostride, obstride, nb,
+                               npy_int16);
+            CASE_SCATTER_LINES(gl, po, length, ostride, obstride, nb,
+                               npy_float32);
+        default:
+            break;
+        }
+        for(kk = 0; kk < nb; kk++)
+            NI_ITERATOR_NEXT2(ii, io, pi, po);
+    }
+    task->status = 1;
+
+ exit:
+    free(il);
+    free(ol);
+}
+
+/* Set up the typed correlation of NI_Correlate1D, if the arrays and the
+     weights allow it. The integer case must give exactly the result of
+     the double precision line filter: the weights and the constant value
+     must be integral, and the sums must fit in 32 bits: */
+static int NI_InitTypedCorrelate1D(NpyArray *input, NpyArray *output,
+                                   NI_Correlate1DData *cd, NI_ExtendMode mode,
+                                   double cval, NI_TypedCorrelate1DData *fd)
+{
+    npy_intp ii, filter_size = cd->size1 + cd->size2 + 1;
+    double sum = 0.0, max_value;
+    npy_float64 *fw = cd->fw - cd->size1;
+
+    fd->type = NpyArray_TYPE(input);
+    if (NpyArray_NDIM(input) < 1 || NpyArray_TYPE(output) != fd->type)
+        return 0;
+    switch (fd->type) {
+    case tnpy_uint8:
+        max_value = NPY_MAX_UINT8;
+        break;
+    case tnpy_int8:
+        max_value = -(double)NPY_MIN_INT8;
+        break;
+    case tnpy_uint16:
+        max_value = NPY_MAX_UINT16;
+        break;
+    case tnpy_int16:
+        max_value = -(double)NPY_MIN_INT16;
+        break;
+    case tnpy_float32:
+        return 1;
+    default:
+        return 0;
+    }
+    for(ii = 0; ii < filter_size; ii++) {
+        if (fabs(fw[ii]) > NPY_MAX_INT32 || fw[ii] != floor(fw[ii]))
+            return 0;
+        sum += fabs(fw[ii]);
+    }
+    if (mode == NI_EXTEND_CONSTANT && (cval != floor(cval) ||
+                                       fabs(cval) > max_value))
+        return 0;
+    return sum * max_value <= NPY_MAX_INT32;
+}
+
+int NI_Correlate1D(NpyArray *input, NpyArray *weights,
+                                     int axis, NpyArray *output, NI_ExtendMode mode,
+                   double cval, npy_intp origin)
+{
+    NI_Correlate1DData cd;
+    NI_TypedCorrelate1DData fd;
+    NI_TypedCorrelate1DTask *tasks = NULL;
+    npy_intp ii, filter_size, size = 1, lines;
+    int jj, n_tasks;
+
+    NI_InitCorrelate1DData((void *)NpyArray_DATA(weights),
+                           NpyArray_DIM(weights, 0), &cd);
+    fd.index = NULL;
+    fd.iw = NULL;
+    fd.fw = NULL;
+    if (mode < 0 || mode > NI_EXTEND_LAST ||
+        !NI_InitTypedCorrelate1D(input, output, &cd, mode, cval, &fd))
+        /* filter all the array lines: */
+        return NI_LineFilter(input, axis, cd.size1 + origin,
+                             cd.size2 - origin, mode, cval, output,
+                             NI_Correlate1DLine, &cd, 0);
+
+    for(jj = 0; jj < NpyArray_NDIM(input); jj++)
+        size *= NpyArray_DIM(input, jj);
+    fd.length = NpyArray_DIM(input, axis);
+    if (size < 1)
         goto exit;
-    if (!NI_InitLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                            lines, ibuffer, mode, cval, &iline_buffer))
+    lines = size / fd.length;
+    filter_size = cd.size1 + cd.size2 + 1;
+    fd.size1 = cd.size1;
+    fd.size2 = cd.size2;
+    fd.symmetric = cd.symmetric;
+    fd.index = (npy_intp*)malloc((fd.length + filter_size - 1) *
+                                 sizeof(npy_intp));
+    fd.iw = (npy_int32*)malloc(filter_size * sizeof(npy_int32));
+    fd.fw = (npy_float32*)malloc(filter_size * sizeof(npy_float32));
+    if (!fd.index || !fd.iw || !fd.fw) {
+        NpyErr_NoMemory();
         goto exit;
-    if (!NI_InitLineBuffer(output, axis, 0, 0, lines, obuffer, mode, 0.0,
-                                                 &oline_buffer))
+    }
+    for(ii = 0; ii < filter_size; ii++) {
+        double w = cd.fw[ii - cd.size1];
+        fd.iw[ii] = fd.type == tnpy_float32 ? 0 : (npy_int32)w;
+        fd.fw[ii] = (npy_float32)w;
+    }
+    fd.icval = fd.type == tnpy_float32 ? 0 : (npy_int32)cval;
+    fd.fcval = (npy_float32)cval;
+    /* the positions in the input line of the extended line: */
+    for(ii = 0; ii < fd.length + filter_size - 1; ii++)
+        fd.index[ii] = NI_ExtendIndex(ii - cd.size1 - origin, fd.length,
+                                      mode);
+    fd.istride = NpyArray_STRIDE(input, axis);
+    fd.block = 1;
+    if (axis < NpyArray_NDIM(input) - 1) {
+        fd.block = NpyArray_DIM(input, NpyArray_NDIM(input) - 1);
+        if (fd.block > NI_CORRELATE1D_BLOCK)
+            fd.block = NI_CORRELATE1D_BLOCK;
+    }
+    fd.ostride = NpyArray_STRIDE(output, axis);
+    NI_InitPointIterator(input, &fd.ii);
+    NI_LineIterator(&fd.ii, axis);
+    NI_InitPointIterator(output, &fd.io);
+    NI_LineIterator(&fd.io, axis);
+    fd.pi = (void *)NpyArray_DATA(input);
+    fd.po = (void *)NpyArray_DATA(output);
+
+    /* split the lines over the tasks: */
+    n_tasks = NI_NumTasks(size, lines);
+    tasks = (NI_TypedCorrelate1DTask*)malloc(n_tasks *
+                                            sizeof(NI_TypedCorrelate1DTask));
+    if (!tasks) {
+        NpyErr_NoMemory();
         goto exit;
-    length = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
-    fw += size1;
-    /* iterate over all the array lines: */
-    do {
-        /* copy lines from array to buffer: */
-        if (!NI_ArrayToLineBuffer(&iline_buffer, &lines, &more))
-            goto exit;
-        /* iterate over the lines in the buffers: */
-        for(ii = 0; ii < lines; ii++) {
-            /* get lines: */
-            double *iline = NI_GET_LINE(iline_buffer, ii) + size1;
-            double *oline = NI_GET_LINE(oline_buffer, ii);
-            /* the correlation calculation: */
-            if (symmetric > 0) {
-                for(ll = 0; ll < length; ll++) {
-                    oline[ll] = iline[0] * fw[0];
-                    for(jj = -size1 ; jj < 0; jj++)
-                        oline[ll] += (iline[jj] + iline[-jj]) * fw[jj];
-                    ++iline;
-                }
-            } else if (symmetric < 0) {
-                for(ll = 0; ll < length; ll++) {
-                    oline[ll] = iline[0] * fw[0];
-                    for(jj = -size1 ; jj < 0; jj++)
-                        oline[ll] += (iline[jj] - iline[-jj]) * fw[jj];
-                    ++iline;
-                }
-            } else {
-                for(ll = 0; ll < length; ll++) {
-                    oline[ll] = iline[size2] * fw[size2];
-                    for(jj = -size1; jj < size2; jj++)
-                        oline[ll] += iline[jj] * fw[jj];
-                    ++iline;
-                }
-            }
+    }
+    for(jj = 0; jj < n_tasks; jj++) {
+        tasks[jj].filter = &fd;
+        tasks[jj].start = (lines * jj) / n_tasks;
+        tasks[jj].end = (lines * (jj + 1)) / n_tasks;
+    }
+    NI_RunTasks(NI_RunTypedCorrelate1DTask, tasks,
+                sizeof(NI_TypedCorrelate1DTask), n_tasks);
+    for(jj = 0; jj < n_tasks; jj++) {
+        if (!tasks[jj].status) {
+            NpyErr_NoMemory();
+            break;
         }
-        /* copy lines from buffer to array: */
-        if (!NI_LineBufferToArray(&oline_buffer))
-            goto exit;
-    } while(more);
-exit:
-    if (ibuffer) free(ibuffer);
-    if (obuffer) free(obuffer);
+    }
+
+ exit:
+    if (fd.index) free(fd.index);
+    if (fd.iw) free(fd.iw);
+    if (fd.fw) free(fd.fw);
+    if (tasks) free(tasks);
     return NpyErr_Occurred() ? 0 : 1;
 }
 
-#define CASE_CORRELATE_POINT(_pi, _weights, _offsets, _filter_size, \
-                                                         _cvalue, _type, _res, _mv)             \
-case t ## _type:                                                    \
-{                                                                   \
-    npy_intp _ii, _offset;                                            \
-    for(_ii = 0; _ii < _filter_size; _ii++) {                         \
-        _offset = _offsets[_ii];                                        \
-        if (_offset == _mv)                                             \
-            _res += _weights[_ii] * _cvalue;                              \
-        else                                                            \
-            _res += _weights[_ii] * (double)*(_type*)(_pi + _offset);     \
-    }                                                                 \
-}                                                                   \
+/* Correlate a run of _run points along the last axis, which share their
+     filter offsets, one weight after another, so that the inner loops
+     over the points can be vectorized: */
+#define CASE_CORRELATE_RUN(_pi, _stride, _weights, _offsets, _filter_size, \
+                           _cvalue, _type, _res, _run, _mv)                \
+case t ## _type:                                                          \
+{                                                                         \
+    npy_intp _ii, _kk, _offset;                                           \
+    for(_kk = 0; _kk < _run; _kk++)                                       \
+        _res[_kk] = 0.0;                                                  \
+    for(_ii = 0; _ii < _filter_size; _ii++) {                             \
+        double _w = _weights[_ii];                                        \
+        _offset = _offsets[_ii];                                          \
+        if (_offset == _mv) {                                             \
+            for(_kk = 0; _kk < _run; _kk++)                               \
+                _res[_kk] += _w * _cvalue;                                \
+        } else if (_stride == sizeof(_type)) {                            \
+            _type *_p = (_type*)(_pi + _offset);                          \
+            for(_kk = 0; _kk < _run; _kk++)                               \
+                _res[_kk] += _w * (double)_p[_kk];                        \
+        } else {                                                          \
+            char *_p = _pi + _offset;                                     \
+            for(_kk = 0; _kk < _run; _kk++)                               \
+                _res[_kk] += _w * (double)*(_type*)(_p + _kk * _stride);  \
+        }                                                                 \
+    }                                                                     \
+}                                                                         \
+break
+
+#define CASE_FILTER_OUT_RUN(_po, _stride, _res, _run, _type) \
+case t ## _type:                                             \
+{                                                            \
+    npy_intp _kk;                                             \
+    for(_kk = 0; _kk < _run; _kk++)                            \
+        *(_type*)(_po + _kk * _stride) = (_type)_res[_kk];       \
+}                                                            \
 break
 
+/* the largest run of points correlated at once by NI_Correlate: */
+#define NI_CORRELATE_RUN 256
+
 #define CASE_FILTER_OUT(_po, _tmp, _type) \
 case t ## _type:                          \
     *(_type*)_po = (_type)_tmp;             \
@@ -161,13 +572,14 @@ int NI_Correlate(NpyArray* input, NpyArray* weights,
 {
     npy_bool *pf = NULL;
     npy_intp fsize, jj, kk, filter_size = 0, border_flag_value;
-    npy_intp *offsets = NULL, *oo, size;
+    npy_intp *offsets = NULL, *oo, size, run, istride = 0, ostride = 0;
     NI_FilterIterator fi;
     NI_Iterator ii, io;
     char *pi, *po;
     npy_float64 *pw;
     npy_float64 *ww = NULL;
-    int ll;
+    double *res = NULL;
+    int ll, last = NpyArray_NDIM(input) - 1;
 
     /* get the the footprint: */
     fsize = 1;
@@ -219,193 +631,717 @@ int NI_Correlate(NpyArray* input, NpyArray* weights,
     size = 1;
     for(ll = 0; ll < NpyArray_NDIM(input); ll++)
         size *= NpyArray_DIM(input, ll);
-    /* iterator over the elements: */
+    if (last >= 0) {
+        istride = NpyArray_STRIDE(input, last);
+        ostride = NpyArray_STRIDE(output, last);
+    }
+    res = (double*)malloc(NI_CORRELATE_RUN * sizeof(double));
+    if (!res) {
+        NpyErr_NoMemory();
+        goto exit;
+    }
+    /* iterator over the elements, in runs of points along the last axis
+         that use the same filter offsets: */
     oo = offsets;
-    for(jj = 0; jj < size; jj++) {
-        double tmp = 0.0;
+    for(jj = 0; jj < size; jj += run) {
+        run = 1;
+        if (last >= 0) {
+            npy_intp cc = ii.coordinates[last];
+            if (cc >= fi.bound1[last] && cc < fi.bound2[last]) {
+                run = (fi.bound2[last] < ii.dimensions[last] ?
+                       fi.bound2[last] : ii.dimensions[last]) - cc + 1;
+                if (run > NI_CORRELATE_RUN)
+                    run = NI_CORRELATE_RUN;
+            }
+        }
         switch (NpyArray_TYPE(input)) {
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_bool,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_uint8,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_uint16,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_uint32,
-                                                     tmp, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_bool, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_uint8, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_uint16, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_uint32, res, run, border_flag_value);
 #if HAS_UINT64
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_uint64,
-                                                     tmp, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_uint64, res, run, border_flag_value);
 #endif
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_int8,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_int16,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_int32,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_int64,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_float32,
-                                                     tmp, border_flag_value);
-            CASE_CORRELATE_POINT(pi, ww, oo, filter_size, cvalue, npy_float64,
-                                                     tmp, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_int8, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_int16, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_int32, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_int64, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_float32, res, run, border_flag_value);
+            CASE_CORRELATE_RUN(pi, istride, ww, oo, filter_size, cvalue,
+                               npy_float64, res, run, border_flag_value);
         default:
             NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
             goto exit;
         }
         switch (NpyArray_TYPE(output)) {
-            CASE_FILTER_OUT(po, tmp, npy_bool);
-            CASE_FILTER_OUT(po, tmp, npy_uint8);
-            CASE_FILTER_OUT(po, tmp, npy_uint16);
-            CASE_FILTER_OUT(po, tmp, npy_uint32);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_bool);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_uint8);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_uint16);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_uint32);
 #if HAS_UINT64
-            CASE_FILTER_OUT(po, tmp, npy_uint64);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_uint64);
 #endif
-            CASE_FILTER_OUT(po, tmp, npy_int8);
-            CASE_FILTER_OUT(po, tmp, npy_int16);
-            CASE_FILTER_OUT(po, tmp, npy_int32);
-            CASE_FILTER_OUT(po, tmp, npy_int64);
-            CASE_FILTER_OUT(po, tmp, npy_float32);
-            CASE_FILTER_OUT(po, tmp, npy_float64);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_int8);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_int16);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_int32);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_int64);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_float32);
+            CASE_FILTER_OUT_RUN(po, ostride, res, run, npy_float64);
         default:
             NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
             goto exit;
         }
-        NI_FILTER_NEXT2(fi, ii, io, oo, pi, po);
+        for(kk = 0; kk < run; kk++)
+            NI_FILTER_NEXT2(fi, ii, io, oo, pi, po);
     }
 exit:
     if (offsets) free(offsets);
     if (ww) free(ww);
     if (pf) free(pf);
+    if (res) free(res);
     return NpyErr_Occurred() ? 0 : 1;
 }
 
+static int NI_UniformFilter1DLine(double *iline, npy_intp ilen,
+                                  double *oline, npy_intp length, void *data)
+{
+    npy_intp ll, filter_size = *(npy_intp*)data;
+    double tmp = 0.0;
+    double *l1 = iline;
+    double *l2 = iline + filter_size;
+
+    /* do the uniform filter: */
+    for(ll = 0; ll < filter_size; ll++)
+        tmp += iline[ll];
+    tmp /= (double)filter_size;
+    oline[0] = tmp;
+    for(ll = 1; ll < length; ll++) {
+        tmp += (*l2++ - *l1++) / (double)filter_size;
+        oline[ll] = tmp;
+    }
+    return 1;
+}
+
 int
 NI_UniformFilter1D(NpyArray *input, npy_intp filter_size,
                                      int axis, NpyArray *output, NI_ExtendMode mode,
                    double cval, npy_intp origin)
 {
-    npy_intp lines, kk, ll, length, size1, size2;
-    int more;
-    double *ibuffer = NULL, *obuffer = NULL;
-    NI_LineBuffer iline_buffer, oline_buffer;
+    npy_intp size1, size2;
 
     size1 = filter_size / 2;
     size2 = filter_size - size1 - 1;
-    /* allocate and initialize the line buffers: */
-    lines = -1;
-    if (!NI_AllocateLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                         &lines, BUFFER_SIZE, &ibuffer))
-        goto exit;
-    if (!NI_AllocateLineBuffer(output, axis, 0, 0, &lines, BUFFER_SIZE,
-                                                         &obuffer))
-        goto exit;
-    if (!NI_InitLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                            lines, ibuffer, mode, cval, &iline_buffer))
-        goto exit;
-    if (!NI_InitLineBuffer(output, axis, 0, 0, lines, obuffer, mode, 0.0,
-                                                 &oline_buffer))
+    /* filter all the array lines: */
+    return NI_LineFilter(input, axis, size1 + origin, size2 - origin, mode,
+                         cval, output, NI_UniformFilter1DLine, &filter_size, 0);
+}
+
+/* size in elements of the largest tile buffer of NI_SeparableFilter, and
+     the largest relative amount of work added by tiling: */
+#define NI_TILE_SIZE 65536
+#define NI_TILE_OVERHEAD 1.25
+
+/* one pass of NI_SeparableFilter, a correlation or a uniform filter
+     along an axis: */
+typedef struct {
+    int axis;
+    npy_intp size1, size2, filter_size;
+    NI_LineFunction function;
+    NI_Correlate1DData cd;
+    void *data;
+} NI_SeparablePass;
+
+/* parameters of NI_SeparableFilter, shared by all tasks: */
+typedef struct {
+    NpyArray *input, *output;
+    NI_SeparablePass *passes;
+    int n_passes;
+    NI_ExtendMode mode;
+    double cval;
+    npy_intp tile[NI_MAXDIM], n_tiles[NI_MAXDIM];
+} NI_SeparableFilterData;
+
+/* the tiles filtered by one thread: */
+typedef struct {
+    NI_SeparableFilterData *filter;
+    npy_intp start, end;
+    int status;
+} NI_SeparableTask;
+
+/* The correlation of NI_Correlate1DLine applied to inner lines at once,
+     the elements of which are stored in rows: rows[kk] points to the
+     kk-th elements of the extended lines, and the kk-th elements of the
+     results are stored at out + kk * inner: */
+static void NI_Correlate1DRows(double **rows, double *out, npy_intp length,
+                               npy_intp inner, NI_Correlate1DData *cd)
+{
+    npy_float64 *fw = cd->fw;
+    npy_intp ii, jj, ll, size1 = cd->size1, size2 = cd->size2;
+
+    rows += size1;
+    for(ll = 0; ll < length; ll++) {
+        double *po = out + ll * inner, *p1, *p2;
+        if (cd->symmetric > 0) {
+            p1 = rows[ll];
+            for(ii = 0; ii < inner; ii++)
+                po[ii] = p1[ii] * fw[0];
+            for(jj = -size1; jj < 0; jj++) {
+                double w = fw[jj];
+                p1 = rows[ll + jj];
+                p2 = rows[ll - jj];
+                for(ii = 0; ii < inner; ii++)
+                    po[ii] += (p1[ii] + p2[ii]) * w;
+            }
+        } else if (cd->symmetric < 0) {
+            p1 = rows[ll];
+            for(ii = 0; ii < inner; ii++)
+                po[ii] = p1[ii] * fw[0];
+            for(jj = -size1; jj < 0; jj++) {
+                double w = fw[jj];
+                p1 = rows[ll + jj];
+                p2 = rows[ll - jj];
+                for(ii = 0; ii < inner; ii++)
+                    po[ii] += (p1[ii] - p2[ii]) * w;
+            }
+        } else {
+            double w = fw[size2];
+            p1 = rows[ll + size2];
+            for(ii = 0; ii < inner; ii++)
+                po[ii] = p1[ii] * w;
+            for(jj = -size1; jj < size2; jj++) {
+                w = fw[jj];
+                p1 = rows[ll + jj];
+                for(ii = 0; ii < inner; ii++)
+                    po[ii] += p1[ii] * w;
+            }
+        }
+    }
+}
+
+/* The uniform filter of NI_UniformFilter1DLine applied to inner lines
+     at once, with the same layout as NI_Correlate1DRows: */
+static void NI_UniformFilter1DRows(double **rows, double *out,
+                                   npy_intp length, npy_intp inner,
+                                   npy_intp filter_size)
+{
+    npy_intp ii, ll;
+
+    for(ii = 0; ii < inner; ii++)
+        out[ii] = 0.0;
+    for(ll = 0; ll < filter_size; ll++) {
+        double *pi = rows[ll];
+        for(ii = 0; ii < inner; ii++)
+            out[ii] += pi[ii];
+    }
+    for(ii = 0; ii < inner; ii++)
+        out[ii] /= (double)filter_size;
+    for(ll = 1; ll < length; ll++) {
+        double *l1 = rows[ll - 1], *l2 = rows[ll - 1 + filter_size];
+        double *po = out + ll * inner;
+        for(ii = 0; ii < inner; ii++)
+            po[ii] = po[ii - inner] + (l2[ii] - l1[ii]) / (double)filter_size;
+    }
+}
+
+#define CASE_COPY_DATA_TO_TILE(_pi, _po, _length, _stride, _type) \
+case t ## _type:                                                  \
+{                                                                 \
+    npy_intp _ii;                                                  \
+    for(_ii = 0; _ii < _length; _ii++) {                            \
+        _po[_ii] = (double)*(_type*)_pi;                              \
+        _pi += _stride;                                               \
+    }                                                               \
+}                                                                 \
+break
+
+#define CASE_COPY_TILE_TO_DATA(_pi, _po, _length, _stride, _type) \
+case t ## _type:                                                  \
+{                                                                 \
+    npy_intp _ii;                                                  \
+    for(_ii = 0; _ii < _length; _ii++) {                            \
+        *(_type*)_po = (_type)_pi[_ii];                               \
+        _po += _stride;                                               \
+    }                                                               \
+}                                                                 \
+break
+
+/* Copy the box [lo, hi) of an array to or from a contiguous buffer. The
+     array type must have been checked with NI_LineTypeSupported: */
+static void NI_CopyTile(NpyArray *array, npy_intp *lo, npy_intp *hi,
+                        double *buffer, int to_array)
+{
+    int ii, rank = NpyArray_NDIM(array);
+    npy_intp jj, rows = 1, length = 1, stride = 0;
+    npy_intp *strides = NpyArray_STRIDES(array), coordinates[NI_MAXDIM];
+
+    if (rank > 0) {
+        length = hi[rank - 1] - lo[rank - 1];
+        stride = strides[rank - 1];
+    }
+    for(ii = 0; ii < rank - 1; ii++) {
+        rows *= hi[ii] - lo[ii];
+        coordinates[ii] = lo[ii];
+    }
+    for(jj = 0; jj < rows; jj++) {
+        char *pa = (void *)NpyArray_DATA(array);
+        for(ii = 0; ii < rank - 1; ii++)
+            pa += coordinates[ii] * strides[ii];
+        if (rank > 0)
+            pa += lo[rank - 1] * stride;
+        if (to_array) {
+            switch (NpyArray_TYPE(array)) {
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_bool);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_uint8);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_uint16);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_uint32);
+#if HAS_UINT64
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_uint64);
+#endif
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_int8);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_int16);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_int32);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_int64);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_float32);
+                CASE_COPY_TILE_TO_DATA(buffer, pa, length, stride, npy_float64);
+            default:
+                break;
+            }
+        } else {
+            switch (NpyArray_TYPE(array)) {
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_bool);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_uint8);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_uint16);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_uint32);
+#if HAS_UINT64
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_uint64);
+#endif
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_int8);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_int16);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_int32);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_int64);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_float32);
+                CASE_COPY_DATA_TO_TILE(pa, buffer, length, stride, npy_float64);
+            default:
+                break;
+            }
+        }
+        buffer += length;
+        /* move to the next row of the box: */
+        for(ii = rank - 2; ii >= 0; ii--) {
+            if (++coordinates[ii] < hi[ii])
+                break;
+            coordinates[ii] = lo[ii];
+        }
+    }
+}
+
+/* The size of the largest box of a tile, and the number of values
+     loaded or computed per tile element: */
+static void NI_TileCost(int rank, npy_intp *dims, NI_SeparablePass *passes,
+                        int n_passes, npy_intp *tile, double *size,
+                        double *work)
+{
+    npy_intp box[NI_MAXDIM];
+    double volume = 1.0, tile_volume;
+    int ii, jj;
+
+    for(ii = 0; ii < rank; ii++) {
+        box[ii] = tile[ii];
+        volume *= tile[ii];
+    }
+    tile_volume = volume;
+    *size = volume;
+    *work = 0.0;
+    for(jj = n_passes - 1; jj >= 0; jj--) {
+        int axis = passes[jj].axis;
+        npy_intp extent = box[axis] + passes[jj].size1 + passes[jj].size2;
+        *work += volume;
+        if (extent > dims[axis])
+            extent = dims[axis];
+        volume = volume / box[axis] * extent;
+        box[axis] = extent;
+        if (volume > *size)
+            *size = volume;
+    }
+    *work = (*work + volume) / tile_volume;
+}
+
+/* Choose the tile shape: the tiles are halved along one axis at a time
+     until all boxes of a tile fit in NI_TILE_SIZE elements, each time
+     along the axis that adds the least work for the margins of the
+     tiles. Tiles that would need more than NI_TILE_OVERHEAD times the
+     work of the whole array are not split further: */
+static void NI_SeparableTiles(int rank, npy_intp *dims,
+                              NI_SeparablePass *passes, int n_passes,
+                              npy_intp *tile)
+{
+    npy_intp trial[NI_MAXDIM];
+    double size, work, min_work, best_work = 0.0;
+    int ii, best;
+
+    for(ii = 0; ii < rank; ii++)
+        tile[ii] = dims[ii];
+    NI_TileCost(rank, dims, passes, n_passes, tile, &size, &min_work);
+    for(;;) {
+        NI_TileCost(rank, dims, passes, n_passes, tile, &size, &work);
+        if (size <= NI_TILE_SIZE)
+            break;
+        best = -1;
+        for(ii = 0; ii < rank; ii++) {
+            if (tile[ii] < 2)
+                continue;
+            memcpy(trial, tile, rank * sizeof(npy_intp));
+            trial[ii] = (tile[ii] + 1) / 2;
+            NI_TileCost(rank, dims, passes, n_passes, trial, &size, &work);
+            if (best < 0 || work < best_work) {
+                best = ii;
+                best_work = work;
+            }
+        }
+        if (best < 0 || best_work > NI_TILE_OVERHEAD * min_work)
+            break;
+        tile[best] = (tile[best] + 1) / 2;
+    }
+}
+
+static void NI_RunSeparableTask(void *ptask)
+{
+    NI_SeparableTask *task = (NI_SeparableTask*)ptask;
+    NI_SeparableFilterData *fd = task->filter;
+    NI_SeparablePass *passes = fd->passes;
+    int ii, jj, rank = NpyArray_NDIM(fd->input), n_passes = fd->n_passes;
+    npy_intp *dims = NpyArray_DIMS(fd->input);
+    npy_intp tt, kk, capacity = 0, line_length = 1;
+    npy_intp *lo = NULL, *hi = NULL;
+    double *buffer1 = NULL, *buffer2 = NULL, *constant = NULL;
+    double *iline = NULL, **rows = NULL;
+
+    task->status = 0;
+    for(jj = 0; jj < n_passes; jj++) {
+        npy_intp length = dims[passes[jj].axis] + passes[jj].size1 +
+                          passes[jj].size2;
+        if (length > line_length)
+            line_length = length;
+    }
+    /* the boxes of a tile, the first one is loaded from the input, and
+         the last one is the tile itself: */
+    lo = (npy_intp*)malloc((2 * (n_passes + 1) * rank + 1) *
+                           sizeof(npy_intp));
+    rows = (double**)malloc(line_length * sizeof(double*));
+    iline = (double*)malloc(line_length * sizeof(double));
+    if (!lo || !rows || !iline)
         goto exit;
-    length = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
+    hi = lo + (n_passes + 1) * rank;
 
-    /* iterate over all the array lines: */
-    do {
-        /* copy lines from array to buffer: */
-        if (!NI_ArrayToLineBuffer(&iline_buffer, &lines, &more))
-            goto exit;
-        /* iterate over the lines in the buffers: */
-        for(kk = 0; kk < lines; kk++) {
-            /* get lines: */
-            double *iline = NI_GET_LINE(iline_buffer, kk);
-            double *oline = NI_GET_LINE(oline_buffer, kk);
-            /* do the uniform filter: */
-            double tmp = 0.0;
-            double *l1 = iline;
-            double *l2 = iline + filter_size;
-            for(ll = 0; ll < filter_size; ll++)
-                tmp += iline[ll];
-            tmp /= (double)filter_size;
-            oline[0] = tmp;
-            for(ll = 1; ll < length; ll++) {
-                tmp += (*l2++ - *l1++) / (double)filter_size;
-                oline[ll] = tmp;
+    for(tt = task->start; tt < task->end; tt++) {
+        npy_intp *tlo = lo + n_passes * rank, *thi = hi + n_passes * rank;
+        npy_intp need = 1, rem = tt;
+
+        for(ii = rank - 1; ii >= 0; ii--) {
+            tlo[ii] = (rem % fd->n_tiles[ii]) * fd->tile[ii];
+            thi[ii] = tlo[ii] + fd->tile[ii];
+            if (thi[ii] > dims[ii])
+                thi[ii] = dims[ii];
+            need *= thi[ii] - tlo[ii];
+            rem /= fd->n_tiles[ii];
+        }
+        /* find the boxes needed by each pass, from the last one back to
+             the box loaded from the input: */
+        for(jj = n_passes - 1; jj >= 0; jj--) {
+            NI_SeparablePass *pass = passes + jj;
+            npy_intp *plo = lo + jj * rank, *phi = hi + jj * rank;
+            npy_intp mn = dims[pass->axis], mx = -1, volume = 1;
+            int axis = pass->axis;
+
+            memcpy(plo, plo + rank, rank * sizeof(npy_intp));
+            memcpy(phi, phi + rank, rank * sizeof(npy_intp));
+            for(kk = plo[axis] - pass->size1; kk < phi[axis] + pass->size2;
+                kk++) {
+                npy_intp in = NI_ExtendIndex(kk, dims[axis], fd->mode);
+                if (in >= 0) {
+                    if (in < mn)
+                        mn = in;
+                    if (in > mx)
+                        mx = in;
+                }
+            }
+            if (mx >= mn) {
+                plo[axis] = mn;
+                phi[axis] = mx + 1;
+            } else {
+                phi[axis] = plo[axis];
             }
+            for(ii = 0; ii < rank; ii++)
+                volume *= phi[ii] - plo[ii];
+            if (volume > need)
+                need = volume;
         }
-        /* copy lines from buffer to array: */
-        if (!NI_LineBufferToArray(&oline_buffer))
-            goto exit;
-    } while(more);
+        if (need > capacity) {
+            free(buffer1);
+            free(buffer2);
+            free(constant);
+            buffer1 = (double*)malloc(need * sizeof(double));
+            buffer2 = (double*)malloc(need * sizeof(double));
+            constant = (double*)malloc(need * sizeof(double));
+            if (!buffer1 || !buffer2 || !constant)
+                goto exit;
+            for(kk = 0; kk < need; kk++)
+                constant[kk] = fd->cval;
+            capacity = need;
+        }
+
+        NI_CopyTile(fd->input, lo, hi, buffer1, 0);
+        for(jj = 0; jj < n_passes; jj++) {
+            NI_SeparablePass *pass = passes + jj;
+            npy_intp *plo = lo + jj * rank, *phi = hi + jj * rank;
+            npy_intp outer = 1, inner = 1, oo, in_length, out_length, length;
+            int axis = pass->axis;
+            double *tmp;
+
+            in_length = phi[axis] - plo[axis];
+            out_length = phi[axis + rank] - plo[axis + rank];
+            length = out_length + pass->size1 + pass->size2;
+            for(ii = 0; ii < axis; ii++)
+                outer *= phi[ii] - plo[ii];
+            for(ii = axis + 1; ii < rank; ii++)
+                inner *= phi[ii] - plo[ii];
+            for(oo = 0; oo < outer; oo++) {
+                double *pi = buffer1 + oo * in_length * inner;
+                double *po = buffer2 + oo * out_length * inner;
+                /* the rows of the extended lines in the input box: */
+                for(kk = 0; kk < length; kk++) {
+                    npy_intp in = NI_ExtendIndex(plo[axis + rank] -
+                                    pass->size1 + kk, dims[axis], fd->mode);
+                    rows[kk] = in < 0 ? constant :
+                                        pi + (in - plo[axis]) * inner;
+                }
+                if (inner > 1) {
+                    if (pass->function == NI_Correlate1DLine)
+                        NI_Correlate1DRows(rows, po, out_length, inner,
+                                           &pass->cd);
+                    else
+                        NI_UniformFilter1DRows(rows, po, out_length, inner,
+                                               pass->filter_size);
+                } else if (inner == 1) {
+                    for(kk = 0; kk < length; kk++)
+                        iline[kk] = *rows[kk];
+                    pass->function(iline, length, po, out_length,
+                                   pass->data);
+                }
+            }
+            tmp = buffer1;
+            buffer1 = buffer2;
+            buffer2 = tmp;
+        }
+        NI_CopyTile(fd->output, lo + n_passes * rank, hi + n_passes * rank,
+                    buffer1, 1);
+    }
+    task->status = 1;
 
  exit:
-    if (ibuffer) free(ibuffer);
-    if (obuffer) free(obuffer);
-    return NpyErr_Occurred() ? 0 : 1;
+    free(lo);
+    free(rows);
+    free(iline);
+    free(buffer1);
+    free(buffer2);
+    free(constant);
 }
 
-int
-NI_MinOrMaxFilter1D(NpyArray *input, npy_intp filter_size,
-                                        int axis, NpyArray *output, NI_ExtendMode mode,
-                    double cval, npy_intp origin, int minimum)
+/* Apply a sequence of one-dimensional correlations, or of uniform
+     filters if no weights are given, along the given axes. This is
+     equivalent to calling NI_Correlate1D or NI_UniformFilter1D for each
+     axis in turn with double precision intermediate arrays, but the
+     array is processed in tiles that pass through all the filters before
+     they are stored, so that no full-size intermediate array is needed.
+     The weights of the correlations are concatenated in one array: */
+int NI_SeparableFilter(NpyArray *input, NpyArray *weights, int n_axes,
+                       npy_intp *axes, npy_intp *sizes, npy_intp *origins,
+                       NpyArray *output, NI_ExtendMode mode, double cval)
 {
-    npy_intp lines, kk, jj, ll, length, size1, size2;
-    int more;
-    double *ibuffer = NULL, *obuffer = NULL;
-    NI_LineBuffer iline_buffer, oline_buffer;
+    NI_SeparableFilterData fd;
+    NI_SeparableTask *tasks = NULL;
+    npy_float64 *fw = NULL;
+    npy_intp size = 1, n_tiles = 1;
+    int ii, jj, n_tasks = 0, rank = NpyArray_NDIM(input);
 
-    size1 = filter_size / 2;
-    size2 = filter_size - size1 - 1;
-    /* allocate and initialize the line buffers: */
-    lines = -1;
-    if (!NI_AllocateLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                         &lines, BUFFER_SIZE, &ibuffer))
+    fd.passes = NULL;
+    if (!NI_LineTypeSupported(NpyArray_TYPE(input)) ||
+        !NI_LineTypeSupported(NpyArray_TYPE(output))) {
+        NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
         goto exit;
-    if (!NI_AllocateLineBuffer(output, axis, 0, 0, &lines, BUFFER_SIZE,
-                                                         &obuffer))
-        goto exit;
-    if (!NI_InitLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                             lines, ibuffer, mode, cval, &iline_buffer))
+    }
+    if (mode < 0 || mode > NI_EXTEND_LAST) {
+        NpyErr_SetString(NpyExc_RuntimeError, "mode not supported");
         goto exit;
-    if (!NI_InitLineBuffer(output, axis, 0, 0, lines, obuffer, mode, 0.0,
-                                                 &oline_buffer))
+    }
+    fd.passes = (NI_SeparablePass*)malloc((n_axes > 0 ? n_axes : 1) *
+                                          sizeof(NI_SeparablePass));
+    if (!fd.passes) {
+        NpyErr_NoMemory();
         goto exit;
-    length = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
-
-    /* iterate over all the array lines: */
-    do {
-        /* copy lines from array to buffer: */
-        if (!NI_ArrayToLineBuffer(&iline_buffer, &lines, &more))
+    }
+    if (weights)
+        fw = (void *)NpyArray_DATA(weights);
+    for(jj = 0; jj < n_axes; jj++) {
+        NI_SeparablePass *pass = fd.passes + jj;
+        if (axes[jj] < 0 || axes[jj] >= rank) {
+            NpyErr_SetString(NpyExc_RuntimeError, "invalid axis");
             goto exit;
-        /* iterate over the lines in the buffers: */
-        for(kk = 0; kk < lines; kk++) {
-            /* get lines: */
-            double *iline = NI_GET_LINE(iline_buffer, kk) + size1;
-            double *oline = NI_GET_LINE(oline_buffer, kk);
-            for(ll = 0; ll < length; ll++) {
-            /* find minimum or maximum filter: */
-                double val = iline[ll - size1];
-                for(jj = -size1 + 1; jj <= size2; jj++) {
-                    double tmp = iline[ll + jj];
-                    if (minimum) {
-                        if (tmp < val)
-                            val = tmp;
-                    } else {
-                        if (tmp > val)
-                            val = tmp;
-                    }
-                }
-                oline[ll] = val;
-            }
         }
-        /* copy lines from buffer to array: */
-        if (!NI_LineBufferToArray(&oline_buffer))
+        if (sizes[jj] < 1) {
+            NpyErr_SetString(NpyExc_RuntimeError, "incorrect filter size");
             goto exit;
-    } while(more);
+        }
+        pass->axis = (int)axes[jj];
+        pass->filter_size = sizes[jj];
+        pass->size1 = sizes[jj] / 2 + origins[jj];
+        pass->size2 = sizes[jj] - sizes[jj] / 2 - 1 - origins[jj];
+        if (fw) {
+            NI_InitCorrelate1DData(fw, sizes[jj], &pass->cd);
+            pass->function = NI_Correlate1DLine;
+            pass->data = &pass->cd;
+            fw += sizes[jj];
+        } else {
+            pass->function = NI_UniformFilter1DLine;
+            pass->data = &pass->filter_size;
+        }
+    }
+    for(ii = 0; ii < rank; ii++)
+        size *= NpyArray_DIM(input, ii);
+    if (size < 1)
+        goto exit;
+
+    fd.input = input;
+    fd.output = output;
+    fd.n_passes = n_axes;
+    fd.mode = mode;
+    fd.cval = cval;
+    NI_SeparableTiles(rank, NpyArray_DIMS(input), fd.passes, n_axes, fd.tile);
+    for(ii = 0; ii < rank; ii++) {
+        fd.n_tiles[ii] = (NpyArray_DIM(input, ii) + fd.tile[ii] - 1) /
+                         fd.tile[ii];
+        n_tiles *= fd.n_tiles[ii];
+    }
+
+    /* split the tiles over the tasks: */
+    n_tasks = NI_NumTasks(size, n_tiles);
+    tasks = (NI_SeparableTask*)malloc(n_tasks * sizeof(NI_SeparableTask));
+    if (!tasks) {
+        NpyErr_NoMemory();
+        goto exit;
+    }
+    for(ii = 0; ii < n_tasks; ii++) {
+        tasks[ii].filter = &fd;
+        tasks[ii].start = (n_tiles * ii) / n_tasks;
+        tasks[ii].end = (n_tiles * (ii + 1)) / n_tasks;
+    }
+    NI_RunTasks(NI_RunSeparableTask, tasks, sizeof(NI_SeparableTask),
+                n_tasks);
+    for(ii = 0; ii < n_tasks; ii++) {
+        if (!tasks[ii].status) {
+            NpyErr_NoMemory();
+            break;
+        }
+    }
 
  exit:
-    if (ibuffer) free(ibuffer);
-    if (obuffer) free(obuffer);
+    if (fd.passes) free(fd.passes);
+    if (tasks) free(tasks);
     return NpyErr_Occurred() ? 0 : 1;
 }
 
+/* parameters of the line function of NI_MinOrMaxFilter1D: */
+typedef struct {
+    npy_intp size1, size2;
+    int minimum;
+} NI_MinOrMaxFilter1DData;
+
+/* windows of at most this size are scanned directly by
+     NI_MinOrMaxFilter1DLine: */
+#define NI_MIN_OR_MAX_DIRECT 3
+
+/* Larger windows use the van Herk/Gil-Werman algorithm, which takes
+     three comparisons per element for any window size. The extended
+     line is divided into blocks of the window size, so that each window
+     consists of the end of one block and the start of the next. The
+     minima (maxima) of the block ends are stored in the output line, and
+     those of the block starts replace the extended line, which is not
+     needed afterwards. _op is < for a minimum and > for a maximum: */
+#define NI_MIN_OR_MAX_LINE(_iline, _ilen, _oline, _length, _size, _op) \
+{                                                                      \
+    npy_intp _jj, _ll;                                                 \
+    if (_size <= NI_MIN_OR_MAX_DIRECT) {                               \
+        for(_ll = 0; _ll < _length; _ll++) {                           \
+            double _val = _iline[_ll];                                 \
+            for(_jj = 1; _jj < _size; _jj++) {                         \
+                double _tmp = _iline[_ll + _jj];                       \
+                _val = _tmp _op _val ? _tmp : _val;                    \
+            }                                                          \
+            _oline[_ll] = _val;                                        \
+        }                                                              \
+    } else {                                                           \
+        for(_jj = 0; _jj < _length; _jj += _size) {                    \
+            double _val = _iline[_jj + _size - 1];                     \
+            for(_ll = _jj + _size - 1; _ll >= _length; _ll--)          \
+                _val = _iline[_ll] _op _val ? _iline[_ll] : _val;      \
+            for(; _ll >= _jj; _ll--) {                                 \
+                _val = _iline[_ll] _op _val ? _iline[_ll] : _val;      \
+                _oline[_ll] = _val;                                    \
+            }                                                          \
+        }                                                              \
+        for(_jj = 0; _jj < _ilen; _jj += _size) {                      \
+            npy_intp _end = _jj + _size < _ilen ? _jj + _size : _ilen; \
+            double _val = _iline[_jj];                                 \
+            for(_ll = _jj + 1; _ll < _end; _ll++) {                    \
+                _val = _val _op _iline[_ll] ? _val : _iline[_ll];      \
+                _iline[_ll] = _val;                                    \
+            }                                                          \
+        }                                                              \
+        for(_ll = 0; _ll < _length; _ll++) {                           \
+            double _tmp = _iline[_ll + _size - 1];                     \
+            _oline[_ll] = _tmp _op _oline[_ll] ? _tmp : _oline[_ll];   \
+        }                                                              \
+    }                                                                  \
+}
+
+static int NI_MinOrMaxFilter1DLine(double *iline, npy_intp ilen,
+                                   double *oline, npy_intp length, void *data)
+{
+    NI_MinOrMaxFilter1DData *md = (NI_MinOrMaxFilter1DData*)data;
+    npy_intp size = md->size1 + md->size2 + 1;
+
+    if (md->minimum)
+        NI_MIN_OR_MAX_LINE(iline, ilen, oline, length, size, <)
+    else
+        NI_MIN_OR_MAX_LINE(iline, ilen, oline, length, size, >)
+    return 1;
+}
+
+int
+NI_MinOrMaxFilter1D(NpyArray *input, npy_intp filter_size,
+                                        int axis, NpyArray *output, NI_ExtendMode mode,
+                    double cval, npy_intp origin, int minimum)
+{
+    NI_MinOrMaxFilter1DData md;
+
+    md.size1 = filter_size / 2;
+    md.size2 = filter_size - md.size1 - 1;
+    md.minimum = minimum;
+    /* filter all the array lines: */
+    return NI_LineFilter(input, axis, md.size1 + origin, md.size2 - origin,
+                         mode, cval, output, NI_MinOrMaxFilter1DLine, &md, 0);
+}
+
 
 #define CASE_MIN_OR_MAX_POINT(_pi, _offsets, _filter_size, _cval, \
                                                             _type, _minimum, _res, _mv, _ss)    \
@@ -600,18 +1536,369 @@ case t ## _type:                                                   \
 }                                                                  \
 break
 
+/* footprints with fewer points are always filtered with NI_Select: */
+#define NI_RANK_HISTOGRAM_SIZE 16
+
+/* The sliding histogram of NI_RankFilter. Along runs of points on the
+     last axis that share their filter offsets, the window of the next
+     point is that of the current point without the first point of each
+     footprint row, and with the point following each row. The histogram
+     is updated with those points only, instead of collecting and
+     selecting all points of each window.
+
+     The bins of 8- and 16-bit types are the values themselves. As in
+     Huang's algorithm, the bin of the last result and the number of
+     values below it are kept, and the next result is found by moving
+     from there, skipping blocks of bins using their sums (as proposed by
+     Perreault). The bins of other types are the ranks of the values in
+     a sorted table of all distinct values of the input array, and the
+     histogram is stored as a binary indexed tree, which finds the bin of
+     a given rank in logarithmic time: */
+typedef struct {
+    int type;
+    npy_intp n_bins, shift, offset, cval_bin, top;
+    npy_intp pos, below;
+    npy_int32 *fine, *coarse;
+    double *table;
+    npy_intp *add, *remove, n_add, n_remove;
+} NI_RankHistogram;
+
+static int NI_CompareDoubles(const void *a, const void *b)
+{
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* The bin of a value in the table of distinct values: */
+static npy_intp NI_RankTableBin(double *table, npy_intp n_bins, double value)
+{
+    npy_intp lo = 0, hi = n_bins - 1;
+
+    while (lo < hi) {
+        npy_intp mid = lo + (hi - lo) / 2;
+        if (table[mid] < value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void NI_RankHistogramChange(NI_RankHistogram *hist, npy_intp bin,
+                                   int delta)
+{
+    if (hist->table) {
+        for(bin += 1; bin <= hist->n_bins; bin += bin & -bin)
+            hist->fine[bin] += delta;
+    } else {
+        hist->fine[bin] += delta;
+        hist->coarse[bin >> hist->shift] += delta;
+        if (bin < hist->pos)
+            hist->below += delta;
+    }
+}
+
+/* Find the bin of the value of the given rank: */
+static npy_intp NI_RankHistogramSelect(NI_RankHistogram *hist, npy_intp rank)
+{
+    npy_intp pos, step, below, width;
+    npy_int32 *fine = hist->fine, *coarse = hist->coarse;
+
+    if (hist->table) {
+        pos = 0;
+        for(step = hist->top; step > 0; step >>= 1) {
+            if (pos + step <= hist->n_bins && fine[pos + step] <= rank) {
+                pos += step;
+                rank -= fine[pos];
+            }
+        }
+        return pos;
+    }
+    width = (npy_intp)1 << hist->shift;
+    pos = hist->pos;
+    below = hist->below;
+    while (below > rank) {
+        if ((pos & (width - 1)) == 0 &&
+            below - coarse[(pos >> hist->shift) - 1] > rank) {
+            pos -= width;
+            below -= coarse[pos >> hist->shift];
+        } else {
+            --pos;
+            below -= fine[pos];
+        }
+    }
+    while (below + fine[pos] <= rank) {
+        if ((pos & (width - 1)) == 0 &&
+            below + coarse[pos >> hist->shift] <= rank) {
+            below += coarse[pos >> hist->shift];
+            pos += width;
+        } else {
+            below += fine[pos];
+            ++pos;
+        }
+    }
+    hist->pos = pos;
+    hist->below = below;
+    return pos;
+}
+
+#define CASE_RANK_TABLE_VALUES(_pi, _table, _nn, _iterator, _type) \
+case t ## _type:                                                   \
+{                                                                  \
+    npy_intp _ii;                                                  \
+    for(_ii = 0; _ii < _nn; _ii++) {                               \
+        _table[_ii] = (double)*(_type*)_pi;                        \
+        NI_ITERATOR_NEXT(_iterator, _pi);                          \
+    }                                                              \
+}                                                                  \
+break
+
+#define CASE_RANK_CVAL(_cval, _res, _type) \
+case t ## _type:                           \
+    _res = (double)(_type)_cval;           \
+    break
+
+/* Set up the sliding histogram, if the type of the input and the
+     footprint make it worthwhile. Returns 0 if NI_Select should be
+     used, -1 on a memory error. NI_FreeRankHistogram must be called in
+     all cases: */
+static int NI_InitRankHistogram(NpyArray *input, npy_bool *pf,
+                                npy_intp *fshape, npy_intp filter_size,
+                                NI_ExtendMode mode, double cvalue,
+                                NI_RankHistogram *hist)
+{
+    int ll, rank = NpyArray_NDIM(input);
+    npy_intp fsize = 1, jj, kk, length, size = 1;
+    double cval = 0.0;
+
+    hist->table = NULL;
+    hist->fine = hist->coarse = NULL;
+    hist->add = NULL;
+    if (rank < 1 || filter_size < NI_RANK_HISTOGRAM_SIZE)
+        return 0;
+    for(ll = 0; ll < rank; ll++) {
+        fsize *= fshape[ll];
+        size *= NpyArray_DIM(input, ll);
+    }
+    if (size < 1)
+        return 0;
+    hist->type = NpyArray_TYPE(input);
+    switch (hist->type) {
+        CASE_RANK_CVAL(cvalue, cval, npy_uint8);
+        CASE_RANK_CVAL(cvalue, cval, npy_uint16);
+        CASE_RANK_CVAL(cvalue, cval, npy_uint32);
+#if HAS_UINT64
+        CASE_RANK_CVAL(cvalue, cval, npy_uint64);
+#endif
+        CASE_RANK_CVAL(cvalue, cval, npy_int8);
+        CASE_RANK_CVAL(cvalue, cval, npy_int16);
+        CASE_RANK_CVAL(cvalue, cval, npy_int32);
+        CASE_RANK_CVAL(cvalue, cval, npy_int64);
+        CASE_RANK_CVAL(cvalue, cval, npy_float32);
+        CASE_RANK_CVAL(cvalue, cval, npy_float64);
+    default:
+        return 0;
+    }
+    /* the footprint points that leave and enter the window when moving
+         along the last axis. The histogram pays off if they are a small
+         part of the footprint: */
+    length = fshape[rank - 1];
+    hist->n_add = hist->n_remove = 0;
+    for(jj = 0; jj < fsize; jj++) {
+        if (pf[jj]) {
+            if (jj % length == 0 || !pf[jj - 1])
+                ++hist->n_remove;
+            if (jj % length == length - 1 || !pf[jj + 1])
+                ++hist->n_add;
+        }
+    }
+    if (4 * hist->n_add > filter_size)
+        return 0;
+    switch (hist->type) {
+    case tnpy_uint8:
+    case tnpy_int8:
+        hist->n_bins = 256;
+        hist->shift = 4;
+        hist->offset = hist->type == tnpy_int8 ? 128 : 0;
+        break;
+    case tnpy_uint16:
+    case tnpy_int16:
+        hist->n_bins = 65536;
+        hist->shift = 8;
+        hist->offset = hist->type == tnpy_int16 ? 32768 : 0;
+        break;
+    default:
+        /* sorting the values is only worth the effort for larger
+             footprints: */
+        if (filter_size < 4 * NI_RANK_HISTOGRAM_SIZE)
+            return 0;
+        /* every update searches the table and walks the tree, both
+             logarithmic in the number of values: */
+        for(jj = 1, kk = 0; jj <= size; jj *= 2)
+            ++kk;
+        if (3 * hist->n_add * kk > 2 * filter_size)
+            return 0;
+        hist->n_bins = size + 1;
+        break;
+    }
+    hist->add = (npy_intp*)malloc((hist->n_add + hist->n_remove) *
+                                  sizeof(npy_intp));
+    if (!hist->add)
+        return -1;
+    hist->remove = hist->add + hist->n_add;
+    kk = 0;
+    for(jj = 0, ll = 0; jj < fsize; jj++) {
+        if (pf[jj]) {
+            if (jj % length == length - 1 || !pf[jj + 1])
+                hist->add[ll++] = kk;
+            ++kk;
+        }
+    }
+    kk = 0;
+    for(jj = 0, ll = 0; jj < fsize; jj++) {
+        if (pf[jj]) {
+            if (jj % length == 0 || !pf[jj - 1])
+                hist->remove[ll++] = kk;
+            ++kk;
+        }
+    }
+    if (hist->n_bins == size + 1) {
+        NI_Iterator ii;
+        char *pi = (void *)NpyArray_DATA(input);
+        double *table;
+
+        table = (double*)malloc(hist->n_bins * sizeof(double));
+        if (!table)
+            return -1;
+        hist->table = table;
+        NI_InitPointIterator(input, &ii);
+        switch (hist->type) {
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_uint32);
+#if HAS_UINT64
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_uint64);
+#endif
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_int32);
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_int64);
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_float32);
+            CASE_RANK_TABLE_VALUES(pi, table, size, ii, npy_float64);
+        default:
+            break;
+        }
+        table[size] = mode == NI_EXTEND_CONSTANT ? cval : table[0];
+        /* values that do not compare, such as NaN, are left to
+             NI_Select: */
+        for(jj = 0; jj <= size; jj++) {
+            if (table[jj] != table[jj])
+                return 0;
+        }
+        qsort(table, size + 1, sizeof(double), NI_CompareDoubles);
+        kk = 0;
+        for(jj = 1; jj <= size; jj++) {
+            if (table[jj] != table[kk])
+                table[++kk] = table[jj];
+        }
+        hist->n_bins = kk + 1;
+        for(hist->top = 1; 2 * hist->top <= hist->n_bins; hist->top *= 2)
+            ;
+        hist->cval_bin = NI_RankTableBin(table, hist->n_bins, cval);
+        hist->fine = (npy_int32*)calloc(hist->n_bins + 1, sizeof(npy_int32));
+        if (!hist->fine)
+            return -1;
+    } else {
+        hist->cval_bin = (npy_intp)cval + hist->offset;
+        hist->fine = (npy_int32*)calloc(hist->n_bins, sizeof(npy_int32));
+        hist->coarse = (npy_int32*)calloc(hist->n_bins >> hist->shift,
+                                          sizeof(npy_int32));
+        if (!hist->fine || !hist->coarse)
+            return -1;
+        hist->pos = 0;
+        hist->below = 0;
+    }
+    return 1;
+}
+
+static void NI_FreeRankHistogram(NI_RankHistogram *hist)
+{
+    free(hist->add);
+    free(hist->table);
+    free(hist->fine);
+    free(hist->coarse);
+}
+
+#define CASE_RANK_DIRECT(_pi, _offsets, _list, _nn, _mv, _hist, _delta, \
+                         _type)                                         \
+case t ## _type:                                                        \
+{                                                                       \
+    npy_intp _ii;                                                       \
+    for(_ii = 0; _ii < _nn; _ii++) {                                    \
+        npy_intp _offset = _offsets[_list ? _list[_ii] : _ii];          \
+        NI_RankHistogramChange(_hist, _offset == _mv ? _hist->cval_bin :\
+                    (npy_intp)*(_type*)(_pi + _offset) + _hist->offset, \
+                    _delta);                                            \
+    }                                                                   \
+}                                                                       \
+break
+
+#define CASE_RANK_TABLE(_pi, _offsets, _list, _nn, _mv, _hist, _delta, \
+                        _type)                                         \
+case t ## _type:                                                       \
+{                                                                      \
+    npy_intp _ii;                                                      \
+    for(_ii = 0; _ii < _nn; _ii++) {                                   \
+        npy_intp _offset = _offsets[_list ? _list[_ii] : _ii];         \
+        NI_RankHistogramChange(_hist, _offset == _mv ? _hist->cval_bin :\
+                    NI_RankTableBin(_hist->table, _hist->n_bins,       \
+                                (double)*(_type*)(_pi + _offset)),     \
+                    _delta);                                           \
+    }                                                                  \
+}                                                                      \
+break
+
+/* Add (delta = 1) or remove (delta = -1) the values at the listed
+     filter offsets, or at all of them if list is NULL: */
+static void NI_RankHistogramUpdate(NI_RankHistogram *hist, char *pi,
+                                   npy_intp *offsets, npy_intp *list,
+                                   npy_intp nn, npy_intp mv, int delta)
+{
+    switch (hist->type) {
+        CASE_RANK_DIRECT(pi, offsets, list, nn, mv, hist, delta, npy_uint8);
+        CASE_RANK_DIRECT(pi, offsets, list, nn, mv, hist, delta, npy_uint16);
+        CASE_RANK_DIRECT(pi, offsets, list, nn, mv, hist, delta, npy_int8);
+        CASE_RANK_DIRECT(pi, offsets, list, nn, mv, hist, delta, npy_int16);
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_uint32);
+#if HAS_UINT64
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_uint64);
+#endif
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_int32);
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_int64);
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_float32);
+        CASE_RANK_TABLE(pi, offsets, list, nn, mv, hist, delta, npy_float64);
+    default:
+        break;
+    }
+}
+
+/* The value of the given rank in the histogram: */
+static double NI_RankHistogramValue(NI_RankHistogram *hist, npy_intp rank)
+{
+    npy_intp bin = NI_RankHistogramSelect(hist, rank);
+
+    return hist->table ? hist->table[bin] : (double)(bin - hist->offset);
+}
+
 int NI_RankFilter(NpyArray* input, int rank,
                   NpyArray* footprint, NpyArray* output,
                   NI_ExtendMode mode, double cvalue, npy_intp *origins)
 {
     npy_intp fsize, jj, filter_size = 0, border_flag_value;
-    npy_intp *offsets = NULL, *oo, size;
+    npy_intp *offsets = NULL, *oo, size, run = 0;
     NI_FilterIterator fi;
     NI_Iterator ii, io;
+    NI_RankHistogram hist;
     char *pi, *po;
     npy_bool *pf = NULL;
     double *buffer = NULL;
-    int ll;
+    int ll, use_histogram, last = NpyArray_NDIM(input) - 1;
 
     /* get the the footprint: */
     fsize = 1;
@@ -623,6 +1910,13 @@ int NI_RankFilter(NpyArray* input, int rank,
             ++filter_size;
         }
     }
+    /* initialize the sliding histogram: */
+    use_histogram = NI_InitRankHistogram(input, pf, NpyArray_DIMS(footprint),
+                                         filter_size, mode, cvalue, &hist);
+    if (use_histogram < 0) {
+        NpyErr_NoMemory();
+        goto exit;
+    }
     /* buffer for rank calculation: */
     buffer = (double*)malloc(filter_size * sizeof(double));
     if (!buffer) {
@@ -655,34 +1949,49 @@ int NI_RankFilter(NpyArray* input, int rank,
     oo = offsets;
     for(jj = 0; jj < size; jj++) {
         double tmp = 0.0;
-        switch (NpyArray_TYPE(input)) {
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_bool,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint8,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint16,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint32,
-                                            rank, buffer, tmp, border_flag_value);
+        /* start a run of points along the last axis that share their
+             filter offsets, which are filtered with the histogram: */
+        if (use_histogram && run == 0) {
+            npy_intp cc = ii.coordinates[last];
+            if (cc >= fi.bound1[last] && cc < fi.bound2[last]) {
+                run = (fi.bound2[last] < ii.dimensions[last] ?
+                       fi.bound2[last] : ii.dimensions[last]) - cc + 1;
+                NI_RankHistogramUpdate(&hist, pi, oo, NULL, filter_size,
+                                       border_flag_value, 1);
+            }
+        }
+        if (run > 0) {
+            tmp = NI_RankHistogramValue(&hist, rank);
+        } else {
+            switch (NpyArray_TYPE(input)) {
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_bool,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint8,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint16,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint32,
+                                                rank, buffer, tmp, border_flag_value);
 #if HAS_UINT64
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint64,
-                                            rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_uint64,
+                                                rank, buffer, tmp, border_flag_value);
 #endif
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int8,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int16,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int32,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int64,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_float32,
-                                            rank, buffer, tmp, border_flag_value);
-            CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_float64,
-                                            rank, buffer, tmp, border_flag_value);
-        default:
-            NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
-            goto exit;
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int8,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int16,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int32,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_int64,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_float32,
+                                                rank, buffer, tmp, border_flag_value);
+                CASE_RANK_POINT(pi, oo, filter_size, cvalue, npy_float64,
+                                                rank, buffer, tmp, border_flag_value);
+            default:
+                NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
+                goto exit;
+            }
         }
         switch (NpyArray_TYPE(output)) {
             CASE_FILTER_OUT(po, tmp, npy_bool);
@@ -702,9 +2011,26 @@ int NI_RankFilter(NpyArray* input, int rank,
             NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
             goto exit;
         }
-        NI_FILTER_NEXT2(fi, ii, io, oo, pi, po);
+        if (run > 1) {
+            /* slide the window to the next point of the run: */
+            NI_RankHistogramUpdate(&hist, pi, oo, hist.remove, hist.n_remove,
+                                   border_flag_value, -1);
+            NI_FILTER_NEXT2(fi, ii, io, oo, pi, po);
+            NI_RankHistogramUpdate(&hist, pi, oo, hist.add, hist.n_add,
+                                   border_flag_value, 1);
+            --run;
+        } else {
+            /* at the end of a run, empty the histogram: */
+            if (run == 1) {
+                NI_RankHistogramUpdate(&hist, pi, oo, NULL, filter_size,
+                                       border_flag_value, -1);
+                run = 0;
+            }
+            NI_FILTER_NEXT2(fi, ii, io, oo, pi, po);
+        }
     }
 exit:
+    NI_FreeRankHistogram(&hist);
     if (offsets) free(offsets);
     if (buffer) free(buffer);
     return NpyErr_Occurred() ? 0 : 1;
@@ -715,53 +2041,14 @@ int NI_GenericFilter1D(NpyArray *input,
             void* data, npy_intp filter_size, int axis, NpyArray *output,
             NI_ExtendMode mode, double cval, npy_intp origin)
 {
-    int more;
-    npy_intp ii, lines, length, size1, size2;
-    double *ibuffer = NULL, *obuffer = NULL;
-    NI_LineBuffer iline_buffer, oline_buffer;
+    npy_intp size1, size2;
 
-    /* allocate and initialize the line buffers: */
     size1 = filter_size / 2;
     size2 = filter_size - size1 - 1;
-    lines = -1;
-    if (!NI_AllocateLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                         &lines, BUFFER_SIZE, &ibuffer))
-        goto exit;
-    if (!NI_AllocateLineBuffer(output, axis, 0, 0, &lines, BUFFER_SIZE,
-                                                         &obuffer))
-        goto exit;
-    if (!NI_InitLineBuffer(input, axis, size1 + origin, size2 - origin,
-                                                            lines, ibuffer, mode, cval, &iline_buffer))
-        goto exit;
-    if (!NI_InitLineBuffer(output, axis, 0, 0, lines, obuffer, mode, 0.0,
-                                                 &oline_buffer))
-        goto exit;
-    length = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
-    /* iterate over all the array lines: */
-    do {
-        /* copy lines from array to buffer: */
-        if (!NI_ArrayToLineBuffer(&iline_buffer, &lines, &more))
-            goto exit;
-        /* iterate over the lines in the buffers: */
-        for(ii = 0; ii < lines; ii++) {
-            /* get lines: */
-            double *iline = NI_GET_LINE(iline_buffer, ii);
-            double *oline = NI_GET_LINE(oline_buffer, ii);
-            if (!function(iline, length + size1 + size2, oline, length, data)) {
-                if (!NpyErr_Occurred())
-                    NpyErr_SetString(NpyExc_RuntimeError,
-                                     "unknown error in line processing function");
-                goto exit;
-            }
-        }
-        /* copy lines from buffer to array: */
-        if (!NI_LineBufferToArray(&oline_buffer))
-            goto exit;
-    } while(more);
-exit:
-    if (ibuffer) free(ibuffer);
-    if (obuffer) free(obuffer);
-    return NpyErr_Occurred() ? 0 : 1;
+    /* the function may call back into Python, so the lines are
+         processed on the calling thread: */
+    return NI_LineFilter(input, axis, size1 + origin, size2 - origin, mode,
+                         cval, output, function, data, NI_LINE_SERIAL);
 }
 
 #define CASE_FILTER_POINT(_pi, _offsets, _filter_size, _cvalue, _type, \
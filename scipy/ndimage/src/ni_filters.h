@@ -42,6 +42,8 @@ int NI_Correlate(NpyArray*, NpyArray*, NpyArray*,
                  NI_ExtendMode, double, npy_intp*);
 int NI_UniformFilter1D(NpyArray*, npy_intp, int, NpyArray*,
                        NI_ExtendMode, double, npy_intp);
+int NI_SeparableFilter(NpyArray*, NpyArray*, int, npy_intp*, npy_intp*,
+                       npy_intp*, NpyArray*, NI_ExtendMode, double);
 int NI_MinOrMaxFilter1D(NpyArray*, npy_intp, int, NpyArray*,
                         NI_ExtendMode, double, npy_intp, int);
 int NI_MinOrMaxFilter(NpyArray*, NpyArray*, NpyArray*,
@@ -204,116 +204,103 @@ map_coordinate(double in, npy_intp len, int mode)
     return in;
 }
 
-#define BUFFER_SIZE 256000
 #define TOLERANCE 1e-15
 
+/* parameters of the line function of NI_SplineFilter1D: */
+typedef struct {
+    int npoles;
+    double pole[2], weight;
+} NI_SplineFilter1DData;
+
+static int NI_SplineFilter1DLine(double *iline, npy_intp ilen, double *ln,
+                                 npy_intp len, void *data)
+{
+    NI_SplineFilter1DData *sd = (NI_SplineFilter1DData*)data;
+    int hh;
+    npy_intp ll;
+
+    /* spline filter: */
+    if (len > 1) {
+        for(ll = 0; ll < len; ll++)
+            ln[ll] *= sd->weight;
+        for(hh = 0; hh < sd->npoles; hh++) {
+            double p = sd->pole[hh];
+            int max = (int)ceil(log(TOLERANCE) / log(fabs(p)));
+            if (max < len) {
+                double zn = p;
+                double sum = ln[0];
+                for(ll = 1; ll < max; ll++) {
+                    sum += zn * ln[ll];
+                    zn *= p;
+                }
+                ln[0] = sum;
+            } else {
+                double zn = p;
+                double iz = 1.0 / p;
+                double z2n = pow(p, (double)(len - 1));
+                double sum = ln[0] + z2n * ln[len - 1];
+                z2n *= z2n * iz;
+                for(ll = 1; ll <= len - 2; ll++) {
+                    sum += (zn + z2n) * ln[ll];
+                    zn *= p;
+                    z2n *= iz;
+                }
+                ln[0] = sum / (1.0 - zn * zn);
+            }
+            for(ll = 1; ll < len; ll++)
+                ln[ll] += p * ln[ll - 1];
+            ln[len-1] = (p / (p * p - 1.0)) * (ln[len-1] + p * ln[len-2]);
+            for(ll = len - 2; ll >= 0; ll--)
+                ln[ll] = p * (ln[ll + 1] - ln[ll]);
+        }
+    }
+    return 1;
+}
+
 /* one-dimensional spline filter: */
 int NI_SplineFilter1D(NpyArray *input, int order, int axis,
                                             NpyArray *output)
 {
-    int hh, npoles = 0, more;
-    npy_intp kk, ll, lines, len;
-    double *buffer = NULL, weight, pole[2];
-    NI_LineBuffer iline_buffer, oline_buffer;
+    int hh;
+    npy_intp len;
+    NI_SplineFilter1DData sd;
 
     len = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
     if (len < 1)
-        goto exit;
+        return 1;
 
     /* these are used in the spline filter calculation below: */
+    sd.npoles = 0;
     switch (order) {
     case 2:
-        npoles = 1;
-        pole[0] = sqrt(8.0) - 3.0;
+        sd.npoles = 1;
+        sd.pole[0] = sqrt(8.0) - 3.0;
         break;
     case 3:
-        npoles = 1;
-        pole[0] = sqrt(3.0) - 2.0;
+        sd.npoles = 1;
+        sd.pole[0] = sqrt(3.0) - 2.0;
         break;
     case 4:
-        npoles = 2;
-        pole[0] = sqrt(664.0 - sqrt(438976.0)) + sqrt(304.0) - 19.0;
-        pole[1] = sqrt(664.0 + sqrt(438976.0)) - sqrt(304.0) - 19.0;
+        sd.npoles = 2;
+        sd.pole[0] = sqrt(664.0 - sqrt(438976.0)) + sqrt(304.0) - 19.0;
+        sd.pole[1] = sqrt(664.0 + sqrt(438976.0)) - sqrt(304.0) - 19.0;
         break;
     case 5:
-        npoles = 2;
-        pole[0] = sqrt(67.5 - sqrt(4436.25)) + sqrt(26.25) - 6.5;
-        pole[1] = sqrt(67.5 + sqrt(4436.25)) - sqrt(26.25) - 6.5;
+        sd.npoles = 2;
+        sd.pole[0] = sqrt(67.5 - sqrt(4436.25)) + sqrt(26.25) - 6.5;
+        sd.pole[1] = sqrt(67.5 + sqrt(4436.25)) - sqrt(26.25) - 6.5;
         break;
     default:
         break;
     }
 
-    weight = 1.0;
-    for(hh = 0; hh < npoles; hh++)
-        weight *= (1.0 - pole[hh]) * (1.0 - 1.0 / pole[hh]);
-
-    /* allocate an initialize the line buffer, only a single one is used,
-         because the calculation is in-place: */
-    lines = -1;
-    if (!NI_AllocateLineBuffer(input, axis, 0, 0, &lines, BUFFER_SIZE,
-                                                         &buffer))
-        goto exit;
-    if (!NI_InitLineBuffer(input, axis, 0, 0, lines, buffer,
-                                                 NI_EXTEND_DEFAULT, 0.0, &iline_buffer))
-        goto exit;
-    if (!NI_InitLineBuffer(output, axis, 0, 0, lines, buffer,
-                                                 NI_EXTEND_DEFAULT, 0.0, &oline_buffer))
-        goto exit;
-
-    /* iterate over all the array lines: */
-    do {
-        /* copy lines from array to buffer: */
-        if (!NI_ArrayToLineBuffer(&iline_buffer, &lines, &more))
-            goto exit;
-        /* iterate over the lines in the buffer: */
-        for(kk = 0; kk < lines; kk++) {
-            /* get line: */
-            double *ln = NI_GET_LINE(iline_buffer, kk);
-            /* spline filter: */
-            if (len > 1) {
-                for(ll = 0; ll < len; ll++)
-                    ln[ll] *= weight;
-                for(hh = 0; hh < npoles; hh++) {
-                    double p = pole[hh];
-                    int max = (int)ceil(log(TOLERANCE) / log(fabs(p)));
-                    if (max < len) {
-                        double zn = p;
-                        double sum = ln[0];
-                        for(ll = 1; ll < max; ll++) {
-                            sum += zn * ln[ll];
-                            zn *= p;
-                        }
-                        ln[0] = sum;
-                    } else {
-                        double zn = p;
-                        double iz = 1.0 / p;
-                        double z2n = pow(p, (double)(len - 1));
-                        double sum = ln[0] + z2n * ln[len - 1];
-                        z2n *= z2n * iz;
-                        for(ll = 1; ll <= len - 2; ll++) {
-                            sum += (zn + z2n) * ln[ll];
-                            zn *= p;
-                            z2n *= iz;
-                        }
-                        ln[0] = sum / (1.0 - zn * zn);
-                    }
-                    for(ll = 1; ll < len; ll++)
-                        ln[ll] += p * ln[ll - 1];
-                    ln[len-1] = (p / (p * p - 1.0)) * (ln[len-1] + p * ln[len-2]);
-                    for(ll = len - 2; ll >= 0; ll--)
-                        ln[ll] = p * (ln[ll + 1] - ln[ll]);
-                }
-            }
-        }
-        /* copy lines from buffer to array: */
-        if (!NI_LineBufferToArray(&oline_buffer))
-            goto exit;
-    } while(more);
+    sd.weight = 1.0;
+    for(hh = 0; hh < sd.npoles; hh++)
+        sd.weight *= (1.0 - sd.pole[hh]) * (1.0 - 1.0 / sd.pole[hh]);
 
- exit:
-    if (buffer) free(buffer);
-    return NpyErr_Occurred() ? 0 : 1;
+    /* the calculation is in-place, so only a single line buffer is used: */
+    return NI_LineFilter(input, axis, 0, 0, NI_EXTEND_DEFAULT, 0.0, output,
+                         NI_SplineFilter1DLine, &sd, NI_LINE_IN_PLACE);
 }
 
 #define CASE_MAP_COORDINATES(_p, _coor, _rank, _stride, _type) \
@@ -34,6 +34,13 @@
 #include <npy_os.h>
 #include "ni_support.h"
 
+#include "parallel_api.h"
+
+#define BUFFER_SIZE 256000
+
+/* arrays with fewer elements are filtered on a single thread: */
+#define NI_PARALLEL_THRESHOLD 65536
+
 static void NpyErr_NoMemory(void)
 {
     NpyErr_SetString(NpyExc_MemoryError, "no memory");
@@ -450,6 +457,268 @@ int NI_LineBufferToArray(NI_LineBuffer *buffer)
     return 1;
 }
 
+/* Restrict a line buffer to the array lines [start, end). This must be
+     called before any lines are copied: */
+int NI_LineBufferRange(NI_LineBuffer *buffer, npy_intp start, npy_intp end)
+{
+    npy_intp line = start;
+    int ii;
+
+    /* the coordinates of line number start, last axis fastest: */
+    for(ii = buffer->iterator.rank_m1; ii >= 0; ii--) {
+        npy_intp dim = buffer->iterator.dimensions[ii] + 1;
+        buffer->iterator.coordinates[ii] = line % dim;
+        buffer->array_data += (line % dim) * buffer->iterator.strides[ii];
+        line /= dim;
+    }
+    buffer->next_line = start;
+    buffer->array_lines = end;
+    return 1;
+}
+
+/******************************************************************/
+/* Parallel line processing */
+/******************************************************************/
+
+/* The thread pool of scipy.sparse.sparsetools._parallel, or NULL if
+     the filters run on the calling thread only: */
+static const parallel_api *ni_parallel = NULL;
+
+/* Use the thread pool of scipy.sparse.sparsetools._parallel, see
+     parallel_api.h. Returns 0 if the api has the wrong version: */
+int NI_SetParallelAPI(const void *api)
+{
+    const parallel_api *papi = (const parallel_api*)api;
+    if (papi != NULL && papi->version != PARALLEL_API_VERSION)
+        return 0;
+    ni_parallel = papi;
+    return 1;
+}
+
+/* The number of threads of the pool, set with
+     scipy.sparse.sparsetools.set_num_threads: */
+int NI_GetNumThreads(void)
+{
+    return ni_parallel ? ni_parallel->get_num_threads() : 1;
+}
+
+/* The lines processed by one thread, with its own line buffers: */
+typedef struct {
+    NI_LineBuffer iline_buffer, oline_buffer;
+    double *ibuffer, *obuffer;
+    npy_intp length, size1, size2;
+    NI_LineFunction function;
+    void *data;
+    int flags, status;
+} NI_LineTask;
+
+static void NI_RunLineTask(void *ptask)
+{
+    NI_LineTask *task = (NI_LineTask*)ptask;
+    npy_intp ii, lines;
+    int more;
+
+    task->status = 1;
+    do {
+        /* copy lines from array to buffer: */
+        if (!NI_ArrayToLineBuffer(&task->iline_buffer, &lines, &more)) {
+            task->status = 0;
+            return;
+        }
+        /* iterate over the lines in the buffers: */
+        for(ii = 0; ii < lines; ii++) {
+            double *iline = NI_GET_LINE(task->iline_buffer, ii);
+            double *oline = task->flags & NI_LINE_IN_PLACE ?
+                iline + task->size1 : NI_GET_LINE(task->oline_buffer, ii);
+            if (!task->function(iline, task->length + task->size1 + task->size2,
+                                oline, task->length, task->data)) {
+                task->status = 0;
+                return;
+            }
+        }
+        /* copy lines from buffer to array: */
+        if (!NI_LineBufferToArray(&task->oline_buffer)) {
+            task->status = 0;
+            return;
+        }
+    } while(more);
+}
+
+/* The number of tasks for n_items independent items of work on an
+     array of the given size: */
+int NI_NumTasks(npy_intp size, npy_intp n_items)
+{
+    npy_intp n_tasks = 1;
+
+    if (size >= NI_PARALLEL_THRESHOLD) {
+        n_tasks = NI_GetNumThreads();
+        if (n_tasks > n_items)
+            n_tasks = n_items;
+        if (n_tasks < 1)
+            n_tasks = 1;
+    }
+    return (int)n_tasks;
+}
+
+/* The tasks of one NI_RunTasks call, as run by the pool: */
+typedef struct {
+    NI_TaskFunction function;
+    char *tasks;
+    size_t task_size;
+} NI_PoolRun;
+
+static int NI_RunPoolChunk(void *arg, int chunk)
+{
+    NI_PoolRun *run = (NI_PoolRun*)arg;
+    run->function(run->tasks + chunk * run->task_size);
+    return 0;
+}
+
+/* Run a function on an array of tasks, on the thread pool if there is
+     more than one: */
+void NI_RunTasks(NI_TaskFunction function, void *tasks, size_t task_size,
+                 int n_tasks)
+{
+    int ii;
+
+    if (n_tasks > 1 && ni_parallel != NULL) {
+        NI_PoolRun run;
+        run.function = function;
+        run.tasks = (char*)tasks;
+        run.task_size = task_size;
+        /* the tasks report failure themselves, so the run never fails: */
+        ni_parallel->run(NI_RunPoolChunk, &run, n_tasks);
+        return;
+    }
+    for(ii = 0; ii < n_tasks; ii++)
+        function((char*)tasks + ii * task_size);
+}
+
+int NI_LineTypeSupported(int type)
+{
+    switch (type) {
+    case tnpy_bool:
+    case tnpy_uint8:
+    case tnpy_uint16:
+    case tnpy_uint32:
+#if HAS_UINT64
+    case tnpy_uint64:
+#endif
+    case tnpy_int8:
+    case tnpy_int16:
+    case tnpy_int32:
+    case tnpy_int64:
+    case tnpy_float32:
+    case tnpy_float64:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Apply a function to all lines of the input array along an axis and
+     store the results in the output array, which has the same shape.
+     The input lines are extended by size1 and size2 elements according
+     to the boundary mode.
+
+     The lines are split into contiguous ranges, one for each thread,
+     and every thread copies its lines through its own line buffers.
+     Only the calling thread raises errors, so the line function must
+     not fail unless it is run serially (NI_LINE_SERIAL). */
+int NI_LineFilter(NpyArray *input, int axis, npy_intp size1, npy_intp size2,
+                  NI_ExtendMode mode, double cval, NpyArray *output,
+                  NI_LineFunction function, void *data, int flags)
+{
+    NI_LineTask *tasks = NULL;
+    npy_intp lines, array_lines = 0, size = 1, length;
+    int ii, n_tasks = 1;
+
+    for(ii = 0; ii < NpyArray_NDIM(input); ii++)
+        size *= NpyArray_DIM(input, ii);
+    length = NpyArray_NDIM(input) > 0 ? NpyArray_DIM(input, axis) : 1;
+    if (length > 0)
+        array_lines = size / length;
+
+    if (!NI_LineTypeSupported(NpyArray_TYPE(input)) ||
+        !NI_LineTypeSupported(NpyArray_TYPE(output))) {
+        NpyErr_SetString(NpyExc_RuntimeError, "array type not supported");
+        return 0;
+    }
+    if (size1 + size2 > 0 && (mode < 0 || mode > NI_EXTEND_LAST)) {
+        NpyErr_SetString(NpyExc_RuntimeError, "mode not supported");
+        return 0;
+    }
+
+    if (!(flags & NI_LINE_SERIAL))
+        n_tasks = NI_NumTasks(size, array_lines);
+
+    tasks = (NI_LineTask*)calloc(n_tasks, sizeof(NI_LineTask));
+    if (!tasks) {
+        NpyErr_NoMemory();
+        goto exit;
+    }
+    for(ii = 0; ii < n_tasks; ii++) {
+        NI_LineTask *task = tasks + ii;
+        npy_intp start = (array_lines * ii) / n_tasks;
+        npy_intp end = (array_lines * (ii + 1)) / n_tasks;
+
+        task->length = length;
+        task->size1 = size1;
+        task->size2 = size2;
+        task->function = function;
+        task->data = data;
+        task->flags = flags;
+
+        /* allocate and initialize the line buffers, for in-place
+             processing the input buffer also serves as output buffer: */
+        lines = -1;
+        if (!NI_AllocateLineBuffer(input, axis, size1, size2, &lines,
+                                   BUFFER_SIZE, &task->ibuffer))
+            goto exit;
+        if (lines > end - start && end > start)
+            lines = end - start;
+        if (flags & NI_LINE_IN_PLACE) {
+            if (!NI_InitLineBuffer(output, axis, size1, size2, lines,
+                                   task->ibuffer, mode, 0.0,
+                                   &task->oline_buffer))
+                goto exit;
+        } else {
+            if (!NI_AllocateLineBuffer(output, axis, 0, 0, &lines,
+                                       BUFFER_SIZE, &task->obuffer))
+                goto exit;
+            if (!NI_InitLineBuffer(output, axis, 0, 0, lines, task->obuffer,
+                                   mode, 0.0, &task->oline_buffer))
+                goto exit;
+        }
+        if (!NI_InitLineBuffer(input, axis, size1, size2, lines,
+                               task->ibuffer, mode, cval, &task->iline_buffer))
+            goto exit;
+        NI_LineBufferRange(&task->iline_buffer, start, end);
+        NI_LineBufferRange(&task->oline_buffer, start, end);
+    }
+
+    NI_RunTasks(NI_RunLineTask, tasks, sizeof(NI_LineTask), n_tasks);
+
+    for(ii = 0; ii < n_tasks; ii++) {
+        if (!tasks[ii].status) {
+            if (!NpyErr_Occurred())
+                NpyErr_SetString(NpyExc_RuntimeError,
+                                 "unknown error in line processing function");
+            break;
+        }
+    }
+
+exit:
+    if (tasks) {
+        for(ii = 0; ii < n_tasks; ii++) {
+            if (tasks[ii].ibuffer) free(tasks[ii].ibuffer);
+            if (tasks[ii].obuffer) free(tasks[ii].obuffer);
+        }
+        free(tasks);
+    }
+    return NpyErr_Occurred() ? 0 : 1;
+}
+
 /******************************************************************/
 /* Multi-dimensional filter support functions */
 /******************************************************************/
@@ -190,6 +190,52 @@ int NI_ArrayToLineBuffer(NI_LineBuffer*, npy_intp*, int*);
 /* Copy a line from a buffer to an array: */
 int NI_LineBufferToArray(NI_LineBuffer*);
 
+/* Restrict a line buffer to the array lines [start, end): */
+int NI_LineBufferRange(NI_LineBuffer*, npy_intp, npy_intp);
+
+/******************************************************************/
+/* Parallel line processing */
+/******************************************************************/
+
+/* The function applied to each line by NI_LineFilter. It receives the
+     input line, extended at both ends for the boundary conditions, with
+     its length, the output line with its length, and the user data. It
+     returns 0 on failure. */
+typedef int (*NI_LineFunction)(double*, npy_intp, double*, npy_intp, void*);
+
+/* Flags of NI_LineFilter: */
+enum {
+    /* the function writes its result into the input line: */
+    NI_LINE_IN_PLACE = 1,
+    /* the function is not thread-safe, e.g. a Python callback: */
+    NI_LINE_SERIAL = 2
+};
+
+/* Apply a function to all lines of an array along an axis, with the
+     lines split over several threads: */
+int NI_LineFilter(NpyArray*, int, npy_intp, npy_intp, NI_ExtendMode,
+                  double, NpyArray*, NI_LineFunction, void*, int);
+
+/* Test if an array type can be copied to and from line buffers: */
+int NI_LineTypeSupported(int);
+
+/* Use the thread pool of scipy.sparse.sparsetools, given by the
+     address of its parallel_api structure: */
+int NI_SetParallelAPI(const void*);
+
+/* Number of threads used by NI_LineFilter: */
+int NI_GetNumThreads(void);
+
+/* A task run by NI_RunTasks: */
+typedef void (*NI_TaskFunction)(void*);
+
+/* The number of tasks for n items of work on an array of the given
+     size: */
+int NI_NumTasks(npy_intp, npy_intp);
+
+/* Run a function on an array of n tasks of the given size in bytes: */
+void NI_RunTasks(NI_TaskFunction, void*, size_t, int);
+
 /******************************************************************/
 /* Multi-dimensional filter support functions */
 /******************************************************************/
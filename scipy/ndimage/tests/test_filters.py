@@ -2,7 +2,7 @@
 
 import numpy as np
 
-from numpy.testing import assert_equal, assert_raises
+from numpy.testing import assert_equal, assert_almost_equal, assert_raises
 
 import scipy.ndimage as sndi
 
@@ -28,3 +28,122 @@ def test_orders_gauss():
     yield assert_equal, 0, sndi.gaussian_filter1d(arr, 1, axis=-1, order=3)
     yield assert_raises, ValueError, sndi.gaussian_filter1d, arr, 1, -1, -1
     yield assert_raises, ValueError, sndi.gaussian_filter1d, arr, 1, -1, 4
+
+
+def test_parallel_line_filters():
+    # The 1-D filters give the same result on one and on several threads
+    from scipy.sparse import sparsetools
+    arr = np.sin(np.arange(40 * 50 * 60) * 0.37).reshape((40, 50, 60))
+    filters = [lambda a: sndi.correlate1d(a, [1, 2, 3, -1, 0.5], axis),
+               lambda a: sndi.uniform_filter1d(a, 4, axis, mode='wrap'),
+               lambda a: sndi.minimum_filter1d(a, 6, axis, mode='constant'),
+               lambda a: sndi.spline_filter1d(a, 3, axis)]
+    saved = sparsetools.get_num_threads()
+    try:
+        for axis in range(3):
+            for f in filters:
+                sparsetools.set_num_threads(1)
+                expected = f(arr)
+                sparsetools.set_num_threads(4)
+                yield assert_equal, f(arr), expected
+    finally:
+        sparsetools.set_num_threads(saved)
+
+
+def test_separable_filters():
+    # Gaussian and uniform filters with floating point outputs apply all
+    # axes together, with the same result as one axis at a time
+    arr = np.sin(np.arange(30 * 40 * 50) * 0.37).reshape((30, 40, 50))
+    for mode in ['reflect', 'constant', 'nearest', 'mirror', 'wrap']:
+        expected = arr
+        for axis, sigma in enumerate([1.0, 2.5, 0.7]):
+            expected = sndi.gaussian_filter1d(expected, sigma, axis,
+                                              mode=mode, cval=0.5)
+        res = sndi.gaussian_filter(arr, [1.0, 2.5, 0.7], mode=mode, cval=0.5)
+        yield assert_equal, res, expected
+
+        expected = sndi.uniform_filter1d(arr, 3, 0, mode=mode, origin=1)
+        expected = sndi.uniform_filter1d(expected, 6, 2, mode=mode)
+        res = sndi.uniform_filter(arr, [3, 1, 6], mode=mode, origin=[1, 0, 0])
+        yield assert_almost_equal, res, expected, 12
+
+    # integer outputs and in-place filtering take one axis at a time
+    res = sndi.gaussian_filter(arr, 2.0, output=np.int32)
+    yield assert_equal, res.dtype, np.int32
+    out = arr.copy()
+    sndi.uniform_filter(out, 5, output=out)
+    yield assert_almost_equal, out, sndi.uniform_filter(arr, 5), 12
+
+    # the extension module filters the given axes directly
+    from scipy.ndimage import _nd_image, _ni_support
+    out = np.zeros_like(arr)
+    _nd_image.separable_filter(arr, None, [0, 2], [3, 6], [1, 0], out,
+                               _ni_support._extend_mode_to_code('wrap'), 0.0)
+    expected = sndi.uniform_filter1d(arr, 3, 0, mode='wrap', origin=1)
+    expected = sndi.uniform_filter1d(expected, 6, 2, mode='wrap')
+    yield assert_almost_equal, out, expected, 12
+
+
+def test_typed_correlate():
+    # 8- and 16-bit arrays with integral weights, and float32 arrays, are
+    # correlated in their own type, with the result of the float64 path
+    x = (np.arange(40 * 70) * 37 % 11).reshape((40, 70))
+    for mode in ['reflect', 'constant', 'nearest', 'mirror', 'wrap']:
+        for weights in [[1, 3, 2, 3, 1], [2, 1, 0, 3]]:
+            for axis in [0, 1]:
+                expected = sndi.correlate1d(x.astype(np.float64), weights,
+                                            axis, mode=mode, cval=4,
+                                            origin=1)
+                for dtype in [np.uint8, np.int8, np.uint16, np.int16,
+                              np.float32]:
+                    res = sndi.correlate1d(x.astype(dtype), weights, axis,
+                                           mode=mode, cval=4, origin=1)
+                    yield assert_equal, res, expected.astype(dtype)
+        expected = sndi.correlate(x.astype(np.float64), [[1, 2], [0, 1]],
+                                  mode=mode)
+        for dtype in [np.uint8, np.int16, np.float32]:
+            res = sndi.correlate(x.astype(dtype), [[1, 2], [0, 1]],
+                                 mode=mode)
+            yield assert_equal, res, expected.astype(dtype)
+
+def test_min_or_max_filter1d_sizes():
+    # large windows use the van Herk/Gil-Werman algorithm, compare with the
+    # minimum and maximum of the general filter
+    arr = (np.arange(13 * 90) * 37 % 101).reshape((13, 90)) * 0.5
+    for mode in ['reflect', 'constant', 'nearest', 'mirror', 'wrap']:
+        for size in [2, 3, 4, 7, 16, 31, 200]:
+            for origin in [-(size // 2), 0, (size - 1) // 2]:
+                for axis in [0, 1]:
+                    shape = [1, 1]
+                    shape[axis] = size
+                    footprint = np.ones(shape, bool)
+                    for filter1d, func in [(sndi.minimum_filter1d, np.min),
+                                           (sndi.maximum_filter1d, np.max)]:
+                        res = filter1d(arr, size, axis, mode=mode, cval=7,
+                                       origin=origin)
+                        origins = [0, 0]
+                        origins[axis] = origin
+                        expected = sndi.generic_filter(arr, func,
+                                            footprint=footprint, mode=mode,
+                                            cval=7, origin=origins)
+                        yield assert_equal, res, expected
+
+def test_rank_filter_histogram():
+    # large footprints use a sliding histogram, compare with sorting the
+    # values of the general filter
+    arr = (np.arange(20 * 30) * 37 % 101).reshape((20, 30)) - 50
+    disk = np.add.outer(np.arange(-4, 5) ** 2, np.arange(-4, 5) ** 2) <= 16
+    for type in [np.uint8, np.int8, np.uint16, np.int16, np.int32,
+                 np.float32, np.float64]:
+        data = (arr % 100 if type in [np.uint8, np.uint16] else
+                arr).astype(type)
+        for footprint in [np.ones((3, 24), bool), disk]:
+            size = footprint.sum()
+            for mode in ['reflect', 'constant', 'nearest', 'mirror', 'wrap']:
+                for rank in [0, size // 3, size - 1]:
+                    res = sndi.rank_filter(data, rank, footprint=footprint,
+                                           mode=mode, cval=7)
+                    expected = sndi.generic_filter(data,
+                                    lambda x: np.sort(x)[rank],
+                                    footprint=footprint, mode=mode, cval=7)
+                    yield assert_equal, res, expected
@@ -8,6 +8,7 @@ from dok import *
 from coo import *
 from dia import *
 from bsr import *
+from sell import *
 from csgraph import *
 
 from construct import *
@@ -35,7 +35,8 @@ _formats = {'csc':[0, "Compressed Sparse Column"],
             'jad':[16, "JAgged Diagonal"],
             'uss':[17, "Unsymmetric Sparse Skyline"],
             'vbr':[18, "Variable Block Row"],
-            'und':[19, "Undefined"]
+            'und':[19, "Undefined"],
+            'sell':[20, "Sliced ELLpack (SELL-C-sigma)"]
             }
 
 
@@ -481,6 +482,9 @@ class spmatrix(object):
     def tobsr(self, blocksize=None):
         return self.tocsr().tobsr(blocksize=blocksize)
 
+    def tosell(self, C=8, sigma=256):
+        return self.tocsr().tosell(C=C, sigma=sigma)
+
     def copy(self):
         return self.__class__(self,copy=True)
 
@@ -137,6 +137,7 @@ class BenchmarkSparse(TestCase):
         matrices.append(('Poisson5pt', poisson2d(300,format='csr')))
         matrices.append(('Poisson5pt', poisson2d(300,format='csc')))
         matrices.append(('Poisson5pt', poisson2d(300,format='bsr')))
+        matrices.append(('Poisson5pt', poisson2d(300,format='sell')))
 
         A = sparse.kron(poisson2d(150),ones((2,2))).tobsr(blocksize=(2,2))
         matrices.append( ('Block2x2', A.tocsr()) )
@@ -213,6 +214,130 @@ class BenchmarkSparse(TestCase):
             print fmt % (A.format,name,shape,A.nnz,MFLOPs)
 
 
+    def bench_matmat_accumulators(self):
+        """sparse matrix products with each SpGEMM accumulator"""
+        from scipy.sparse import sparsetools
+
+        matrices = []
+        matrices.append( ('Poisson5pt^2', poisson2d(300,format='csr'), poisson2d(300,format='csr')) )
+        matrices.append( ('WideRand3', random_sparse(10**5,10**5,3), random_sparse(10**5,10**7,3)) )
+        matrices.append( ('WideRand10', random_sparse(10**5,10**5,10), random_sparse(10**5,10**7,2)) )
+
+        print
+        print '                Sparse Matrix Product Accumulators'
+        print '===================================================================='
+        print '    name      |     shape of A*B     |  accum  |   nnz    | time (msec) '
+        print '--------------------------------------------------------------------'
+        fmt = ' %12s | %20s |  %5s  | %8d |   %7.1f '
+
+        saved = sparsetools.get_matmat_accumulator()
+        try:
+            for name,A,B in matrices:
+                for method in ['dense','hash','esc','auto']:
+                    sparsetools.set_matmat_accumulator(method)
+
+                    C = A*B  #warmup
+
+                    start = time.clock()
+                    iter = 0
+                    while iter < 3 or time.clock() < start + 1:
+                        C = A*B
+                        iter += 1
+                    end = time.clock()
+
+                    shape = ("%s" % (C.shape,)).center(20)
+                    print fmt % (name.center(12),shape,method,C.nnz,1e3*(end-start)/float(iter))
+        finally:
+            sparsetools.set_matmat_accumulator(saved)
+
+    def bench_workspace(self):
+        """repeated operations with and without reusing scratch arrays"""
+        from scipy.sparse import sparsetools
+
+        matrices = []
+        matrices.append( ('Poisson5pt', poisson2d(100,format='csr')) )
+        matrices.append( ('Poisson5pt^2', poisson2d(60,format='csr')**2) )
+
+        print
+        print '                  Scratch Array Reuse'
+        print '===================================================================='
+        print '    name      |  op   | workspace | allocs/call | time (msec) '
+        print '--------------------------------------------------------------------'
+        fmt = ' %12s | %5s |  %7s  |   %7.1f   |   %7.3f '
+
+        for name,A in matrices:
+            B = A.T.tocsr()
+
+            # unsorted indices send D+D through csr_binop_csr_general
+            D = A.copy()
+            D.indices[:2] = D.indices[1::-1]
+
+            ops = []
+            ops.append( ('A*B', lambda : A*B) )
+            ops.append( ('D+D', lambda : D+D) )
+
+            for op,fn in ops:
+                for reuse in [False,True]:
+                    sparsetools.clear_workspaces()
+                    fn()  #warmup
+
+                    allocs = sparsetools.get_workspace_allocations()
+                    start = time.clock()
+                    iter = 0
+                    while iter < 10 or time.clock() < start + 0.5:
+                        if not reuse:
+                            sparsetools.clear_workspaces()
+                        fn()
+                        iter += 1
+                    end = time.clock()
+                    allocs = sparsetools.get_workspace_allocations() - allocs
+
+                    print fmt % (name.center(12),op,['cleared','kept'][reuse],
+                                 allocs/float(iter),1e3*(end-start)/float(iter))
+
+    def bench_bsr_block_sizes(self):
+        """BSR kernels with unrolled and generic block arithmetic"""
+        from scipy.sparse import sparsetools
+
+        print
+        print '                 BSR Unrolled vs. Generic Block Kernels'
+        print '======================================================================'
+        print ' blocksize |   op   |    nnz    | generic (msec) | unrolled (msec) '
+        print '----------------------------------------------------------------------'
+        fmt = '    %dx%d    | %6s | %9d |     %7.2f    |     %7.2f '
+
+        def timeit(fn):
+            fn()  #warmup
+            start = time.clock()
+            iter = 0
+            while iter < 5 or time.clock() < start + 0.5:
+                fn()
+                iter += 1
+            end = time.clock()
+            return 1e3*(end-start)/float(iter)
+
+        saved = sparsetools.get_bsr_unrolled()
+        try:
+            for R in range(2,9):
+                A = sparse.kron(poisson2d(300 // R), ones((R,R))).tobsr(blocksize=(R,R))
+                x = ones(A.shape[1], dtype=A.dtype)
+                X = ones((A.shape[1],4), dtype=A.dtype)
+
+                ops = []
+                ops.append( ('A*x',    lambda : A*x) )
+                ops.append( ('A*X',    lambda : A*X) )
+                ops.append( ('A*A',    lambda : A*A) )
+                ops.append( ('A+A',    lambda : A+A) )
+
+                for name,fn in ops:
+                    times = []
+                    for unrolled in [False,True]:
+                        sparsetools.set_bsr_unrolled(unrolled)
+                        times.append(timeit(fn))
+                    print fmt % (R,R,name,A.nnz,times[0],times[1])
+        finally:
+            sparsetools.set_bsr_unrolled(saved)
+
     def bench_construction(self):
         """build matrices by inserting single values"""
         matrices = []
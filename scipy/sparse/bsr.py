@@ -9,9 +9,10 @@ from warnings import warn
 import numpy as np
 
 from data import _data_matrix
-from compressed import _cs_matrix
+from compressed import _cs_matrix, _max_major_length
 from base import isspmatrix, _formats
-from sputils import isshape, getdtype, to_native, upcast
+from sputils import isshape, getdtype, to_native, upcast, get_index_dtype, \
+        has_mixed_kernel
 import sparsetools
 from sparsetools import bsr_matvec, bsr_matvecs, csr_matmat_pass1, \
                         bsr_matmat_pass2, bsr_transpose, bsr_sort_indices
@@ -115,13 +116,14 @@ class bsr_matrix(_cs_matrix):
                         raise ValueError('invalid blocksize=%s' % blocksize)
                     blocksize = tuple(blocksize)
                 self.data    = np.zeros( (0,) + blocksize, getdtype(dtype, default=float) )
-                self.indices = np.zeros( 0, dtype=np.intc )
 
                 R,C = blocksize
                 if (M % R) != 0 or (N % C) != 0:
                     raise ValueError('shape must be multiple of blocksize')
 
-                self.indptr  = np.zeros(M//R + 1, dtype=np.intc )
+                idx_dtype = get_index_dtype(maxval=max(M//R, N//C, R, C))
+                self.indices = np.zeros( 0, dtype=idx_dtype )
+                self.indptr  = np.zeros(M//R + 1, dtype=idx_dtype )
 
             elif len(arg1) == 2:
                 # (data,(row,col)) format
@@ -131,8 +133,9 @@ class bsr_matrix(_cs_matrix):
             elif len(arg1) == 3:
                 # (data,indices,indptr) format
                 (data, indices, indptr) = arg1
-                self.indices = np.array(indices, copy=copy)
-                self.indptr  = np.array(indptr,  copy=copy)
+                idx_dtype = get_index_dtype((indices, indptr), check_contents=True)
+                self.indices = np.array(indices, copy=copy, dtype=idx_dtype)
+                self.indptr  = np.array(indptr,  copy=copy, dtype=idx_dtype)
                 self.data    = np.array(data,    copy=copy, dtype=getdtype(dtype, data))
             else:
                 raise ValueError('unrecognized bsr_matrix constructor usage')
@@ -193,9 +196,10 @@ class bsr_matrix(_cs_matrix):
             warn("indices array has non-integer dtype (%s)" \
                     % self.indices.dtype.name )
 
-        # only support 32-bit ints for now
-        self.indptr  = np.asarray(self.indptr, np.intc)
-        self.indices = np.asarray(self.indices, np.intc)
+        # indptr and indices must have the same index dtype
+        idx_dtype = get_index_dtype((self.indptr, self.indices))
+        self.indptr  = np.asarray(self.indptr, idx_dtype)
+        self.indices = np.asarray(self.indices, idx_dtype)
         self.data    = to_native(self.data)
 
         # check array shapes
@@ -293,7 +297,11 @@ class bsr_matrix(_cs_matrix):
 
         result = np.zeros(self.shape[0], dtype=upcast(self.dtype, other.dtype))
 
-        bsr_matvec(M//R, N//C, R, C, \
+        if has_mixed_kernel(self.dtype, result.dtype):
+            fn = sparsetools.bsr_matvec_mixed
+        else:
+            fn = bsr_matvec
+        fn(M//R, N//C, R, C, \
             self.indptr, self.indices, self.data.ravel(),
             other, result)
 
@@ -306,7 +314,11 @@ class bsr_matrix(_cs_matrix):
 
         result = np.zeros((M,n_vecs), dtype=upcast(self.dtype,other.dtype))
 
-        bsr_matvecs(M//R, N//C, n_vecs, R, C, \
+        if has_mixed_kernel(self.dtype, result.dtype):
+            fn = sparsetools.bsr_matvecs_mixed
+        else:
+            fn = bsr_matvecs
+        fn(M//R, N//C, n_vecs, R, C, \
                 self.indptr, self.indices, self.data.ravel(), \
                 other.ravel(), result.ravel())
 
@@ -316,8 +328,6 @@ class bsr_matrix(_cs_matrix):
         M, K1 = self.shape
         K2, N = other.shape
 
-        indptr = np.empty_like( self.indptr )
-
         R,n = self.blocksize
 
         #convert to this format
@@ -333,18 +343,30 @@ class bsr_matrix(_cs_matrix):
         else:
             other = other.tobsr(blocksize=(n,C))
 
+        # the product has at most bnnz(A) * (longest block row of B) blocks
+        max_bnnz = len(self.indices) * _max_major_length(other)
+        idx_dtype = get_index_dtype((self.indptr, self.indices,
+                                     other.indptr, other.indices),
+                                    maxval=max(M//R, N//C, R*C*max_bnnz))
+        self_indptr   = np.asarray(self.indptr,    dtype=idx_dtype)
+        self_indices  = np.asarray(self.indices,   dtype=idx_dtype)
+        other_indptr  = np.asarray(other.indptr,  dtype=idx_dtype)
+        other_indices = np.asarray(other.indices, dtype=idx_dtype)
+
+        indptr = np.empty(M//R + 1, dtype=idx_dtype)
+
         csr_matmat_pass1( M//R, N//C, \
-                self.indptr,  self.indices, \
-                other.indptr, other.indices, \
+                self_indptr,  self_indices, \
+                other_indptr, other_indices, \
                 indptr)
 
         bnnz = indptr[-1]
-        indices = np.empty(bnnz, dtype=np.intc)
+        indices = np.empty(bnnz, dtype=idx_dtype)
         data    = np.empty(R*C*bnnz, dtype=upcast(self.dtype,other.dtype))
 
         bsr_matmat_pass2( M//R, N//C, R, C, n, \
-                self.indptr,  self.indices,  np.ravel(self.data), \
-                other.indptr, other.indices, np.ravel(other.data), \
+                self_indptr,  self_indices,  np.ravel(self.data), \
+                other_indptr, other_indices, np.ravel(other.data), \
                 indptr,       indices,       data)
 
         data = data.reshape(-1,R,C)
@@ -499,14 +521,21 @@ class bsr_matrix(_cs_matrix):
         R,C = self.blocksize
 
         max_bnnz = len(self.data) + len(other.data)
-        indptr  = np.empty_like(self.indptr)
-        indices = np.empty(max_bnnz, dtype=np.intc)
+        idx_dtype = get_index_dtype((self.indptr, self.indices,
+                                     other.indptr, other.indices),
+                                    maxval=R*C*max_bnnz)
+        indptr  = np.empty(self.indptr.shape, dtype=idx_dtype)
+        indices = np.empty(max_bnnz, dtype=idx_dtype)
         data    = np.empty(R*C*max_bnnz, dtype=upcast(self.dtype,other.dtype))
 
         fn(self.shape[0]//R, self.shape[1]//C, R, C,
-                self.indptr,  self.indices,  np.ravel(self.data),
-                other.indptr, other.indices, np.ravel(other.data),
-                indptr,       indices,       data)
+                np.asarray(self.indptr,  dtype=idx_dtype),
+                np.asarray(self.indices, dtype=idx_dtype),
+                np.ravel(self.data),
+                np.asarray(other.indptr,  dtype=idx_dtype),
+                np.asarray(other.indices, dtype=idx_dtype),
+                np.ravel(other.data),
+                indptr, indices, data)
 
         actual_bnnz = indptr[-1]
         indices = indices[:actual_bnnz]
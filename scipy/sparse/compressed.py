@@ -11,7 +11,7 @@ from base import spmatrix, isspmatrix, SparseEfficiencyWarning
 from data import _data_matrix
 import sparsetools
 from sputils import upcast, to_native, isdense, isshape, getdtype, \
-        isscalarlike, isintlike
+        isscalarlike, isintlike, get_index_dtype, has_mixed_kernel
 
 
 class _cs_matrix(_data_matrix):
@@ -34,9 +34,10 @@ class _cs_matrix(_data_matrix):
                 # create empty matrix
                 self.shape = arg1   #spmatrix checks for errors here
                 M, N = self.shape
+                idx_dtype = get_index_dtype(maxval=max(M,N))
                 self.data    = np.zeros(0, getdtype(dtype, default=float))
-                self.indices = np.zeros(0, np.intc)
-                self.indptr  = np.zeros(self._swap((M,N))[0] + 1, dtype=np.intc)
+                self.indices = np.zeros(0, idx_dtype)
+                self.indptr  = np.zeros(self._swap((M,N))[0] + 1, dtype=idx_dtype)
             else:
                 if len(arg1) == 2:
                     # (data, ij) format
@@ -46,8 +47,13 @@ class _cs_matrix(_data_matrix):
                 elif len(arg1) == 3:
                     # (data, indices, indptr) format
                     (data, indices, indptr) = arg1
-                    self.indices = np.array(indices, copy=copy)
-                    self.indptr  = np.array(indptr, copy=copy)
+                    maxval = None
+                    if shape is not None:
+                        maxval = max(shape)
+                    idx_dtype = get_index_dtype((indices, indptr), maxval=maxval,
+                                                check_contents=True)
+                    self.indices = np.array(indices, copy=copy, dtype=idx_dtype)
+                    self.indptr  = np.array(indptr, copy=copy, dtype=idx_dtype)
                     self.data    = np.array(data, copy=copy, dtype=getdtype(dtype, data))
                 else:
                     raise ValueError("unrecognized %s_matrix constructor usage" %
@@ -121,9 +127,11 @@ class _cs_matrix(_data_matrix):
             warn("indices array has non-integer dtype (%s)" \
                     % self.indices.dtype.name )
 
-        # only support 32-bit ints for now
-        self.indptr  = np.asarray(self.indptr,  dtype=np.intc)
-        self.indices = np.asarray(self.indices, dtype=np.intc)
+        # sparsetools needs both index arrays of the same type,
+        # int32 unless one of them is already int64
+        idx_dtype = get_index_dtype((self.indptr, self.indices))
+        self.indptr  = np.asarray(self.indptr,  dtype=idx_dtype)
+        self.indices = np.asarray(self.indices, dtype=idx_dtype)
         self.data    = to_native(self.data)
 
         # check array shapes
@@ -253,8 +261,12 @@ class _cs_matrix(_data_matrix):
         #output array
         result = np.zeros( self.shape[0], dtype=upcast(self.dtype,other.dtype) )
 
-        # csr_matvec or csc_matvec
-        fn = getattr(sparsetools,self.format + '_matvec')
+        # csr_matvec or csc_matvec, or csr_matvec_mixed or csc_matvec_mixed
+        # to avoid converting self.data to the type of the result
+        if has_mixed_kernel(self.dtype, result.dtype):
+            fn = getattr(sparsetools,self.format + '_matvec_mixed')
+        else:
+            fn = getattr(sparsetools,self.format + '_matvec')
         fn(M, N, self.indptr, self.indices, self.data, other, result)
 
         return result
@@ -266,8 +278,11 @@ class _cs_matrix(_data_matrix):
 
         result = np.zeros( (M,n_vecs), dtype=upcast(self.dtype,other.dtype) )
 
-        # csr_matvecs or csc_matvecs
-        fn = getattr(sparsetools,self.format + '_matvecs')
+        # csr_matvecs or csc_matvecs, or the _mixed versions
+        if has_mixed_kernel(self.dtype, result.dtype):
+            fn = getattr(sparsetools,self.format + '_matvecs_mixed')
+        else:
+            fn = getattr(sparsetools,self.format + '_matvecs')
         fn(M, N, n_vecs, self.indptr, self.indices, self.data, other.ravel(), result.ravel())
 
         return result
@@ -278,24 +293,51 @@ class _cs_matrix(_data_matrix):
         K2, N = other.shape
 
         major_axis = self._swap((M,N))[0]
-        indptr = np.empty(major_axis + 1, dtype=np.intc)
-
         other = self.__class__(other) #convert to this format
+
+        # The product has at most nnz(A) * (longest row of B) entries in
+        # CSR and nnz(B) * (longest column of A) entries in CSC, use 64-bit
+        # indices if that bound does not fit in 32 bits
+        if self.format == 'csr':
+            max_nnz = self.nnz * _max_major_length(other)
+        else:
+            max_nnz = other.nnz * _max_major_length(self)
+        idx_dtype = get_index_dtype((self.indptr, self.indices,
+                                     other.indptr, other.indices),
+                                    maxval=max(M, N, min(M*N, max_nnz)))
+        self_indptr   = np.asarray(self.indptr,    dtype=idx_dtype)
+        self_indices  = np.asarray(self.indices,   dtype=idx_dtype)
+        other_indptr  = np.asarray(other.indptr,  dtype=idx_dtype)
+        other_indices = np.asarray(other.indices, dtype=idx_dtype)
+
+        indptr = np.empty(major_axis + 1, dtype=idx_dtype)
+
         fn = getattr(sparsetools, self.format + '_matmat_pass1')
-        fn( M, N, self.indptr, self.indices, \
-                  other.indptr, other.indices, \
+        fn( M, N, self_indptr, self_indices, \
+                  other_indptr, other_indices, \
                   indptr)
 
         nnz = indptr[-1]
-        indices = np.empty(nnz, dtype=np.intc)
+        indices = np.empty(nnz, dtype=idx_dtype)
         data    = np.empty(nnz, dtype=upcast(self.dtype,other.dtype))
 
-        fn = getattr(sparsetools, self.format + '_matmat_pass2')
-        fn( M, N, self.indptr, self.indices, self.data, \
-                  other.indptr, other.indices, other.data, \
+        # keep products of matrices with sorted indices sorted, so that
+        # the result does not need a separate sort_indices() later
+        sort_indices = self.has_sorted_indices and other.has_sorted_indices
+
+        # csr_matmat_pass2[_sorted] or csc_matmat_pass2[_sorted]
+        if sort_indices:
+            fn = getattr(sparsetools, self.format + '_matmat_pass2_sorted')
+        else:
+            fn = getattr(sparsetools, self.format + '_matmat_pass2')
+        fn( M, N, self_indptr, self_indices, self.data, \
+                  other_indptr, other_indices, other.data, \
                   indptr, indices, data)
 
-        return self.__class__((data,indices,indptr),shape=(M,N))
+        A = self.__class__((data,indices,indptr),shape=(M,N))
+        if sort_indices:
+            A.has_sorted_indices = True
+        return A
 
 
     def diagonal(self):
@@ -386,20 +428,13 @@ class _cs_matrix(_data_matrix):
         if stop <= start:
             raise ValueError("slice width must be >= 1")
 
-        #TODO make [i,:] faster
-        #TODO implement [i,x:y:z]
-
-        indices = []
+        M = self._swap(self.shape)[0]
+        if i < 0:
+            i += M
+        if not (0 <= i < M):
+            raise IndexError('index (%d) out of range' % i)
 
-        for ind in xrange(self.indptr[i], self.indptr[i+1]):
-            if self.indices[ind] >= start and self.indices[ind] < stop:
-                indices.append(ind)
-
-        index  = self.indices[indices] - start
-        data   = self.data[indices]
-        indptr = np.array([0, len(indices)])
-        return self.__class__((data, index, indptr), shape=shape, \
-                              dtype=self.dtype)
+        return self._submatrix(i, i + 1, start, stop)
 
     def _get_submatrix( self, slice0, slice1 ):
         """Return a submatrix of this matrix (new matrix is created)."""
@@ -440,14 +475,94 @@ class _cs_matrix(_data_matrix):
         _in_bounds( i0, i1, shape0 )
         _in_bounds( j0, j1, shape1 )
 
-        aux = sparsetools.get_csr_submatrix( shape0, shape1,
-                                             self.indptr, self.indices,
-                                             self.data,
-                                             i0, i1, j0, j1 )
+        return self._submatrix(i0, i1, j0, j1)
+
+    def _submatrix(self, i0, i1, j0, j1):
+        """Return rows i0:i1 and columns j0:j1 of a CSR matrix (the
+        transposed ranges of a CSC matrix).  The ranges must be in bounds.
+        """
+        i0, i1, j0, j1 = int(i0), int(i1), int(j0), int(j1)
+
+        if (j0, j1) == (0, self._swap(self.shape)[1]):
+            return self._major_range(i0, i1)
+
+        indptr = np.empty(i1 - i0 + 1, dtype=self.indptr.dtype)
+        sparsetools.csr_submatrix_count(self.indptr, self.indices,
+                                        i0, i1, j0, j1, indptr)
+
+        indices = np.empty(indptr[-1], dtype=self.indices.dtype)
+        data    = np.empty(indptr[-1], dtype=self.dtype)
+        sparsetools.csr_submatrix(self.indptr, self.indices, self.data,
+                                  i0, i1, j0, j1, indptr, indices, data)
 
-        data, indices, indptr = aux[2], aux[1], aux[0]
         shape = self._swap( (i1 - i0, j1 - j0) )
+        return self.__class__( (data,indices,indptr), shape=shape )
+
+    def _major_range(self, start, stop, copy=True):
+        """Return rows start:stop of a CSR matrix (columns of a CSC matrix)
+        with all of their entries.
+
+        With copy=False the result shares indices and data with this
+        matrix and only the index pointer is new.
+        """
+        M, N = self._swap(self.shape)
+        start, stop, stride = slice(start, stop).indices(M)
+        stop = max(start, stop)
+
+        lo, hi  = self.indptr[start], self.indptr[stop]
+        indptr  = self.indptr[start:stop + 1] - lo
+        indices = self.indices[lo:hi]
+        data    = self.data[lo:hi]
+        if copy:
+            indices = indices.copy()
+            data    = data.copy()
 
+        shape = self._swap( (stop - start, N) )
+        return self.__class__( (data,indices,indptr), shape=shape, copy=False )
+
+    def _major_index(self, idx):
+        """Return rows idx of a CSR matrix (columns of a CSC matrix)
+
+        idx is a 1-d array of indices in range, in any order and possibly
+        with repeats.
+        """
+        idx = np.asarray(idx, dtype=self.indptr.dtype)
+        N = self._swap(self.shape)[1]
+
+        indptr = np.empty(len(idx) + 1, dtype=self.indptr.dtype)
+        sparsetools.csr_row_index_count(len(idx), idx, self.indptr, indptr)
+
+        indices = np.empty(indptr[-1], dtype=self.indices.dtype)
+        data    = np.empty(indptr[-1], dtype=self.dtype)
+        sparsetools.csr_row_index(len(idx), idx, self.indptr, self.indices,
+                                  self.data, indptr, indices, data)
+
+        shape = self._swap( (len(idx), N) )
+        return self.__class__( (data,indices,indptr), shape=shape )
+
+    def _minor_index(self, idx):
+        """Return columns idx of a CSR matrix (rows of a CSC matrix)
+
+        idx is a 1-d array of indices in range, in any order and possibly
+        with repeats.
+        """
+        idx = np.asarray(idx, dtype=self.indices.dtype)
+        M, N = self._swap(self.shape)
+
+        col_offsets = np.empty(N + 1, dtype=self.indices.dtype)
+        col_order   = np.empty(len(idx), dtype=self.indices.dtype)
+        indptr      = np.empty(M + 1, dtype=self.indptr.dtype)
+        sparsetools.csr_column_index_count(len(idx), idx, M, N,
+                                           self.indptr, self.indices,
+                                           col_offsets, col_order, indptr)
+
+        indices = np.empty(indptr[-1], dtype=self.indices.dtype)
+        data    = np.empty(indptr[-1], dtype=self.dtype)
+        sparsetools.csr_column_index(M, self.indptr, self.indices, self.data,
+                                     col_offsets, col_order,
+                                     indptr, indices, data)
+
+        shape = self._swap( (M, len(idx)) )
         return self.__class__( (data,indices,indptr), shape=shape )
 
 
@@ -518,7 +633,7 @@ class _cs_matrix(_data_matrix):
     ######################
 
     def todia(self):
-        return self.tocoo(copy=False).todia()
+        return self.tocsr().todia()
 
     def todok(self):
         return self.tocoo(copy=False).todok()
@@ -537,7 +652,7 @@ class _cs_matrix(_data_matrix):
             data = data.copy()
             minor_indices = minor_indices.copy()
 
-        major_indices = np.empty(len(minor_indices), dtype=np.intc)
+        major_indices = np.empty(len(minor_indices), dtype=minor_indices.dtype)
 
         sparsetools.expandptr(major_dim,self.indptr,major_indices)
 
@@ -569,11 +684,15 @@ class _cs_matrix(_data_matrix):
 
         The is an *in place* operation
         """
-        self.sort_indices()
-
-        fn = sparsetools.csr_sum_duplicates
-        M,N = self._swap(self.shape)
-        fn( M, N, self.indptr, self.indices, self.data)
+        if self.has_sorted_indices:
+            fn = sparsetools.csr_sum_duplicates
+            M,N = self._swap(self.shape)
+            fn( M, N, self.indptr, self.indices, self.data)
+        else:
+            # sort and sum in a single pass
+            fn = sparsetools.csr_canonicalize
+            fn( len(self.indptr) - 1, self.indptr, self.indices, self.data)
+            self.has_sorted_indices = True
 
         self.prune() #nnz may have changed
 
@@ -660,13 +779,20 @@ class _cs_matrix(_data_matrix):
         fn = getattr(sparsetools, self.format + op + self.format)
 
         maxnnz  = self.nnz + other.nnz
-        indptr  = np.empty_like(self.indptr)
-        indices = np.empty(maxnnz, dtype=np.intc)
+        idx_dtype = get_index_dtype((self.indptr, self.indices,
+                                     other.indptr, other.indices),
+                                    maxval=maxnnz)
+        indptr  = np.empty(len(self.indptr), dtype=idx_dtype)
+        indices = np.empty(maxnnz, dtype=idx_dtype)
         data    = np.empty(maxnnz, dtype=upcast(self.dtype,other.dtype))
 
         fn(self.shape[0], self.shape[1], \
-                self.indptr,  self.indices,  self.data,
-                other.indptr, other.indices, other.data,
+                np.asarray(self.indptr,  dtype=idx_dtype),
+                np.asarray(self.indices, dtype=idx_dtype),
+                self.data,
+                np.asarray(other.indptr,  dtype=idx_dtype),
+                np.asarray(other.indices, dtype=idx_dtype),
+                other.data,
                 indptr, indices, data)
 
         actual_nnz = indptr[-1]
@@ -680,3 +806,10 @@ class _cs_matrix(_data_matrix):
         A = self.__class__((data, indices, indptr), shape=self.shape)
 
         return A
+
+
+def _max_major_length(A):
+    """length of the longest row (CSR) or column (CSC) of A"""
+    if len(A.indptr) < 2:
+        return 0
+    return int(np.diff(A.indptr).max())
@@ -11,14 +11,16 @@ from warnings import warn
 
 import numpy as np
 
-from sputils import upcast
+from sputils import upcast, get_index_dtype
 
-from csr import csr_matrix
+from base import isspmatrix
+from csr import csr_matrix, isspmatrix_csr
 from csc import csc_matrix
-from bsr import bsr_matrix
+from bsr import bsr_matrix, isspmatrix_bsr
 from coo import coo_matrix
 from lil import lil_matrix
 from dia import dia_matrix
+import sparsetools
 
 def spdiags(data, diags, m, n, format=None):
     """
@@ -83,14 +85,16 @@ def identity(n, dtype='d', format=None):
     """
 
     if format in ['csr','csc']:
-        indptr  = np.arange(n+1, dtype=np.intc)
-        indices = np.arange(n,   dtype=np.intc)
+        idx_dtype = get_index_dtype(maxval=n)
+        indptr  = np.arange(n+1, dtype=idx_dtype)
+        indices = np.arange(n,   dtype=idx_dtype)
         data    = np.ones(n,     dtype=dtype)
         cls = eval('%s_matrix' % format)
         return cls((data,indices,indptr),(n,n))
     elif format == 'coo':
-        row  = np.arange(n, dtype=np.intc)
-        col  = np.arange(n, dtype=np.intc)
+        idx_dtype = get_index_dtype(maxval=n)
+        row  = np.arange(n, dtype=idx_dtype)
+        col  = np.arange(n, dtype=idx_dtype)
         data = np.ones(n, dtype=dtype)
         return coo_matrix((data,(row,col)),(n,n))
     elif format == 'dia':
@@ -144,7 +148,8 @@ def kron(A, B, format=None):
             [15, 20,  0,  0]])
 
     """
-    B = coo_matrix(B)
+    if not isspmatrix(B):
+        B = coo_matrix(B)
 
     if (format is None or format == "bsr") and 2*B.nnz >= B.shape[0] * B.shape[1]:
         #B is fairly dense, use BSR
@@ -157,13 +162,28 @@ def kron(A, B, format=None):
             return coo_matrix( output_shape )
 
         B = B.toarray()
-        data = A.data.repeat(B.size).reshape(-1,B.shape[0],B.shape[1])
-        data = data * B
+        data = A.data.reshape(-1,1,1) * B
 
         return bsr_matrix((data,A.indices,A.indptr), shape=output_shape)
+    elif isspmatrix_csr(A) and isspmatrix_csr(B) and \
+            sparsetools.assembler_supports(upcast(A.dtype, B.dtype)):
+        #write the rows of the CSR result directly
+        output_shape = (A.shape[0]*B.shape[0], A.shape[1]*B.shape[1])
+        nnz = int(A.indptr[-1]) * int(B.indptr[-1])
+
+        idx_dtype = get_index_dtype(maxval=max(output_shape + (nnz,)))
+        indptr  = np.empty(output_shape[0] + 1, dtype=idx_dtype)
+        indices = np.empty(nnz, dtype=idx_dtype)
+        data    = np.empty(nnz, dtype=upcast(A.dtype, B.dtype))
+        sparsetools.csr_kron((A.indptr, A.indices, A.data),
+                             (B.indptr, B.indices, B.data), B.shape[1],
+                             indptr, indices, data)
+
+        return csr_matrix((data,indices,indptr), shape=output_shape).asformat(format)
     else:
         #use COO
         A = coo_matrix(A)
+        B = coo_matrix(B)
         output_shape = (A.shape[0]*B.shape[0], A.shape[1]*B.shape[1])
 
         if A.nnz == 0 or B.nnz == 0:
@@ -330,15 +350,29 @@ def bmat(blocks, format=None, dtype=None):
 
     M,N = blocks.shape
 
+    # CSR blocks, or BSR blocks of one block size, are copied into the
+    # result directly, anything else is converted to COO
+    present = [A for A in blocks.flat if A is not None]
+    if len(present) > 0 and all([isspmatrix_csr(A) for A in present]):
+        native = 'csr'
+    elif len(present) > 0 and all([isspmatrix_bsr(A) for A in present]) and \
+            len(set([A.blocksize for A in present])) == 1:
+        native = 'bsr'
+    else:
+        native = None
+
     block_mask   = np.zeros(blocks.shape,    dtype=np.bool)
-    brow_lengths = np.zeros(blocks.shape[0], dtype=np.intc)
-    bcol_lengths = np.zeros(blocks.shape[1], dtype=np.intc)
+    brow_lengths = np.zeros(blocks.shape[0], dtype=np.int64)
+    bcol_lengths = np.zeros(blocks.shape[1], dtype=np.int64)
 
-    # convert everything to COO format
+    # check the shapes, converting everything to COO unless native
     for i in range(M):
         for j in range(N):
             if blocks[i,j] is not None:
-                A = coo_matrix(blocks[i,j])
+                if native is None:
+                    A = coo_matrix(blocks[i,j])
+                else:
+                    A = blocks[i,j]
                 blocks[i,j] = A
                 block_mask[i,j] = True
 
@@ -361,22 +395,32 @@ def bmat(blocks, format=None, dtype=None):
     if bcol_lengths.min() == 0:
         raise ValueError('blocks[:,%d] is all None' % bcol_lengths.argmin() )
 
-    nnz = sum([ A.nnz for A in blocks[block_mask] ])
     if dtype is None:
         dtype = upcast( *tuple([A.dtype for A in blocks[block_mask]]) )
 
+    shape = (np.sum(brow_lengths), np.sum(bcol_lengths))
+
+    if native is not None and np.dtype(dtype).kind in 'biufc':
+        return _compressed_bmat(blocks, brow_lengths, bcol_lengths,
+                                dtype, native).asformat(format)
+
+    nnz = sum([ A.nnz for A in blocks[block_mask] ])
+
     row_offsets = np.concatenate(([0], np.cumsum(brow_lengths)))
     col_offsets = np.concatenate(([0], np.cumsum(bcol_lengths)))
 
     data = np.empty(nnz, dtype=dtype)
-    row  = np.empty(nnz, dtype=np.intc)
-    col  = np.empty(nnz, dtype=np.intc)
+    idx_dtype = get_index_dtype(maxval=max(row_offsets[-1], col_offsets[-1]))
+    row  = np.empty(nnz, dtype=idx_dtype)
+    col  = np.empty(nnz, dtype=idx_dtype)
 
     nnz = 0
     for i in range(M):
         for j in range(N):
             if blocks[i,j] is not None:
                 A = blocks[i,j]
+                if native is not None:
+                    A = A.tocoo()
                 data[nnz:nnz + A.nnz] = A.data
                 row[nnz:nnz + A.nnz]  = A.row
                 col[nnz:nnz + A.nnz]  = A.col
@@ -386,9 +430,49 @@ def bmat(blocks, format=None, dtype=None):
 
                 nnz += A.nnz
 
-    shape = (np.sum(brow_lengths), np.sum(bcol_lengths))
     return coo_matrix((data, (row, col)), shape=shape).asformat(format)
 
+def _compressed_bmat(blocks, brow_lengths, bcol_lengths, dtype, format):
+    """bmat for a grid of CSR matrices, or BSR matrices with equal
+    block sizes, without conversion to COO
+    """
+    M,N = blocks.shape
+    shape = (int(np.sum(brow_lengths)), int(np.sum(bcol_lengths)))
+
+    if format == 'bsr':
+        R,C = [A for A in blocks.flat if A is not None][0].blocksize
+    else:
+        R,C = 1,1
+
+    # offsets of the blocks in (block) rows and columns of the result
+    row_offsets = np.concatenate(([0], np.cumsum(brow_lengths // R)))
+    col_offsets = np.concatenate(([0], np.cumsum(bcol_lengths // C)))
+
+    grid = []
+    nnz = 0
+    for A in blocks.flat:
+        if A is None:
+            grid.append(None)
+        else:
+            grid.append((A.indptr, A.indices, A.data))
+            nnz += int(A.indptr[-1])
+
+    idx_dtype = get_index_dtype(maxval=max(shape + (nnz,)))
+    indptr  = np.empty(row_offsets[-1] + 1, dtype=idx_dtype)
+    indices = np.empty(nnz, dtype=idx_dtype)
+    if format == 'bsr':
+        data = np.empty((nnz,R,C), dtype=dtype)
+    else:
+        data = np.empty(nnz, dtype=dtype)
+
+    sparsetools.csr_bmat(M, N, grid, row_offsets, col_offsets,
+                         indptr, indices, data)
+
+    if format == 'bsr':
+        return bsr_matrix((data,indices,indptr), shape=shape)
+    else:
+        return csr_matrix((data,indices,indptr), shape=shape)
+
 def rand(m, n, density=0.01, format="coo", dtype=None):
     """Generate a sparse matrix of the given shape and density with uniformely
     distributed values.
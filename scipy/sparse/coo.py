@@ -8,10 +8,11 @@ from warnings import warn
 
 import numpy as np
 
-from sparsetools import coo_tocsr, coo_todense, coo_matvec
+from sparsetools import coo_tocsr_canonical, coo_todense, coo_matvec
 from base import isspmatrix
 from data import _data_matrix
-from sputils import upcast, to_native, isshape, getdtype, isintlike
+from sputils import upcast, to_native, isshape, getdtype, isintlike, \
+        get_index_dtype
 
 class coo_matrix(_data_matrix):
     """
@@ -100,8 +101,9 @@ class coo_matrix(_data_matrix):
             if isshape(arg1):
                 M, N = arg1
                 self.shape = (M,N)
-                self.row  = np.array([], dtype=np.intc)
-                self.col  = np.array([], dtype=np.intc)
+                idx_dtype = get_index_dtype(maxval=max(M,N))
+                self.row  = np.array([], dtype=idx_dtype)
+                self.col  = np.array([], dtype=idx_dtype)
                 self.data = np.array([], getdtype(dtype, default=float))
             else:
                 try:
@@ -115,8 +117,10 @@ class coo_matrix(_data_matrix):
                 except TypeError:
                     raise TypeError('invalid input format')
 
-                self.row  = np.array(ij[0], copy=copy, dtype=np.intc)
-                self.col  = np.array(ij[1], copy=copy, dtype=np.intc)
+                idx_dtype = get_index_dtype(ij, check_contents=True,
+                                            maxval=max(shape) if shape is not None else None)
+                self.row  = np.array(ij[0], copy=copy, dtype=idx_dtype)
+                self.col  = np.array(ij[1], copy=copy, dtype=idx_dtype)
                 self.data = np.array(  obj, copy=copy)
 
                 if shape is None:
@@ -138,8 +142,9 @@ class coo_matrix(_data_matrix):
                     'use coo_matrix( (M,N) ) instead', DeprecationWarning)
             self.shape = shape
             self.data = np.array([], getdtype(dtype, default=float))
-            self.row  = np.array([], dtype=np.intc)
-            self.col  = np.array([], dtype=np.intc)
+            idx_dtype = get_index_dtype(maxval=max(shape))
+            self.row  = np.array([], dtype=idx_dtype)
+            self.col  = np.array([], dtype=idx_dtype)
         else:
             if isspmatrix(arg1):
                 if isspmatrix_coo(arg1) and copy:
@@ -163,8 +168,11 @@ class coo_matrix(_data_matrix):
                 if np.rank(M) != 2:
                     raise TypeError('expected rank <= 2 array or matrix')
                 self.shape = M.shape
-                self.row,self.col = (M != 0).nonzero()
-                self.data  = M[self.row,self.col]
+                row, col = (M != 0).nonzero()
+                idx_dtype = get_index_dtype(maxval=max(self.shape))
+                self.row   = row.astype(idx_dtype)
+                self.col   = col.astype(idx_dtype)
+                self.data  = M[row,col]
 
         if dtype is not None:
             self.data = self.data.astype(dtype)
@@ -195,9 +203,10 @@ class coo_matrix(_data_matrix):
             warn("col index array has non-integer dtype (%s) " \
                     % self.col.dtype.name )
 
-        # only support 32-bit ints for now
-        self.row  = np.asarray(self.row, dtype=np.intc)
-        self.col  = np.asarray(self.col, dtype=np.intc)
+        # row and col must have the same index dtype
+        idx_dtype = get_index_dtype((self.row, self.col), maxval=max(self.shape))
+        self.row  = np.asarray(self.row, dtype=idx_dtype)
+        self.col  = np.asarray(self.col, dtype=idx_dtype)
         self.data = to_native(self.data)
 
         if nnz > 0:
@@ -246,16 +255,18 @@ class coo_matrix(_data_matrix):
             return csc_matrix(self.shape, dtype=self.dtype)
         else:
             M,N = self.shape
-            indptr  = np.empty(N + 1,    dtype=np.intc)
-            indices = np.empty(self.nnz, dtype=np.intc)
+            idx_dtype = get_index_dtype(self.row, maxval=max(self.nnz, M))
+            indptr  = np.empty(N + 1,    dtype=idx_dtype)
+            indices = np.empty(self.nnz, dtype=idx_dtype)
             data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
-            coo_tocsr(N, M, self.nnz, \
-                      self.col, self.row, self.data, \
-                      indptr, indices, data)
+            coo_tocsr_canonical(N, M, self.nnz, \
+                                np.asarray(self.col, dtype=idx_dtype), \
+                                np.asarray(self.row, dtype=idx_dtype), \
+                                self.data, indptr, indices, data)
 
             A = csc_matrix((data, indices, indptr), shape=self.shape)
-            A.sum_duplicates()
+            A.has_sorted_indices = True #and duplicates were summed
 
             return A
 
@@ -284,16 +295,18 @@ class coo_matrix(_data_matrix):
             return csr_matrix(self.shape, dtype=self.dtype)
         else:
             M,N = self.shape
-            indptr  = np.empty(M + 1,    dtype=np.intc)
-            indices = np.empty(self.nnz, dtype=np.intc)
+            idx_dtype = get_index_dtype(self.row, maxval=max(self.nnz, N))
+            indptr  = np.empty(M + 1,    dtype=idx_dtype)
+            indices = np.empty(self.nnz, dtype=idx_dtype)
             data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
-            coo_tocsr(M, N, self.nnz, \
-                      self.row, self.col, self.data, \
-                      indptr, indices, data)
+            coo_tocsr_canonical(M, N, self.nnz, \
+                                np.asarray(self.row, dtype=idx_dtype), \
+                                np.asarray(self.col, dtype=idx_dtype), \
+                                self.data, indptr, indices, data)
 
             A = csr_matrix((data, indices, indptr), shape=self.shape)
-            A.sum_duplicates()
+            A.has_sorted_indices = True #and duplicates were summed
 
             return A
 
@@ -99,8 +99,8 @@ class csc_matrix(_cs_matrix):
 
     def tocsr(self):
         M,N = self.shape
-        indptr  = np.empty(M + 1,    dtype=np.intc)
-        indices = np.empty(self.nnz, dtype=np.intc)
+        indptr  = np.empty(M + 1,    dtype=self.indptr.dtype)
+        indices = np.empty(self.nnz, dtype=self.indptr.dtype)
         data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
         csc_tocsr(M, N, \
@@ -126,8 +126,8 @@ class csc_matrix(_cs_matrix):
                 if isintlike(col) or isinstance(col,slice):
                     return self.T[col,row].T
                 else:
-                    row = np.asarray(row, dtype=np.intc)
-                    col = np.asarray(col, dtype=np.intc)
+                    row = np.asarray(row, dtype=self.indices.dtype)
+                    col = np.asarray(col, dtype=self.indices.dtype)
                     if len(row.shape) == 1:
                         return self.T[col,row]
                     elif len(row.shape) == 2:
@@ -143,6 +143,15 @@ class csc_matrix(_cs_matrix):
         else:
             return self.T[:,key].T                              #[[1,2]]
 
+    def getcols(self, start, stop, copy=True):
+        """Return columns start:stop of this matrix as a CSC matrix
+
+        With copy=False the result is a view that shares indices and data
+        with this matrix; only its index pointer is new.  Changes to the
+        values or the order of the entries of either matrix, e.g. by
+        sort_indices(), then show in the other one.
+        """
+        return self._major_range(start, stop, copy=copy)
 
     # these functions are used by the parent class (_cs_matrix)
     # to remove redudancy between csc_matrix and csr_matrix
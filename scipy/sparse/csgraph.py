@@ -2,11 +2,14 @@
 
 __docformat__ = "restructuredtext en"
 
-__all__ = ['cs_graph_components']
+__all__ = ['cs_graph_components', 'reverse_cuthill_mckee', 'nested_dissection',
+           'permute_symmetric']
 
 import numpy as np
 
-from sparsetools import cs_graph_components as _cs_graph_components
+import sparsetools
+from sparsetools import cs_graph_components as _cs_graph_components, \
+        cs_graph_rcm, cs_graph_nested_dissection, csr_permute_symmetric
 
 from csr import csr_matrix
 from base import isspmatrix
@@ -14,7 +17,11 @@ from base import isspmatrix
 _msg0 = 'x must be a symmetric square matrix!'
 _msg1 = _msg0 + '(has shape %s)'
 
-def cs_graph_components(x):
+_algorithms = {'auto'       : sparsetools.GRAPH_COMPONENTS_AUTO,
+               'bfs'        : sparsetools.GRAPH_COMPONENTS_BFS,
+               'union_find' : sparsetools.GRAPH_COMPONENTS_UNION_FIND}
+
+def cs_graph_components(x, algorithm='auto'):
     """
     Determine connected compoments of a graph stored as a compressed
     sparse row or column matrix. For speed reasons, the symmetry of the
@@ -27,6 +34,14 @@ def cs_graph_components(x):
     x: ndarray-like, 2 dimensions, or sparse matrix
         The adjacency matrix of the graph. Only the upper triangular part
         is used.
+    algorithm: {'auto', 'bfs', 'union_find'}, optional
+        - 'bfs' : breadth first search from one node of each component
+        - 'union_find' : union-find over the edges, run on several
+          threads (see scipy.sparse.sparsetools.set_num_threads)
+        - 'auto' : 'union_find' for graphs that are large enough to use
+          several threads, 'bfs' otherwise (default)
+
+        All algorithms give the same result for symmetric matrices.
 
     Returns
     --------
@@ -64,6 +79,11 @@ def cs_graph_components(x):
         shape = x.shape
     except AttributeError:
         raise ValueError(_msg0)
+
+    try:
+        algorithm = _algorithms[algorithm]
+    except KeyError:
+        raise ValueError("unknown algorithm '%s'" % (algorithm,))
     
     if not ((len(x.shape) == 2) and (x.shape[0] == x.shape[1])):
         raise ValueError(_msg1 % x.shape)
@@ -75,8 +95,144 @@ def cs_graph_components(x):
     
     label = np.empty((shape[0],), dtype=x.indptr.dtype)
 
-    n_comp = _cs_graph_components(shape[0], x.indptr, x.indices, label)
+    n_comp = _cs_graph_components(shape[0], x.indptr, x.indices, label,
+                                  algorithm)
 
     return n_comp, label
 
 
+def _square_csr(x):
+    """x as a square CSR matrix"""
+    try:
+        shape = x.shape
+    except AttributeError:
+        raise ValueError('x must be a square matrix')
+
+    if not ((len(shape) == 2) and (shape[0] == shape[1])):
+        raise ValueError('x must be a square matrix (has shape %s)' % (shape,))
+
+    if isspmatrix(x):
+        return x.tocsr()
+    else:
+        return csr_matrix(x)
+
+def _graph_structure(x, symmetric_mode):
+    """Sparsity structure of x as a CSR matrix, symmetrized unless
+    symmetric_mode is True"""
+    x = _square_csr(x)
+    if not symmetric_mode:
+        S = csr_matrix((np.ones(len(x.indices), dtype=np.int8),
+                        x.indices, x.indptr), shape=x.shape)
+        x = S + S.T
+    return x
+
+def reverse_cuthill_mckee(x, symmetric_mode=False):
+    """
+    Reverse Cuthill-McKee ordering of a square sparse matrix.
+
+    Returns a permutation that reduces the bandwidth and profile of x
+    when it is applied to both the rows and the columns, e.g. with
+    permute_symmetric().  Banded matrices make better use of the cache
+    in matrix-vector products.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The matrix to reorder.  Only its sparsity structure is used.
+    symmetric_mode: bool, optional
+        If True, the structure of x is assumed to be symmetric and is
+        used as is.  Otherwise the structure of x + x.T is used
+        (default).
+
+    Returns
+    --------
+    perm: ndarray (ints, 1 dimension)
+        perm[k] is the row (and column) of x that is placed at k.
+
+    Example
+    -------
+
+    >>> from scipy.sparse import reverse_cuthill_mckee, permute_symmetric
+    >>> import numpy as np
+    >>> D = np.eye(4)
+    >>> D[0,3] = D[3,0] = 1
+    >>> perm = reverse_cuthill_mckee(D)
+    >>> permute_symmetric(D, perm).todense()
+    matrix([[ 1.,  0.,  0.,  0.],
+            [ 0.,  1.,  0.,  0.],
+            [ 0.,  0.,  1.,  1.],
+            [ 0.,  0.,  1.,  1.]])
+
+    """
+    x = _graph_structure(x, symmetric_mode)
+    perm = np.empty((x.shape[0],), dtype=x.indptr.dtype)
+    cs_graph_rcm(x.shape[0], x.indptr, x.indices, perm)
+    return perm
+
+def nested_dissection(x, symmetric_mode=False):
+    """
+    Nested dissection ordering of a square sparse matrix.
+
+    The graph of x is split recursively by small vertex separators,
+    which are ordered after the parts they separate.  Each split is
+    computed by a multilevel bisection (coarsening by heavy edge
+    matching, then refinement on every level).  Eliminating the
+    unknowns in this order produces little fill-in in sparse
+    factorizations of matrices from 2-d and 3-d meshes.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The matrix to reorder.  Only its sparsity structure is used.
+    symmetric_mode: bool, optional
+        If True, the structure of x is assumed to be symmetric and is
+        used as is.  Otherwise the structure of x + x.T is used
+        (default).
+
+    Returns
+    --------
+    perm: ndarray (ints, 1 dimension)
+        perm[k] is the row (and column) of x that is placed at k.
+
+    """
+    x = _graph_structure(x, symmetric_mode)
+    perm = np.empty((x.shape[0],), dtype=x.indptr.dtype)
+    cs_graph_nested_dissection(x.shape[0], x.indptr, x.indices, perm)
+    return perm
+
+def permute_symmetric(x, perm):
+    """
+    Apply a permutation to the rows and the columns of a square matrix.
+
+    Returns the CSR matrix x[perm,:][:,perm], which is built in a single
+    pass over x.
+
+    Parameters
+    -----------
+    x: ndarray-like, 2 dimensions, or sparse matrix
+        The matrix to permute.
+    perm: array-like (ints, 1 dimension)
+        A permutation of range(x.shape[0]), e.g. from
+        reverse_cuthill_mckee() or nested_dissection().
+
+    """
+    x = _square_csr(x)
+    n = x.shape[0]
+
+    perm = np.asarray(perm, dtype=x.indptr.dtype)
+    if perm.shape != (n,):
+        raise ValueError('perm must have length %d' % n)
+    if n > 0 and (perm.min() < 0 or perm.max() >= n):
+        raise ValueError('perm is not a permutation')
+    present = np.zeros(n, dtype=bool)
+    present[perm] = True
+    if not present.all():
+        raise ValueError('perm is not a permutation')
+
+    indptr  = np.empty(n + 1, dtype=x.indptr.dtype)
+    indices = np.empty(x.nnz, dtype=x.indices.dtype)
+    data    = np.empty(x.nnz, dtype=x.dtype)
+    csr_permute_symmetric(n, x.indptr, x.indices, x.data, perm,
+                          indptr, indices, data)
+
+    return csr_matrix((data, indices, indptr), shape=x.shape)
@@ -10,8 +10,9 @@ from warnings import warn
 import numpy as np
 
 from sparsetools import csr_tocsc, csr_tobsr, csr_count_blocks, \
-        get_csr_submatrix, csr_sample_values
-from sputils import upcast, isintlike
+        csr_tosell_pass1, csr_tosell, \
+        csr_sample_values, csr_matmat_plan, csr_todia_offsets, csr_todia
+from sputils import upcast, isintlike, get_index_dtype
 
 
 from compressed import _cs_matrix
@@ -53,6 +54,13 @@ class csr_matrix(_cs_matrix):
       - slow column slicing operations (consider CSC)
       - changes to the sparsity structure are expensive (consider LIL or DOK)
 
+    Repeated products
+      When A.reuse_product_pattern is set to True, A*B for a CSR matrix B
+      keeps the pattern of the product.  Later products with matrices
+      that have the same patterns as A and B, e.g. in Newton iterations,
+      then only compute the values.  The result keeps entries whose
+      products sum to zero.
+
     Examples
     --------
 
@@ -81,6 +89,39 @@ class csr_matrix(_cs_matrix):
 
     """
 
+    # see 'Repeated products' above
+    reuse_product_pattern = False
+
+    def _mul_sparse_matrix(self, other):
+        if not self.reuse_product_pattern or not isspmatrix_csr(other):
+            return _cs_matrix._mul_sparse_matrix(self, other)
+
+        M, N = self.shape[0], other.shape[1]
+
+        plan = getattr(self, '_product_plan', None)
+        if plan is None or plan.shape != (M,N) or \
+                not plan.matches(self.indptr, self.indices,
+                                 other.indptr, other.indices):
+            # the product pointer of the plan counts the products
+            n_products = np.diff(other.indptr)[self.indices].sum()
+            idx_dtype = get_index_dtype((self.indptr, self.indices,
+                                         other.indptr, other.indices),
+                                        maxval=max(M, N, n_products))
+            plan = csr_matmat_plan(M, N,
+                                   np.asarray(self.indptr,    dtype=idx_dtype),
+                                   np.asarray(self.indices,   dtype=idx_dtype),
+                                   np.asarray(other.indptr,  dtype=idx_dtype),
+                                   np.asarray(other.indices, dtype=idx_dtype))
+            self._product_plan = plan
+
+        data = np.empty(len(plan.indices), dtype=upcast(self.dtype, other.dtype))
+        plan.numeric(np.asarray(self.data,  dtype=data.dtype),
+                     np.asarray(other.data, dtype=data.dtype), data)
+
+        A = csr_matrix((data, plan.indices.copy(), plan.indptr.copy()), shape=(M,N))
+        A.has_sorted_indices = True
+        return A
+
     def transpose(self, copy=False):
         from csc import csc_matrix
         M,N = self.shape
@@ -110,8 +151,9 @@ class csr_matrix(_cs_matrix):
             return self
 
     def tocsc(self):
-        indptr  = np.empty(self.shape[1] + 1, dtype=np.intc)
-        indices = np.empty(self.nnz, dtype=np.intc)
+        idx_dtype = self.indptr.dtype
+        indptr  = np.empty(self.shape[1] + 1, dtype=idx_dtype)
+        indices = np.empty(self.nnz, dtype=idx_dtype)
         data    = np.empty(self.nnz, dtype=upcast(self.dtype))
 
         csr_tocsc(self.shape[0], self.shape[1], \
@@ -123,6 +165,23 @@ class csr_matrix(_cs_matrix):
         A.has_sorted_indices = True
         return A
 
+    def todia(self):
+        from dia import dia_matrix
+
+        M,N = self.shape
+        if self.nnz == 0:
+            return dia_matrix(self.shape, dtype=self.dtype)
+
+        # diag_map[k + M - 1] is the row of diagonal k in data, or -1
+        diag_map = np.empty(M + N - 1, dtype=self.indices.dtype)
+        num_diags = csr_todia_offsets(M, N, self.indptr, self.indices, diag_map)
+        offsets = np.flatnonzero(diag_map >= 0) - (M - 1)
+
+        data = np.zeros((num_diags, N), dtype=self.dtype)
+        csr_todia(M, self.indptr, self.indices, self.data, diag_map, N, data)
+
+        return dia_matrix((data, offsets), shape=self.shape)
+
     def tobsr(self, blocksize=None, copy=True):
         from bsr import bsr_matrix
 
@@ -143,8 +202,8 @@ class csr_matrix(_cs_matrix):
 
             blks = csr_count_blocks(M,N,R,C,self.indptr,self.indices)
 
-            indptr  = np.empty(M//R + 1,    dtype=np.intc)
-            indices = np.empty(blks,       dtype=np.intc)
+            indptr  = np.empty(M//R + 1,    dtype=self.indptr.dtype)
+            indices = np.empty(blks,       dtype=self.indptr.dtype)
             data    = np.zeros((blks,R,C), dtype=self.dtype)
 
             csr_tobsr(M, N, R, C, self.indptr, self.indices, self.data, \
@@ -152,6 +211,42 @@ class csr_matrix(_cs_matrix):
 
             return bsr_matrix((data,indices,indptr), shape=self.shape)
 
+    def tosell(self, C=8, sigma=256):
+        """Return this matrix in SELL-C-sigma format
+
+        Parameters
+        ----------
+        C : int
+            chunk height, a multiple of the SIMD width (8 suits both
+            AVX2 and AVX-512)
+        sigma : int
+            rows are sorted by length inside windows of sigma rows,
+            sigma <= 1 keeps the original row order
+        """
+        from sell import sell_matrix
+
+        C, sigma = int(C), int(sigma)
+        if C < 1:
+            raise ValueError('invalid chunk height %d' % C)
+
+        M,N = self.shape
+        n_chunks = (M + C - 1) // C
+
+        idx_dtype = self.indptr.dtype
+        perm   = np.empty(M,            dtype=idx_dtype)
+        indptr = np.empty(n_chunks + 1, dtype=idx_dtype)
+
+        csr_tosell_pass1(M, self.indptr, C, sigma, perm, indptr)
+
+        indices = np.empty(indptr[-1], dtype=idx_dtype)
+        data    = np.empty(indptr[-1], dtype=self.dtype)
+
+        csr_tosell(M, N, self.indptr, self.indices, self.data, C, \
+                   perm, indptr, indices, data)
+
+        return sell_matrix((data, indices, indptr, perm), shape=self.shape, \
+                           C=C, sigma=sigma)
+
     # these functions are used by the parent class (_cs_matrix)
     # to remove redudancy between csc_matrix and csr_matrix
     def _swap(self,x):
@@ -163,7 +258,7 @@ class csr_matrix(_cs_matrix):
     def __getitem__(self, key):
         def asindices(x):
             try:
-                x = np.asarray(x, dtype=np.intc)
+                x = np.asarray(x, dtype=self.indices.dtype)
             except:
                 raise IndexError('invalid index')
             else:
@@ -179,9 +274,8 @@ class csr_matrix(_cs_matrix):
 
             return (min_indx,max_indx)
 
-        def extractor(indices,N):
-            """Return a sparse matrix P so that P*self implements
-            slicing of the form self[[1,2,3],:]
+        def normalize(indices,N):
+            """Return indices as an index array with values in [0,N)
             """
             indices = asindices(indices)
 
@@ -191,11 +285,7 @@ class csr_matrix(_cs_matrix):
                 indices = indices.copy()
                 indices[indices < 0] += N
 
-            indptr  = np.arange(len(indices) + 1, dtype=np.intc)
-            data    = np.ones(len(indices), dtype=self.dtype)
-            shape   = (len(indices),N)
-
-            return csr_matrix((data,indices,indptr), shape=shape)
+            return indices
 
 
         if isinstance(key, tuple):
@@ -209,22 +299,22 @@ class csr_matrix(_cs_matrix):
                 elif isinstance(col, slice):
                     return self._get_row_slice(row, col)      #[i,1:2]
                 else:
-                    P = extractor(col,self.shape[1]).T        #[i,[1,2]]
-                    return self[row,:]*P
+                    col = normalize(col,self.shape[1])        #[i,[1,2]]
+                    return self[row,:]._minor_index(col)
 
             elif isinstance(row, slice):
                 #[1:2,??]
                 if isintlike(col) or isinstance(col, slice):
                     return self._get_submatrix(row, col)      #[1:2,j]
                 else:
-                    P = extractor(col,self.shape[1]).T        #[1:2,[1,2]]
-                    return self[row,:]*P
+                    col = normalize(col,self.shape[1])        #[1:2,[1,2]]
+                    return self[row,:]._minor_index(col)
 
             else:
                 #[[1,2],??] or [[[1],[2]],??]
                 if isintlike(col) or isinstance(col,slice):
-                    P = extractor(row, self.shape[0])        #[[1,2],j] or [[1,2],1:2]
-                    return (P*self)[:,col]
+                    row = normalize(row, self.shape[0])      #[[1,2],j] or [[1,2],1:2]
+                    return self._major_index(row)[:,col]
 
                 else:
                     row = asindices(row)
@@ -248,8 +338,8 @@ class csr_matrix(_cs_matrix):
 
                     elif len(row.shape) == 2:
                         row = np.ravel(row)                   #[[[1],[2]],[1,2]]
-                        P = extractor(row, self.shape[0])
-                        return (P*self)[:,col]
+                        row = normalize(row, self.shape[0])
+                        return self._major_index(row)[:,col]
 
                     else:
                         raise NotImplementedError('unsupported indexing')
@@ -303,19 +393,7 @@ class csr_matrix(_cs_matrix):
         if stop <= start:
             raise ValueError("slice width must be >= 1")
 
-        #TODO make [i,:] faster
-        #TODO implement [i,x:y:z]
-
-        indices = []
-
-        for ind in xrange(self.indptr[i], self.indptr[i+1]):
-            if self.indices[ind] >= start and self.indices[ind] < stop:
-                indices.append(ind)
-
-        index  = self.indices[indices] - start
-        data   = self.data[indices]
-        indptr = np.array([0, len(indices)])
-        return csr_matrix( (data, index, indptr), shape=(1, stop-start) )
+        return self._submatrix(i, i + 1, start, stop)
 
     def _get_submatrix( self, row_slice, col_slice ):
         """Return a submatrix of this matrix (new matrix is created)."""
@@ -357,13 +435,17 @@ class csr_matrix(_cs_matrix):
         check_bounds( i0, i1, M )
         check_bounds( j0, j1, N )
 
-        indptr, indices, data = get_csr_submatrix( M, N, \
-                self.indptr, self.indices, self.data, \
-                int(i0), int(i1), int(j0), int(j1) )
+        return self._submatrix(i0, i1, j0, j1)
 
-        shape =  (i1 - i0, j1 - j0)
+    def getrows(self, start, stop, copy=True):
+        """Return rows start:stop of this matrix as a CSR matrix
 
-        return self.__class__( (data,indices,indptr), shape=shape )
+        With copy=False the result is a view that shares indices and data
+        with this matrix; only its index pointer is new.  Changes to the
+        values or the order of the entries of either matrix, e.g. by
+        sort_indices(), then show in the other one.
+        """
+        return self._major_range(start, stop, copy=copy)
 
 
 
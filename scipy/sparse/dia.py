@@ -8,7 +8,8 @@ import numpy as np
 
 from base import isspmatrix, _formats
 from data import _data_matrix
-from sputils import isshape, upcast, getdtype
+from sputils import isshape, upcast, getdtype, get_index_dtype, has_mixed_kernel
+import sparsetools
 from sparsetools import dia_matvec
 
 class dia_matrix(_data_matrix):
@@ -73,7 +74,7 @@ class dia_matrix(_data_matrix):
                 # create empty matrix
                 self.shape   = arg1   #spmatrix checks for errors here
                 self.data    = np.zeros( (0,0), getdtype(dtype, default=float))
-                self.offsets = np.zeros( (0), dtype=np.intc)
+                self.offsets = np.zeros( (0), dtype=get_index_dtype(maxval=max(self.shape)))
             else:
                 try:
                     # Try interpreting it as (data, offsets)
@@ -83,8 +84,11 @@ class dia_matrix(_data_matrix):
                 else:
                     if shape is None:
                         raise ValueError('expected a shape argument')
+                    # offsets are passed to dia_matvec with the matrix
+                    # dimensions, so they need 64 bits for huge shapes
+                    idx_dtype = get_index_dtype(maxval=max(shape))
                     self.data    = np.atleast_2d(np.array(arg1[0], dtype=dtype, copy=copy))
-                    self.offsets = np.atleast_1d(np.array(arg1[1], dtype=np.intc, copy=copy))
+                    self.offsets = np.atleast_1d(np.array(arg1[1], dtype=idx_dtype, copy=copy))
                     self.shape   = shape
         else:
             #must be dense, convert to COO first, then to DIA
@@ -151,7 +155,11 @@ class dia_matrix(_data_matrix):
 
         M,N = self.shape
 
-        dia_matvec(M,N, len(self.offsets), L, self.offsets, self.data, x.ravel(), y.ravel())
+        if has_mixed_kernel(self.dtype, y.dtype):
+            fn = sparsetools.dia_matvec_mixed
+        else:
+            fn = dia_matvec
+        fn(M,N, len(self.offsets), L, self.offsets, self.data, x.ravel(), y.ravel())
 
         return y
 
@@ -165,12 +173,28 @@ class dia_matrix(_data_matrix):
             return self
 
     def tocsr(self):
-        #this could be faster
-        return self.tocoo().tocsr()
+        M,N = self.shape
+        L = self.data.shape[1]
+
+        idx_dtype = get_index_dtype(maxval=max(M, N, self.getnnz()))
+        offsets = np.asarray(self.offsets, dtype=idx_dtype)
+
+        indptr = np.empty(M + 1, dtype=idx_dtype)
+        sparsetools.dia_tocsr_count(M, N, len(offsets), L, offsets,
+                                    self.data, indptr)
+
+        indices = np.empty(indptr[-1], dtype=idx_dtype)
+        data    = np.empty(indptr[-1], dtype=self.dtype)
+        sparsetools.dia_tocsr(M, N, len(offsets), L, offsets, self.data,
+                              indptr, indices, data)
+
+        from csr import csr_matrix
+        A = csr_matrix((data, indices, indptr), shape=self.shape)
+        A.has_sorted_indices = True
+        return A
 
     def tocsc(self):
-        #this could be faster
-        return self.tocoo().tocsc()
+        return self.tocsr().tocsc()
 
     def tocoo(self):
         num_data = len(self.data)
@@ -9,7 +9,9 @@ from itertools import izip
 import numpy as np
 
 from base import spmatrix, isspmatrix
-from sputils import isdense, getdtype, isshape, isintlike, isscalarlike, upcast
+from sputils import isdense, getdtype, isshape, isintlike, isscalarlike, upcast, \
+        get_index_dtype
+import sparsetools
 
 try:
     from operator import isSequenceType as _is_sequence
@@ -510,7 +512,8 @@ class dok_matrix(spmatrix, dict):
             return coo_matrix(self.shape, dtype=self.dtype)
         else:
             data    = np.asarray(self.values(), dtype=self.dtype)
-            indices = np.asarray(self.keys(), dtype=np.intc).T
+            idx_dtype = get_index_dtype(maxval=max(self.shape))
+            indices = np.asarray(self.keys(), dtype=idx_dtype).T
             return coo_matrix((data,indices), shape=self.shape, dtype=self.dtype)
 
     def todok(self,copy=False):
@@ -521,7 +524,16 @@ class dok_matrix(spmatrix, dict):
 
     def tocsr(self):
         """ Return a copy of this matrix in Compressed Sparse Row format"""
-        return self.tocoo().tocsr()
+        if self.nnz == 0 or not sparsetools.assembler_supports(self.dtype):
+            return self.tocoo().tocsr()
+
+        # build the rows directly instead of sorting a COO matrix
+        from csr import csr_matrix
+        ij = np.asarray(self.keys(), dtype=np.intp).reshape(-1, 2)
+        A = sparsetools.assembler(self.shape, self.dtype)
+        A.add(ij[:,0], ij[:,1], np.asarray(self.values(), dtype=self.dtype))
+        data, indices, indptr = A.tocsr()
+        return csr_matrix((data, indices, indptr), shape=self.shape)
 
     def tocsc(self):
         """ Return a copy of this matrix in Compressed Sparse Column format"""
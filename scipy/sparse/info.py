@@ -7,7 +7,7 @@ SciPy 2-D sparse matrix package.
 Original code by Travis Oliphant.
 Modified and extended by Ed Schofield, Robert Cimrman, and Nathan Bell.
 
-There are seven available sparse matrix types:
+There are eight available sparse matrix types:
     1. csc_matrix: Compressed Sparse Column format
     2. csr_matrix: Compressed Sparse Row format
     3. bsr_matrix: Block Sparse Row format
@@ -15,6 +15,7 @@ There are seven available sparse matrix types:
     5. dok_matrix: Dictionary of Keys format
     6. coo_matrix: COOrdinate format (aka IJV, triplet format)
     7. dia_matrix: DIAgonal format
+    8. sell_matrix: Sliced ELLPACK (SELL-C-sigma) format
 
 To construct a matrix efficiently, use either lil_matrix (recommended) or
 dok_matrix. The lil_matrix class supports basic slicing and fancy
@@ -115,6 +116,7 @@ Modules
    dok - Dictionary Of Keys based matrix
    extract - Functions to extract parts of sparse matrices
    lil - LInked List sparse matrix class
+   sell - Sliced ELLPACK (SELL-C-sigma) format
    linalg -
    sparsetools - A collection of routines for sparse matrix operations
    spfuncs - Functions that operate on sparse matrices
@@ -135,6 +137,7 @@ Classes
    dia_matrix - Sparse matrix with DIAgonal storage
    dok_matrix - Dictionary Of Keys based sparse matrix
    lil_matrix - Row-based linked list sparse matrix
+   sell_matrix - Sliced ELLPACK matrix for repeated products
 
 Functions
 ---------
@@ -157,6 +160,7 @@ Functions
    isspmatrix_dia -
    isspmatrix_dok -
    isspmatrix_lil -
+   isspmatrix_sell -
    kron - kronecker product of two sparse matrices
    kronsum - kronecker sum of sparse matrices
    lil_diags - Generate a lil_matrix with the given diagonals
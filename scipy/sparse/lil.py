@@ -10,7 +10,8 @@ from bisect import bisect_left
 import numpy as np
 
 from base import spmatrix, isspmatrix
-from sputils import getdtype, isshape, issequence, isscalarlike
+from sputils import getdtype, isshape, issequence, isscalarlike, get_index_dtype
+import sparsetools
 
 class lil_matrix(spmatrix):
     """Row-based linked list sparse matrix
@@ -424,15 +425,13 @@ class lil_matrix(spmatrix):
         """ Return Compressed Sparse Row format arrays for this matrix.
         """
 
-        indptr = np.asarray([len(x) for x in self.rows], dtype=np.intc)
-        indptr = np.concatenate( (np.array([0], dtype=np.intc), np.cumsum(indptr)) )
-
-        nnz = indptr[-1]
+        lengths = [len(x) for x in self.rows]
+        idx_dtype = get_index_dtype(maxval=max(self.shape[1], sum(lengths)))
 
         indices = []
         for x in self.rows:
             indices.extend(x)
-        indices = np.asarray(indices, dtype=np.intc)
+        indices = np.asarray(indices, dtype=idx_dtype)
 
         data = []
         for x in self.data:
@@ -440,6 +439,19 @@ class lil_matrix(spmatrix):
         data = np.asarray(data, dtype=self.dtype)
 
         from csr import csr_matrix
+
+        if sparsetools.assembler_supports(self.dtype):
+            # rows that were modified through A.rows and A.data need not
+            # be sorted, the assembler returns canonical CSR in any case
+            rows = np.repeat(np.arange(self.shape[0]), lengths)
+            A = sparsetools.assembler(self.shape, self.dtype)
+            A.add(rows, indices, data)
+            data, indices, indptr = A.tocsr()
+            return csr_matrix((data, indices, indptr), shape=self.shape)
+
+        indptr = np.asarray(lengths, dtype=idx_dtype)
+        indptr = np.concatenate( (np.array([0], dtype=idx_dtype), np.cumsum(indptr, dtype=idx_dtype)) )
+
         return csr_matrix((data, indices, indptr), shape=self.shape)
 
     def tocsc(self):
@@ -134,6 +134,7 @@ cgssv(superlu_options_t *options, SuperMatrix *A, int *perm_c, int *perm_r,
       SuperMatrix *L, SuperMatrix *U, SuperMatrix *B,
       SuperLUStat_t *stat, int *info )
 {
+    GlobalLU_t Glu; /* storage of the factors while they are computed */
 
     DNformat *Bstore;
     SuperMatrix *AA;/* A in SLU_NC format used by the factorization routine.*/
@@ -207,7 +208,7 @@ cgssv(superlu_options_t *options, SuperMatrix *A, int *perm_c, int *perm_r,
     t = SuperLU_timer_(); 
     /* Compute the LU factorization of A. */
     cgstrf(options, &AC, relax, panel_size, etree,
-            NULL, lwork, perm_c, perm_r, L, U, stat, info);
+            NULL, lwork, perm_c, perm_r, L, U, &Glu, stat, info);
     utime[FACT] = SuperLU_timer_() - t;
 
     t = SuperLU_timer_();
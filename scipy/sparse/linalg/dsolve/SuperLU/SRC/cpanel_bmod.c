@@ -104,7 +104,7 @@ cpanel_bmod (
     complex      comp_temp, comp_temp1;
     register int ldaTmp;
     register int r_ind, r_hi;
-    static   int first = 1, maxsuper, rowblk, colblk;
+    int       first = 1, maxsuper, rowblk, colblk;
     flops_t  *ops = stat->ops;
     
     xsup    = Glu->xsup;
@@ -381,6 +381,7 @@ dgsisx(superlu_options_t *options, SuperMatrix *A, int *perm_c, int *perm_r,
        double *recip_pivot_growth, double *rcond,
        mem_usage_t *mem_usage, SuperLUStat_t *stat, int *info)
 {
+    static GlobalLU_t Glu; /* persistent to facilitate multiple factors. */
 
     DNformat  *Bstore, *Xstore;
     double    *Bmat, *Xmat;
@@ -601,7 +602,7 @@ dgsisx(superlu_options_t *options, SuperMatrix *A, int *perm_c, int *perm_r,
 	/* Compute the LU factorization of A*Pc. */
 	t0 = SuperLU_timer_();
 	dgsitrf(options, &AC, relax, panel_size, etree, work, lwork,
-                perm_c, perm_r, L, U, stat, info);
+                perm_c, perm_r, L, U, &Glu, stat, info);
 	utime[FACT] = SuperLU_timer_() - t0;
 
 	if ( lwork == -1 ) {
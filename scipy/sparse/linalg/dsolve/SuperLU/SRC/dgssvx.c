@@ -340,6 +340,7 @@ dgssvx(superlu_options_t *options, SuperMatrix *A, int *perm_c, int *perm_r,
        double *rcond, double *ferr, double *berr, 
        mem_usage_t *mem_usage, SuperLUStat_t *stat, int *info )
 {
+    static GlobalLU_t Glu; /* persistent to facilitate multiple factors. */
 
 
     DNformat  *Bstore, *Xstore;
@@ -529,7 +530,7 @@ printf("dgssvx: Fact=%4d, Trans=%4d, equed=%c\n",
 	/* Compute the LU factorization of A*Pc. */
 	t0 = SuperLU_timer_();
 	dgstrf(options, &AC, relax, panel_size, etree,
-                work, lwork, perm_c, perm_r, L, U, stat, info);
+                work, lwork, perm_c, perm_r, L, U, &Glu, stat, info);
 	utime[FACT] = SuperLU_timer_() - t0;
 	
 	if ( lwork == -1 ) {
@@ -76,7 +76,7 @@ ilu_ccolumn_dfs(
     int     mem_error;
     int     *xsup, *supno, *lsub, *xlsub;
     int     nzlmax;
-    static  int  first = 1, maxsuper;
+    int       first = 1, maxsuper;
 
     xsup    = Glu->xsup;
     supno   = Glu->supno;
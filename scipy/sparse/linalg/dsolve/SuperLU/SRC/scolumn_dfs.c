@@ -91,7 +91,7 @@ scolumn_dfs(
     int     mem_error;
     int     *xsup, *supno, *lsub, *xlsub;
     int     nzlmax;
-    static  int  first = 1, maxsuper;
+    int       first = 1, maxsuper;
     
     xsup    = Glu->xsup;
     supno   = Glu->supno;
@@ -160,7 +160,8 @@ extern void    fixupL (const int, const int *, GlobalLU_t *);
 extern void    callocateA (int, int, complex **, int **, int **);
 extern void    cgstrf (superlu_options_t*, SuperMatrix*,
                        int, int, int*, void *, int, int *, int *, 
-                       SuperMatrix *, SuperMatrix *, SuperLUStat_t*, int *);
+                       SuperMatrix *, SuperMatrix *, GlobalLU_t *,
+                       SuperLUStat_t*, int *);
 extern int     csnode_dfs (const int, const int, const int *, const int *,
 			     const int *, int *, int *, GlobalLU_t *);
 extern int     csnode_bmod (const int, const int, const int, complex *,
@@ -191,7 +192,7 @@ extern void    cgstrs (trans_t, SuperMatrix *, SuperMatrix *, int *, int *,
 /* ILU */
 extern void    cgsitrf (superlu_options_t*, SuperMatrix*, int, int, int*,
 		        void *, int, int *, int *, SuperMatrix *, SuperMatrix *,
-                        SuperLUStat_t*, int *);
+                        GlobalLU_t *, SuperLUStat_t*, int *);
 extern int     cldperm(int, int, int, int [], int [], complex [],
                         int [],	float [], float []);
 extern int     ilu_csnode_dfs (const int, const int, const int *, const int *,
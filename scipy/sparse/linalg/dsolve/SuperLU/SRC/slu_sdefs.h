@@ -159,7 +159,8 @@ extern void    fixupL (const int, const int *, GlobalLU_t *);
 extern void    sallocateA (int, int, float **, int **, int **);
 extern void    sgstrf (superlu_options_t*, SuperMatrix*,
                        int, int, int*, void *, int, int *, int *, 
-                       SuperMatrix *, SuperMatrix *, SuperLUStat_t*, int *);
+                       SuperMatrix *, SuperMatrix *, GlobalLU_t *,
+                       SuperLUStat_t*, int *);
 extern int     ssnode_dfs (const int, const int, const int *, const int *,
 			     const int *, int *, int *, GlobalLU_t *);
 extern int     ssnode_bmod (const int, const int, const int, float *,
@@ -190,7 +191,7 @@ extern void    sgstrs (trans_t, SuperMatrix *, SuperMatrix *, int *, int *,
 /* ILU */
 extern void    sgsitrf (superlu_options_t*, SuperMatrix*, int, int, int*,
 		        void *, int, int *, int *, SuperMatrix *, SuperMatrix *,
-                        SuperLUStat_t*, int *);
+                        GlobalLU_t *, SuperLUStat_t*, int *);
 extern int     sldperm(int, int, int, int [], int [], float [],
                         int [],	float [], float []);
 extern int     ilu_ssnode_dfs (const int, const int, const int *, const int *,
@@ -160,7 +160,8 @@ extern void    fixupL (const int, const int *, GlobalLU_t *);
 extern void    zallocateA (int, int, doublecomplex **, int **, int **);
 extern void    zgstrf (superlu_options_t*, SuperMatrix*,
                        int, int, int*, void *, int, int *, int *, 
-                       SuperMatrix *, SuperMatrix *, SuperLUStat_t*, int *);
+                       SuperMatrix *, SuperMatrix *, GlobalLU_t *,
+                       SuperLUStat_t*, int *);
 extern int     zsnode_dfs (const int, const int, const int *, const int *,
 			     const int *, int *, int *, GlobalLU_t *);
 extern int     zsnode_bmod (const int, const int, const int, doublecomplex *,
@@ -191,7 +192,7 @@ extern void    zgstrs (trans_t, SuperMatrix *, SuperMatrix *, int *, int *,
 /* ILU */
 extern void    zgsitrf (superlu_options_t*, SuperMatrix*, int, int, int*,
 		        void *, int, int *, int *, SuperMatrix *, SuperMatrix *,
-                        SuperLUStat_t*, int *);
+                        GlobalLU_t *, SuperLUStat_t*, int *);
 extern int     zldperm(int, int, int, int [], int [], doublecomplex [],
                         int [],	double [], double []);
 extern int     ilu_zsnode_dfs (const int, const int, const int *, const int *,
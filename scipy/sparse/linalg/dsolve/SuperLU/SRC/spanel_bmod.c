@@ -103,7 +103,7 @@ spanel_bmod (
     float      one = 1.0;
     register int ldaTmp;
     register int r_ind, r_hi;
-    static   int first = 1, maxsuper, rowblk, colblk;
+    int       first = 1, maxsuper, rowblk, colblk;
     flops_t  *ops = stat->ops;
     
     xsup    = Glu->xsup;
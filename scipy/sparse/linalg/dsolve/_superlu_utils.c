@@ -7,67 +7,176 @@
 
 #include "_superluobject.h"
 #include "numpy/npy_3kcompat.h"
+#include "pythread.h"
 #include <setjmp.h>
+#include <string.h>
 
-jmp_buf _superlu_py_jmpbuf;
-PyObject *_superlumodule_memory_dict=NULL;
+/*
+ * Current SuperLUContext of each thread, see _superluobject.h
+ */
+static int superlu_context_key = -1;
+
+int superlu_context_init(void)
+{
+  if (superlu_context_key == -1) {
+    superlu_context_key = PyThread_create_key();
+  }
+  return superlu_context_key == -1 ? -1 : 0;
+}
+
+static SuperLUContext *superlu_context_current(void)
+{
+  return (SuperLUContext *) PyThread_get_key_value(superlu_context_key);
+}
+
+static void superlu_context_set_current(SuperLUContext *ctx)
+{
+  /* a key that already has a value is not overwritten */
+  PyThread_delete_key_value(superlu_context_key);
+  if (ctx != NULL) {
+    PyThread_set_key_value(superlu_context_key, ctx);
+  }
+}
+
+void superlu_context_enter(SuperLUContext *ctx)
+{
+  ctx->message[0] = '\0';
+  ctx->blocks.link.prev = &ctx->blocks;
+  ctx->blocks.link.next = &ctx->blocks;
+  ctx->thread_state = NULL;
+  ctx->previous = superlu_context_current();
+  superlu_context_set_current(ctx);
+}
+
+void superlu_context_release_gil(SuperLUContext *ctx)
+{
+  if (ctx->thread_state == NULL) {
+    ctx->thread_state = PyEval_SaveThread();
+  }
+}
+
+void superlu_context_acquire_gil(SuperLUContext *ctx)
+{
+  if (ctx->thread_state != NULL) {
+    PyEval_RestoreThread(ctx->thread_state);
+    ctx->thread_state = NULL;
+  }
+}
+
+/* Leave the context without using the Python API, e.g. in a thread that
+   Python does not know about.  After an abort, the memory allocated within
+   the context is freed and the message stays in ctx->message. */
+void superlu_context_leave(SuperLUContext *ctx, int aborted)
+{
+  SuperLUBlock *head = &ctx->blocks;
+  SuperLUBlock *block, *next;
+
+  superlu_context_set_current(ctx->previous);
+
+  if (head->link.next == head) {
+    /* nothing left */
+  }
+  else if (aborted) {
+    for (block = head->link.next; block != head; block = next) {
+      next = block->link.next;
+      free(block);
+    }
+  }
+  else if (ctx->previous != NULL) {
+    /* move the blocks to the enclosing context */
+    SuperLUBlock *outer = &ctx->previous->blocks;
+    head->link.next->link.prev = outer;
+    head->link.prev->link.next = outer->link.next;
+    outer->link.next->link.prev = head->link.prev;
+    outer->link.next = head->link.next;
+  }
+  else {
+    /* the blocks now belong to their users only */
+    for (block = head->link.next; block != head; block = next) {
+      next = block->link.next;
+      block->link.prev = block->link.next = block;
+    }
+  }
+  head->link.prev = head->link.next = head;
+}
+
+/* Whether ptr was allocated within the context and not freed yet */
+int superlu_context_owns(SuperLUContext *ctx, void *ptr)
+{
+  SuperLUBlock *head = &ctx->blocks;
+  SuperLUBlock *block;
+
+  if (ptr == NULL) return 0;
+  for (block = head->link.next; block != head; block = block->link.next) {
+    if ((void *)(block + 1) == ptr) return 1;
+  }
+  return 0;
+}
+
+/* Leave the context, with the GIL held.  After an abort, the memory
+   allocated within the context is freed and a RuntimeError is set. */
+void superlu_context_exit(SuperLUContext *ctx, int aborted)
+{
+  superlu_context_acquire_gil(ctx);
+  superlu_context_leave(ctx, aborted);
+
+  if (aborted) {
+    PyErr_SetString(PyExc_RuntimeError, ctx->message);
+  }
+}
 
 /* Abort to be used inside the superlu module so that memory allocation
    errors don't exit Python and memory allocated internal to SuperLU is freed.
-   Calling program should deallocate (using SUPERLU_FREE) all memory that could have
-   been allocated.  (It's ok to FREE unallocated memory)---will be ignored.
+   The caller's context frees all memory that SuperLU allocated since it
+   was entered.
 */
 
 void superlu_python_module_abort(char *msg)
 {
-  PyErr_SetString(PyExc_RuntimeError, msg);
-  longjmp(_superlu_py_jmpbuf, -1);
+  SuperLUContext *ctx = superlu_context_current();
+
+  if (ctx == NULL) {
+    /* SuperLU called outside of any context: nowhere to return to, and
+       the abort sites assume that this function does not return */
+    Py_FatalError(msg);
+  }
+  strncpy(ctx->message, msg, sizeof(ctx->message) - 1);
+  ctx->message[sizeof(ctx->message) - 1] = '\0';
+  longjmp(ctx->jmpbuf, -1);
 }
 
 void *superlu_python_module_malloc(size_t size)
 {
-  PyObject *key=NULL;
-  void *mem_ptr;
+  SuperLUContext *ctx = superlu_context_current();
+  SuperLUBlock *block;
 
-  if (_superlumodule_memory_dict == NULL) {
-    _superlumodule_memory_dict = PyDict_New();
-  }
-  mem_ptr = malloc(size);
-  if (mem_ptr == NULL) return NULL;
-  key = PyLong_FromVoidPtr(mem_ptr);
-  if (key == NULL) goto fail;
-  if (PyDict_SetItem(_superlumodule_memory_dict, key, Py_None)) goto fail;
-  Py_DECREF(key);
-  return mem_ptr;
-
- fail:
-  Py_XDECREF(key);
-  free(mem_ptr);
-  superlu_python_module_abort("superlu_malloc: Cannot set dictionary key value in malloc.");
-  return NULL;
+  block = (SuperLUBlock *) malloc(sizeof(SuperLUBlock) + size);
+  if (block == NULL) return NULL;
 
+  if (ctx != NULL) {
+    SuperLUBlock *head = &ctx->blocks;
+    block->link.prev = head;
+    block->link.next = head->link.next;
+    head->link.next->link.prev = block;
+    head->link.next = block;
+  }
+  else {
+    block->link.prev = block->link.next = block;
+  }
+  return (void *)(block + 1);
 }
 
 void superlu_python_module_free(void *ptr)
 {
-  PyObject *key;
-  PyObject *ptype, *pvalue, *ptraceback;
+  SuperLUBlock *block;
 
   if (ptr == NULL) return;
-  PyErr_Fetch(&ptype, &pvalue, &ptraceback);
-  key = PyLong_FromVoidPtr(ptr);
-  /* This will only free the pointer if it could find it in the dictionary
-     of already allocated pointers --- thus after abort, the module can free all
-     the memory that "might" have been allocated to avoid memory leaks on abort
-     calls.
-   */
-  if (_superlumodule_memory_dict && \
-      !(PyDict_DelItem(_superlumodule_memory_dict, key))) {
-    free(ptr);
-  }
-  Py_DECREF(key);
-  PyErr_Restore(ptype, pvalue, ptraceback);
-  return;
+  block = (SuperLUBlock *)ptr - 1;
+
+  /* unlink from the context that allocated it, if any */
+  block->link.prev->link.next = block->link.next;
+  block->link.next->link.prev = block->link.prev;
+  free(block);
 }
 
 /*
@@ -20,8 +20,6 @@
 #include "_superluobject.h"
 #include "numpy/npy_3kcompat.h"
 
-extern jmp_buf _superlu_py_jmpbuf;
-
 /*
  * Data-type dependent implementations for Xgssv and Xgstrf;
  *
@@ -42,9 +40,9 @@ Py_gssv(PyObject *self, PyObject *args, PyObject *kwdict)
     SuperMatrix A, B, L, U;
     superlu_options_t options;
     SuperLUStat_t stat;
+    SuperLUContext ctx;
     PyObject *option_dict = NULL;
     int type;
-    int ssv_finished = 0;
 
     static char *kwlist[] = {"N","nnz","nzvals","colind","rowptr","B", "csc",
                              "options",NULL};
@@ -74,8 +72,10 @@ Py_gssv(PyObject *self, PyObject *args, PyObject *kwdict)
         return NULL;
     }
 
-    /* Create Space for output */
-    Py_X = PyArray_CopyFromObject(Py_B, type, 1, 2);
+    /* Create Space for output, one right hand side per column */
+    Py_X = PyArray_FromAny(Py_B, PyArray_DescrFromType(type), 1, 2,
+                           NPY_F_CONTIGUOUS | NPY_ALIGNED | NPY_WRITEABLE |
+                           NPY_ENSURECOPY, NULL);
     if (Py_X == NULL) return NULL;
 
     if (csc) {
@@ -103,41 +103,41 @@ Py_gssv(PyObject *self, PyObject *args, PyObject *kwdict)
     
     /* Setup options */
     
-    if (setjmp(_superlu_py_jmpbuf)) {
+    superlu_context_enter(&ctx);
+    if (setjmp(ctx.jmpbuf)) {
+        /* frees perm_r, perm_c, stat and whatever gssv allocated */
+        superlu_context_exit(&ctx, 1);
         goto fail;
     }
-    else {
-        perm_c = intMalloc(N);
-        perm_r = intMalloc(N);
-        StatInit(&stat);
 
-        /* Compute direct inverse of sparse Matrix */
-        gssv(type, &options, &A, perm_c, perm_r, &L, &U, &B, &stat, &info);
-    }
-    ssv_finished = 1;
+    perm_c = intMalloc(N);
+    perm_r = intMalloc(N);
+    StatInit(&stat);
+
+    /* Compute direct inverse of sparse Matrix */
+    if (SUPERLU_ORDERING_REENTRANT(options.ColPerm))
+        superlu_context_release_gil(&ctx);
+    gssv(type, &options, &A, perm_c, perm_r, &L, &U, &B, &stat, &info);
+    superlu_context_acquire_gil(&ctx);
 
     SUPERLU_FREE(perm_r);
     SUPERLU_FREE(perm_c);
+    if (info >= 0 && info <= N) {
+        /* otherwise the factors may be partially initialized */
+        Destroy_SuperNode_Matrix(&L);
+        Destroy_CompCol_Matrix(&U);
+    }
+    StatFree(&stat);
+    superlu_context_exit(&ctx, 0);
+
     Destroy_SuperMatrix_Store(&A);  /* holds just a pointer to the data */
     Destroy_SuperMatrix_Store(&B);
-    Destroy_SuperNode_Matrix(&L);
-    Destroy_CompCol_Matrix(&U);
-    StatFree(&stat);
  
     return Py_BuildValue("Ni", Py_X, info);
 
 fail:
-    SUPERLU_FREE(perm_r);
-    SUPERLU_FREE(perm_c);
     Destroy_SuperMatrix_Store(&A);  /* holds just a pointer to the data */
     Destroy_SuperMatrix_Store(&B);
-    if (ssv_finished) {
-        /* Avoid trying to free partially initialized matrices;
-           might leak some memory, but avoids a crash */
-        Destroy_SuperNode_Matrix(&L);
-        Destroy_CompCol_Matrix(&U);
-    }
-    StatFree(&stat);  
     Py_XDECREF(Py_X);
     return NULL;
 }
@@ -154,6 +154,8 @@ Py_gstrf(PyObject *self, PyObject *args, PyObject *keywds)
     int type;
     int ilu = 0;
 
+    A.Store = NULL;
+
     static char *kwlist[] = {"N","nnz","nzvals","colind","rowptr",
                              "options", "ilu",
                              NULL};
@@ -267,6 +269,12 @@ PyObject *PyInit__superlu(void)
     if (PyType_Ready(&SciPySuperLUType) < 0) {
         return;
     }
+    if (superlu_context_init() < 0) {
+        Py_FatalError("can't initialize module _superlu");
+    }
+    if (superlu_parallel_import() < 0) {
+        return NULL;
+    }
 
     m = PyModule_Create(&moduledef);
     d = PyModule_GetDict(m);
@@ -293,6 +301,13 @@ init_superlu(void)
     if (PyType_Ready(&SciPySuperLUType) < 0) {
         return;
     }
+    if (superlu_context_init() < 0) {
+        PyErr_SetString(PyExc_RuntimeError, "can't create thread key");
+        return;
+    }
+    if (superlu_parallel_import() < 0) {
+        return;
+    }
 
     m = Py_InitModule("_superlu", SuperLU_Methods);
     d = PyModule_GetDict(m);
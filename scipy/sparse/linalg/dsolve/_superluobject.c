@@ -14,27 +14,34 @@
 #include "numpy/npy_3kcompat.h"
 #include <setjmp.h>
 #include <ctype.h>
+#include <string.h>
 
-extern jmp_buf _superlu_py_jmpbuf;
+static int SciPyLU_factor(SciPyLUObject *self, SuperMatrix *A);
 
 
 /*********************************************************************** 
  * SciPyLUObject methods
  */
 
-static char solve_doc[] = "x = self.solve(b, trans)\n\
+static char solve_doc[] = "x = self.solve(b, trans, threads)\n\
 \n\
 solves linear system of equations with one or sereral right hand sides.\n\
 \n\
 parameters\n\
 ----------\n\
 \n\
-b        array, right hand side(s) of equation\n\
+b        array, right hand side(s) of equation, one per column\n\
 x        array, solution vector(s)\n\
 trans    'N': solve A   * x == b\n\
          'T': solve A^T * x == b\n\
          'H': solve A^H * x == b\n\
          (optional, default value 'N')\n\
+threads  number of threads.  Several right hand sides are split into\n\
+         blocks of columns; a single one is solved level by level over\n\
+         the supernodes of L and U ('N' only).  Values <= 0 select the\n\
+         number of threads of scipy.sparse.sparsetools, see\n\
+         sparsetools.set_num_threads.\n\
+         (optional, default value 0)\n\
 ";
 
 static PyObject *
@@ -46,11 +53,15 @@ SciPyLU_solve(SciPyLUObject *self, PyObject *args, PyObject *kwds) {
 #else
   int itrans = 'N';
 #endif
-  int info;
+  int info, nrhs, nnz, solved;
+  int n_threads = 0;
   trans_t trans;
   SuperLUStat_t stat;
+  SuperLUContext ctx;
+
+  static char *kwlist[] = {"rhs","trans","threads",NULL};
 
-  static char *kwlist[] = {"rhs","trans",NULL};
+  B.Store = NULL;
 
   if (!CHECK_SLU_TYPE(self->type)) {
       PyErr_SetString(PyExc_ValueError, "unsupported data type");
@@ -58,12 +69,12 @@ SciPyLU_solve(SciPyLUObject *self, PyObject *args, PyObject *kwds) {
   }
 
 #ifndef NPY_PY3K
-  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|c", kwlist,
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|ci", kwlist,
 #else
-  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|C", kwlist,
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!|Ci", kwlist,
 #endif
                                    &PyArray_Type, &b, 
-                                   &itrans))
+                                   &itrans, &n_threads))
     return NULL;
 
   /* solve transposed system: matrix was passed row-wise instead of
@@ -79,22 +90,93 @@ SciPyLU_solve(SciPyLUObject *self, PyObject *args, PyObject *kwds) {
     return NULL;
   }
 
-  if ((x = (PyArrayObject *) \
-       PyArray_CopyFromObject((PyObject *)b,self->type,1,2))==NULL) return NULL;
+  if (self->busy < 0) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "the matrix is being refactored by another thread");
+    return NULL;
+  }
+  if (self->L.Store == NULL) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "no factors, the last factorization failed");
+    return NULL;
+  }
 
-  if (b->dimensions[0] != self->n) goto fail;
+  /* the right hand sides become the contiguous columns of x */
+  x = (PyArrayObject *) PyArray_FromAny((PyObject *)b,
+                                        PyArray_DescrFromType(self->type),
+                                        1, 2,
+                                        NPY_F_CONTIGUOUS | NPY_ALIGNED |
+                                        NPY_WRITEABLE | NPY_ENSURECOPY,
+                                        NULL);
+  if (x == NULL) return NULL;
+
+  if (b->dimensions[0] != self->n) {
+    PyErr_SetString(PyExc_ValueError, "right hand side has wrong size");
+    goto fail;
+  }
 
+  if (DenseSuper_from_Numeric(&B, (PyObject *)x)) goto fail;
 
-  if (setjmp(_superlu_py_jmpbuf)) goto fail; 
+  nrhs = B.ncol;
+  nnz = ((SCformat *)self->L.Store)->nnz + ((NCformat *)self->U.Store)->nnz;
+  if (n_threads <= 0)
+    n_threads = superlu_num_threads();
+  if ((double)nnz * nrhs < SUPERLU_PARALLEL_THRESHOLD)
+    n_threads = 1;
+
+  if (n_threads > 1 && nrhs == 1 && trans == NOTRANS &&
+      self->schedule == NULL) {
+    /* built with the GIL held, so that concurrent solves see one
+       schedule */
+    self->schedule = superlu_schedule_new(&self->L, &self->U);
+    if (self->schedule == NULL) goto fail;
+  }
 
-  if (DenseSuper_from_Numeric(&B, (PyObject *)x)) goto fail;
+  /* L and U stay unchanged until the last solve has finished */
+  self->busy++;
 
-  StatInit(&stat);
+  superlu_context_enter(&ctx);
+  if (setjmp(ctx.jmpbuf)) {
+      superlu_context_exit(&ctx, 1);
+      self->busy--;
+      goto fail;
+  }
 
   /* Solve the system, overwriting vector x. */
-  gstrs(self->type,
-        trans, &self->L, &self->U, self->perm_c, self->perm_r, &B,
-        &stat, &info);
+  superlu_context_release_gil(&ctx);
+  solved = 0;
+  info = 0;
+  if (n_threads > 1 && nrhs > 1) {
+      if (superlu_solve_batched(self->type, trans, &self->L, &self->U,
+                                self->perm_c, self->perm_r, &B, n_threads,
+                                &info, ctx.message, sizeof(ctx.message))) {
+          /* a thread was aborted, its message is in ctx.message */
+          superlu_context_exit(&ctx, 1);
+          self->busy--;
+          goto fail;
+      }
+      solved = 1;
+  }
+  else if (n_threads > 1 && nrhs == 1 && trans == NOTRANS &&
+           superlu_schedule_is_parallel(self->schedule, n_threads)) {
+      /* fails only if there is no memory for the permuted vector */
+      solved = (superlu_solve_scheduled(self->type, self->schedule,
+                                        &self->L, &self->U,
+                                        self->perm_c, self->perm_r, &B,
+                                        n_threads) == 0);
+  }
+  if (!solved) {
+      /* serial solve */
+      StatInit(&stat);
+      gstrs(self->type,
+            trans, &self->L, &self->U, self->perm_c, self->perm_r, &B,
+            &stat, &info);
+      StatFree(&stat);
+  }
+  superlu_context_acquire_gil(&ctx);
+
+  superlu_context_exit(&ctx, 0);
+  self->busy--;
 
   if (info) { 
       PyErr_SetString(PyExc_SystemError,
@@ -104,20 +186,113 @@ SciPyLU_solve(SciPyLUObject *self, PyObject *args, PyObject *kwds) {
   
   /* free memory */
   Destroy_SuperMatrix_Store(&B);
-  StatFree(&stat);
   return (PyObject *)x;
 
 fail:
   Destroy_SuperMatrix_Store(&B);  
-  StatFree(&stat);
   Py_XDECREF(x);
   return NULL;
 }
 
+static char refactor_doc[] = "self.refactor(nzvals, rowind, colptr, same_row_perm=False)\n\
+\n\
+factors a new matrix with the same sparsity pattern as the matrix factored\n\
+before, in compressed sparse column form.  The column permutation and the\n\
+elimination tree of the first factorization are reused.\n\
+\n\
+parameters\n\
+----------\n\
+\n\
+nzvals         non-zero values, of the same type as before\n\
+rowind         row-index for this column (same as before)\n\
+colptr         index into rowind for first non-zero value in this column\n\
+               (same as before)\n\
+same_row_perm  also reuse the row permutation and the storage of L and U\n\
+               (SuperLU's SamePattern_SameRowPerm).  Pivots are then only\n\
+               changed where they became too small.\n\
+               (optional, default value False)\n\
+\n\
+If the factorization fails, solve raises an error until refactor succeeds.\n\
+";
+
+static PyObject *
+SciPyLU_refactor(SciPyLUObject *self, PyObject *args, PyObject *kwds) {
+  PyArrayObject *nzvals, *rowind, *colptr;
+  SuperMatrix A;
+  int same_row_perm = 0;
+  int result;
+
+  static char *kwlist[] = {"nzvals","rowind","colptr","same_row_perm",NULL};
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!O!O!|i", kwlist,
+                                   &PyArray_Type, &nzvals,
+                                   &PyArray_Type, &rowind,
+                                   &PyArray_Type, &colptr,
+                                   &same_row_perm))
+    return NULL;
+
+  if (!_CHECK_INTEGER(colptr) || !_CHECK_INTEGER(rowind)) {
+    PyErr_SetString(PyExc_TypeError,
+                    "rowind and colptr must be of type cint");
+    return NULL;
+  }
+  if (PyArray_TYPE(nzvals) != self->type) {
+    PyErr_SetString(PyExc_TypeError,
+                    "nzvals must have the type of the first factorization");
+    return NULL;
+  }
+  if (colptr->nd != 1 || colptr->dimensions[0] != self->n + 1 ||
+      ((int *)colptr->data)[self->n] != self->nnz ||
+      rowind->nd != 1 || rowind->dimensions[0] < self->nnz) {
+    PyErr_SetString(PyExc_ValueError,
+                    "matrix does not have the pattern of the first factorization");
+    return NULL;
+  }
+  /* the column permutation and the etree are only valid for the same
+     pattern, and with same_row_perm gstrf writes into the old storage */
+  if (!PyArray_ISCONTIGUOUS(colptr) || !PyArray_ISCONTIGUOUS(rowind) ||
+      memcmp(colptr->data, self->colptr, (self->n + 1) * sizeof(int)) != 0 ||
+      memcmp(rowind->data, self->rowind, self->nnz * sizeof(int)) != 0) {
+    PyErr_SetString(PyExc_ValueError,
+                    "matrix does not have the pattern of the first factorization");
+    return NULL;
+  }
+  if (same_row_perm && self->L.Store == NULL) {
+    PyErr_SetString(PyExc_ValueError,
+                    "same_row_perm needs the factors of a previous factorization");
+    return NULL;
+  }
+  if (self->busy != 0) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "the factorization is in use by another thread");
+    return NULL;
+  }
+
+  A.Store = NULL;
+  if (NCFormat_from_spMatrix(&A, self->m, self->n, self->nnz, nzvals,
+                             rowind, colptr, self->type)) {
+    return NULL;
+  }
+
+  self->options.Fact = same_row_perm ? SamePattern_SameRowPerm : SamePattern;
+
+  self->busy = -1;
+  result = SciPyLU_factor(self, &A);
+  self->busy = 0;
+
+  /* arrays of input matrix will not be freed */
+  Destroy_SuperMatrix_Store(&A);
+  if (result) return NULL;
+
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
 /** table of object methods
  */
 PyMethodDef SciPyLU_methods[] = {
   {"solve", (PyCFunction)SciPyLU_solve, METH_VARARGS|METH_KEYWORDS, solve_doc},
+  {"refactor", (PyCFunction)SciPyLU_refactor, METH_VARARGS|METH_KEYWORDS, refactor_doc},
   {NULL, NULL}			/* sentinel */
 };
 
@@ -131,6 +306,10 @@ SciPyLU_dealloc(SciPyLUObject *self)
 {
   SUPERLU_FREE(self->perm_r);
   SUPERLU_FREE(self->perm_c);
+  SUPERLU_FREE(self->etree);
+  superlu_schedule_free(self->schedule);
+  free(self->colptr);
+  free(self->rowind);
   if (self->L.Store != NULL) {
       Destroy_SuperNode_Matrix(&self->L);
   }
@@ -145,8 +324,11 @@ SciPyLU_getattr(SciPyLUObject *self, char *name)
 {
   if (strcmp(name, "shape") == 0)
     return Py_BuildValue("(i,i)", self->m, self->n);
-  if (strcmp(name, "nnz") == 0)
+  if (strcmp(name, "nnz") == 0) {
+    if (self->L.Store == NULL)
+      return Py_BuildValue("i", 0);
     return Py_BuildValue("i", ((SCformat *)self->L.Store)->nnz + ((SCformat *)self->U.Store)->nnz);
+  }
   if (strcmp(name, "perm_r") == 0) {
     PyArrayObject* perm_r = PyArray_SimpleNewFromData(1, (npy_intp*) (&self->n), NPY_INT, (void*)self->perm_r);
     /* For ref counting of the memory */
@@ -211,8 +393,13 @@ perm_r\n\
 Methods\n\
 -------\n\
 solve\n\
-    solves the system for a given right hand side vector\n \
+    solves the system for a given right hand side vector\n\
+refactor\n\
+    factors a new matrix with the same sparsity pattern\n\
 \n\
+The GIL is released while SuperLU factors and solves, so several threads\n\
+may use different factorizations at the same time, or solve with the\n\
+same one.\n\
 ";
 
 PyTypeObject SciPySuperLUType = {
@@ -277,6 +464,7 @@ int DenseSuper_from_Numeric(SuperMatrix *X, PyObject *PyX)
 {
   int m, n, ldx, nd;
   PyArrayObject *aX;
+  SuperLUContext ctx;
   
   if (!PyArray_Check(PyX)) {
     PyErr_SetString(PyExc_TypeError, "dgssv: Second argument is not an array.");
@@ -291,23 +479,32 @@ int DenseSuper_from_Numeric(SuperMatrix *X, PyObject *PyX)
     n = 1;
     ldx = m;
   }
-  else {  /* nd == 2 */
-    m = aX->dimensions[1];
-    n = aX->dimensions[0];
+  else {  /* nd == 2, one right hand side per column */
+    if (!PyArray_ISFORTRAN(aX)) {
+      PyErr_SetString(PyExc_ValueError,
+                      "right hand sides must be in Fortran order");
+      return -1;
+    }
+    m = aX->dimensions[0];
+    n = aX->dimensions[1];
     ldx = m;
   }
   
-  if (setjmp(_superlu_py_jmpbuf))
+  if (!CHECK_SLU_TYPE(aX->descr->type_num)) {
+      PyErr_SetString(PyExc_ValueError, "unsupported data type");
       return -1;
-  else {
-      if (!CHECK_SLU_TYPE(aX->descr->type_num)) {
-          PyErr_SetString(PyExc_ValueError, "unsupported data type");
-          return -1;
-      }
-      Create_Dense_Matrix(aX->descr->type_num, X, m, n,
-                          aX->data, ldx, SLU_DN,
-                          NPY_TYPECODE_TO_SLU(aX->descr->type_num), SLU_GE);
   }
+
+  superlu_context_enter(&ctx);
+  if (setjmp(ctx.jmpbuf)) {
+      superlu_context_exit(&ctx, 1);
+      X->Store = NULL;
+      return -1;
+  }
+  Create_Dense_Matrix(aX->descr->type_num, X, m, n,
+                      aX->data, ldx, SLU_DN,
+                      NPY_TYPECODE_TO_SLU(aX->descr->type_num), SLU_GE);
+  superlu_context_exit(&ctx, 0);
   return 0;
 }
 
@@ -318,6 +515,7 @@ int NRFormat_from_spMatrix(SuperMatrix *A, int m, int n, int nnz,
                            PyArrayObject *rowptr, int typenum)
 {
   int err = 0;
+  SuperLUContext ctx;
     
   err = (nzvals->descr->type_num != typenum);
   err += (nzvals->nd != 1);
@@ -327,19 +525,23 @@ int NRFormat_from_spMatrix(SuperMatrix *A, int m, int n, int nnz,
     return -1;
   }
 
-  if (setjmp(_superlu_py_jmpbuf))
+  if (!CHECK_SLU_TYPE(nzvals->descr->type_num)) {
+      PyErr_SetString(PyExc_TypeError, "Invalid type for array.");
+      return -1;  
+  }
+
+  superlu_context_enter(&ctx);
+  if (setjmp(ctx.jmpbuf)) {
+      superlu_context_exit(&ctx, 1);
+      A->Store = NULL;
       return -1;
-  else {
-      if (!CHECK_SLU_TYPE(nzvals->descr->type_num)) {
-          PyErr_SetString(PyExc_TypeError, "Invalid type for array.");
-          return -1;  
-      }
-      Create_CompRow_Matrix(nzvals->descr->type_num,
-                            A, m, n, nnz, nzvals->data, (int *)colind->data,
-                            (int *)rowptr->data, SLU_NR,
-                            NPY_TYPECODE_TO_SLU(nzvals->descr->type_num),
-                            SLU_GE);
   }
+  Create_CompRow_Matrix(nzvals->descr->type_num,
+                        A, m, n, nnz, nzvals->data, (int *)colind->data,
+                        (int *)rowptr->data, SLU_NR,
+                        NPY_TYPECODE_TO_SLU(nzvals->descr->type_num),
+                        SLU_GE);
+  superlu_context_exit(&ctx, 0);
 
   return 0;
 }
@@ -349,6 +551,7 @@ int NCFormat_from_spMatrix(SuperMatrix *A, int m, int n, int nnz,
                            PyArrayObject *colptr, int typenum)
 {
   int err=0;
+  SuperLUContext ctx;
 
   err = (nzvals->descr->type_num != typenum);
   err += (nzvals->nd != 1);
@@ -359,18 +562,182 @@ int NCFormat_from_spMatrix(SuperMatrix *A, int m, int n, int nnz,
   }
 
 
-  if (setjmp(_superlu_py_jmpbuf))
+  if (!CHECK_SLU_TYPE(nzvals->descr->type_num)) {
+      PyErr_SetString(PyExc_TypeError, "Invalid type for array.");
+      return -1;  
+  }
+
+  superlu_context_enter(&ctx);
+  if (setjmp(ctx.jmpbuf)) {
+      superlu_context_exit(&ctx, 1);
+      A->Store = NULL;
+      return -1;
+  }
+  Create_CompCol_Matrix(nzvals->descr->type_num,
+                        A, m, n, nnz, nzvals->data, (int *)rowind->data,
+                        (int *)colptr->data, SLU_NC,
+                        NPY_TYPECODE_TO_SLU(nzvals->descr->type_num),
+                        SLU_GE);
+  superlu_context_exit(&ctx, 0);
+
+  return 0;
+}
+
+/*
+ * Factor the SLU_NC matrix A into self->L and self->U.
+ *
+ * With self->options.Fact == DOFACT the column permutation and the
+ * elimination tree are computed first.  With SamePattern, those of an
+ * earlier factorization are reused; SamePattern_SameRowPerm also reuses
+ * self->perm_r and the storage of L and U.
+ *
+ * Returns 0 on success.  On failure an exception is set and self has no
+ * factors.
+ */
+static int
+SciPyLU_factor(SciPyLUObject *self, SuperMatrix *A)
+{
+  SuperMatrix AC;     /* Matrix postmultiplied by Pc */
+  SuperLUContext ctx;
+  SuperLUStat_t stat;
+  int lwork = 0;
+  int info;
+  int n = self->n;
+  int type = SLU_TYPECODE_TO_NPY(A->Dtype);
+  fact_t fact = self->options.Fact;
+  int first = (self->perm_c == NULL);
+
+  if (!CHECK_SLU_TYPE(type)) {
+      PyErr_SetString(PyExc_ValueError, "Invalid type in SuperMatrix.");
+      return -1;
+  }
+
+  /* the levels are rebuilt for the new factors when needed */
+  superlu_schedule_free(self->schedule);
+  self->schedule = NULL;
+
+  if (fact != SamePattern_SameRowPerm) {
+      /* gstrf allocates new factors */
+      if (self->L.Store != NULL) {
+          Destroy_SuperNode_Matrix(&self->L);
+          self->L.Store = NULL;
+      }
+      if (self->U.Store != NULL) {
+          Destroy_CompCol_Matrix(&self->U);
+          self->U.Store = NULL;
+      }
+  }
+
+  AC.Store = NULL;
+
+  superlu_context_enter(&ctx);
+  if (setjmp(ctx.jmpbuf)) {
+      /* all memory allocated since entering the context is gone, including
+         any new factors; reused ones are not consistent any more */
+      superlu_context_exit(&ctx, 1);
+      self->L.Store = NULL;
+      self->U.Store = NULL;
+      self->Glu.expanders = NULL;
+      if (first) {
+          self->perm_r = NULL;
+          self->perm_c = NULL;
+          self->etree = NULL;
+      }
       return -1;
+  }
+
+  if (first) {
+      self->etree = intMalloc(n);
+      self->perm_r = intMalloc(n);
+      self->perm_c = intMalloc(n);
+  }
+  StatInit(&stat);
+
+  if (fact == DOFACT) {
+      /* Calculate column permutation */
+      if (SUPERLU_ORDERING_REENTRANT(self->options.ColPerm))
+          superlu_context_release_gil(&ctx);
+      get_perm_c(self->options.ColPerm, A, self->perm_c);
+      superlu_context_acquire_gil(&ctx);
+  }
+
+  /* Apply column permutation; for DOFACT also compute the etree */
+  sp_preorder(&self->options, A, self->perm_c, self->etree, &AC);
+
+  /* Perform factorization.  The ILU dropping rules keep state in static
+     variables, so the incomplete factorization keeps the GIL. */
+  if (self->ilu) {
+      gsitrf(type,
+             &self->options, &AC, self->relax, self->panel_size,
+             self->etree, NULL, lwork, self->perm_c, self->perm_r,
+             &self->L, &self->U, &self->Glu, &stat, &info);
+  }
   else {
-      if (!CHECK_SLU_TYPE(nzvals->descr->type_num)) {
-          PyErr_SetString(PyExc_TypeError, "Invalid type for array.");
-          return -1;  
+      superlu_context_release_gil(&ctx);
+      gstrf(type,
+            &self->options, &AC, self->relax, self->panel_size,
+            self->etree, NULL, lwork, self->perm_c, self->perm_r,
+            &self->L, &self->U, &self->Glu, &stat, &info);
+      superlu_context_acquire_gil(&ctx);
+  }
+
+  Destroy_CompCol_Permuted(&AC);
+  StatFree(&stat);
+
+  if (info > n) {
+      /* out of memory: gstrf returned part way, with the arrays of L and
+         U in self->Glu.  Those allocated within the context are freed
+         with it; with SamePattern_SameRowPerm the ones of the previous
+         factors that were not replaced, and their Store, are freed here */
+      if (fact == SamePattern_SameRowPerm) {
+          void *arrays[9];
+          int i;
+
+          arrays[0] = self->Glu.xsup;
+          arrays[1] = self->Glu.supno;
+          arrays[2] = self->Glu.lsub;
+          arrays[3] = self->Glu.xlsub;
+          arrays[4] = self->Glu.lusup;
+          arrays[5] = self->Glu.xlusup;
+          arrays[6] = self->Glu.ucol;
+          arrays[7] = self->Glu.usub;
+          arrays[8] = self->Glu.xusub;
+          for (i = 0; i < 9; i++) {
+              if (arrays[i] != NULL && !superlu_context_owns(&ctx, arrays[i]))
+                  SUPERLU_FREE(arrays[i]);
+          }
+          SUPERLU_FREE(self->L.Store);
+          SUPERLU_FREE(self->U.Store);
+      }
+      superlu_context_leave(&ctx, 1);
+      self->L.Store = NULL;
+      self->U.Store = NULL;
+      self->Glu.expanders = NULL;
+      if (first) {
+          self->perm_r = NULL;
+          self->perm_c = NULL;
+          self->etree = NULL;
       }
-      Create_CompCol_Matrix(nzvals->descr->type_num,
-                            A, m, n, nnz, nzvals->data, (int *)rowind->data,
-                            (int *)colptr->data, SLU_NC,
-                            NPY_TYPECODE_TO_SLU(nzvals->descr->type_num),
-                            SLU_GE);
+      PyErr_NoMemory();
+      return -1;
+  }
+
+  superlu_context_exit(&ctx, 0);
+
+  if (info) {
+    if (info < 0)
+        PyErr_SetString(PyExc_SystemError,
+                        "gstrf was called with invalid arguments");
+    else
+        PyErr_SetString(PyExc_RuntimeError, "Factor is exactly singular");
+    if (info > 0) {
+        /* the factorization was completed */
+        Destroy_SuperNode_Matrix(&self->L);
+        Destroy_CompCol_Matrix(&self->U);
+    }
+    self->L.Store = NULL;
+    self->U.Store = NULL;
+    return -1;
   }
 
   return 0;
@@ -382,96 +749,56 @@ newSciPyLUObject(SuperMatrix *A, PyObject *option_dict, int intype, int ilu)
 
    /* A must be in SLU_NC format used by the factorization routine. */
   SciPyLUObject *self;
-  SuperMatrix AC;     /* Matrix postmultiplied by Pc */
-  int lwork = 0;
-  int *etree=NULL;
-  int info;
-  int n;
   superlu_options_t options;
-  SuperLUStat_t stat;
   int panel_size, relax;
-  int trf_finished = 0;
-
-  n = A->ncol;
 
   if (!set_superlu_options_from_dict(&options, ilu, option_dict,
                                      &panel_size, &relax)) {
       return NULL;
   }
+  options.Fact = DOFACT;
 
   /* Create SciPyLUObject */
   self = PyObject_New(SciPyLUObject, &SciPySuperLUType);
   if (self == NULL)
     return PyErr_NoMemory();
   self->m = A->nrow;
-  self->n = n;
+  self->n = A->ncol;
+  self->L.Store = NULL;
+  self->U.Store = NULL;
   self->perm_r = NULL;
   self->perm_c = NULL;
+  self->etree = NULL;
+  self->colptr = NULL;
+  self->rowind = NULL;
+  self->Glu.expanders = NULL;
   self->type = intype;
-
-  if (setjmp(_superlu_py_jmpbuf)) goto fail;
-  
-  /* Calculate and apply minimum degree ordering*/
-  etree = intMalloc(n);
-  self->perm_r = intMalloc(n);
-  self->perm_c = intMalloc(n);
-  StatInit(&stat);
-
-  get_perm_c(options.ColPerm, A, self->perm_c); /* calc column permutation */
-  sp_preorder(&options, A, self->perm_c, etree, &AC); /* apply column
-                                                       * permutation */
-
-  /* Perform factorization */
-  if (!CHECK_SLU_TYPE(SLU_TYPECODE_TO_NPY(A->Dtype))) {
-      PyErr_SetString(PyExc_ValueError, "Invalid type in SuperMatrix.");
-      goto fail;
-  }
-  if (ilu) {
-      gsitrf(SLU_TYPECODE_TO_NPY(A->Dtype),
-             &options, &AC, relax, panel_size,
-             etree, NULL, lwork, self->perm_c, self->perm_r,
-             &self->L, &self->U, &stat, &info);
-  }
-  else {
-      gstrf(SLU_TYPECODE_TO_NPY(A->Dtype),
-            &options, &AC, relax, panel_size,
-            etree, NULL, lwork, self->perm_c, self->perm_r,
-            &self->L, &self->U, &stat, &info);
+  self->ilu = ilu;
+  self->nnz = ((NCformat *)A->Store)->nnz;
+  self->options = options;
+  self->panel_size = panel_size;
+  self->relax = relax;
+  self->busy = 0;
+  self->schedule = NULL;
+
+  /* copy the pattern for refactor */
+  self->colptr = (int *) malloc((self->n + 1) * sizeof(int));
+  self->rowind = (int *) malloc((self->nnz > 0 ? self->nnz : 1) * sizeof(int));
+  if (self->colptr == NULL || self->rowind == NULL) {
+      SciPyLU_dealloc(self);
+      return PyErr_NoMemory();
   }
-  trf_finished = 1;
+  memcpy(self->colptr, ((NCformat *)A->Store)->colptr,
+         (self->n + 1) * sizeof(int));
+  memcpy(self->rowind, ((NCformat *)A->Store)->rowind,
+         self->nnz * sizeof(int));
 
-  if (info) {
-    if (info < 0)
-        PyErr_SetString(PyExc_SystemError,
-                        "gstrf was called with invalid arguments");
-    else {
-        if (info <= n) 
-            PyErr_SetString(PyExc_RuntimeError, "Factor is exactly singular");
-        else
-            PyErr_NoMemory();
-    }
-    goto fail;
+  if (SciPyLU_factor(self, A)) {
+      SciPyLU_dealloc(self);
+      return NULL;
   }
 
-  /* free memory */
-  SUPERLU_FREE(etree);
-  Destroy_CompCol_Permuted(&AC);
-  StatFree(&stat);
-  
   return (PyObject *)self;
-
-fail:
-  if (!trf_finished) {
-      /* Avoid trying to free partially initialized matrices;
-         might leak some memory, but avoids a crash */
-      self->L.Store = NULL;
-      self->U.Store = NULL;
-  }
-  SUPERLU_FREE(etree);
-  Destroy_CompCol_Permuted(&AC);
-  StatFree(&stat);
-  SciPyLU_dealloc(self);
-  return NULL;
 }
 
 
@@ -9,6 +9,7 @@
 #define __SUPERLU_OBJECT
 
 #include "Python.h"
+#include <setjmp.h>
 #include "SuperLU/SRC/slu_zdefs.h"
 #include "numpy/arrayobject.h"
 #include "SuperLU/SRC/slu_util.h"
@@ -18,17 +19,103 @@
 
 #define _CHECK_INTEGER(x) (PyArray_ISINTEGER(x) && (x)->descr->elsize == sizeof(int))
 
+/*
+ * Error and memory context of a call into SuperLU
+ *
+ * SuperLU reports errors through USER_ABORT, which must not return.  A
+ * caller puts a SuperLUContext on its stack, makes it the current context
+ * of its thread with superlu_context_enter and calls setjmp on ctx.jmpbuf;
+ * an abort then jumps back there with the message in ctx.message.
+ * Outside of any context, an abort is fatal.
+ *
+ * Memory from SUPERLU_MALLOC is linked into the current context.  After
+ * an abort, superlu_context_exit frees all of it, so the caller must not
+ * touch anything SuperLU allocated since superlu_context_enter.  After a
+ * normal exit the memory is handed to the enclosing context, if any.
+ *
+ * None of this uses the Python API, so SuperLU may run with the GIL
+ * released (see superlu_context_release_gil).
+ */
+typedef union SuperLUBlock {
+    struct {
+        union SuperLUBlock *prev;
+        union SuperLUBlock *next;
+    } link;
+    double align;               /* keeps the memory after the header aligned */
+} SuperLUBlock;
+
+typedef struct SuperLUContext {
+    jmp_buf jmpbuf;
+    char message[256];
+    SuperLUBlock blocks;        /* memory allocated within the context */
+    PyThreadState *thread_state;/* non-NULL while the GIL is released */
+    struct SuperLUContext *previous;
+} SuperLUContext;
+
+int superlu_context_init(void);
+void superlu_context_enter(SuperLUContext *);
+void superlu_context_exit(SuperLUContext *, int aborted);
+void superlu_context_leave(SuperLUContext *, int aborted);
+int superlu_context_owns(SuperLUContext *, void *ptr);
+void superlu_context_release_gil(SuperLUContext *);
+void superlu_context_acquire_gil(SuperLUContext *);
+
+/*
+ * Parallel triangular solves (_superlu_solve.c.src)
+ *
+ * Several right hand sides are split into blocks of columns that are
+ * solved by gstrs in separate threads.  A single right hand side is solved
+ * level by level: the supernodes of L (and of U) are grouped into levels
+ * that only depend on earlier levels, and the supernodes of a level are
+ * solved concurrently.  The levels are kept in a SuperLUSchedule, which is
+ * built once per factorization.
+ *
+ * The threads are those of the scipy.sparse.sparsetools pool, and the
+ * default number of threads is sparsetools.get_num_threads().  Solves
+ * whose work, roughly the number of nonzeros of L and U times the number
+ * of right hand sides, is below SUPERLU_PARALLEL_THRESHOLD always run
+ * serially.
+ */
+#define SUPERLU_PARALLEL_THRESHOLD (1 << 16)
+
+typedef struct SuperLUSchedule SuperLUSchedule;
+
+int superlu_parallel_import(void);
+int superlu_num_threads(void);
+SuperLUSchedule *superlu_schedule_new(SuperMatrix *L, SuperMatrix *U);
+void superlu_schedule_free(SuperLUSchedule *);
+int superlu_schedule_is_parallel(SuperLUSchedule *, int n_threads);
+int superlu_solve_batched(int type, trans_t trans, SuperMatrix *L,
+                          SuperMatrix *U, int *perm_c, int *perm_r,
+                          SuperMatrix *B, int n_threads, int *info,
+                          char *message, size_t message_size);
+int superlu_solve_scheduled(int type, SuperLUSchedule *, SuperMatrix *L,
+                            SuperMatrix *U, int *perm_c, int *perm_r,
+                            SuperMatrix *B, int n_threads);
+
 /*
  * SuperLUObject definition
  */
 typedef struct {
     PyObject_HEAD
     npy_intp m,n;
-    SuperMatrix L;
+    SuperMatrix L;              /* L.Store == NULL if not factored */
     SuperMatrix U;
     int *perm_r;
     int *perm_c;
+    int *etree;
     int type;
+    int ilu;
+    int nnz;                    /* nnz of the factored matrix */
+    int *colptr;                /* pattern of the first factorization, */
+    int *rowind;                /* checked by refactor */
+    superlu_options_t options;
+    int panel_size, relax;
+    GlobalLU_t Glu;             /* reused by SamePattern_SameRowPerm */
+    int busy;                   /* number of running solves, or -1 while
+                                   refactoring */
+    SuperLUSchedule *schedule;  /* levels of L and U, built by the first
+                                   parallel solve with one right hand side */
 } SciPyLUObject;
 
 extern PyTypeObject SciPySuperLUType;
@@ -49,6 +136,11 @@ int set_superlu_options_from_dict(superlu_options_t *options,
  * and type-generic definitions.
  */
 
+/* genmmd keeps its state in static variables, the other orderings may
+   run in several threads at once */
+#define SUPERLU_ORDERING_REENTRANT(colperm) \
+    ((colperm) != MMD_ATA && (colperm) != MMD_AT_PLUS_A)
+
 #define CHECK_SLU_TYPE(type) \
     (type == NPY_FLOAT || type == NPY_DOUBLE || type == NPY_CFLOAT || type == NPY_CDOUBLE)
 
@@ -83,8 +175,8 @@ int set_superlu_options_from_dict(superlu_options_t *options,
     superlu_options_t *a, SuperMatrix *b,                           \
     int c, int d, int *e, void *f, int g,                           \
     int *h, int *i, SuperMatrix *j, SuperMatrix *k,                 \
-    SuperLUStat_t *l, int *m
-#define gstrf_ARGS_REF a,b,c,d,e,f,g,h,i,j,k,l,m
+    GlobalLU_t *l, SuperLUStat_t *m, int *n
+#define gstrf_ARGS_REF a,b,c,d,e,f,g,h,i,j,k,l,m,n
 
 #define gsitrf_ARGS gstrf_ARGS
 #define gsitrf_ARGS_REF gstrf_ARGS_REF
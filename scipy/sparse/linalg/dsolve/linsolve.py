@@ -138,7 +138,7 @@ def splu(A, permc_spec=None, diag_pivot_thresh=None,
     Returns
     -------
     invA : scipy.sparse.linalg.dsolve._superlu.SciPyLUType
-        Object, which has a ``solve`` method.
+        Object, which has ``solve`` and ``refactor`` methods.
 
     See also
     --------
@@ -148,6 +148,26 @@ def splu(A, permc_spec=None, diag_pivot_thresh=None,
     -----
     This function uses the SuperLU library.
 
+    A matrix ``B`` with the same sparsity pattern as ``A`` (e.g. the next
+    Jacobian of a Newton iteration) can be factored without computing the
+    column ordering again::
+
+        B = csc_matrix(B)
+        B.sort_indices()
+        invA.refactor(B.data, B.indices, B.indptr)
+
+    Passing ``same_row_perm=True`` also keeps the row pivots where they are
+    still acceptable.  SuperLU releases the GIL while it factors and solves,
+    so different factorizations can be used from several threads at once.
+
+    ``invA.solve(b)`` accepts a 2-D array with one right hand side per
+    column.  Large solves use several threads: the columns of ``b`` are
+    split between them, and a single right hand side is solved by levels of
+    independent supernodes.  They run on the thread pool of
+    scipy.sparse.sparsetools.  Pass ``threads=n`` to split the work into
+    ``n`` parts; by default it is split into
+    ``sparsetools.get_num_threads()`` parts.
+
     References
     ----------
     .. [SLU] SuperLU http://crd.lbl.gov/~xiaoye/SuperLU/
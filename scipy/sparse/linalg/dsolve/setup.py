@@ -31,12 +31,19 @@ def configuration(parent_package='',top_path=None):
                        include_dirs=[superlu_src],
                        )
 
+    # the solves run on the thread pool of scipy.sparse.sparsetools,
+    # described by parallel_api.h
+    sparsetools_dir = join(dirname(__file__), '..', '..', 'sparsetools')
+
     # Extension
     config.add_extension('_superlu',
                          sources = ['_superlumodule.c',
                                     '_superlu_utils.c',
-                                    '_superluobject.c'],
+                                    '_superluobject.c',
+                                    '_superlu_solve.c.src'],
                          libraries = ['superlu_src'],
+                         include_dirs = [sparsetools_dir],
+                         depends = [join(sparsetools_dir, 'parallel_api.h')],
                          extra_info = lapack_opt,
                          )
 
@@ -6,7 +6,8 @@ from numpy.testing import TestCase, run_module_suite, assert_array_almost_equal,
     assert_raises, assert_almost_equal, assert_equal, assert_array_equal, assert_
 
 from scipy.linalg import norm, inv
-from scipy.sparse import spdiags, SparseEfficiencyWarning, csc_matrix
+from scipy.sparse import spdiags, SparseEfficiencyWarning, csc_matrix, \
+        kron, identity
 from scipy.sparse.linalg.dsolve import spsolve, use_solver, splu, spilu
 
 warnings.simplefilter('ignore',SparseEfficiencyWarning)
@@ -133,6 +134,93 @@ class TestSplu(object):
         lu = splu(a_)
         assert_array_equal(lu.perm_r, lu.perm_c)
 
+    def test_splu_refactor(self):
+        # Test factoring a new matrix with the same pattern.
+        n = 30
+        a = random.random((n, n))
+        a[a < 0.9] = 0
+        a += 4*eye(n)
+        a_ = csc_matrix(a)
+        lu = splu(a_)
+        perm_c = lu.perm_c.copy()
+        b = ones(n)
+
+        for same_row_perm in [False, True]:
+            a_.data *= random.random(a_.nnz) + 0.5
+            lu.refactor(a_.data, a_.indices, a_.indptr,
+                        same_row_perm=same_row_perm)
+            assert_almost_equal(a_*lu.solve(b), b)
+            assert_array_equal(lu.perm_c, perm_c)
+
+        # a failed factorization leaves no factors until the next one
+        a_.data[:] = 0
+        assert_raises(RuntimeError, lu.refactor,
+                      a_.data, a_.indices, a_.indptr)
+        assert_raises(RuntimeError, lu.solve, b)
+        assert_raises(ValueError, lu.refactor,
+                      a_.data, a_.indices, a_.indptr, True)
+
+        a_ = csc_matrix(a)
+        lu.refactor(a_.data, a_.indices, a_.indptr)
+        assert_almost_equal(dot(a, lu.solve(b)), b)
+
+        # the pattern must match
+        assert_raises(ValueError, lu.refactor,
+                      a_.data[:-1], a_.indices[:-1], a_.indptr[:-1])
+        indices = a_.indices.copy()
+        column = indices[a_.indptr[0]:a_.indptr[1]]
+        column[0] = [i for i in range(n) if i not in column][0]
+        assert_raises(ValueError, lu.refactor, a_.data, indices, a_.indptr)
+
+    def test_splu_threads(self):
+        # Test factoring and solving in several threads at once.
+        import threading
+        n = 200
+        results = [None]*4
+        matrices = []
+        for k in range(len(results)):
+            a = random.random((n, n))
+            a[a < 0.95] = 0
+            a += (4 + k)*eye(n)
+            matrices.append(a)
+
+        def worker(k):
+            a_ = csc_matrix(matrices[k])
+            lu = splu(a_)
+            for it in range(5):
+                x = lu.solve(ones(n))
+                lu.refactor(a_.data, a_.indices, a_.indptr)
+            results[k] = x
+
+        threads = [threading.Thread(target=worker, args=(k,))
+                   for k in range(len(results))]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        for a, x in zip(matrices, results):
+            assert_almost_equal(dot(a, x), ones(n))
+
+    def test_splu_solve_threads(self):
+        # Test batched and level scheduled solves against serial ones.
+        k = 70
+        t = spdiags([-1.3*ones(k), 4.2*ones(k), -0.7*ones(k)], [-1, 0, 1], k, k)
+        a = kron(identity(k), t) + kron(t, identity(k))
+        b = random.random((k*k, 6))
+        for dtype in ['f', 'd', 'F', 'D']:
+            a_ = csc_matrix(a, dtype=dtype)
+            b_ = b.astype(dtype)
+            lu = splu(a_)
+            decimal = 3 if dtype in 'fF' else 10
+            for trans in ['N', 'T']:
+                x1 = lu.solve(b_, trans, threads=1)
+                x4 = lu.solve(b_, trans, threads=4)
+                assert_array_almost_equal(x1, x4, decimal=decimal)
+            for j in range(b.shape[1]):
+                x = lu.solve(b_[:,j], threads=4)
+                assert_array_almost_equal(x, x1[:,j], decimal=decimal)
+            assert_array_almost_equal(a_*x1, b_, decimal=decimal - 2)
+
     def test_lu_refcount(self):
         # Test that we are keeping track of the reference count with splu.
         n = 30
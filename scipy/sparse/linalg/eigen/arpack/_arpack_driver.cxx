@@ -0,0 +1,507 @@
+/*
+ * _arpack_driver
+ *
+ * Runs the reverse communication loop of the ARPACK drivers
+ * (s,d)saupd and (s,d,c,z)naupd in compiled code when the operator is a
+ * CSR, CSC or BSR matrix.  The products with the operator are computed by
+ * the sparsetools kernels on the thread pool of sparsetools._parallel
+ * and the GIL is released for the whole loop, so eigs and eigsh do not
+ * return to Python once per Arnoldi step.
+ *
+ * ARPACK keeps its state between the calls of one iteration in SAVE
+ * variables, so only one loop runs at a time.  Loops driven from Python
+ * take the same lock through acquire_lock and release_lock.
+ */
+
+#include "Python.h"
+#include "pythread.h"
+
+#define PY_ARRAY_UNIQUE_SYMBOL _scipy_arpack_driver_ARRAY_API
+#include "numpy/arrayobject.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "complex_ops.h"
+#include "csr.h"
+#include "csc.h"
+#include "bsr.h"
+
+#if defined(NO_APPEND_FORTRAN)
+#if defined(UPPERCASE_FORTRAN)
+#define F_FUNC(f,F) F
+#else
+#define F_FUNC(f,F) f
+#endif
+#else
+#if defined(UPPERCASE_FORTRAN)
+#define F_FUNC(f,F) F##_
+#else
+#define F_FUNC(f,F) f##_
+#endif
+#endif
+
+#define ARPACK_AUPD_ARGS(T, R)                                          \
+    int *ido, char *bmat, int *n, char *which, int *nev, R *tol,        \
+    T *resid, int *ncv, T *v, int *ldv, int *iparam, int *ipntr,        \
+    T *workd, T *workl, int *lworkl
+
+extern "C" {
+void F_FUNC(ssaupd,SSAUPD)(ARPACK_AUPD_ARGS(float, float), int *info);
+void F_FUNC(dsaupd,DSAUPD)(ARPACK_AUPD_ARGS(double, double), int *info);
+void F_FUNC(snaupd,SNAUPD)(ARPACK_AUPD_ARGS(float, float), int *info);
+void F_FUNC(dnaupd,DNAUPD)(ARPACK_AUPD_ARGS(double, double), int *info);
+void F_FUNC(cnaupd,CNAUPD)(ARPACK_AUPD_ARGS(npy_cfloat_wrapper, float),
+                           float *rwork, int *info);
+void F_FUNC(znaupd,ZNAUPD)(ARPACK_AUPD_ARGS(npy_cdouble_wrapper, double),
+                           double *rwork, int *info);
+}
+
+/* held while an ARPACK loop runs */
+static PyThread_type_lock arpack_lock = NULL;
+
+
+/*
+ * Arguments of the *aupd routines
+ */
+template <class T, class R>
+struct arpack_state
+{
+    int ido;
+    char bmat[1];
+    int n;
+    char which[2];
+    int nev;
+    R tol;
+    T * resid;
+    int ncv;
+    T * v;
+    int ldv;
+    int * iparam;
+    int * ipntr;
+    T * workd;
+    T * workl;
+    int lworkl;
+    R * rwork;
+    int info;
+};
+
+#define ARPACK_AUPD_CALL(s)                                             \
+    &s.ido, s.bmat, &s.n, s.which, &s.nev, &s.tol, s.resid, &s.ncv,     \
+    s.v, &s.ldv, s.iparam, s.ipntr, s.workd, s.workl, &s.lworkl
+
+inline void arpack_aupd(arpack_state<float,float>& s, const bool symmetric)
+{
+    if (symmetric)
+        F_FUNC(ssaupd,SSAUPD)(ARPACK_AUPD_CALL(s), &s.info);
+    else
+        F_FUNC(snaupd,SNAUPD)(ARPACK_AUPD_CALL(s), &s.info);
+}
+
+inline void arpack_aupd(arpack_state<double,double>& s, const bool symmetric)
+{
+    if (symmetric)
+        F_FUNC(dsaupd,DSAUPD)(ARPACK_AUPD_CALL(s), &s.info);
+    else
+        F_FUNC(dnaupd,DNAUPD)(ARPACK_AUPD_CALL(s), &s.info);
+}
+
+inline void arpack_aupd(arpack_state<npy_cfloat_wrapper,float>& s, const bool)
+{
+    F_FUNC(cnaupd,CNAUPD)(ARPACK_AUPD_CALL(s), s.rwork, &s.info);
+}
+
+inline void arpack_aupd(arpack_state<npy_cdouble_wrapper,double>& s, const bool)
+{
+    F_FUNC(znaupd,ZNAUPD)(ARPACK_AUPD_CALL(s), s.rwork, &s.info);
+}
+
+
+/*
+ * y = A*x for a square CSR, CSC or BSR matrix A of size n
+ */
+template <class I, class T>
+struct sparse_operator
+{
+    char format;        // 'r' (CSR), 'c' (CSC) or 'b' (BSR)
+    I n;
+    I R, C;             // block size of BSR
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+
+    void operator()(const T * x, T * y) const
+    {
+        std::fill(y, y + n, T(0));
+        switch (format) {
+        case 'r':
+            csr_matvec(n, n, Ap, Aj, Ax, x, y);
+            break;
+        case 'c':
+            csc_matvec(n, n, Ap, Aj, Ax, x, y);
+            break;
+        case 'b':
+            bsr_matvec(n / R, n / C, R, C, Ap, Aj, Ax, x, y);
+            break;
+        }
+    }
+};
+
+/*
+ * Call *aupd and apply the operator until ARPACK asks for anything else
+ * (with bmat = 'I' and exact shifts, this means it has finished)
+ */
+template <class I, class T, class R>
+void arpack_aupd_loop(arpack_state<T,R>& s, const bool symmetric,
+                      const sparse_operator<I,T>& op)
+{
+    for (;;) {
+        arpack_aupd(s, symmetric);
+        if (s.ido != -1 && s.ido != 1)
+            break;
+        op(s.workd + (s.ipntr[0] - 1), s.workd + (s.ipntr[1] - 1));
+    }
+}
+
+
+/*
+ * Python interface
+ */
+
+struct aupd_arrays
+{
+    PyArrayObject *indptr, *indices, *data;
+    PyArrayObject *resid, *v, *iparam, *ipntr, *workd, *workl, *rwork;
+};
+
+template <class I, class T, class R>
+static int run_aupd_loop(aupd_arrays& a, const bool symmetric,
+                         const char format, const int R_, const int C_,
+                         int& ido, const char *bmat, const char *which,
+                         const int nev, const double tol, int& info)
+{
+    arpack_state<T,R> s;
+    sparse_operator<I,T> op;
+    const char *error = NULL;
+
+    s.ido = ido;
+    s.bmat[0] = bmat[0];
+    s.n = (int) PyArray_DIM(a.resid, 0);
+    s.which[0] = which[0];
+    s.which[1] = which[1];
+    s.nev = nev;
+    s.tol = (R) tol;
+    s.resid = (T *) PyArray_DATA(a.resid);
+    s.ncv = (int) PyArray_DIM(a.v, 1);
+    s.v = (T *) PyArray_DATA(a.v);
+    s.ldv = (int) PyArray_DIM(a.v, 0);
+    s.iparam = (int *) PyArray_DATA(a.iparam);
+    s.ipntr = (int *) PyArray_DATA(a.ipntr);
+    s.workd = (T *) PyArray_DATA(a.workd);
+    s.workl = (T *) PyArray_DATA(a.workl);
+    s.lworkl = (int) PyArray_DIM(a.workl, 0);
+    s.rwork = (a.rwork != NULL) ? (R *) PyArray_DATA(a.rwork) : NULL;
+    s.info = info;
+
+    op.format = format;
+    op.n = (I) s.n;
+    op.R = (I) R_;
+    op.C = (I) C_;
+    op.Ap = (const I *) PyArray_DATA(a.indptr);
+    op.Aj = (const I *) PyArray_DATA(a.indices);
+    op.Ax = (const T *) PyArray_DATA(a.data);
+
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(arpack_lock, 1);
+    try {
+        arpack_aupd_loop(s, symmetric, op);
+    } catch (const std::exception&) {
+        error = "arpack: applying the operator failed";
+    }
+    PyThread_release_lock(arpack_lock);
+    Py_END_ALLOW_THREADS
+
+    if (error != NULL) {
+        PyErr_SetString(PyExc_RuntimeError, error);
+        return -1;
+    }
+    ido = s.ido;
+    info = s.info;
+    return 0;
+}
+
+template <class I>
+static int dispatch_aupd_loop(aupd_arrays& a, const bool symmetric,
+                              const char format, const int R, const int C,
+                              int& ido, const char *bmat, const char *which,
+                              const int nev, const double tol, int& info)
+{
+    switch (PyArray_TYPE(a.data)) {
+    case NPY_FLOAT:
+        return run_aupd_loop<I,float,float>(a, symmetric, format, R, C,
+                                            ido, bmat, which, nev, tol, info);
+    case NPY_DOUBLE:
+        return run_aupd_loop<I,double,double>(a, symmetric, format, R, C,
+                                              ido, bmat, which, nev, tol, info);
+    case NPY_CFLOAT:
+        return run_aupd_loop<I,npy_cfloat_wrapper,float>(a, symmetric, format,
+                                                         R, C, ido, bmat, which,
+                                                         nev, tol, info);
+    case NPY_CDOUBLE:
+        return run_aupd_loop<I,npy_cdouble_wrapper,double>(a, symmetric, format,
+                                                           R, C, ido, bmat, which,
+                                                           nev, tol, info);
+    }
+    PyErr_SetString(PyExc_TypeError, "matrix type must be 'f', 'd', 'F', or 'D'");
+    return -1;
+}
+
+static PyArrayObject *inout_array(PyObject *obj, int typenum, int nd,
+                                  npy_intp min_size, const char *name)
+{
+    PyArrayObject *arr;
+
+    arr = (PyArrayObject *) PyArray_FROMANY(obj, typenum, nd, nd,
+                                            NPY_INOUT_FARRAY);
+    if (arr == NULL)
+        return NULL;
+    if (PyArray_SIZE(arr) < min_size) {
+        PyErr_Format(PyExc_ValueError, "%s is too small", name);
+        Py_DECREF(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+static char aupd_loop_doc[] =
+"ido, info = aupd_loop(symmetric, format, R, C, indptr, indices, data,\n"
+"                      ido, bmat, which, nev, tol, resid, v, iparam, ipntr,\n"
+"                      workd, workl, rwork, info)\n"
+"\n"
+"Calls (s,d)saupd (symmetric) or (s,d,c,z)naupd and multiplies with the\n"
+"square CSR, CSC or BSR matrix given by format ('csr', 'csc' or 'bsr'),\n"
+"block size R x C, indptr, indices and data until ARPACK returns anything\n"
+"but ido = -1 or 1.  The work arrays are updated in place; rwork is None\n"
+"for real types.  The products run on the thread pool of\n"
+"scipy.sparse.sparsetools, see sparsetools.set_num_threads.";
+
+static PyObject *aupd_loop(PyObject *self, PyObject *args)
+{
+    int symmetric, R, C, ido, nev, info, result = -1;
+    char *format, *bmat, *which;
+    double tol;
+    PyObject *o_indptr, *o_indices, *o_data, *o_resid, *o_v, *o_iparam;
+    PyObject *o_ipntr, *o_workd, *o_workl, *o_rwork;
+    aupd_arrays a = {NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                     NULL};
+    npy_intp n, ncv, n_brow, nnz;
+    int typenum, index_type;
+    char fmt;
+
+    if (!PyArg_ParseTuple(args, "isiiOOOissidOOOOOOOi:aupd_loop",
+                          &symmetric, &format, &R, &C,
+                          &o_indptr, &o_indices, &o_data,
+                          &ido, &bmat, &which, &nev, &tol,
+                          &o_resid, &o_v, &o_iparam, &o_ipntr,
+                          &o_workd, &o_workl, &o_rwork, &info))
+        return NULL;
+
+    if (strcmp(format, "csr") == 0)
+        fmt = 'r';
+    else if (strcmp(format, "csc") == 0)
+        fmt = 'c';
+    else if (strcmp(format, "bsr") == 0)
+        fmt = 'b';
+    else {
+        PyErr_SetString(PyExc_ValueError, "format must be 'csr', 'csc' or 'bsr'");
+        return NULL;
+    }
+    if (fmt != 'b')
+        R = C = 1;
+    if (R <= 0 || C <= 0 || strlen(bmat) != 1 || strlen(which) != 2) {
+        PyErr_SetString(PyExc_ValueError, "invalid arguments");
+        return NULL;
+    }
+
+    /* matrix, with 32 or 64 bit indices */
+    a.data = (PyArrayObject *) PyArray_FROMANY(o_data, NPY_NOTYPE, 1, 3,
+                                               NPY_IN_ARRAY);
+    if (a.data == NULL)
+        goto fail;
+    typenum = PyArray_TYPE(a.data);
+    index_type = NPY_INT;
+    if (PyArray_Check(o_indptr) &&
+        PyArray_ISINTEGER((PyArrayObject *) o_indptr) &&
+        PyArray_ITEMSIZE((PyArrayObject *) o_indptr) == 8)
+        index_type = (sizeof(long) == 8) ? NPY_LONG : NPY_LONGLONG;
+    a.indptr = (PyArrayObject *) PyArray_FROMANY(o_indptr, index_type, 1, 1,
+                                                 NPY_IN_ARRAY);
+    a.indices = (PyArrayObject *) PyArray_FROMANY(o_indices, index_type, 1, 1,
+                                                  NPY_IN_ARRAY);
+    if (a.indptr == NULL || a.indices == NULL)
+        goto fail;
+
+    /* ARPACK arrays, updated in place */
+    a.resid = inout_array(o_resid, typenum, 1, 1, "resid");
+    if (a.resid == NULL)
+        goto fail;
+    n = PyArray_DIM(a.resid, 0);
+    a.v = inout_array(o_v, typenum, 2, 1, "v");
+    if (a.v == NULL)
+        goto fail;
+    ncv = PyArray_DIM(a.v, 1);
+    a.iparam = inout_array(o_iparam, NPY_INT, 1, 11, "iparam");
+    a.ipntr = inout_array(o_ipntr, NPY_INT, 1, symmetric ? 11 : 14, "ipntr");
+    a.workd = inout_array(o_workd, typenum, 1, 3 * n, "workd");
+    a.workl = inout_array(o_workl, typenum, 1, 1, "workl");
+    if (a.iparam == NULL || a.ipntr == NULL || a.workd == NULL ||
+        a.workl == NULL)
+        goto fail;
+    if (PyTypeNum_ISCOMPLEX(typenum)) {
+        if (symmetric) {
+            PyErr_SetString(PyExc_ValueError,
+                            "the symmetric driver needs a real matrix");
+            goto fail;
+        }
+        a.rwork = inout_array(o_rwork,
+                              typenum == NPY_CFLOAT ? NPY_FLOAT : NPY_DOUBLE,
+                              1, ncv, "rwork");
+        if (a.rwork == NULL)
+            goto fail;
+    }
+    if (PyArray_DIM(a.v, 0) < n) {
+        PyErr_SetString(PyExc_ValueError, "v is too small");
+        goto fail;
+    }
+
+    /* the shape of the matrix; its indices are not checked */
+    if (n % R != 0 || n % C != 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "block size does not divide the matrix size");
+        goto fail;
+    }
+    n_brow = (fmt == 'b') ? n / R : n;
+    if (PyArray_DIM(a.indptr, 0) != n_brow + 1) {
+        PyErr_SetString(PyExc_ValueError, "indptr does not match the matrix size");
+        goto fail;
+    }
+    if (index_type == NPY_INT)
+        nnz = ((int *) PyArray_DATA(a.indptr))[n_brow];
+    else
+        nnz = (npy_intp) ((npy_int64 *) PyArray_DATA(a.indptr))[n_brow];
+    if (nnz < 0 || PyArray_DIM(a.indices, 0) < nnz ||
+        PyArray_SIZE(a.data) < nnz * R * C) {
+        PyErr_SetString(PyExc_ValueError, "indices or data are too small");
+        goto fail;
+    }
+
+    if (index_type == NPY_INT)
+        result = dispatch_aupd_loop<int>(a, symmetric != 0, fmt, R, C, ido,
+                                         bmat, which, nev, tol, info);
+    else
+        result = dispatch_aupd_loop<npy_int64>(a, symmetric != 0, fmt, R, C,
+                                               ido, bmat, which, nev, tol, info);
+
+fail:
+    /* copies made for the ARPACK arrays are written back here */
+    Py_XDECREF(a.indptr);
+    Py_XDECREF(a.indices);
+    Py_XDECREF(a.data);
+    Py_XDECREF(a.resid);
+    Py_XDECREF(a.v);
+    Py_XDECREF(a.iparam);
+    Py_XDECREF(a.ipntr);
+    Py_XDECREF(a.workd);
+    Py_XDECREF(a.workl);
+    Py_XDECREF(a.rwork);
+
+    if (result != 0)
+        return NULL;
+    return Py_BuildValue("ii", ido, info);
+}
+
+static char acquire_lock_doc[] =
+"acquire_lock()\n"
+"\n"
+"Waits for the lock that aupd_loop holds while it runs.  A loop that calls\n"
+"*aupd from Python holds it from the first call until ARPACK is done, and\n"
+"must not call aupd_loop meanwhile.";
+
+static PyObject *acquire_lock(PyObject *self, PyObject *unused)
+{
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(arpack_lock, 1);
+    Py_END_ALLOW_THREADS
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static char release_lock_doc[] =
+"release_lock()\n"
+"\n"
+"Releases the lock taken by acquire_lock.";
+
+static PyObject *release_lock(PyObject *self, PyObject *unused)
+{
+    PyThread_release_lock(arpack_lock);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMethodDef arpack_driver_methods[] = {
+    {"aupd_loop", aupd_loop, METH_VARARGS, aupd_loop_doc},
+    {"acquire_lock", (PyCFunction) acquire_lock, METH_NOARGS,
+     acquire_lock_doc},
+    {"release_lock", (PyCFunction) release_lock, METH_NOARGS,
+     release_lock_doc},
+    {NULL, NULL, 0, NULL}
+};
+
+#if PY_VERSION_HEX >= 0x03000000
+
+static struct PyModuleDef moduledef = {
+    PyModuleDef_HEAD_INIT,
+    "_arpack_driver",
+    NULL,
+    -1,
+    arpack_driver_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC PyInit__arpack_driver(void)
+{
+    PyObject *m;
+
+    import_array();
+    import_parallel();
+
+    arpack_lock = PyThread_allocate_lock();
+    if (arpack_lock == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        return NULL;
+    }
+
+    m = PyModule_Create(&moduledef);
+    return m;
+}
+
+#else
+
+PyMODINIT_FUNC init_arpack_driver(void)
+{
+    import_array();
+    import_parallel();
+
+    arpack_lock = PyThread_allocate_lock();
+    if (arpack_lock == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "can't allocate lock");
+        return;
+    }
+
+    Py_InitModule("_arpack_driver", arpack_driver_methods);
+}
+
+#endif
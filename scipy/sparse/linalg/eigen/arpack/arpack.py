@@ -37,14 +37,25 @@ Uses ARPACK: http://www.caam.rice.edu/software/ARPACK/
 # for eigenvalues by providing a shift (sigma) and a solver.
 # This is currently not implemented
 
+# Reverse communication
+# ---------------------
+# *aupd returns to the caller each time it needs a product with the
+# operator.  When A is a CSR, CSC or BSR matrix, the whole loop runs in
+# _arpack_driver, which multiplies with the sparsetools kernels and
+# releases the GIL; other operators are called from iterate() below.
+# *aupd keeps its state in SAVE variables between these calls, so the
+# Python loop holds the lock of _arpack_driver until ARPACK is done.
+
 __docformat__ = "restructuredtext en"
 
 __all___=['eigs', 'eigsh', 'svds', 'ArpackNoConvergence']
 
 import _arpack
+import _arpack_driver
 import numpy as np
 from scipy.sparse.linalg.interface import aslinearoperator, LinearOperator
-from scipy.sparse import csc_matrix, csr_matrix, isspmatrix
+from scipy.sparse import csc_matrix, csr_matrix, isspmatrix, \
+        isspmatrix_csr, isspmatrix_csc, isspmatrix_bsr
 
 _type_conv = {'f':'s', 'd':'d', 'F':'c', 'D':'z'}
 _ndigits = {'f':5, 'd':12, 'F':5, 'D':12}
@@ -163,7 +174,8 @@ class ArpackNoConvergence(ArpackError):
 
 class _ArpackParams(object):
     def __init__(self, n, k, tp, matvec, sigma=None,
-                 ncv=None, v0=None, maxiter=None, which="LM", tol=0):
+                 ncv=None, v0=None, maxiter=None, which="LM", tol=0,
+                 native=None):
         if k <= 0:
             raise ValueError("k must be positive, k=%d" % k)
 
@@ -178,6 +190,8 @@ class _ArpackParams(object):
         if v0 is not None:
             # ARPACK overwrites its initial resid,  make a copy
             self.resid = np.array(v0, copy=True)
+            if native is not None:
+                self.resid = self.resid.astype(tp)
             info = 1
         else:
             self.resid = np.zeros(n, tp)
@@ -190,8 +204,8 @@ class _ArpackParams(object):
             ncv = 2 * k + 1
         ncv = min(ncv, n)
 
-        self.v = np.zeros((n, ncv), tp) # holds Ritz vectors
-        self.iparam = np.zeros(11, "int")
+        self.v = np.zeros((n, ncv), tp, order='F') # holds Ritz vectors
+        self.iparam = np.zeros(11, np.intc)
 
         # set solver mode and parameters
         # only supported mode is 1: Ax=lx
@@ -203,6 +217,7 @@ class _ArpackParams(object):
 
         self.n = n
         self.matvec = matvec
+        self.native = native
         self.tol = tol
         self.k = k
         self.maxiter = maxiter
@@ -228,16 +243,45 @@ class _ArpackParams(object):
             k_ok = 0
         raise ArpackNoConvergence(msg % (num_iter, k_ok, self.k), ev, vec)
 
+    def solve(self):
+        # run iterate() until ARPACK is done; aupd_loop takes the lock
+        # itself
+        if self.native is not None:
+            while not self.converged:
+                self.iterate()
+            return
+
+        _arpack_driver.acquire_lock()
+        try:
+            while not self.converged:
+                self.iterate()
+        finally:
+            _arpack_driver.release_lock()
+
+    def _iterate_native(self):
+        # run *aupd until it stops asking for products with A; the work
+        # arrays are updated in place
+        fmt, R, C, indptr, indices, data = self.native
+        rwork = getattr(self, 'rwork', None)
+        self.ido, self.info = _arpack_driver.aupd_loop(self._symmetric,
+                fmt, R, C, indptr, indices, data,
+                self.ido, self.bmat, self.which, self.k, self.tol,
+                self.resid, self.v, self.iparam, self.ipntr,
+                self.workd, self.workl, rwork, self.info)
+
 class _SymmetricArpackParams(_ArpackParams):
+    _symmetric = True
+
     def __init__(self, n, k, tp, matvec, sigma=None,
-                 ncv=None, v0=None, maxiter=None, which="LM", tol=0):
+                 ncv=None, v0=None, maxiter=None, which="LM", tol=0,
+                 native=None):
         if not which in ['LM', 'SM', 'LA', 'SA', 'BE']:
             raise ValueError("which must be one of %s" % ' '.join(whiches))
         if k >= n:
             raise ValueError("k must be less than rank(A), k=%d" % k)
 
         _ArpackParams.__init__(self, n, k, tp, matvec, sigma,
-                 ncv, v0, maxiter, which, tol)
+                 ncv, v0, maxiter, which, tol, native)
 
         if self.ncv > n or self.ncv <= k:
             raise ValueError("ncv must be k<ncv<=n, ncv=%s" % self.ncv)
@@ -251,13 +295,16 @@ class _SymmetricArpackParams(_ArpackParams):
         self._arpack_solver = _arpack.__dict__[ltr + 'saupd']
         self._arpack_extract = _arpack.__dict__[ltr + 'seupd']
 
-        self.ipntr = np.zeros(11, "int")
+        self.ipntr = np.zeros(11, np.intc)
 
     def iterate(self):
-        self.ido, self.resid, self.v, self.iparam, self.ipntr, self.info = \
-            self._arpack_solver(self.ido, self.bmat, self.which, self.k, self.tol,
-                    self.resid, self.v, self.iparam, self.ipntr,
-                    self.workd, self.workl, self.info)
+        if self.native is not None:
+            self._iterate_native()
+        else:
+            self.ido, self.resid, self.v, self.iparam, self.ipntr, self.info = \
+                self._arpack_solver(self.ido, self.bmat, self.which, self.k,
+                        self.tol, self.resid, self.v, self.iparam, self.ipntr,
+                        self.workd, self.workl, self.info)
 
         xslice = slice(self.ipntr[0]-1, self.ipntr[0]-1+self.n)
         yslice = slice(self.ipntr[1]-1, self.ipntr[1]-1+self.n)
@@ -302,15 +349,18 @@ class _SymmetricArpackParams(_ArpackParams):
             return d
 
 class _UnsymmetricArpackParams(_ArpackParams):
+    _symmetric = False
+
     def __init__(self, n, k, tp, matvec, sigma=None,
-                 ncv=None, v0=None, maxiter=None, which="LM", tol=0):
+                 ncv=None, v0=None, maxiter=None, which="LM", tol=0,
+                 native=None):
         if not which in ["LM", "SM", "LR", "SR", "LI", "SI"]:
             raise ValueError("Parameter which must be one of %s" % ' '.join(whiches))
         if k >= n-1:
             raise ValueError("k must be less than rank(A)-1, k=%d" % k)
 
         _ArpackParams.__init__(self, n, k, tp, matvec, sigma,
-                 ncv, v0, maxiter, which, tol)
+                 ncv, v0, maxiter, which, tol, native)
 
         if self.ncv > n or self.ncv <= k+1:
             raise ValueError("ncv must be k+1<ncv<=n, ncv=%s" % self.ncv)
@@ -322,7 +372,7 @@ class _UnsymmetricArpackParams(_ArpackParams):
         self._arpack_solver = _arpack.__dict__[ltr + 'naupd']
         self._arpack_extract = _arpack.__dict__[ltr + 'neupd']
 
-        self.ipntr = np.zeros(14, "int")
+        self.ipntr = np.zeros(14, np.intc)
 
         if self.tp in 'FD':
             self.rwork = np.zeros(self.ncv, self.tp.lower())
@@ -330,7 +380,9 @@ class _UnsymmetricArpackParams(_ArpackParams):
             self.rwork = None
 
     def iterate(self):
-        if self.tp in 'fd':
+        if self.native is not None:
+            self._iterate_native()
+        elif self.tp in 'fd':
             self.ido, self.resid, self.v, self.iparam, self.ipntr, self.info = \
                 self._arpack_solver(self.ido, self.bmat, self.which, self.k, self.tol,
                         self.resid, self.v, self.iparam, self.ipntr,
@@ -451,6 +503,20 @@ class _UnsymmetricArpackParams(_ArpackParams):
         else:
             return d
 
+def _native_operator(A):
+    """Return (format, R, C, indptr, indices, data) of a CSR, CSC or BSR
+    matrix A, or None if the products with A have to go through Python."""
+    if not isspmatrix(A) or A.dtype.char not in 'fdFD':
+        return None
+    if isspmatrix_csr(A):
+        return ('csr', 1, 1, A.indptr, A.indices, A.data)
+    elif isspmatrix_csc(A):
+        return ('csc', 1, 1, A.indptr, A.indices, A.data)
+    elif isspmatrix_bsr(A):
+        R, C = A.blocksize
+        return ('bsr', R, C, A.indptr, A.indices, A.data)
+    return None
+
 def _aslinearoperator_with_dtype(m):
     m = aslinearoperator(m)
     if not hasattr(m, 'dtype'):
@@ -555,6 +621,7 @@ def eigs(A, k=6, M=None, sigma=None, which='LM', v0=None,
        Solution of Large Scale Eigenvalue Problems by Implicitly Restarted
        Arnoldi Methods. SIAM, Philadelphia, PA, 1998.
     """
+    native = _native_operator(A)
     A = _aslinearoperator_with_dtype(A)
     if A.shape[0] != A.shape[1]:
         raise ValueError('expected square matrix (shape=%s)' % (A.shape,))
@@ -562,13 +629,12 @@ def eigs(A, k=6, M=None, sigma=None, which='LM', v0=None,
 
     matvec = lambda x : A.matvec(x)
     params = _UnsymmetricArpackParams(n, k, A.dtype.char, matvec, sigma,
-                           ncv, v0, maxiter, which, tol)
+                           ncv, v0, maxiter, which, tol, native)
 
     if M is not None:
         raise NotImplementedError("generalized eigenproblem not supported yet")
 
-    while not params.converged:
-        params.iterate()
+    params.solve()
 
     return params.extract(return_eigenvectors)
 
@@ -664,6 +730,7 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
        Solution of Large Scale Eigenvalue Problems by Implicitly Restarted
        Arnoldi Methods. SIAM, Philadelphia, PA, 1998.
     """
+    native = _native_operator(A)
     A = _aslinearoperator_with_dtype(A)
     if A.shape[0] != A.shape[1]:
         raise ValueError('expected square matrix (shape=%s)' % (A.shape,))
@@ -674,10 +741,9 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
 
     matvec = lambda x : A.matvec(x)
     params = _SymmetricArpackParams(n, k, A.dtype.char, matvec, sigma,
-                           ncv, v0, maxiter, which, tol)
+                           ncv, v0, maxiter, which, tol, native)
 
-    while not params.converged:
-        params.iterate()
+    params.solve()
 
     return params.extract(return_eigenvectors)
 
@@ -19,6 +19,7 @@ def needs_veclib_wrapper(info):
     return res
 
 def configuration(parent_package='',top_path=None):
+    import sys
     from numpy.distutils.system_info import get_info, NotFoundError
     from numpy.distutils.misc_util import Configuration
 
@@ -57,6 +58,22 @@ def configuration(parent_package='',top_path=None):
                          extra_info = lapack_opt
                         )
 
+    # compiled reverse communication loop for sparse matrices; it uses the
+    # sparsetools kernels, which run on pthreads where available
+    if sys.platform == 'win32':
+        libraries = ['arpack']
+    else:
+        libraries = ['arpack', 'pthread']
+    sparsetools_dir = join('..', '..', '..', 'sparsetools')
+    config.add_extension('_arpack_driver',
+                         sources=['_arpack_driver.cxx'],
+                         include_dirs=[sparsetools_dir],
+                         define_macros=[('__STDC_FORMAT_MACROS', 1)],
+                         libraries=libraries,
+                         depends=[join(sparsetools_dir, '*.h')],
+                         extra_info = lapack_opt
+                        )
+
     config.add_data_dir('tests')
     return config
 
@@ -11,7 +11,7 @@ from numpy.testing import assert_almost_equal, assert_array_almost_equal, \
         assert_raises, verbose, assert_equal
 
 from numpy import array, finfo, argsort, dot, round, conj, random
-from scipy.sparse import csc_matrix, isspmatrix
+from scipy.sparse import csc_matrix, csr_matrix, bsr_matrix, isspmatrix
 from scipy.sparse.linalg import LinearOperator
 from scipy.sparse.linalg.eigen.arpack import eigs, eigsh, svds, \
      ArpackNoConvergence
@@ -359,6 +359,37 @@ def test_eigs_operator():
     w, v = eigs(fft_op, k=3)
     assert_equal(w.dtype, np.complex_)
 
+def test_sparse_native_loop():
+    # CSR, CSC and BSR matrices run the ARPACK loop in compiled code; the
+    # results must agree with the LinearOperator path
+    random.seed(1234)
+    n = 40
+    d = np.arange(1., n + 1)
+    b = random.rand(n - 1)
+    for typ in 'fdFD':
+        digits = _ndigits[typ]
+        a = np.diag(d) + np.diag(b, 1) + np.diag(b, -1)
+        a = a.astype(typ)
+        if typ in 'fd':
+            op = LinearOperator(a.shape, lambda x: dot(a, x), dtype=typ)
+            w0 = eigsh(op, k=4, v0=np.ones(n, typ), return_eigenvectors=False)
+            for fmt in [csr_matrix, csc_matrix]:
+                w = eigsh(fmt(a), k=4, v0=np.ones(n, typ),
+                          return_eigenvectors=False)
+                assert_array_almost_equal(np.sort(w), np.sort(w0),
+                                          decimal=digits)
+
+        a = a + np.diag(b, 2).astype(typ)
+        op = LinearOperator(a.shape, lambda x: dot(a, x), dtype=typ)
+        w0 = eigs(op, k=4, v0=np.ones(n, typ), return_eigenvectors=False)
+        for m in [csr_matrix(a), csc_matrix(a), bsr_matrix(a, blocksize=(2,2)),
+                  bsr_matrix(a, blocksize=(4,1))]:
+            w, v = eigs(m, k=4, v0=np.ones(n, typ))
+            assert_array_almost_equal(np.sort_complex(w), np.sort_complex(w0),
+                                      decimal=digits)
+            for ww, vv in zip(w, v.T):
+                assert_array_almost_equal(dot(a, vv), ww*vv, decimal=digits)
+
 def sorted_svd(m, k):
     """Compute svd of a dense matrix m, and return singular vectors/values
     sorted."""
@@ -3,8 +3,11 @@
 __all__ = ['bicg','bicgstab','cg','cgs','gmres','qmr']
 
 import _iterative
+import _krylov
 import numpy as np
 
+from scipy.sparse import isspmatrix, isspmatrix_csr, isspmatrix_csc, \
+        isspmatrix_bsr
 from scipy.sparse.linalg.interface import LinearOperator
 from utils import make_system
 
@@ -62,6 +65,43 @@ xtype : {'f','d','F','D'}
 """
 
 
+def _native_operand(A, tp):
+    """Return (format, R, C, indptr, indices, data) of a CSR, CSC or BSR
+    matrix A of type tp, or None"""
+    if not isspmatrix(A) or A.dtype.char != tp:
+        return None
+    if isspmatrix_csr(A):
+        return ('csr', 1, 1, A.indptr, A.indices, A.data)
+    elif isspmatrix_csc(A):
+        return ('csc', 1, 1, A.indptr, A.indices, A.data)
+    elif isspmatrix_bsr(A):
+        R, C = A.blocksize
+        return ('bsr', R, C, A.indptr, A.indices, A.data)
+    return None
+
+def _native_system(A, M, tp, callback):
+    """Return the operands (A, M) of the compiled solvers in _krylov, or
+    None if the solver has to call back into Python.
+
+    The compiled solvers handle a CSR, CSC or BSR matrix A with the same
+    type as the solution, no preconditioner (nor a psolve method of A) or
+    a preconditioner of the same kind, and no callback.
+    """
+    if callback is not None:
+        return None
+    A_native = _native_operand(A, tp)
+    if A_native is None:
+        return None
+    if M is None:
+        if hasattr(A, 'psolve') or hasattr(A, 'rpsolve'):
+            return None
+        return A_native, None
+    M_native = _native_operand(M, tp)
+    if M_native is None:
+        return None
+    return A_native, M_native
+
+
 def set_docstring(header, footer):
     def combine(fn):
         fn.__doc__ = header + '\n' + common_doc + '\n' + footer
@@ -133,12 +173,21 @@ def bicg(A, b, x0=None, tol=1e-5, maxiter=None, xtype=None, M=None, callback=Non
 
 @set_docstring('Use BIConjugate Gradient STABilized iteration to solve A x = b','')
 def bicgstab(A, b, x0=None, tol=1e-5, maxiter=None, xtype=None, M=None, callback=None):
+    A_, M_ = A, M
     A,M,x,b,postprocess = make_system(A,M,x0,b,xtype)
 
     n = len(b)
     if maxiter is None:
         maxiter = n*10
 
+    native = _native_system(A_, M_, x.dtype.char, callback)
+    if native is not None:
+        iter_, resid, info = _krylov.bicgstab(native[0], native[1], b, x,
+                tol, maxiter)
+        if info > 0 and iter_ == maxiter and resid > tol:
+            info = iter_
+        return postprocess(x), info
+
     matvec = A.matvec
     psolve = M.matvec
     ltr = _type_conv[x.dtype.char]
@@ -191,12 +240,21 @@ def bicgstab(A, b, x0=None, tol=1e-5, maxiter=None, xtype=None, M=None, callback
 
 @set_docstring('Use Conjugate Gradient iteration to solve A x = b','')
 def cg(A, b, x0=None, tol=1e-5, maxiter=None, xtype=None, M=None, callback=None):
+    A_, M_ = A, M
     A,M,x,b,postprocess = make_system(A,M,x0,b,xtype)
 
     n = len(b)
     if maxiter is None:
         maxiter = n*10
 
+    native = _native_system(A_, M_, x.dtype.char, callback)
+    if native is not None:
+        iter_, resid, info = _krylov.cg(native[0], native[1], b, x,
+                tol, maxiter)
+        if info > 0 and iter_ == maxiter and resid > tol:
+            info = iter_
+        return postprocess(x), info
+
     matvec = A.matvec
     psolve = M.matvec
     ltr = _type_conv[x.dtype.char]
@@ -390,6 +448,7 @@ def gmres(A, b, x0=None, tol=1e-5, restart=None, maxiter=None, xtype=None, M=Non
         raise ValueError("Cannot specify both restart and restrt keywords. "
                          "Preferably use 'restart' only.")
 
+    A_, M_ = A, M
     A,M,x,b,postprocess = make_system(A,M,x0,b,xtype)
 
     n = len(b)
@@ -400,6 +459,14 @@ def gmres(A, b, x0=None, tol=1e-5, restart=None, maxiter=None, xtype=None, M=Non
         restrt = 20
     restrt = min(restrt, n)
 
+    native = _native_system(A_, M_, x.dtype.char, callback)
+    if native is not None and restrt > 0:
+        iter_, resid, info = _krylov.gmres(native[0], native[1], b, x,
+                tol, restrt, maxiter)
+        if info >= 0 and resid > tol:
+            info = maxiter
+        return postprocess(x), info
+
     matvec = A.matvec
     psolve = M.matvec
     ltr = _type_conv[x.dtype.char]
@@ -0,0 +1,1215 @@
+/*
+ * _krylov
+ *
+ * CG, BiCGSTAB and GMRES for systems with a CSR, CSC or BSR matrix and
+ * no preconditioner or a CSR, CSC or BSR preconditioner.
+ *
+ * The methods take the same steps as the reverse communication routines
+ * CGREVCOM, BiCGSTABREVCOM and GMRESREVCOM with the driver loops of
+ * iterative.py, but the products with the matrix and the preconditioner
+ * are computed by the sparsetools kernels and the vector updates of a
+ * step (axpy, dot products, norms) are fused into single passes over the
+ * vectors.  The passes run on the sparsetools thread pool and the GIL is
+ * released while a method runs.
+ */
+
+#include "Python.h"
+
+#define PY_ARRAY_UNIQUE_SYMBOL _scipy_krylov_ARRAY_API
+#include "numpy/arrayobject.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "complex_ops.h"
+#include "csr.h"
+#include "csc.h"
+#include "bsr.h"
+
+
+/*
+ * Real and complex scalars
+ */
+template <class T>
+struct krylov_traits
+{
+    typedef T real_type;
+    static T conj(const T& x) { return x; }
+    static real_type real(const T& x) { return x; }
+    static real_type abs2(const T& x) { return x * x; }
+};
+
+template <class c_type, class npy_type>
+struct krylov_traits< complex_wrapper<c_type, npy_type> >
+{
+    typedef complex_wrapper<c_type, npy_type> T;
+    typedef c_type real_type;
+    static T conj(const T& x) { return T(x.real, -x.imag); }
+    static real_type real(const T& x) { return x.real; }
+    static real_type abs2(const T& x) { return x.real * x.real + x.imag * x.imag; }
+};
+
+template <class T>
+inline typename krylov_traits<T>::real_type krylov_abs(const T& x)
+{
+    return std::sqrt(krylov_traits<T>::abs2(x));
+}
+
+
+/*
+ * y = A*x for a square CSR, CSC or BSR matrix A of size n, or y = x if
+ * no matrix is given
+ */
+template <class I, class T>
+struct sparse_operator
+{
+    bool identity;
+    char format;        // 'r' (CSR), 'c' (CSC) or 'b' (BSR)
+    I n;
+    I R, C;             // block size of BSR
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+
+    void operator()(const T * x, T * y) const
+    {
+        if (identity) {
+            std::copy(x, x + n, y);
+            return;
+        }
+        std::fill(y, y + n, T(0));
+        switch (format) {
+        case 'r':
+            csr_matvec(n, n, Ap, Aj, Ax, x, y);
+            break;
+        case 'c':
+            csc_matvec(n, n, Ap, Aj, Ax, x, y);
+            break;
+        case 'b':
+            bsr_matvec(n / R, n / C, R, C, Ap, Aj, Ax, x, y);
+            break;
+        }
+    }
+};
+
+
+/*
+ * Passes over the vectors
+ *
+ * A pass applies a kernel, i.e. a functor with
+ *   void operator()(const npy_intp start, const npy_intp end, T sums[])
+ * to blocks of KRYLOV_BLOCK entries.  The kernel updates its vectors in
+ * [start, end) and adds the contributions of these entries to its
+ * n_sums sums.  The blocks run on the thread pool when the pass is large
+ * enough (see set_parallel_threshold) and their partial sums are added
+ * in a fixed order, so the results do not depend on the number of
+ * threads.
+ */
+#define KRYLOV_BLOCK 4096
+
+template <class T, class kernel_type>
+class vector_pass_task : public parallel_task
+{
+    public:
+        vector_pass_task(const npy_intp n, kernel_type& kernel, T * partial)
+            : n(n), kernel(kernel), partial(partial) {}
+
+        void operator()(const int block)
+        {
+            const npy_intp start = (npy_intp) block * KRYLOV_BLOCK;
+            const npy_intp end = std::min(start + (npy_intp) KRYLOV_BLOCK, n);
+            kernel(start, end, partial + block * kernel_type::n_sums);
+        }
+
+    private:
+        const npy_intp n;
+        kernel_type& kernel;
+        T * partial;
+};
+
+/*
+ * The passes of one solve, over vectors of size n.  The partial sums of
+ * the blocks are kept between passes, for kernels with up to
+ * KRYLOV_MAX_SUMS sums.
+ */
+#define KRYLOV_MAX_SUMS 2
+
+template <class T>
+class vector_passes
+{
+    public:
+        vector_passes(const npy_intp n)
+            : n(n), n_blocks((int) ((n + KRYLOV_BLOCK - 1) / KRYLOV_BLOCK)),
+              partial((size_t) n_blocks * KRYLOV_MAX_SUMS + 1) {}
+
+        template <class kernel_type>
+        void operator()(kernel_type& kernel, T sums[])
+        {
+            const int n_sums = kernel_type::n_sums;
+
+            std::fill(partial.begin(), partial.begin() + (size_t) n_blocks * n_sums,
+                      T(0));
+            vector_pass_task<T, kernel_type> task(n, kernel, &partial[0]);
+            if (parallel_num_chunks((double) n * kernel_type::n_vectors) > 1) {
+                parallel_run(task, n_blocks);
+            } else {
+                for (int k = 0; k < n_blocks; k++)
+                    task(k);
+            }
+
+            for (int s = 0; s < n_sums; s++) {
+                T total = T(0);
+                for (int k = 0; k < n_blocks; k++)
+                    total += partial[(size_t) k * n_sums + s];
+                sums[s] = total;
+            }
+        }
+
+        template <class kernel_type>
+        void operator()(kernel_type& kernel)
+        {
+            T unused;
+            (*this)(kernel, &unused);
+        }
+
+        const npy_intp n;
+
+    private:
+        const int n_blocks;
+        std::vector<T> partial;
+};
+
+
+/*
+ * Kernels
+ */
+
+// sums[0] = x^H y
+template <class T>
+struct dot_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 2 };
+    const T * x;
+    const T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        T s = T(0);
+        for (npy_intp i = start; i < end; i++)
+            s += krylov_traits<T>::conj(x[i]) * y[i];
+        sums[0] += s;
+    }
+};
+
+// sums[0] = |x|^2
+template <class T>
+struct norm_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 1 };
+    const T * x;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        typename krylov_traits<T>::real_type s = 0;
+        for (npy_intp i = start; i < end; i++)
+            s += krylov_traits<T>::abs2(x[i]);
+        sums[0] += T(s);
+    }
+};
+
+// y = a*x (x may be y)
+template <class T>
+struct scale_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 0, n_vectors = 2 };
+    T a;
+    const T * x;
+    T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T *) const
+    {
+        for (npy_intp i = start; i < end; i++)
+            y[i] = a * x[i];
+    }
+};
+
+// y = x + a*y
+template <class T>
+struct xpay_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 0, n_vectors = 2 };
+    T a;
+    const T * x;
+    T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T *) const
+    {
+        for (npy_intp i = start; i < end; i++)
+            y[i] = x[i] + a * y[i];
+    }
+};
+
+// y += a*x
+template <class T>
+struct axpy_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 0, n_vectors = 2 };
+    T a;
+    const T * x;
+    T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T *) const
+    {
+        for (npy_intp i = start; i < end; i++)
+            y[i] += a * x[i];
+    }
+};
+
+// r = b - q, sums[0] = |r|^2
+template <class T>
+struct residual_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 3 };
+    const T * b;
+    const T * q;
+    T * r;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        typename krylov_traits<T>::real_type s = 0;
+        for (npy_intp i = start; i < end; i++) {
+            r[i] = b[i] - q[i];
+            s += krylov_traits<T>::abs2(r[i]);
+        }
+        sums[0] += T(s);
+    }
+};
+
+// y -= a*x, sums[0] = |y|^2
+template <class T>
+struct axpy_norm_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 2 };
+    T a;
+    const T * x;
+    T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        typename krylov_traits<T>::real_type s = 0;
+        for (npy_intp i = start; i < end; i++) {
+            y[i] -= a * x[i];
+            s += krylov_traits<T>::abs2(y[i]);
+        }
+        sums[0] += T(s);
+    }
+};
+
+// y -= a*x, sums[0] = u^H y
+template <class T>
+struct axpy_dot_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 3 };
+    T a;
+    const T * x;
+    const T * u;
+    T * y;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        T s = T(0);
+        for (npy_intp i = start; i < end; i++) {
+            y[i] -= a * x[i];
+            s += krylov_traits<T>::conj(u[i]) * y[i];
+        }
+        sums[0] += s;
+    }
+};
+
+// x += sum_j y[j] * V[:,j] for the k columns of V
+template <class T>
+struct combine_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 0, n_vectors = 4 };
+    npy_intp n;
+    int k;
+    const T * y;
+    const T * V;
+    T * x;
+
+    void operator()(const npy_intp start, const npy_intp end, T *) const
+    {
+        for (int j = 0; j < k; j++) {
+            const T yj = y[j];
+            const T * v = V + (npy_intp) j * n;
+            for (npy_intp i = start; i < end; i++)
+                x[i] += yj * v[i];
+        }
+    }
+};
+
+// CG: x += alpha*p, r -= alpha*q, sums[0] = |r|^2
+template <class T>
+struct cg_update_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 1, n_vectors = 4 };
+    T alpha;
+    const T * p;
+    const T * q;
+    T * x;
+    T * r;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        typename krylov_traits<T>::real_type s = 0;
+        for (npy_intp i = start; i < end; i++) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            s += krylov_traits<T>::abs2(r[i]);
+        }
+        sums[0] += T(s);
+    }
+};
+
+// BiCGSTAB: p = r + beta*(p - omega*v)
+template <class T>
+struct bicgstab_p_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 0, n_vectors = 3 };
+    T beta;
+    T omega;
+    const T * r;
+    const T * v;
+    T * p;
+
+    void operator()(const npy_intp start, const npy_intp end, T *) const
+    {
+        for (npy_intp i = start; i < end; i++)
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+    }
+};
+
+// BiCGSTAB: sums[0] = t^H s, sums[1] = |t|^2
+template <class T>
+struct bicgstab_omega_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 2, n_vectors = 2 };
+    const T * t;
+    const T * s;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        T ts = T(0);
+        typename krylov_traits<T>::real_type tt = 0;
+        for (npy_intp i = start; i < end; i++) {
+            ts += krylov_traits<T>::conj(t[i]) * s[i];
+            tt += krylov_traits<T>::abs2(t[i]);
+        }
+        sums[0] += ts;
+        sums[1] += T(tt);
+    }
+};
+
+// BiCGSTAB: x += alpha*phat + omega*shat, r -= omega*t,
+// sums[0] = |r|^2, sums[1] = rtld^H r  (shat may be r)
+template <class T>
+struct bicgstab_update_kernel
+{
+    typedef T value_type;
+    enum { n_sums = 2, n_vectors = 6 };
+    T alpha;
+    T omega;
+    const T * phat;
+    const T * shat;
+    const T * t;
+    const T * rtld;
+    T * x;
+    T * r;
+
+    void operator()(const npy_intp start, const npy_intp end, T sums[]) const
+    {
+        typename krylov_traits<T>::real_type rr = 0;
+        T rho = T(0);
+        for (npy_intp i = start; i < end; i++) {
+            x[i] += alpha * phat[i] + omega * shat[i];
+            r[i] -= omega * t[i];
+            rr += krylov_traits<T>::abs2(r[i]);
+            rho += krylov_traits<T>::conj(rtld[i]) * r[i];
+        }
+        sums[0] += T(rr);
+        sums[1] += rho;
+    }
+};
+
+
+/*
+ * Shorthands for single passes
+ */
+template <class T>
+inline T krylov_dot(vector_passes<T>& pass, const T * x, const T * y)
+{
+    dot_kernel<T> kernel;
+    T sum;
+    kernel.x = x;
+    kernel.y = y;
+    pass(kernel, &sum);
+    return sum;
+}
+
+template <class T>
+inline typename krylov_traits<T>::real_type krylov_norm(vector_passes<T>& pass, const T * x)
+{
+    norm_kernel<T> kernel;
+    T sum;
+    kernel.x = x;
+    pass(kernel, &sum);
+    return std::sqrt(krylov_traits<T>::real(sum));
+}
+
+// r = b - A*x, returns |r|
+template <class I, class T>
+typename krylov_traits<T>::real_type
+krylov_residual(const sparse_operator<I,T>& A, vector_passes<T>& pass,
+                const T * b, const T * x, T * r, T * work)
+{
+    residual_kernel<T> kernel;
+    T sum;
+    A(x, work);
+    kernel.b = b;
+    kernel.q = work;
+    kernel.r = r;
+    pass(kernel, &sum);
+    return std::sqrt(krylov_traits<T>::real(sum));
+}
+
+// |b|, or 1 if b = 0
+template <class T>
+inline typename krylov_traits<T>::real_type krylov_bnorm(vector_passes<T>& pass, const T * b)
+{
+    typename krylov_traits<T>::real_type bnrm2 = krylov_norm(pass, b);
+    return (bnrm2 == 0) ? 1 : bnrm2;
+}
+
+// breakdown tolerance of BiCGSTAB, the square of the unit roundoff
+template <class R>
+inline R krylov_breaktol()
+{
+    const R eps = std::numeric_limits<R>::epsilon() / 2;
+    return eps * eps;
+}
+
+
+/*
+ * The methods
+ *
+ * Input Arguments:
+ *   sparse_operator  A      - matrix
+ *   sparse_operator  M      - preconditioner (may be the identity)
+ *   npy_intp         n      - size of the system
+ *   T                b[n]   - right hand side
+ *   double           tol    - tolerance
+ *   int              maxiter- maximum number of (outer) iterations
+ *
+ * Input/Output Arguments:
+ *   T                x[n]   - initial guess, solution on exit
+ *
+ * Output Arguments:
+ *   int              iter   - iterations taken
+ *   double           resid  - relative residual |b - A*x| / |b| of the
+ *                             last test, tol if none was made
+ *
+ * Return value:
+ *   info as returned by the reverse communication routines: 0 on
+ *   convergence, 1 if maxiter was reached, -10 and -11 on breakdown
+ *   of BiCGSTAB
+ */
+template <class I, class T>
+int krylov_cg(const sparse_operator<I,T>& A, const sparse_operator<I,T>& M,
+              const npy_intp n, const T * b, T * x, const double tol_,
+              const int maxiter, int& iter, double& resid)
+{
+    typedef typename krylov_traits<T>::real_type R;
+
+    const R tol = (R) tol_;
+    std::vector<T> work(4 * n + 1);
+    vector_passes<T> pass(n);
+    T * r = &work[0];
+    T * z = r + n;
+    T * p = z + n;
+    T * q = p + n;
+    const T * zp;
+    T rho = T(0), rho1 = T(0), rr, sum;
+    R bnrm2, rnorm;
+
+    iter = maxiter;
+    resid = tol_;
+
+    if (krylov_norm(pass, x) != 0) {
+        rnorm = krylov_residual(A, pass, b, x, r, q);
+    } else {
+        std::copy(b, b + n, r);
+        rnorm = krylov_norm(pass, r);
+    }
+    if (rnorm < tol)
+        return 0;
+    rr = T(rnorm * rnorm);
+    bnrm2 = krylov_bnorm(pass, b);
+
+    for (iter = 1; ; iter++) {
+        // z = M*r, rho = r^H z
+        if (M.identity) {
+            zp = r;
+            rho = rr;
+        } else {
+            M(r, z);
+            zp = z;
+            rho = krylov_dot(pass, r, zp);
+        }
+
+        // p = z + beta*p
+        if (iter > 1) {
+            xpay_kernel<T> kernel;
+            kernel.a = rho / rho1;
+            kernel.x = zp;
+            kernel.y = p;
+            pass(kernel);
+        } else {
+            std::copy(zp, zp + n, p);
+        }
+
+        A(p, q);
+        const T alpha = rho / krylov_dot(pass, p, q);
+
+        cg_update_kernel<T> update;
+        update.alpha = alpha;
+        update.p = p;
+        update.q = q;
+        update.x = x;
+        update.r = r;
+        pass(update, &sum);
+        rr = sum;
+
+        resid = std::sqrt(krylov_traits<T>::real(rr)) / bnrm2;
+        if (resid <= tol)
+            return 0;
+        if (iter >= maxiter)
+            return 1;
+        rho1 = rho;
+    }
+}
+
+template <class I, class T>
+int krylov_bicgstab(const sparse_operator<I,T>& A, const sparse_operator<I,T>& M,
+                    const npy_intp n, const T * b, T * x, const double tol_,
+                    const int maxiter, int& iter, double& resid)
+{
+    typedef typename krylov_traits<T>::real_type R;
+
+    const R tol = (R) tol_;
+    const R rhotol = krylov_breaktol<R>();
+    const R omegatol = krylov_breaktol<R>();
+    std::vector<T> work(7 * n + 1);
+    vector_passes<T> pass(n);
+    T * r = &work[0];   // also s
+    T * rtld = r + n;
+    T * p = rtld + n;
+    T * v = p + n;
+    T * t = v + n;
+    T * phat = t + n;
+    T * shat = phat + n;
+    const T * phat_p;
+    const T * shat_p;
+    T rho, rho1 = T(0), alpha = T(0), omega = T(0), sums[2];
+    R bnrm2, rnorm;
+
+    iter = maxiter;
+    resid = tol_;
+
+    if (krylov_norm(pass, x) != 0) {
+        rnorm = krylov_residual(A, pass, b, x, r, t);
+    } else {
+        std::copy(b, b + n, r);
+        rnorm = krylov_norm(pass, r);
+    }
+    if (rnorm <= tol)
+        return 0;
+    std::copy(r, r + n, rtld);
+    bnrm2 = krylov_bnorm(pass, b);
+    rho = T(rnorm * rnorm);
+
+    for (iter = 1; ; iter++) {
+        if (krylov_abs(rho) < rhotol)
+            return -10;
+
+        // p = r + beta*(p - omega*v)
+        if (iter > 1) {
+            bicgstab_p_kernel<T> kernel;
+            kernel.beta = (rho / rho1) * (alpha / omega);
+            kernel.omega = omega;
+            kernel.r = r;
+            kernel.v = v;
+            kernel.p = p;
+            pass(kernel);
+        } else {
+            std::copy(r, r + n, p);
+        }
+
+        if (M.identity) {
+            phat_p = p;
+        } else {
+            M(p, phat);
+            phat_p = phat;
+        }
+        A(phat_p, v);
+        alpha = rho / krylov_dot(pass, rtld, v);
+
+        // s = r - alpha*v, stored in r
+        axpy_norm_kernel<T> s_kernel;
+        s_kernel.a = alpha;
+        s_kernel.x = v;
+        s_kernel.y = r;
+        pass(s_kernel, sums);
+        rnorm = std::sqrt(krylov_traits<T>::real(sums[0]));
+        if (rnorm <= tol) {
+            axpy_kernel<T> kernel;
+            kernel.a = alpha;
+            kernel.x = phat_p;
+            kernel.y = x;
+            pass(kernel);
+            resid = rnorm / bnrm2;
+            return 0;
+        }
+
+        if (M.identity) {
+            shat_p = r;
+        } else {
+            M(r, shat);
+            shat_p = shat;
+        }
+        A(shat_p, t);
+
+        bicgstab_omega_kernel<T> omega_kernel;
+        omega_kernel.t = t;
+        omega_kernel.s = r;
+        pass(omega_kernel, sums);
+        omega = sums[0] / sums[1];
+
+        bicgstab_update_kernel<T> update;
+        update.alpha = alpha;
+        update.omega = omega;
+        update.phat = phat_p;
+        update.shat = shat_p;
+        update.t = t;
+        update.rtld = rtld;
+        update.x = x;
+        update.r = r;
+        pass(update, sums);
+
+        resid = std::sqrt(krylov_traits<T>::real(sums[0])) / bnrm2;
+        if (resid <= tol)
+            return 0;
+        if (iter >= maxiter)
+            return 1;
+        if (krylov_abs(omega) < omegatol)
+            return -11;
+        rho1 = rho;
+        rho = sums[1];
+    }
+}
+
+// Givens rotation (c, s) that zeroes b in (a, b)
+template <class T>
+void krylov_getgiv(const T& a, const T& b, T& c, T& s)
+{
+    typedef typename krylov_traits<T>::real_type R;
+
+    if (krylov_abs(b) == 0) {
+        c = T(1);
+        s = T(0);
+    } else if (krylov_abs(b) > krylov_abs(a)) {
+        const T temp = -a / b;
+        s = T(R(1) / std::sqrt(R(1) + krylov_traits<T>::abs2(temp)));
+        c = temp * s;
+    } else {
+        const T temp = -b / a;
+        c = T(R(1) / std::sqrt(R(1) + krylov_traits<T>::abs2(temp)));
+        s = temp * c;
+    }
+}
+
+template <class T>
+inline void krylov_rotvec(T& x, T& y, const T& c, const T& s)
+{
+    const T temp = krylov_traits<T>::conj(c) * x - krylov_traits<T>::conj(s) * y;
+    y = s * x + c * y;
+    x = temp;
+}
+
+// x += V*y with H[0:k,0:k] y = s[0:k] (H upper triangular, leading dimension ldh)
+template <class T>
+void krylov_gmres_update(vector_passes<T>& pass, const int k, T * x, const T * H,
+                         const int ldh, T * y, const T * s, const T * V)
+{
+    std::copy(s, s + k, y);
+    for (int j = k - 1; j >= 0; j--) {
+        y[j] = y[j] / H[j + j * ldh];
+        for (int i = 0; i < j; i++)
+            y[i] -= y[j] * H[i + j * ldh];
+    }
+
+    combine_kernel<T> kernel;
+    kernel.n = pass.n;
+    kernel.k = k;
+    kernel.y = y;
+    kernel.V = V;
+    kernel.x = x;
+    pass(kernel);
+}
+
+template <class I, class T>
+int krylov_gmres(const sparse_operator<I,T>& A, const sparse_operator<I,T>& M,
+                 const npy_intp n, const T * b, T * x, const double tol_,
+                 const int restrt, const int maxiter, int& iter, double& resid)
+{
+    typedef typename krylov_traits<T>::real_type R;
+
+    const R tol = (R) tol_;
+    const int ldh = restrt + 1;
+    std::vector<T> work((restrt + 4) * n + 1);
+    vector_passes<T> pass(n);
+    T * r = &work[0];
+    T * w = r + n;
+    T * av = w + n;
+    T * V = av + n;     // restrt + 1 columns
+    std::vector<T> H(ldh * restrt), gc(restrt), gs(restrt), s(ldh), y(restrt);
+    T sum;
+    R bnrm2, rnorm;
+
+    iter = maxiter;
+    resid = tol_;
+
+    if (krylov_norm(pass, x) != 0) {
+        rnorm = krylov_residual(A, pass, b, x, r, w);
+    } else {
+        std::copy(b, b + n, r);
+        rnorm = krylov_norm(pass, r);
+    }
+    if (rnorm < tol)
+        return 0;
+    bnrm2 = krylov_bnorm(pass, b);
+
+    for (iter = 1; ; iter++) {
+        // v_0 = M*r / |M*r|
+        M(r, V);
+        rnorm = krylov_norm(pass, V);
+        scale_kernel<T> normalize;
+        normalize.a = T(R(1) / rnorm);
+        normalize.x = V;
+        normalize.y = V;
+        pass(normalize);
+
+        std::fill(s.begin(), s.end(), T(0));
+        s[0] = T(rnorm);
+
+        for (int i = 1; i <= restrt; i++) {
+            const T * vi = V + (npy_intp) (i - 1) * n;
+            T * h = &H[(i - 1) * ldh];
+
+            // w = M*A*v_{i-1}
+            if (M.identity) {
+                A(vi, w);
+            } else {
+                A(vi, av);
+                M(av, w);
+            }
+
+            // modified Gram-Schmidt; the update with v_k is fused with the
+            // product with v_{k+1}
+            h[0] = krylov_dot(pass, (const T *) V, (const T *) w);
+            for (int k = 0; k < i - 1; k++) {
+                axpy_dot_kernel<T> kernel;
+                kernel.a = h[k];
+                kernel.x = V + (npy_intp) k * n;
+                kernel.u = V + (npy_intp) (k + 1) * n;
+                kernel.y = w;
+                pass(kernel, &sum);
+                h[k + 1] = sum;
+            }
+            axpy_norm_kernel<T> last;
+            last.a = h[i - 1];
+            last.x = V + (npy_intp) (i - 1) * n;
+            last.y = w;
+            pass(last, &sum);
+            const R hnorm = std::sqrt(krylov_traits<T>::real(sum));
+            h[i] = T(hnorm);
+            if (hnorm != 0) {
+                scale_kernel<T> kernel;
+                kernel.a = T(R(1) / hnorm);
+                kernel.x = w;
+                kernel.y = V + (npy_intp) i * n;
+                pass(kernel);
+            }
+
+            for (int j = 0; j < i - 1; j++)
+                krylov_rotvec(h[j], h[j + 1], gc[j], gs[j]);
+            krylov_getgiv(h[i - 1], h[i], gc[i - 1], gs[i - 1]);
+            krylov_rotvec(h[i - 1], h[i], gc[i - 1], gs[i - 1]);
+
+            krylov_rotvec(s[i - 1], s[i], gc[i - 1], gs[i - 1]);
+            resid = krylov_abs(s[i]) / bnrm2;
+            if (resid <= tol) {
+                krylov_gmres_update(pass, i, x, &H[0], ldh, &y[0], &s[0], V);
+                return 0;
+            }
+        }
+
+        krylov_gmres_update(pass, restrt, x, &H[0], ldh, &y[0], &s[0], V);
+        rnorm = krylov_residual(A, pass, b, x, r, w);
+
+        resid = rnorm / bnrm2;
+        if (resid <= tol)
+            return 0;
+        if (iter >= maxiter)
+            return 1;
+    }
+}
+
+
+/*
+ * Python interface
+ */
+
+enum krylov_method { KRYLOV_CG, KRYLOV_BICGSTAB, KRYLOV_GMRES };
+
+struct krylov_operand
+{
+    char format;
+    int R, C;
+    PyArrayObject *indptr, *indices, *data;
+};
+
+struct krylov_args
+{
+    krylov_method method;
+    krylov_operand A, M;
+    PyArrayObject *b, *x;
+    double tol;
+    int restrt, maxiter;
+};
+
+template <class I, class T>
+static void krylov_make_operator(const krylov_operand& op, const npy_intp n,
+                                 sparse_operator<I,T>& A)
+{
+    A.identity = (op.data == NULL);
+    A.format = op.format;
+    A.n = (I) n;
+    A.R = (I) op.R;
+    A.C = (I) op.C;
+    if (!A.identity) {
+        A.Ap = (const I *) PyArray_DATA(op.indptr);
+        A.Aj = (const I *) PyArray_DATA(op.indices);
+        A.Ax = (const T *) PyArray_DATA(op.data);
+    } else {
+        A.Ap = A.Aj = NULL;
+        A.Ax = NULL;
+    }
+}
+
+template <class I, class T>
+static int krylov_run(krylov_args& a, int& iter, double& resid, int& info)
+{
+    sparse_operator<I,T> A, M;
+    const npy_intp n = PyArray_DIM(a.b, 0);
+    const T * b = (const T *) PyArray_DATA(a.b);
+    T * x = (T *) PyArray_DATA(a.x);
+    int failed = 0;
+
+    krylov_make_operator(a.A, n, A);
+    krylov_make_operator(a.M, n, M);
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        switch (a.method) {
+        case KRYLOV_CG:
+            info = krylov_cg(A, M, n, b, x, a.tol, a.maxiter, iter, resid);
+            break;
+        case KRYLOV_BICGSTAB:
+            info = krylov_bicgstab(A, M, n, b, x, a.tol, a.maxiter, iter, resid);
+            break;
+        case KRYLOV_GMRES:
+            info = krylov_gmres(A, M, n, b, x, a.tol, a.restrt, a.maxiter,
+                                iter, resid);
+            break;
+        }
+    } catch (const std::exception&) {
+        failed = 1;
+    }
+    Py_END_ALLOW_THREADS
+
+    if (failed) {
+        PyErr_SetString(PyExc_RuntimeError, "krylov: applying an operator failed");
+        return -1;
+    }
+    return 0;
+}
+
+template <class I>
+static int krylov_dispatch(krylov_args& a, int& iter, double& resid, int& info)
+{
+    switch (PyArray_TYPE(a.x)) {
+    case NPY_FLOAT:
+        return krylov_run<I,float>(a, iter, resid, info);
+    case NPY_DOUBLE:
+        return krylov_run<I,double>(a, iter, resid, info);
+    case NPY_CFLOAT:
+        return krylov_run<I,npy_cfloat_wrapper>(a, iter, resid, info);
+    case NPY_CDOUBLE:
+        return krylov_run<I,npy_cdouble_wrapper>(a, iter, resid, info);
+    }
+    PyErr_SetString(PyExc_TypeError, "x must be of type 'f', 'd', 'F', or 'D'");
+    return -1;
+}
+
+/*
+ * Convert the tuple (format, R, C, indptr, indices, data) describing a
+ * square matrix of size n.  None stands for the identity.
+ */
+static int krylov_parse_operand(PyObject *obj, const int typenum,
+                                int& index_type, const npy_intp n,
+                                krylov_operand& op)
+{
+    PyObject *o_indptr, *o_indices, *o_data;
+    const char *format;
+    npy_intp n_brow, nnz;
+
+    op.indptr = op.indices = op.data = NULL;
+    op.format = 0;
+    op.R = op.C = 1;
+    if (obj == Py_None)
+        return 0;
+
+    if (!PyArg_ParseTuple(obj, "siiOOO", &format, &op.R, &op.C,
+                          &o_indptr, &o_indices, &o_data))
+        return -1;
+    if (strcmp(format, "csr") == 0)
+        op.format = 'r';
+    else if (strcmp(format, "csc") == 0)
+        op.format = 'c';
+    else if (strcmp(format, "bsr") == 0)
+        op.format = 'b';
+    else {
+        PyErr_SetString(PyExc_ValueError, "format must be 'csr', 'csc' or 'bsr'");
+        return -1;
+    }
+    if (op.format != 'b')
+        op.R = op.C = 1;
+    if (op.R <= 0 || op.C <= 0 || n % op.R != 0 || n % op.C != 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "block size does not divide the matrix size");
+        return -1;
+    }
+
+    // the first matrix fixes the index type
+    if (index_type == NPY_NOTYPE) {
+        index_type = NPY_INT;
+        if (PyArray_Check(o_indptr) &&
+            PyArray_ISINTEGER((PyArrayObject *) o_indptr) &&
+            PyArray_ITEMSIZE((PyArrayObject *) o_indptr) == 8)
+            index_type = (sizeof(long) == 8) ? NPY_LONG : NPY_LONGLONG;
+    }
+    op.indptr = (PyArrayObject *) PyArray_FROMANY(o_indptr, index_type, 1, 1,
+                                                  NPY_IN_ARRAY);
+    op.indices = (PyArrayObject *) PyArray_FROMANY(o_indices, index_type, 1, 1,
+                                                   NPY_IN_ARRAY);
+    op.data = (PyArrayObject *) PyArray_FROMANY(o_data, typenum, 1, 3,
+                                                NPY_IN_ARRAY);
+    if (op.indptr == NULL || op.indices == NULL || op.data == NULL)
+        return -1;
+
+    // the shape of the matrix; its indices are not checked
+    n_brow = (op.format == 'b') ? n / op.R : n;
+    if (PyArray_DIM(op.indptr, 0) != n_brow + 1) {
+        PyErr_SetString(PyExc_ValueError, "indptr does not match the matrix size");
+        return -1;
+    }
+    if (index_type == NPY_INT)
+        nnz = ((int *) PyArray_DATA(op.indptr))[n_brow];
+    else
+        nnz = (npy_intp) ((npy_int64 *) PyArray_DATA(op.indptr))[n_brow];
+    if (nnz < 0 || PyArray_DIM(op.indices, 0) < nnz ||
+        PyArray_SIZE(op.data) < nnz * op.R * op.C) {
+        PyErr_SetString(PyExc_ValueError, "indices or data are too small");
+        return -1;
+    }
+    return 0;
+}
+
+static void krylov_release_operand(krylov_operand& op)
+{
+    Py_XDECREF(op.indptr);
+    Py_XDECREF(op.indices);
+    Py_XDECREF(op.data);
+}
+
+static PyObject *krylov_call(krylov_method method, PyObject *args)
+{
+    PyObject *o_A, *o_M, *o_b, *o_x;
+    krylov_args a;
+    int iter = 0, info = 0, result = -1;
+    int typenum, index_type = NPY_NOTYPE;
+    double resid = 0;
+    npy_intp n;
+
+    a.method = method;
+    a.restrt = 0;
+    a.A.indptr = a.A.indices = a.A.data = NULL;
+    a.M.indptr = a.M.indices = a.M.data = NULL;
+    a.b = a.x = NULL;
+
+    if (method == KRYLOV_GMRES) {
+        if (!PyArg_ParseTuple(args, "OOOOdii", &o_A, &o_M, &o_b, &o_x,
+                              &a.tol, &a.restrt, &a.maxiter))
+            return NULL;
+    } else {
+        if (!PyArg_ParseTuple(args, "OOOOdi", &o_A, &o_M, &o_b, &o_x,
+                              &a.tol, &a.maxiter))
+            return NULL;
+    }
+    if (o_A == Py_None) {
+        PyErr_SetString(PyExc_ValueError, "A must be a matrix");
+        return NULL;
+    }
+
+    // x is updated in place
+    a.x = (PyArrayObject *) PyArray_FROMANY(o_x, NPY_NOTYPE, 1, 1,
+                                            NPY_INOUT_ARRAY);
+    if (a.x == NULL)
+        goto fail;
+    typenum = PyArray_TYPE(a.x);
+    n = PyArray_DIM(a.x, 0);
+    a.b = (PyArrayObject *) PyArray_FROMANY(o_b, typenum, 1, 1, NPY_IN_ARRAY);
+    if (a.b == NULL)
+        goto fail;
+    if (PyArray_DIM(a.b, 0) != n) {
+        PyErr_SetString(PyExc_ValueError, "b and x have different sizes");
+        goto fail;
+    }
+    if (method == KRYLOV_GMRES && (a.restrt <= 0 || a.restrt > n)) {
+        PyErr_SetString(PyExc_ValueError, "restrt must be in 1..n");
+        goto fail;
+    }
+    if (krylov_parse_operand(o_A, typenum, index_type, n, a.A) != 0 ||
+        krylov_parse_operand(o_M, typenum, index_type, n, a.M) != 0)
+        goto fail;
+
+    if (index_type == NPY_INT)
+        result = krylov_dispatch<int>(a, iter, resid, info);
+    else
+        result = krylov_dispatch<npy_int64>(a, iter, resid, info);
+
+fail:
+    krylov_release_operand(a.A);
+    krylov_release_operand(a.M);
+    Py_XDECREF(a.b);
+    Py_XDECREF(a.x);
+
+    if (result != 0)
+        return NULL;
+    return Py_BuildValue("idi", iter, resid, info);
+}
+
+static char cg_doc[] =
+"iter, resid, info = cg(A, M, b, x, tol, maxiter)\n"
+"\n"
+"Conjugate Gradient iteration for A x = b.  A is a tuple\n"
+"(format, R, C, indptr, indices, data) describing a square CSR, CSC or\n"
+"BSR matrix (format 'csr', 'csc' or 'bsr', block size R x C), M is the\n"
+"preconditioner in the same form or None.  x holds the initial guess and\n"
+"is overwritten by the solution.  The passes run on the thread pool of\n"
+"scipy.sparse.sparsetools, see sparsetools.set_num_threads.";
+
+static PyObject *cg(PyObject *self, PyObject *args)
+{
+    return krylov_call(KRYLOV_CG, args);
+}
+
+static char bicgstab_doc[] =
+"iter, resid, info = bicgstab(A, M, b, x, tol, maxiter)\n"
+"\n"
+"BIConjugate Gradient STABilized iteration for A x = b, see cg.";
+
+static PyObject *bicgstab(PyObject *self, PyObject *args)
+{
+    return krylov_call(KRYLOV_BICGSTAB, args);
+}
+
+static char gmres_doc[] =
+"iter, resid, info = gmres(A, M, b, x, tol, restrt, maxiter)\n"
+"\n"
+"Generalized Minimal RESidual iteration for A x = b restarted every\n"
+"restrt steps, see cg.";
+
+static PyObject *gmres(PyObject *self, PyObject *args)
+{
+    return krylov_call(KRYLOV_GMRES, args);
+}
+
+static PyMethodDef krylov_methods[] = {
+    {"cg", cg, METH_VARARGS, cg_doc},
+    {"bicgstab", bicgstab, METH_VARARGS, bicgstab_doc},
+    {"gmres", gmres, METH_VARARGS, gmres_doc},
+    {NULL, NULL, 0, NULL}
+};
+
+#if PY_VERSION_HEX >= 0x03000000
+
+static struct PyModuleDef moduledef = {
+    PyModuleDef_HEAD_INIT,
+    "_krylov",
+    NULL,
+    -1,
+    krylov_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC PyInit__krylov(void)
+{
+    PyObject *m;
+
+    import_array();
+    import_parallel();
+
+    m = PyModule_Create(&moduledef);
+    return m;
+}
+
+#else
+
+PyMODINIT_FUNC init_krylov(void)
+{
+    import_array();
+    import_parallel();
+
+    Py_InitModule("_krylov", krylov_methods);
+}
+
+#endif
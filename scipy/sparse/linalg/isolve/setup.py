@@ -37,6 +37,21 @@ def configuration(parent_package='',top_path=None):
                          extra_info = lapack_opt
                          )
 
+    # compiled CG, BiCGSTAB and GMRES for sparse matrices; they use the
+    # sparsetools kernels, which run on pthreads where available
+    if sys.platform == 'win32':
+        libraries = []
+    else:
+        libraries = ['pthread']
+    sparsetools_dir = join('..', '..', 'sparsetools')
+    config.add_extension('_krylov',
+                         sources = [join('iterative', '_krylov.cxx')],
+                         include_dirs = [sparsetools_dir],
+                         define_macros = [('__STDC_FORMAT_MACROS', 1)],
+                         libraries = libraries,
+                         depends = [join(sparsetools_dir, '*.h')]
+                         )
+
     config.add_data_dir('tests')
 
     return config
@@ -6,7 +6,7 @@ from numpy.testing import TestCase, assert_equal, assert_array_equal, assert_
 
 from numpy import zeros, ones, arange, array, abs, max
 from scipy.linalg import norm
-from scipy.sparse import spdiags, csr_matrix
+from scipy.sparse import spdiags, csr_matrix, csc_matrix, bsr_matrix
 
 from scipy.sparse.linalg.interface import LinearOperator
 from scipy.sparse.linalg.isolve import cg, cgs, bicg, bicgstab, gmres, qmr, minres, lgmres
@@ -141,6 +141,42 @@ class TestIterative(TestCase):
                 assert_equal(info,0)
                 assert_( norm(b - A*x) < tol*norm(b) )
 
+    def test_native(self):
+        """test the compiled solvers for sparse matrices against the
+        LinearOperator path"""
+
+        solvers = [(cg, True), (bicgstab, False), (gmres, False)]
+
+        for typ in 'fdFD':
+            tol = {'f':1e-5, 'd':1e-8, 'F':1e-5, 'D':1e-8}[typ]
+            for solver, req_sym in solvers:
+                A = Poisson1D + spdiags([arange(N)*0.1], [0], N, N)
+                if not req_sym:
+                    A = A + spdiags([ones(N)*0.5], [2], N, N)
+                A = A.astype(typ)
+                D = spdiags([1.0/A.diagonal()], [0], N, N).astype(typ)
+                b = arange(N, dtype=typ)
+                if typ in 'FD':
+                    b = (b + 1j*ones(N)).astype(typ)
+
+                op = LinearOperator(A.shape, lambda x: A*x, dtype=typ)
+                precond = LinearOperator(A.shape, lambda x: D*x, dtype=typ)
+                x0, info = solver(op, b, tol=tol, M=precond)
+                assert_equal(info, 0)
+
+                for fmt in [csr_matrix, csc_matrix]:
+                    x, info = solver(fmt(A), b, tol=tol, M=fmt(D))
+                    assert_equal(info, 0)
+                    assert_( norm(x - x0) < 1e-3*norm(x0) )
+
+                B = bsr_matrix(A, blocksize=(2,2))
+                x, info = solver(B, b, tol=tol)
+                assert_equal(info, 0)
+                assert_( norm(b - A*x) < 1e-3*norm(b) )
+
+                x, info = solver(B, b, tol=1e-30, maxiter=2)
+                assert_(info > 0)
+
 
 class TestQMR(TestCase):
     def test_leftright_precond(self):
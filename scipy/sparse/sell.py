@@ -0,0 +1,238 @@
+"""Sliced ELLPACK (SELL-C-sigma) format"""
+
+__docformat__ = "restructuredtext en"
+
+__all__ = ['sell_matrix', 'isspmatrix_sell']
+
+import numpy as np
+
+from base import isspmatrix, _formats
+from data import _data_matrix
+from sputils import isshape, upcast, getdtype, get_index_dtype
+from sparsetools import sell_matvec
+
+class sell_matrix(_data_matrix):
+    """Sparse matrix in Sliced ELLPACK (SELL-C-sigma) format
+
+    The rows are sorted by decreasing length inside windows of ``sigma``
+    rows and then stored in column-major chunks of ``C`` rows, so that
+    the matrix-vector product can work on ``C`` rows at a time with SIMD
+    instructions.  Conversion costs about as much as a few products, so
+    the format is intended for matrices that are multiplied by many
+    vectors.  Arithmetic other than multiplication by vectors and
+    scalars goes through CSR.
+
+    This can be instantiated in several ways:
+        sell_matrix(D, C=8, sigma=256)
+            with a dense matrix
+
+        sell_matrix(S, C=8, sigma=256)
+            with another sparse matrix S (equivalent to S.tosell(C, sigma))
+
+        sell_matrix((data, indices, indptr, perm), shape=(M, N), C=8)
+            is the native representation: chunk ``c`` holds rows
+            ``perm[C*c:C*(c+1)]`` and its entries are stored in
+            ``data[indptr[c]:indptr[c+1]]`` with entry ``k`` of lane
+            ``r`` at offset ``C*k + r``.  Padding entries have
+            ``indices == -1``.
+
+    Attributes
+    ----------
+    C : int
+        Chunk height
+    sigma : int
+        Sorting window, in rows
+
+    Notes
+    -----
+    See M. Kreutzer et al., "A unified sparse matrix data format for
+    efficient general sparse matrix-vector multiplication on modern
+    processors with wide SIMD units", SIAM J. Sci. Comput. 36(5), 2014.
+
+    Examples
+    --------
+
+    >>> from scipy.sparse import *
+    >>> from scipy import *
+    >>> A = csr_matrix([[1,0,2],[0,0,3],[4,5,6]])
+    >>> S = A.tosell(C=2)
+    >>> S * array([1,1,1])
+    array([ 3,  3, 15])
+
+    """
+
+    def __init__(self, arg1, shape=None, dtype=None, copy=False, C=None, sigma=None):
+        _data_matrix.__init__(self)
+        self.format = 'sell'
+
+        if isspmatrix_sell(arg1):
+            # keep the layout unless asked otherwise
+            if C is None:
+                C = arg1.C
+            if sigma is None:
+                sigma = arg1.sigma
+        if C is None:
+            C = 8
+        if sigma is None:
+            sigma = 256
+
+        if isspmatrix_sell(arg1) and C == arg1.C and sigma == arg1.sigma:
+            if copy:
+                arg1 = arg1.copy()
+            self.data    = arg1.data
+            self.indices = arg1.indices
+            self.indptr  = arg1.indptr
+            self.perm    = arg1.perm
+            self.C       = arg1.C
+            self.sigma   = arg1.sigma
+            self.shape   = arg1.shape
+        elif isspmatrix(arg1):
+            A = arg1.tocsr().tosell(C=C, sigma=sigma)
+            self.data    = A.data
+            self.indices = A.indices
+            self.indptr  = A.indptr
+            self.perm    = A.perm
+            self.C       = A.C
+            self.sigma   = A.sigma
+            self.shape   = A.shape
+        elif isinstance(arg1, tuple) and not isshape(arg1):
+            try:
+                data, indices, indptr, perm = arg1
+            except:
+                raise ValueError('unrecognized form for sell_matrix constructor')
+            if shape is None:
+                raise ValueError('expected a shape argument')
+            self.data    = np.array(data, dtype=getdtype(dtype, data), copy=copy)
+            idx_dtype = get_index_dtype((indices, indptr, perm), check_contents=True,
+                                        maxval=max(shape))
+            self.indices = np.array(indices, dtype=idx_dtype, copy=copy)
+            self.indptr  = np.array(indptr,  dtype=idx_dtype, copy=copy)
+            self.perm    = np.array(perm,    dtype=idx_dtype, copy=copy)
+            self.C       = int(C)
+            self.sigma   = int(sigma)
+            self.shape   = shape
+        else:
+            # dense matrix or shape tuple: build through CSR
+            from csr import csr_matrix
+            A = csr_matrix(arg1, shape=shape, dtype=dtype).tosell(C=C, sigma=sigma)
+            self.data    = A.data
+            self.indices = A.indices
+            self.indptr  = A.indptr
+            self.perm    = A.perm
+            self.C       = A.C
+            self.sigma   = A.sigma
+            self.shape   = A.shape
+
+        if dtype is not None:
+            self.data = self.data.astype(dtype)
+
+        self.check_format()
+
+    def check_format(self):
+        """check whether the matrix format is valid"""
+        M,N = self.shape
+        C = self.C
+
+        if C < 1:
+            raise ValueError('chunk height C must be positive')
+
+        n_chunks = (M + C - 1) // C
+
+        if self.indptr.ndim != 1 or len(self.indptr) != n_chunks + 1:
+            raise ValueError('indptr should have length %d' % (n_chunks + 1))
+        if len(self.perm) != M:
+            raise ValueError('perm should have length %d' % M)
+        if len(self.indices) != len(self.data) or len(self.data) < self.indptr[-1]:
+            raise ValueError('indices and data should have length %d' \
+                    % self.indptr[-1])
+        if np.any(np.diff(self.indptr) % C):
+            raise ValueError('chunk sizes must be multiples of C')
+
+    def getnnz(self):
+        """number of stored values, excluding padding
+
+        explicit zero values are included in this number
+        """
+        return int(np.sum(self.indices[:self.indptr[-1]] >= 0))
+
+    nnz = property(fget=getnnz)
+
+    def __repr__(self):
+        format = self.getformat()
+        return "<%dx%d sparse matrix of type '%s'\n" \
+               "\twith %d stored elements (C=%d, sigma=%d) in %s format>" % \
+               ( self.shape + (self.dtype.type, self.nnz, self.C, self.sigma, \
+                 _formats[format][1],) )
+
+    def _mul_vector(self, other):
+        M,N = self.shape
+
+        # output array
+        result = np.zeros(M, dtype=upcast(self.dtype, other.dtype))
+
+        sell_matvec(M, N, self.C, self.perm, self.indptr, self.indices,
+                    self.data, other, result)
+
+        return result
+
+    def _mul_multivector(self, other):
+        return np.hstack( [ self._mul_vector(col).reshape(-1,1) for col in other.T ] )
+
+    def tosell(self, C=None, sigma=None, copy=False):
+        if (C is None or C == self.C) and (sigma is None or sigma == self.sigma):
+            if copy:
+                return self.copy()
+            else:
+                return self
+        if C is None:
+            C = self.C
+        if sigma is None:
+            sigma = self.sigma
+        return self.tocsr().tosell(C=C, sigma=sigma)
+
+    def tocoo(self):
+        M,N = self.shape
+        C = self.C
+
+        nnz     = self.indptr[-1]
+        widths  = np.diff(self.indptr) // C
+        chunk   = np.repeat(np.arange(len(widths)), widths * C)
+        lane    = (np.arange(nnz) - self.indptr[chunk]) % C
+        slot    = C * chunk + lane
+
+        col  = self.indices[:nnz]
+        mask = col >= 0
+
+        # lanes past M only ever contain padding
+        row  = self.perm[slot[mask]]
+        col  = col[mask]
+        data = self.data[:nnz][mask]
+
+        from coo import coo_matrix
+        return coo_matrix((data,(row,col)), shape=self.shape)
+
+    def tocsr(self):
+        return self.tocoo().tocsr()
+
+    def tocsc(self):
+        return self.tocoo().tocsc()
+
+    def transpose(self):
+        return self.tocsr().transpose().tosell(C=self.C, sigma=self.sigma)
+
+    # needed by _data_matrix
+    def _with_data(self, data, copy=True):
+        """Returns a matrix with the same sparsity structure as self,
+        but with different data.  By default the structure arrays are copied.
+        """
+        if copy:
+            arg1 = (data, self.indices.copy(), self.indptr.copy(), self.perm.copy())
+        else:
+            arg1 = (data, self.indices, self.indptr, self.perm)
+        return sell_matrix(arg1, shape=self.shape, C=self.C, sigma=self.sigma)
+
+
+from sputils import _isinstance
+
+def isspmatrix_sell(x):
+    return _isinstance(x, sell_matrix)
@@ -1,6 +1,8 @@
 """sparsetools - a collection of routines for sparse matrix operations
 """
 
+import numpy as np
+
 from csr import *
 from csc import *
 from coo import *
@@ -8,3 +10,107 @@ from dia import *
 from bsr import *
 from csgraph import *
 
+import csr, csc, coo, dia, bsr, csgraph
+import _parallel
+import _assembler
+from _assembler import assembler, csr_bmat, csr_kron
+
+_modules = [csr, csc, coo, dia, bsr, csgraph, _assembler]
+
+def assembler_supports(dtype):
+    """Return whether assembler() accepts matrices of the given dtype"""
+    return np.dtype(dtype).char in _assembler.typecodes
+
+def set_num_threads(n_threads):
+    """Set the number of threads used by the parallel sparsetools kernels
+
+    The extension modules that run parallel kernels share one thread
+    pool (see parallel_api.h), so the setting applies to all of them.
+
+    Parameters
+    ----------
+    n_threads : int
+        Number of threads; values <= 0 select one thread per processor.
+        The initial value is taken from the environment variable
+        SCIPY_SPARSE_NUM_THREADS, if set.
+    """
+    _parallel.set_num_threads(int(n_threads))
+
+def get_num_threads():
+    """Return the number of threads used by the parallel sparsetools kernels"""
+    return _parallel.get_num_threads()
+
+def set_parallel_threshold(threshold):
+    """Set the work size (roughly the number of nonzeros touched) below
+    which the sparsetools kernels run serially
+    """
+    _parallel.set_parallel_threshold(int(threshold))
+
+def get_parallel_threshold():
+    """Return the work size below which the sparsetools kernels run serially"""
+    return _parallel.get_parallel_threshold()
+
+def get_workspace_allocations():
+    """Return the number of scratch buffer allocations made so far
+
+    Sparse matrix products and elementwise operations keep their scratch
+    arrays between calls.  Once these are large enough for the matrices
+    at hand, repeated operations do not allocate scratch space and this
+    count stays constant.
+    """
+    return sum([module.get_workspace_allocations() for module in _modules])
+
+def clear_workspaces():
+    """Drop the scratch arrays kept between calls
+
+    Each kind of scratch array is freed the next time an operation uses
+    it, so memory is not returned before then.
+    """
+    for module in _modules:
+        module.clear_workspaces()
+
+_matmat_accumulators = {'auto'  : csr.MATMAT_AUTO,
+                        'dense' : csr.MATMAT_DENSE,
+                        'hash'  : csr.MATMAT_HASH,
+                        'esc'   : csr.MATMAT_ESC}
+
+def set_matmat_accumulator(method):
+    """Select how sparse matrix products accumulate the rows of the result
+
+    Parameters
+    ----------
+    method : {'auto', 'dense', 'hash', 'esc'}
+        - 'dense' : dense workspace of length n_col per thread (SMMP)
+        - 'hash'  : open addressing hash table sized to each row
+        - 'esc'   : expand, sort and compress the products of each row
+        - 'auto'  : choose per row from the number of entries in the
+                    row and the number of columns (default)
+    """
+    try:
+        accumulator = _matmat_accumulators[method]
+    except KeyError:
+        raise ValueError("unknown accumulator '%s'" % (method,))
+
+    for module in [csr, csc, bsr]:
+        module.set_matmat_accumulator(accumulator)
+
+def get_matmat_accumulator():
+    """Return the accumulator used by sparse matrix products"""
+    accumulator = csr.get_matmat_accumulator()
+    for name, value in _matmat_accumulators.items():
+        if value == accumulator:
+            return name
+
+def set_bsr_unrolled(enable):
+    """Enable or disable the unrolled BSR kernels
+
+    When enabled (the default) products and elementwise operations of
+    BSR matrices with square blocks of size 2 to 8 use kernels that are
+    specialized for the block size.  Disabling them is mainly useful to
+    compare timings with the generic kernels.
+    """
+    bsr.set_bsr_unrolled(int(bool(enable)))
+
+def get_bsr_unrolled():
+    """Return whether the unrolled BSR kernels are enabled"""
+    return bool(bsr.get_bsr_unrolled())
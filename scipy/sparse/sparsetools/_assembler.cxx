@@ -0,0 +1,996 @@
+/*
+ * _assembler
+ *
+ * Incremental assembly of sparse matrices for lil_matrix and
+ * dok_matrix.  An assembler object accepts batches of (row, column,
+ * value) updates that either add to or set the entries of the matrix
+ * and converts the result to canonical CSR format, see assemble.h.
+ * The GIL is released while updates are applied and while the matrix
+ * is converted.
+ *
+ * csr_bmat and csr_kron assemble block matrices and Kronecker products
+ * of CSR and BSR matrices for construct.py.
+ */
+
+#include "Python.h"
+
+#define PY_ARRAY_UNIQUE_SYMBOL _scipy_assembler_ARRAY_API
+#include "numpy/arrayobject.h"
+
+#include <climits>
+#include <new>
+#include <stdexcept>
+
+#include "complex_ops.h"
+#include "assemble.h"
+#include "workspace.h"
+
+
+/*
+ * Type erased sparse_assembler<I,T>
+ */
+class assembler_interface
+{
+    public:
+        virtual ~assembler_interface() {}
+        virtual npy_intp check_indices(const npy_intp nnz,
+                                       const npy_intp Ai[],
+                                       const npy_intp Aj[]) const = 0;
+        virtual void insert(const npy_intp nnz,
+                            const npy_intp Ai[],
+                            const npy_intp Aj[],
+                            const void * Ax,
+                            const npy_intp x_stride,
+                            const bool overwrite) = 0;
+        virtual double compact() = 0;
+        virtual void csr(int Bp[], int Bj[], void * Bx) const = 0;
+        virtual void csr(npy_int64 Bp[], npy_int64 Bj[], void * Bx) const = 0;
+};
+
+template <class I, class T>
+class assembler_impl : public assembler_interface
+{
+    public:
+        assembler_impl(const I n_row, const I n_col) : a(n_row, n_col) {}
+
+        npy_intp check_indices(const npy_intp nnz,
+                               const npy_intp Ai[],
+                               const npy_intp Aj[]) const
+        {
+            return a.check_indices(nnz, Ai, Aj);
+        }
+
+        void insert(const npy_intp nnz,
+                    const npy_intp Ai[],
+                    const npy_intp Aj[],
+                    const void * Ax,
+                    const npy_intp x_stride,
+                    const bool overwrite)
+        {
+            a.insert(nnz, Ai, Aj, (const T *) Ax, x_stride, overwrite);
+        }
+
+        double compact() { return a.compact(); }
+
+        void csr(int Bp[], int Bj[], void * Bx) const
+        {
+            a.csr(Bp, Bj, (T *) Bx);
+        }
+
+        void csr(npy_int64 Bp[], npy_int64 Bj[], void * Bx) const
+        {
+            a.csr(Bp, Bj, (T *) Bx);
+        }
+
+    private:
+        sparse_assembler<I,T> a;
+};
+
+template <class I>
+static assembler_interface *assembler_create(const int typenum,
+                                             const I n_row,
+                                             const I n_col)
+{
+    switch (typenum) {
+    case NPY_INT:
+        return new assembler_impl<I,int>(n_row, n_col);
+    case NPY_LONG:
+        return new assembler_impl<I,long>(n_row, n_col);
+    case NPY_LONGLONG:
+        return new assembler_impl<I,long long>(n_row, n_col);
+    case NPY_FLOAT:
+        return new assembler_impl<I,float>(n_row, n_col);
+    case NPY_DOUBLE:
+        return new assembler_impl<I,double>(n_row, n_col);
+    case NPY_LONGDOUBLE:
+        return new assembler_impl<I,npy_longdouble>(n_row, n_col);
+    case NPY_CFLOAT:
+        return new assembler_impl<I,npy_cfloat_wrapper>(n_row, n_col);
+    case NPY_CDOUBLE:
+        return new assembler_impl<I,npy_cdouble_wrapper>(n_row, n_col);
+    case NPY_CLONGDOUBLE:
+        return new assembler_impl<I,npy_clongdouble_wrapper>(n_row, n_col);
+    }
+    return NULL;
+}
+
+static const int assembler_types[] = {
+    NPY_INT, NPY_LONG, NPY_LONGLONG, NPY_FLOAT, NPY_DOUBLE, NPY_LONGDOUBLE,
+    NPY_CFLOAT, NPY_CDOUBLE, NPY_CLONGDOUBLE
+};
+
+
+/*
+ * Assembler object
+ */
+typedef struct {
+    PyObject_HEAD
+    assembler_interface *impl;
+    npy_intp n_row, n_col;
+    int typenum;
+    int busy;
+} AssemblerObject;
+
+static int assembler_acquire(AssemblerObject *self)
+{
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "assembler is in use by another thread");
+        return -1;
+    }
+    self->busy = 1;
+    return 0;
+}
+
+static void assembler_set_error(const char *what)
+{
+    if (what == NULL)
+        PyErr_NoMemory();
+    else
+        PyErr_SetString(PyExc_RuntimeError, what);
+}
+
+static PyObject *assembler_update(AssemblerObject *self, PyObject *args,
+                                  const bool overwrite)
+{
+    PyObject *o_rows, *o_cols, *o_vals;
+    PyArrayObject *rows = NULL, *cols = NULL, *vals = NULL;
+    npy_intp nnz, x_stride, bad;
+    const char *error = "";
+    PyObject *result = NULL;
+
+    if (!PyArg_ParseTuple(args, "OOO", &o_rows, &o_cols, &o_vals))
+        return NULL;
+
+    rows = (PyArrayObject *) PyArray_FROMANY(o_rows, NPY_INTP, 0, 0,
+                                             NPY_IN_ARRAY);
+    cols = (PyArrayObject *) PyArray_FROMANY(o_cols, NPY_INTP, 0, 0,
+                                             NPY_IN_ARRAY);
+    vals = (PyArrayObject *) PyArray_FROMANY(o_vals, self->typenum, 0, 0,
+                                             NPY_IN_ARRAY | NPY_FORCECAST);
+    if (rows == NULL || cols == NULL || vals == NULL)
+        goto fail;
+
+    nnz = PyArray_SIZE(rows);
+    if (PyArray_SIZE(cols) != nnz) {
+        PyErr_SetString(PyExc_ValueError,
+                        "row and column indices have different sizes");
+        goto fail;
+    }
+    if (PyArray_SIZE(vals) == nnz)
+        x_stride = 1;
+    else if (PyArray_SIZE(vals) == 1)
+        x_stride = 0;
+    else {
+        PyErr_SetString(PyExc_ValueError,
+                        "values must be a scalar or match the indices in size");
+        goto fail;
+    }
+    if (nnz == 0) {
+        Py_INCREF(Py_None);
+        result = Py_None;
+        goto fail;
+    }
+
+    bad = self->impl->check_indices(nnz, (const npy_intp *) PyArray_DATA(rows),
+                                    (const npy_intp *) PyArray_DATA(cols));
+    if (bad != nnz) {
+        PyErr_Format(PyExc_IndexError, "index (%ld,%ld) out of range",
+                     (long) ((npy_intp *) PyArray_DATA(rows))[bad],
+                     (long) ((npy_intp *) PyArray_DATA(cols))[bad]);
+        goto fail;
+    }
+
+    if (assembler_acquire(self) != 0)
+        goto fail;
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        self->impl->insert(nnz, (const npy_intp *) PyArray_DATA(rows),
+                           (const npy_intp *) PyArray_DATA(cols),
+                           PyArray_DATA(vals), x_stride, overwrite);
+    } catch (const std::bad_alloc&) {
+        error = NULL;
+    } catch (const std::exception&) {
+        error = "assembler: applying the updates failed";
+    }
+    Py_END_ALLOW_THREADS
+
+    self->busy = 0;
+    if (error == NULL || *error) {
+        assembler_set_error(error);
+        goto fail;
+    }
+
+    Py_INCREF(Py_None);
+    result = Py_None;
+
+fail:
+    Py_XDECREF(rows);
+    Py_XDECREF(cols);
+    Py_XDECREF(vals);
+    return result;
+}
+
+static char add_doc[] =
+"add(rows, cols, vals)\n"
+"\n"
+"Add vals to the entries (rows, cols).  vals may be a scalar.  Updates\n"
+"of the same entry are summed.";
+
+static PyObject *Assembler_add(AssemblerObject *self, PyObject *args)
+{
+    return assembler_update(self, args, false);
+}
+
+static char set_doc[] =
+"set(rows, cols, vals)\n"
+"\n"
+"Set the entries (rows, cols) to vals.  vals may be a scalar.  Of\n"
+"several updates of the same entry the last one is kept, entries that\n"
+"are set to zero are removed.";
+
+static PyObject *Assembler_set(AssemblerObject *self, PyObject *args)
+{
+    return assembler_update(self, args, true);
+}
+
+/*
+ * Compact all rows and, with Bp != NULL, write the matrix in CSR
+ * format.  Returns the number of entries or -1 on error.
+ */
+template <class J>
+static double assembler_run(AssemblerObject *self,
+                            J Bp[], J Bj[], void * Bx)
+{
+    const char *error = "";
+    double nnz = 0;
+
+    Py_BEGIN_ALLOW_THREADS
+    try {
+        if (Bp == NULL)
+            nnz = self->impl->compact();
+        else
+            self->impl->csr(Bp, Bj, Bx);
+    } catch (const std::bad_alloc&) {
+        error = NULL;
+    } catch (const std::exception&) {
+        error = "assembler: converting the matrix failed";
+    }
+    Py_END_ALLOW_THREADS
+
+    if (error == NULL || *error) {
+        assembler_set_error(error);
+        return -1;
+    }
+    return nnz;
+}
+
+static char getnnz_doc[] =
+"getnnz()\n"
+"\n"
+"Number of stored entries of the matrix.";
+
+static PyObject *Assembler_getnnz(AssemblerObject *self, PyObject *unused)
+{
+    double nnz;
+
+    if (assembler_acquire(self) != 0)
+        return NULL;
+    nnz = assembler_run<int>(self, NULL, NULL, NULL);
+    self->busy = 0;
+
+    if (nnz < 0)
+        return NULL;
+    return Py_BuildValue("n", (npy_intp) nnz);
+}
+
+static char tocsr_doc[] =
+"data, indices, indptr = tocsr()\n"
+"\n"
+"Return the matrix in canonical CSR format (sorted indices without\n"
+"duplicates).  The index arrays are int32 unless the matrix is too\n"
+"large, then int64.  The assembler may be updated further afterwards.";
+
+static PyObject *Assembler_tocsr(AssemblerObject *self, PyObject *unused)
+{
+    PyArrayObject *data = NULL, *indices = NULL, *indptr = NULL;
+    npy_intp dims[1];
+    int index_type;
+    double nnz;
+
+    if (assembler_acquire(self) != 0)
+        return NULL;
+
+    nnz = assembler_run<int>(self, NULL, NULL, NULL);
+    if (nnz < 0)
+        goto fail;
+
+    if (nnz <= INT_MAX && self->n_row < INT_MAX && self->n_col <= INT_MAX)
+        index_type = NPY_INT;
+    else
+        index_type = (sizeof(long) == 8) ? NPY_LONG : NPY_LONGLONG;
+
+    dims[0] = (npy_intp) nnz;
+    data = (PyArrayObject *) PyArray_SimpleNew(1, dims, self->typenum);
+    indices = (PyArrayObject *) PyArray_SimpleNew(1, dims, index_type);
+    dims[0] = self->n_row + 1;
+    indptr = (PyArrayObject *) PyArray_SimpleNew(1, dims, index_type);
+    if (data == NULL || indices == NULL || indptr == NULL)
+        goto fail;
+
+    if (index_type == NPY_INT)
+        nnz = assembler_run(self, (int *) PyArray_DATA(indptr),
+                            (int *) PyArray_DATA(indices),
+                            PyArray_DATA(data));
+    else
+        nnz = assembler_run(self, (npy_int64 *) PyArray_DATA(indptr),
+                            (npy_int64 *) PyArray_DATA(indices),
+                            PyArray_DATA(data));
+    if (nnz < 0)
+        goto fail;
+
+    self->busy = 0;
+    return Py_BuildValue("NNN", data, indices, indptr);
+
+fail:
+    self->busy = 0;
+    Py_XDECREF(data);
+    Py_XDECREF(indices);
+    Py_XDECREF(indptr);
+    return NULL;
+}
+
+static PyMethodDef Assembler_methods[] = {
+    {"add", (PyCFunction) Assembler_add, METH_VARARGS, add_doc},
+    {"set", (PyCFunction) Assembler_set, METH_VARARGS, set_doc},
+    {"getnnz", (PyCFunction) Assembler_getnnz, METH_NOARGS, getnnz_doc},
+    {"tocsr", (PyCFunction) Assembler_tocsr, METH_NOARGS, tocsr_doc},
+    {NULL, NULL, 0, NULL}   /* sentinel */
+};
+
+static PyObject *Assembler_get_shape(AssemblerObject *self, void *closure)
+{
+    return Py_BuildValue("(nn)", self->n_row, self->n_col);
+}
+
+static PyObject *Assembler_get_dtype(AssemblerObject *self, void *closure)
+{
+    return (PyObject *) PyArray_DescrFromType(self->typenum);
+}
+
+static PyGetSetDef Assembler_getset[] = {
+    {(char *) "shape", (getter) Assembler_get_shape, NULL,
+     (char *) "shape of the matrix", NULL},
+    {(char *) "dtype", (getter) Assembler_get_dtype, NULL,
+     (char *) "data type of the matrix", NULL},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static void Assembler_dealloc(AssemblerObject *self)
+{
+    delete self->impl;
+    PyObject_Del(self);
+}
+
+static char Assembler_doc[] =
+"Sparse matrix under assembly, see assembler()\n"
+"\n"
+"Attributes\n"
+"----------\n"
+"shape : 2-tuple\n"
+"    shape of the matrix\n"
+"dtype : dtype\n"
+"    data type of the matrix\n"
+"\n"
+"Methods\n"
+"-------\n"
+"add\n"
+"    add values to entries\n"
+"set\n"
+"    set entries\n"
+"getnnz\n"
+"    number of stored entries\n"
+"tocsr\n"
+"    return the matrix in CSR format\n";
+
+static PyTypeObject AssemblerType = {
+#if PY_VERSION_HEX >= 0x03000000
+    PyVarObject_HEAD_INIT(NULL, 0)
+#else
+    PyObject_HEAD_INIT(NULL)
+    0,
+#endif
+    "assembler",
+    sizeof(AssemblerObject),
+    0,
+    (destructor) Assembler_dealloc, /* tp_dealloc */
+    0,                              /* tp_print */
+    0,                              /* tp_getattr */
+    0,                              /* tp_setattr */
+    0,                              /* tp_compare / tp_reserved */
+    0,                              /* tp_repr */
+    0,                              /* tp_as_number*/
+    0,                              /* tp_as_sequence*/
+    0,                              /* tp_as_mapping*/
+    0,                              /* tp_hash */
+    0,                              /* tp_call */
+    0,                              /* tp_str */
+    PyObject_GenericGetAttr,        /* tp_getattro */
+    0,                              /* tp_setattro */
+    0,                              /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,             /* tp_flags */
+    Assembler_doc,                  /* tp_doc */
+    0,                              /* tp_traverse */
+    0,                              /* tp_clear */
+    0,                              /* tp_richcompare */
+    0,                              /* tp_weaklistoffset */
+    0,                              /* tp_iter */
+    0,                              /* tp_iternext */
+    Assembler_methods,              /* tp_methods */
+    0,                              /* tp_members */
+    Assembler_getset,               /* tp_getset */
+    0,                              /* tp_base */
+    0,                              /* tp_dict */
+    0,                              /* tp_descr_get */
+    0,                              /* tp_descr_set */
+    0,                              /* tp_dictoffset */
+    0,                              /* tp_init */
+    0,                              /* tp_alloc */
+    0,                              /* tp_new */
+    0,                              /* tp_free */
+    0,                              /* tp_is_gc */
+    0,                              /* tp_bases */
+    0,                              /* tp_mro */
+    0,                              /* tp_cache */
+    0,                              /* tp_subclasses */
+    0,                              /* tp_weaklist */
+    0,                              /* tp_del */
+#if PY_VERSION_HEX >= 0x02060000
+    0,                              /* tp_version_tag */
+#endif
+};
+
+
+/*
+ * Module functions
+ */
+static char assembler_doc[] =
+"A = assembler(shape, dtype)\n"
+"\n"
+"Return an empty sparse matrix of the given shape for incremental\n"
+"assembly.  dtype must be one of the types listed in typecodes.";
+
+static PyObject *assembler(PyObject *self, PyObject *args)
+{
+    PyArray_Descr *descr = NULL;
+    npy_intp n_row, n_col;
+    AssemblerObject *A;
+    assembler_interface *impl = NULL;
+    int typenum;
+
+    if (!PyArg_ParseTuple(args, "(nn)O&", &n_row, &n_col,
+                          PyArray_DescrConverter, &descr))
+        return NULL;
+    typenum = descr->type_num;
+    Py_DECREF(descr);
+
+    if (n_row < 0 || n_col < 0) {
+        PyErr_SetString(PyExc_ValueError, "invalid shape");
+        return NULL;
+    }
+
+    try {
+        if (n_row <= INT_MAX && n_col <= INT_MAX)
+            impl = assembler_create<int>(typenum, (int) n_row, (int) n_col);
+        else
+            impl = assembler_create<npy_int64>(typenum, n_row, n_col);
+    } catch (const std::bad_alloc&) {
+        return PyErr_NoMemory();
+    }
+    if (impl == NULL) {
+        PyErr_SetString(PyExc_TypeError, "unsupported data type");
+        return NULL;
+    }
+
+    A = PyObject_New(AssemblerObject, &AssemblerType);
+    if (A == NULL) {
+        delete impl;
+        return NULL;
+    }
+    A->impl = impl;
+    A->n_row = n_row;
+    A->n_col = n_col;
+    A->typenum = typenum;
+    A->busy = 0;
+    return (PyObject *) A;
+}
+
+/*
+ * Block matrices and Kronecker products
+ */
+
+/*
+ * Convert a tuple (indptr, indices, data) to arrays of the given types.
+ * Returns -1 on error, the arrays must be released in any case.
+ */
+static int assembler_parse_csr(PyObject *obj, const int index_type,
+                               const int typenum, PyArrayObject *arrays[3])
+{
+    PyObject *o_indptr, *o_indices, *o_data;
+
+    if (!PyArg_ParseTuple(obj, "OOO", &o_indptr, &o_indices, &o_data))
+        return -1;
+
+    // the caller has chosen index and data types that hold the values
+    arrays[0] = (PyArrayObject *) PyArray_FROMANY(o_indptr, index_type, 1, 1,
+                                                  NPY_IN_ARRAY | NPY_FORCECAST);
+    arrays[1] = (PyArrayObject *) PyArray_FROMANY(o_indices, index_type, 1, 1,
+                                                  NPY_IN_ARRAY | NPY_FORCECAST);
+    arrays[2] = (PyArrayObject *) PyArray_FROMANY(o_data, typenum, 1, 3,
+                                                  NPY_IN_ARRAY | NPY_FORCECAST);
+    if (arrays[0] == NULL || arrays[1] == NULL || arrays[2] == NULL)
+        return -1;
+    return 0;
+}
+
+/*
+ * Number of entries of a CSR or BSR matrix with n_row (block) rows and
+ * RC values per entry, or -1 if the arrays are inconsistent
+ */
+template <class I>
+static npy_intp assembler_csr_nnz(PyArrayObject *arrays[3], const npy_intp n_row,
+                                  const npy_intp RC)
+{
+    const I * Ap = (const I *) PyArray_DATA(arrays[0]);
+    npy_intp nnz;
+
+    if (PyArray_DIM(arrays[0], 0) != n_row + 1) {
+        PyErr_SetString(PyExc_ValueError, "index pointer has the wrong size");
+        return -1;
+    }
+    nnz = (npy_intp) Ap[n_row];
+    if (Ap[0] != 0 || nnz < 0 || PyArray_DIM(arrays[1], 0) < nnz ||
+        PyArray_SIZE(arrays[2]) < RC * nnz) {
+        PyErr_SetString(PyExc_ValueError, "inconsistent sparse matrix");
+        return -1;
+    }
+    return nnz;
+}
+
+static int assembler_output_index_type(PyArrayObject *indptr)
+{
+    if (PyArray_ITEMSIZE(indptr) == 8)
+        return (sizeof(long) == 8) ? NPY_LONG : NPY_LONGLONG;
+    return NPY_INT;
+}
+
+template <class I>
+static int assembler_bmat(const npy_intp M, const npy_intp N, PyObject *blocks,
+                          PyArrayObject *row_offsets, PyArrayObject *col_offsets,
+                          PyArrayObject *indptr, PyArrayObject *indices,
+                          PyArrayObject *data)
+{
+    const int index_type = PyArray_TYPE(indptr);
+    const int typenum = PyArray_TYPE(data);
+    const I * r_off = (const I *) PyArray_DATA(row_offsets);
+    const npy_intp itemsize = PyArray_ITEMSIZE(data);
+    npy_intp RC = 1, nnz = 0, n;
+    std::vector<PyArrayObject *> arrays(3 * M * N, (PyArrayObject *) NULL);
+    std::vector< csr_bmat_block<I,char> > grid(M * N);
+    int result = -1;
+
+    for (n = 1; n < PyArray_NDIM(data); n++)
+        RC *= PyArray_DIM(data, n);
+
+    for (n = 0; n < M * N; n++) {
+        PyObject *item = PySequence_GetItem(blocks, n);
+        npy_intp i = n / N, block_nnz;
+        int failed;
+
+        if (item == NULL)
+            goto fail;
+        grid[n].Ap = NULL;
+        grid[n].Aj = NULL;
+        grid[n].Ax = NULL;
+        if (item == Py_None) {
+            Py_DECREF(item);
+            continue;
+        }
+        failed = assembler_parse_csr(item, index_type, typenum, &arrays[3 * n]);
+        Py_DECREF(item);
+        if (failed)
+            goto fail;
+
+        block_nnz = assembler_csr_nnz<I>(&arrays[3 * n],
+                                         (npy_intp) (r_off[i + 1] - r_off[i]), RC);
+        if (block_nnz < 0)
+            goto fail;
+        grid[n].Ap = (const I *) PyArray_DATA(arrays[3 * n]);
+        grid[n].Aj = (const I *) PyArray_DATA(arrays[3 * n + 1]);
+        grid[n].Ax = (const char *) PyArray_DATA(arrays[3 * n + 2]);
+        nnz += block_nnz;
+    }
+
+    if (PyArray_DIM(indptr, 0) != (npy_intp) r_off[M] + 1 ||
+        PyArray_DIM(indices, 0) < nnz || PyArray_DIM(data, 0) < nnz) {
+        PyErr_SetString(PyExc_ValueError, "output arrays have the wrong size");
+        goto fail;
+    }
+
+    // the values are only copied, as RC * itemsize bytes per entry
+    Py_BEGIN_ALLOW_THREADS
+    csr_bmat((I) M, (I) N, r_off, (const I *) PyArray_DATA(col_offsets),
+             &grid[0], (size_t) RC * (size_t) itemsize,
+             (I *) PyArray_DATA(indptr), (I *) PyArray_DATA(indices),
+             (char *) PyArray_DATA(data));
+    Py_END_ALLOW_THREADS
+    result = 0;
+
+fail:
+    for (n = 0; n < 3 * M * N; n++)
+        Py_XDECREF(arrays[n]);
+    return result;
+}
+
+static char csr_bmat_doc[] =
+"csr_bmat(M, N, blocks, row_offsets, col_offsets, indptr, indices, data)\n"
+"\n"
+"Assemble the CSR or BSR matrix with a M x N grid of blocks.  blocks\n"
+"lists the blocks row by row, each None or a tuple (indptr, indices,\n"
+"data).  Block row i starts at (block) row row_offsets[i] and block\n"
+"column j at column col_offsets[j] of the result.  The result is\n"
+"written to the preallocated arrays indptr, indices and data, whose\n"
+"types are used for all blocks.";
+
+static PyObject *assembler_csr_bmat(PyObject *self, PyObject *args)
+{
+    PyObject *blocks, *o_row_offsets, *o_col_offsets, *o_indptr, *o_indices, *o_data;
+    PyArrayObject *row_offsets = NULL, *col_offsets = NULL;
+    PyArrayObject *indptr = NULL, *indices = NULL, *data = NULL;
+    npy_intp M, N;
+    int index_type, result = -1;
+
+    if (!PyArg_ParseTuple(args, "nnOOOOOO", &M, &N, &blocks, &o_row_offsets,
+                          &o_col_offsets, &o_indptr, &o_indices, &o_data))
+        return NULL;
+
+    indptr = (PyArrayObject *) PyArray_FROMANY(o_indptr, NPY_NOTYPE, 1, 1,
+                                               NPY_INOUT_ARRAY);
+    if (indptr == NULL)
+        goto fail;
+    index_type = assembler_output_index_type(indptr);
+    if (PyArray_TYPE(indptr) != index_type) {
+        PyErr_SetString(PyExc_TypeError, "indptr must be int32 or int64");
+        goto fail;
+    }
+    indices = (PyArrayObject *) PyArray_FROMANY(o_indices, index_type, 1, 1,
+                                                NPY_INOUT_ARRAY);
+    data = (PyArrayObject *) PyArray_FROMANY(o_data, NPY_NOTYPE, 1, 3,
+                                             NPY_INOUT_ARRAY);
+    row_offsets = (PyArrayObject *) PyArray_FROMANY(o_row_offsets, index_type,
+                                                    1, 1, NPY_IN_ARRAY | NPY_FORCECAST);
+    col_offsets = (PyArrayObject *) PyArray_FROMANY(o_col_offsets, index_type,
+                                                    1, 1, NPY_IN_ARRAY | NPY_FORCECAST);
+    if (indices == NULL || data == NULL || row_offsets == NULL ||
+        col_offsets == NULL)
+        goto fail;
+
+    if (PyDataType_REFCHK(PyArray_DESCR(data))) {
+        PyErr_SetString(PyExc_TypeError, "object arrays are not supported");
+        goto fail;
+    }
+    if (M < 0 || N < 0 || PySequence_Size(blocks) != M * N ||
+        PyArray_DIM(row_offsets, 0) != M + 1 ||
+        PyArray_DIM(col_offsets, 0) != N + 1) {
+        PyErr_SetString(PyExc_ValueError, "inconsistent grid of blocks");
+        goto fail;
+    }
+
+    if (index_type == NPY_INT)
+        result = assembler_bmat<int>(M, N, blocks, row_offsets, col_offsets,
+                                     indptr, indices, data);
+    else
+        result = assembler_bmat<npy_int64>(M, N, blocks, row_offsets,
+                                           col_offsets, indptr, indices, data);
+
+fail:
+    Py_XDECREF(row_offsets);
+    Py_XDECREF(col_offsets);
+    Py_XDECREF(indptr);
+    Py_XDECREF(indices);
+    Py_XDECREF(data);
+
+    if (result != 0)
+        return NULL;
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+template <class I, class T>
+static void assembler_kron(PyArrayObject *A[3], PyArrayObject *B[3],
+                           const npy_intp n_col_B, PyArrayObject *indptr,
+                           PyArrayObject *indices, PyArrayObject *data)
+{
+    Py_BEGIN_ALLOW_THREADS
+    csr_kron((I) (PyArray_DIM(A[0], 0) - 1),
+             (const I *) PyArray_DATA(A[0]), (const I *) PyArray_DATA(A[1]),
+             (const T *) PyArray_DATA(A[2]),
+             (I) (PyArray_DIM(B[0], 0) - 1), (I) n_col_B,
+             (const I *) PyArray_DATA(B[0]), (const I *) PyArray_DATA(B[1]),
+             (const T *) PyArray_DATA(B[2]),
+             (I *) PyArray_DATA(indptr), (I *) PyArray_DATA(indices),
+             (T *) PyArray_DATA(data));
+    Py_END_ALLOW_THREADS
+}
+
+template <class I>
+static int assembler_kron_dispatch(PyArrayObject *A[3], PyArrayObject *B[3],
+                                   const npy_intp n_col_B, PyArrayObject *indptr,
+                                   PyArrayObject *indices, PyArrayObject *data)
+{
+    switch (PyArray_TYPE(data)) {
+    case NPY_INT:
+        assembler_kron<I,int>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_LONG:
+        assembler_kron<I,long>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_LONGLONG:
+        assembler_kron<I,long long>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_FLOAT:
+        assembler_kron<I,float>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_DOUBLE:
+        assembler_kron<I,double>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_LONGDOUBLE:
+        assembler_kron<I,npy_longdouble>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_CFLOAT:
+        assembler_kron<I,npy_cfloat_wrapper>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_CDOUBLE:
+        assembler_kron<I,npy_cdouble_wrapper>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    case NPY_CLONGDOUBLE:
+        assembler_kron<I,npy_clongdouble_wrapper>(A, B, n_col_B, indptr, indices, data);
+        return 0;
+    }
+    PyErr_SetString(PyExc_TypeError, "unsupported data type");
+    return -1;
+}
+
+static char csr_kron_doc[] =
+"csr_kron(A, B, n_col_B, indptr, indices, data)\n"
+"\n"
+"Compute the Kronecker product of the CSR matrices A and B, given as\n"
+"tuples (indptr, indices, data), into the preallocated arrays indptr,\n"
+"indices and data.  The types of the output arrays are used for A and\n"
+"B, the data type must be one of those listed in typecodes.";
+
+static PyObject *assembler_csr_kron(PyObject *self, PyObject *args)
+{
+    PyObject *o_A, *o_B, *o_indptr, *o_indices, *o_data;
+    PyArrayObject *A[3] = {NULL, NULL, NULL}, *B[3] = {NULL, NULL, NULL};
+    PyArrayObject *indptr = NULL, *indices = NULL, *data = NULL;
+    npy_intp n_col_B, nnz_A, nnz_B, n_row_A, n_row_B;
+    int index_type, typenum, n, result = -1;
+
+    if (!PyArg_ParseTuple(args, "OOnOOO", &o_A, &o_B, &n_col_B,
+                          &o_indptr, &o_indices, &o_data))
+        return NULL;
+
+    indptr = (PyArrayObject *) PyArray_FROMANY(o_indptr, NPY_NOTYPE, 1, 1,
+                                               NPY_INOUT_ARRAY);
+    if (indptr == NULL)
+        goto fail;
+    index_type = assembler_output_index_type(indptr);
+    if (PyArray_TYPE(indptr) != index_type) {
+        PyErr_SetString(PyExc_TypeError, "indptr must be int32 or int64");
+        goto fail;
+    }
+    indices = (PyArrayObject *) PyArray_FROMANY(o_indices, index_type, 1, 1,
+                                                NPY_INOUT_ARRAY);
+    data = (PyArrayObject *) PyArray_FROMANY(o_data, NPY_NOTYPE, 1, 1,
+                                             NPY_INOUT_ARRAY);
+    if (indices == NULL || data == NULL)
+        goto fail;
+    typenum = PyArray_TYPE(data);
+
+    if (assembler_parse_csr(o_A, index_type, typenum, A) != 0 ||
+        assembler_parse_csr(o_B, index_type, typenum, B) != 0)
+        goto fail;
+
+    n_row_A = PyArray_DIM(A[0], 0) - 1;
+    n_row_B = PyArray_DIM(B[0], 0) - 1;
+    if (index_type == NPY_INT) {
+        nnz_A = assembler_csr_nnz<int>(A, n_row_A, 1);
+        nnz_B = assembler_csr_nnz<int>(B, n_row_B, 1);
+    } else {
+        nnz_A = assembler_csr_nnz<npy_int64>(A, n_row_A, 1);
+        nnz_B = assembler_csr_nnz<npy_int64>(B, n_row_B, 1);
+    }
+    if (nnz_A < 0 || nnz_B < 0)
+        goto fail;
+    if (PyArray_DIM(indptr, 0) != n_row_A * n_row_B + 1 ||
+        PyArray_DIM(indices, 0) < nnz_A * nnz_B ||
+        PyArray_DIM(data, 0) < nnz_A * nnz_B) {
+        PyErr_SetString(PyExc_ValueError, "output arrays have the wrong size");
+        goto fail;
+    }
+
+    if (index_type == NPY_INT)
+        result = assembler_kron_dispatch<int>(A, B, n_col_B, indptr, indices, data);
+    else
+        result = assembler_kron_dispatch<npy_int64>(A, B, n_col_B, indptr,
+                                                    indices, data);
+
+fail:
+    for (n = 0; n < 3; n++) {
+        Py_XDECREF(A[n]);
+        Py_XDECREF(B[n]);
+    }
+    Py_XDECREF(indptr);
+    Py_XDECREF(indices);
+    Py_XDECREF(data);
+
+    if (result != 0)
+        return NULL;
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/*
+ * Settings of the shared thread pool, as in the SWIG modules
+ */
+static PyObject *assembler_set_num_threads(PyObject *self, PyObject *args)
+{
+    int n_threads;
+    if (!PyArg_ParseTuple(args, "i", &n_threads))
+        return NULL;
+    set_num_threads(n_threads);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *assembler_get_num_threads(PyObject *self, PyObject *unused)
+{
+    return Py_BuildValue("i", get_num_threads());
+}
+
+static PyObject *assembler_set_parallel_threshold(PyObject *self, PyObject *args)
+{
+    long threshold;
+    if (!PyArg_ParseTuple(args, "l", &threshold))
+        return NULL;
+    set_parallel_threshold(threshold);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *assembler_get_parallel_threshold(PyObject *self, PyObject *unused)
+{
+    return Py_BuildValue("l", get_parallel_threshold());
+}
+
+static PyObject *assembler_get_workspace_allocations(PyObject *self, PyObject *unused)
+{
+    return Py_BuildValue("l", get_workspace_allocations());
+}
+
+static PyObject *assembler_clear_workspaces(PyObject *self, PyObject *unused)
+{
+    clear_workspaces();
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyMethodDef assembler_methods[] = {
+    {"assembler", assembler, METH_VARARGS, assembler_doc},
+    {"csr_bmat", assembler_csr_bmat, METH_VARARGS, csr_bmat_doc},
+    {"csr_kron", assembler_csr_kron, METH_VARARGS, csr_kron_doc},
+    {"set_num_threads", assembler_set_num_threads, METH_VARARGS, NULL},
+    {"get_num_threads", (PyCFunction) assembler_get_num_threads,
+     METH_NOARGS, NULL},
+    {"set_parallel_threshold", assembler_set_parallel_threshold,
+     METH_VARARGS, NULL},
+    {"get_parallel_threshold", (PyCFunction) assembler_get_parallel_threshold,
+     METH_NOARGS, NULL},
+    {"get_workspace_allocations",
+     (PyCFunction) assembler_get_workspace_allocations, METH_NOARGS, NULL},
+    {"clear_workspaces", (PyCFunction) assembler_clear_workspaces,
+     METH_NOARGS, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
+/*
+ * Add the type and the string typecodes of the supported data types
+ */
+static int assembler_init_module(PyObject *m)
+{
+    char typecodes[sizeof(assembler_types) / sizeof(int) + 1];
+    size_t n;
+
+    if (PyType_Ready(&AssemblerType) < 0)
+        return -1;
+
+    for (n = 0; n < sizeof(assembler_types) / sizeof(int); n++) {
+        PyArray_Descr *descr = PyArray_DescrFromType(assembler_types[n]);
+        if (descr == NULL)
+            return -1;
+        typecodes[n] = descr->type;
+        Py_DECREF(descr);
+    }
+    typecodes[n] = '\0';
+
+    Py_INCREF(&AssemblerType);
+    if (PyModule_AddObject(m, "AssemblerType", (PyObject *) &AssemblerType) < 0)
+        return -1;
+    return PyModule_AddStringConstant(m, "typecodes", typecodes);
+}
+
+#if PY_VERSION_HEX >= 0x03000000
+
+static struct PyModuleDef moduledef = {
+    PyModuleDef_HEAD_INIT,
+    "_assembler",
+    NULL,
+    -1,
+    assembler_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC PyInit__assembler(void)
+{
+    PyObject *m;
+
+    import_array();
+    import_parallel();
+
+    m = PyModule_Create(&moduledef);
+    if (m == NULL || assembler_init_module(m) < 0)
+        return NULL;
+    return m;
+}
+
+#else
+
+PyMODINIT_FUNC init_assembler(void)
+{
+    PyObject *m;
+
+    import_array();
+    import_parallel();
+
+    m = Py_InitModule("_assembler", assembler_methods);
+    if (m == NULL)
+        return;
+    assembler_init_module(m);
+}
+
+#endif
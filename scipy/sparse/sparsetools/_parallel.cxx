@@ -0,0 +1,138 @@
+/*
+ * _parallel
+ *
+ * Owner of the thread pool of parallel.h.  The other extension modules
+ * that run parallel kernels call import_parallel() when they are
+ * initialized and from then on use this pool and its thread count and
+ * size threshold through the parallel_api structure exported as _C_API
+ * (see parallel_api.h).
+ */
+
+#include "Python.h"
+
+#include "parallel.h"
+
+
+static int api_get_num_threads(void)
+{
+    return local_get_num_threads();
+}
+
+static void api_set_num_threads(int n_threads)
+{
+    local_set_num_threads(n_threads);
+}
+
+static long api_get_parallel_threshold(void)
+{
+    return local_get_parallel_threshold();
+}
+
+static void api_set_parallel_threshold(long threshold)
+{
+    local_set_parallel_threshold(threshold);
+}
+
+static parallel_api api = {
+    PARALLEL_API_VERSION,
+    api_get_num_threads,
+    api_set_num_threads,
+    api_get_parallel_threshold,
+    api_set_parallel_threshold,
+    local_parallel_run_chunks
+};
+
+
+static PyObject *parallel_set_num_threads(PyObject *self, PyObject *args)
+{
+    int n_threads;
+    if (!PyArg_ParseTuple(args, "i", &n_threads))
+        return NULL;
+    set_num_threads(n_threads);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *parallel_get_num_threads(PyObject *self, PyObject *unused)
+{
+    return Py_BuildValue("i", get_num_threads());
+}
+
+static PyObject *parallel_set_parallel_threshold(PyObject *self, PyObject *args)
+{
+    long threshold;
+    if (!PyArg_ParseTuple(args, "l", &threshold))
+        return NULL;
+    set_parallel_threshold(threshold);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+static PyObject *parallel_get_parallel_threshold(PyObject *self, PyObject *unused)
+{
+    return Py_BuildValue("l", get_parallel_threshold());
+}
+
+static PyMethodDef parallel_methods[] = {
+    {"set_num_threads", parallel_set_num_threads, METH_VARARGS, NULL},
+    {"get_num_threads", (PyCFunction) parallel_get_num_threads,
+     METH_NOARGS, NULL},
+    {"set_parallel_threshold", parallel_set_parallel_threshold,
+     METH_VARARGS, NULL},
+    {"get_parallel_threshold", (PyCFunction) parallel_get_parallel_threshold,
+     METH_NOARGS, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
+/*
+ * Add the capsule _C_API
+ */
+static int parallel_init_module(PyObject *m)
+{
+#if PY_VERSION_HEX < 0x03010000
+    PyObject *c_api = PyCObject_FromVoidPtr(&api, 0);
+#else
+    PyObject *c_api = PyCapsule_New(&api, 0, 0);
+#endif
+    if (c_api == NULL)
+        return -1;
+    return PyModule_AddObject(m, "_C_API", c_api);
+}
+
+#if PY_VERSION_HEX >= 0x03000000
+
+static struct PyModuleDef moduledef = {
+    PyModuleDef_HEAD_INIT,
+    "_parallel",
+    NULL,
+    -1,
+    parallel_methods,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC PyInit__parallel(void)
+{
+    PyObject *m;
+
+    m = PyModule_Create(&moduledef);
+    if (m == NULL || parallel_init_module(m) < 0)
+        return NULL;
+    return m;
+}
+
+#else
+
+PyMODINIT_FUNC init_parallel(void)
+{
+    PyObject *m;
+
+    m = Py_InitModule("_parallel", parallel_methods);
+    if (m == NULL)
+        return;
+    parallel_init_module(m);
+}
+
+#endif
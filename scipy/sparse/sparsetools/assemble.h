@@ -0,0 +1,569 @@
+#ifndef __ASSEMBLE_H__
+#define __ASSEMBLE_H__
+
+/*
+ * assemble.h
+ *   Incremental assembly of a sparse matrix from batches of
+ *   (row, column, value) updates.
+ *
+ * The entries of each row are kept in a small vector that starts with
+ * a sorted, duplicate free part and ends with the updates received
+ * since the row was last compacted.  A row is compacted (the pending
+ * updates are sorted and merged into the sorted part) when the pending
+ * part grows longer than the sorted part, so that the work per update
+ * stays O(log(nnz in row)) amortized while rows only touch their own
+ * memory.
+ *
+ * An update either adds its value to the entry (as for duplicate COO
+ * entries) or sets the entry (as for A[i,j] = x in lil_matrix and
+ * dok_matrix).  Updates to the same entry are applied in the order in
+ * which they were made.  An entry whose last update set it to zero is
+ * removed, an entry that sums to zero is kept.
+ *
+ * csr() writes the matrix in canonical CSR format (sorted indices, no
+ * duplicates) without forming an intermediate COO matrix.  Large
+ * batches and conversions run in parallel, each thread owning a
+ * contiguous range of rows.  A large batch is first grouped by row with
+ * the bucket scatter of transpose.h, so that each thread only reads the
+ * updates of its own rows.
+ *
+ * csr_bmat and csr_kron assemble block matrices and Kronecker products
+ * of CSR and BSR matrices.  They compute the row pointer with one
+ * prefix sum and then copy the rows of the result in parallel.
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "parallel.h"
+#include "transpose.h"
+
+
+/*
+ * Entry of a row under assembly.  Updates that set the entry store
+ * the column as -col-1, updates that add to it store col.
+ */
+template <class I, class T>
+struct assembler_entry
+{
+    I key;
+    T value;
+
+    I col() const { return key < 0 ? -key - 1 : key; }
+    bool is_set() const { return key < 0; }
+};
+
+template <class I, class T>
+struct assembler_entry_less
+{
+    bool operator()(const assembler_entry<I,T>& a,
+                    const assembler_entry<I,T>& b) const
+    {
+        return a.col() < b.col();
+    }
+};
+
+
+/*
+ * Updates (row, column, value) of a batch, as an entry source of
+ * bucket_scatter (see transpose.h)
+ */
+template <class J, class T>
+struct assembler_batch
+{
+    J nnz;
+    const J * Ai;
+    const J * Aj;
+    const T * Ax;
+    J x_stride;
+
+    J size() const { return nnz; }
+
+    void split(const J n_parts, J parts[]) const
+    {
+        for(J k = 0; k <= n_parts; k++){
+            parts[k] = (J) ((double) nnz * k / n_parts);
+        }
+        parts[n_parts] = nnz;
+    }
+
+    template <class visitor>
+    void visit(const J start, const J end, visitor& v) const
+    {
+        for(J n = start; n < end; n++){
+            v(Ai[n], Aj[n], Ax[n * x_stride]);
+        }
+    }
+};
+
+
+template <class I, class T>
+class sparse_assembler
+{
+    public:
+        typedef assembler_entry<I,T> entry;
+
+        sparse_assembler(const I n_row, const I n_col)
+            : n_row(n_row), n_col(n_col), rows(n_row), n_sorted(n_row, 0) {}
+
+        I n_row;
+        I n_col;
+
+        /*
+         * Apply the updates (Ai[n], Aj[n], Ax[n * x_stride]) for
+         * 0 <= n < nnz.  With x_stride = 0 all updates use the value
+         * Ax[0].  The indices must be in range (see check_indices).
+         */
+        template <class J>
+        void insert(const J nnz,
+                    const J Ai[],
+                    const J Aj[],
+                    const T Ax[],
+                    const J x_stride,
+                    const bool overwrite);
+
+        /*
+         * Compact all rows and return the number of entries
+         */
+        double compact();
+
+        /*
+         * Write the matrix in canonical CSR format.  Must directly
+         * follow compact(), Bj and Bx need room for the number of
+         * entries it returned.
+         */
+        template <class J>
+        void csr(J Bp[], J Bj[], T Bx[]) const;
+
+        /*
+         * Return the first n for which (Ai[n], Aj[n]) is out of range,
+         * or nnz if all updates are in range
+         */
+        template <class J>
+        J check_indices(const J nnz, const J Ai[], const J Aj[]) const
+        {
+            for(J n = 0; n < nnz; n++){
+                if (Ai[n] < 0 || Ai[n] >= (J) n_row ||
+                    Aj[n] < 0 || Aj[n] >= (J) n_col)
+                    return n;
+            }
+            return nnz;
+        }
+
+    private:
+        std::vector< std::vector<entry> > rows;
+        std::vector<I> n_sorted;
+
+        void compact_row(const I i);
+
+        /*
+         * Append the update (key, value) to row i, see assembler_entry
+         */
+        void insert_update(const I i, const I key, const T& value)
+        {
+            entry e;
+            e.key = key;
+            e.value = value;
+
+            std::vector<entry>& row = rows[i];
+            row.push_back(e);
+
+            const size_t n_old = (size_t) n_sorted[i];
+            if (row.size() - n_old > std::max(n_old, (size_t) 8))
+                compact_row(i);
+        }
+
+        class assembler_compact_kernel
+        {
+            public:
+                assembler_compact_kernel(sparse_assembler& a) : a(a) {}
+                void operator()(const I row_start, const I row_end)
+                {
+                    for(I i = row_start; i < row_end; i++)
+                        a.compact_row(i);
+                }
+            private:
+                sparse_assembler& a;
+        };
+
+        template <class J>
+        class assembler_csr_kernel
+        {
+            public:
+                assembler_csr_kernel(const sparse_assembler& a,
+                                     const J * Bp, J * Bj, T * Bx)
+                    : a(a), Bp(Bp), Bj(Bj), Bx(Bx) {}
+                void operator()(const I row_start, const I row_end)
+                {
+                    for(I i = row_start; i < row_end; i++){
+                        const std::vector<entry>& row = a.rows[i];
+                        J nnz = Bp[i];
+                        for(size_t n = 0; n < row.size(); n++){
+                            Bj[nnz] = (J) row[n].col();
+                            Bx[nnz] = row[n].value;
+                            nnz++;
+                        }
+                    }
+                }
+            private:
+                const sparse_assembler& a;
+                const J * Bp;
+                J * Bj;
+                T * Bx;
+        };
+
+        // updates grouped by row: row i has columns Bj[Bp[i]:Bp[i+1]]
+        template <class J>
+        class assembler_insert_kernel
+        {
+            public:
+                assembler_insert_kernel(sparse_assembler& a, const J * Bp,
+                                        const J * Bj, const T * Bx,
+                                        const bool overwrite)
+                    : a(a), Bp(Bp), Bj(Bj), Bx(Bx), overwrite(overwrite) {}
+                void operator()(const I row_start, const I row_end)
+                {
+                    for(I i = row_start; i < row_end; i++){
+                        for(J jj = Bp[i]; jj < Bp[i+1]; jj++){
+                            const I key = overwrite ? (I) (-Bj[jj] - 1) : (I) Bj[jj];
+                            a.insert_update(i, key, Bx[jj]);
+                        }
+                    }
+                }
+            private:
+                sparse_assembler& a;
+                const J * Bp;
+                const J * Bj;
+                const T * Bx;
+                const bool overwrite;
+        };
+};
+
+
+/*
+ * Sort the pending updates of row i, merge them into the sorted part
+ * and combine the entries of each column
+ */
+template <class I, class T>
+void sparse_assembler<I,T>::compact_row(const I i)
+{
+    std::vector<entry>& row = rows[i];
+    const size_t n_old = (size_t) n_sorted[i];
+    if (n_old == row.size())
+        return;
+
+    // stable, so that updates of a column stay in the order they were made
+    typename std::vector<entry>::iterator mid = row.begin() + n_old;
+    std::stable_sort(mid, row.end(), assembler_entry_less<I,T>());
+    std::inplace_merge(row.begin(), mid, row.end(), assembler_entry_less<I,T>());
+
+    const T zero = T();
+    size_t nnz = 0;
+    size_t n = 0;
+    while (n < row.size()){
+        const I j = row[n].col();
+        T value = row[n].value;
+        bool is_set = row[n].is_set();
+        for(n++; n < row.size() && row[n].col() == j; n++){
+            if (row[n].is_set())
+                value = row[n].value;
+            else
+                value += row[n].value;
+            is_set = row[n].is_set();
+        }
+
+        if (is_set && value == zero)
+            continue;
+
+        row[nnz].key = is_set ? -j - 1 : j;
+        row[nnz].value = value;
+        nnz++;
+    }
+    row.resize(nnz);
+    n_sorted[i] = (I) nnz;
+}
+
+
+template <class I, class T>
+template <class J>
+void sparse_assembler<I,T>::insert(const J nnz,
+                                   const J Ai[],
+                                   const J Aj[],
+                                   const T Ax[],
+                                   const J x_stride,
+                                   const bool overwrite)
+{
+    if (parallel_num_chunks((double) nnz) <= 1 || n_row <= 1){
+        for(J n = 0; n < nnz; n++){
+            const I key = overwrite ? (I) (-Aj[n] - 1) : (I) Aj[n];
+            insert_update((I) Ai[n], key, Ax[n * x_stride]);
+        }
+        return;
+    }
+
+    // group the updates by row, each row keeps them in the order they
+    // were made
+    std::vector<J> Bp((size_t) n_row + 1);
+    std::vector<J> Bj((size_t) nnz + 1);
+    std::vector<T> Bx((size_t) nnz + 1);
+    assembler_batch<J,T> src = {nnz, Ai, Aj, Ax, x_stride};
+    bucket_scatter((J) n_row, src, &Bp[0], &Bj[0], &Bx[0]);
+
+    // each thread applies the updates of a range of rows
+    assembler_insert_kernel<J> kernel(*this, &Bp[0], &Bj[0], &Bx[0], overwrite);
+    parallel_for_rows(n_row, &Bp[0], kernel);
+}
+
+
+template <class I, class T>
+double sparse_assembler<I,T>::compact()
+{
+    // cumulative row lengths balance the work of the threads
+    std::vector<double> Wp(n_row + 1);
+    Wp[0] = 0;
+    for(I i = 0; i < n_row; i++)
+        Wp[i + 1] = Wp[i] + (double) rows[i].size();
+
+    assembler_compact_kernel kernel(*this);
+    parallel_for_rows(n_row, &Wp[0], kernel, 4.0);
+
+    double nnz = 0;
+    for(I i = 0; i < n_row; i++)
+        nnz += (double) rows[i].size();
+    return nnz;
+}
+
+
+template <class I, class T>
+template <class J>
+void sparse_assembler<I,T>::csr(J Bp[], J Bj[], T Bx[]) const
+{
+    Bp[0] = 0;
+    for(I i = 0; i < n_row; i++)
+        Bp[i + 1] = Bp[i] + (J) rows[i].size();
+
+    assembler_csr_kernel<J> kernel(*this, Bp, Bj, Bx);
+    parallel_for_rows(n_row, Bp, kernel);
+}
+
+/*
+ * Block of a matrix assembled by csr_bmat, a CSR matrix or a BSR
+ * matrix.  Ap == NULL stands for a block of zeros.
+ */
+template <class I, class T>
+struct csr_bmat_block
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+};
+
+template <class I, class T>
+class csr_bmat_kernel
+{
+    public:
+        csr_bmat_kernel(const I M, const I N,
+                        const I * row_offsets, const I * col_offsets,
+                        const csr_bmat_block<I,T> * blocks, const size_t RC,
+                        const I * Cp, I * Cj, T * Cx)
+            : M(M), N(N), row_offsets(row_offsets), col_offsets(col_offsets),
+              blocks(blocks), RC(RC), Cp(Cp), Cj(Cj), Cx(Cx) {}
+
+        void operator()(const I row_start, const I row_end)
+        {
+            // block row of row_start
+            I bi = (I) (std::upper_bound(row_offsets, row_offsets + M + 1,
+                                         row_start) - row_offsets) - 1;
+
+            for(I r = row_start; r < row_end; r++){
+                while (r >= row_offsets[bi + 1])
+                    bi++;
+                const I i = r - row_offsets[bi];
+
+                I nnz = Cp[r];
+                for(I bj = 0; bj < N; bj++){
+                    const csr_bmat_block<I,T>& A = blocks[N * bi + bj];
+                    if (A.Ap == NULL)
+                        continue;
+                    for(I jj = A.Ap[i]; jj < A.Ap[i + 1]; jj++){
+                        Cj[nnz] = A.Aj[jj] + col_offsets[bj];
+                        std::copy(A.Ax + RC * (size_t) jj,
+                                  A.Ax + RC * (size_t) (jj + 1),
+                                  Cx + RC * (size_t) nnz);
+                        nnz++;
+                    }
+                }
+            }
+        }
+
+    private:
+        const I M, N;
+        const I * row_offsets;
+        const I * col_offsets;
+        const csr_bmat_block<I,T> * blocks;
+        const size_t RC;
+        const I * Cp;
+        I * Cj;
+        T * Cx;
+};
+
+/*
+ * Compute C = bmat(blocks) for a M x N grid of CSR or BSR matrices
+ *
+ * Input Arguments:
+ *   I  M, N              - shape of the grid of blocks
+ *   I  row_offsets[M+1]  - first (block) row of each row of blocks in C
+ *   I  col_offsets[N+1]  - first (block) column of each column of blocks
+ *   blocks[M*N]          - the blocks, row by row
+ *   size_t RC            - number of values per entry (R*C for BSR)
+ *
+ * Output Arguments:
+ *   I  Cp[row_offsets[M]+1] - row pointer
+ *   I  Cj[nnz(C)]           - column indices
+ *   T  Cx[RC*nnz(C)]        - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx must be preallocated, nnz(C) is the
+ *   sum of the number of entries of the blocks
+ *
+ *   Block (bi,bj) has row_offsets[bi+1] - row_offsets[bi] (block)
+ *   rows.  The entries of a row of C are those of the blocks from left
+ *   to right, so C has sorted indices if all blocks have.
+ *
+ *   Only values are copied, so T may be any type of the size of the
+ *   data, e.g. char with RC = R*C*itemsize.  RC and the offsets into
+ *   Ax and Cx are computed in size_t, so RC*nnz may exceed the range
+ *   of I.
+ *
+ */
+template <class I, class T>
+void csr_bmat(const I M,
+              const I N,
+              const I row_offsets[],
+              const I col_offsets[],
+              const csr_bmat_block<I,T> blocks[],
+              const size_t RC,
+                    I Cp[],
+                    I Cj[],
+                    T Cx[])
+{
+    Cp[0] = 0;
+    for(I bi = 0; bi < M; bi++){
+        for(I i = 0; i < row_offsets[bi + 1] - row_offsets[bi]; i++){
+            I row_nnz = 0;
+            for(I bj = 0; bj < N; bj++){
+                const csr_bmat_block<I,T>& A = blocks[N * bi + bj];
+                if (A.Ap != NULL)
+                    row_nnz += A.Ap[i + 1] - A.Ap[i];
+            }
+            const I r = row_offsets[bi] + i;
+            Cp[r + 1] = Cp[r] + row_nnz;
+        }
+    }
+
+    csr_bmat_kernel<I,T> kernel(M, N, row_offsets, col_offsets, blocks, RC,
+                                Cp, Cj, Cx);
+    parallel_for_rows(row_offsets[M], Cp, kernel, (double) RC);
+}
+
+
+template <class I, class T>
+class csr_kron_kernel
+{
+    public:
+        csr_kron_kernel(const I * Ap, const I * Aj, const T * Ax,
+                        const I n_row_B, const I n_col_B,
+                        const I * Bp, const I * Bj, const T * Bx,
+                        const I * Cp, I * Cj, T * Cx)
+            : Ap(Ap), Aj(Aj), Ax(Ax), n_row_B(n_row_B), n_col_B(n_col_B),
+              Bp(Bp), Bj(Bj), Bx(Bx), Cp(Cp), Cj(Cj), Cx(Cx) {}
+
+        void operator()(const I row_start, const I row_end)
+        {
+            for(I r = row_start; r < row_end; r++){
+                const I iA = r / n_row_B;
+                const I iB = r - iA * n_row_B;
+
+                I nnz = Cp[r];
+                for(I jj = Ap[iA]; jj < Ap[iA + 1]; jj++){
+                    const I col = Aj[jj] * n_col_B;
+                    const T a = Ax[jj];
+                    for(I kk = Bp[iB]; kk < Bp[iB + 1]; kk++){
+                        Cj[nnz] = col + Bj[kk];
+                        Cx[nnz] = a * Bx[kk];
+                        nnz++;
+                    }
+                }
+            }
+        }
+
+    private:
+        const I * Ap;
+        const I * Aj;
+        const T * Ax;
+        const I n_row_B, n_col_B;
+        const I * Bp;
+        const I * Bj;
+        const T * Bx;
+        const I * Cp;
+        I * Cj;
+        T * Cx;
+};
+
+/*
+ * Compute C = kron(A, B) for CSR matrices A, B and C
+ *
+ * Input Arguments:
+ *   I  n_row_A         - number of rows in A
+ *   I  Ap[n_row_A+1]   - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  n_row_B         - number of rows in B
+ *   I  n_col_B         - number of columns in B
+ *   I  Bp[n_row_B+1]   - row pointer
+ *   I  Bj[nnz(B)]      - column indices
+ *   T  Bx[nnz(B)]      - nonzeros
+ *
+ * Output Arguments:
+ *   I  Cp[n_row_A*n_row_B+1] - row pointer
+ *   I  Cj[nnz(A)*nnz(B)]     - column indices
+ *   T  Cx[nnz(A)*nnz(B)]     - nonzeros
+ *
+ * Note:
+ *   Output arrays Cp, Cj, and Cx must be preallocated
+ *
+ *   Row n_row_B*iA + iB of C holds the products of row iA of A and
+ *   row iB of B, so C has sorted indices without duplicates if A and
+ *   B have.
+ *
+ */
+template <class I, class T>
+void csr_kron(const I n_row_A,
+              const I Ap[],
+              const I Aj[],
+              const T Ax[],
+              const I n_row_B,
+              const I n_col_B,
+              const I Bp[],
+              const I Bj[],
+              const T Bx[],
+                    I Cp[],
+                    I Cj[],
+                    T Cx[])
+{
+    Cp[0] = 0;
+    for(I iA = 0; iA < n_row_A; iA++){
+        const I nnz_A = Ap[iA + 1] - Ap[iA];
+        for(I iB = 0; iB < n_row_B; iB++){
+            const I r = n_row_B * iA + iB;
+            Cp[r + 1] = Cp[r] + nnz_A * (Bp[iB + 1] - Bp[iB]);
+        }
+    }
+
+    csr_kron_kernel<I,T> kernel(Ap, Aj, Ax, n_row_B, n_col_B, Bp, Bj, Bx,
+                                Cp, Cj, Cx);
+    parallel_for_rows(n_row_A * n_row_B, Cp, kernel);
+}
+
+#endif
@@ -7,6 +7,127 @@
 
 #include "csr.h"
 #include "dense.h"
+#include "fixed_size.h"
+#include "parallel.h"
+
+
+/*
+ * Block operations used by the BSR kernels.
+ *
+ * bsr_block<N> handles N by N blocks with the unrolled templates of
+ * fixed_size.h, while bsr_block<0> handles R by C blocks of any size
+ * with the runtime-sized routines of dense.h.  Kernels are written
+ * against this interface and instantiated for square blocks of size
+ * 2 to 8 (the common FEM block sizes) and for the generic case, see
+ * bsr_fixed_block_size().
+ *
+ */
+template <int N>
+struct bsr_block
+{
+    // number of entries in a block
+    template <class I>
+    static I size(const I R, const I C) { return N*N; }
+
+    // y += A*x, where x and y may have a wider type V than A
+    template <class I, class T, class V>
+    static void gemv(const I R, const I C, const T * A, const V * x, V * y)
+    {
+        matvec<N,N,1,1>(A, x, y);
+    }
+
+    // Y += A*X for n_vecs column vectors stored in the rows of X,Y
+    template <class I, class T, class V>
+    static void gemvs(const I R, const I C, const I n_vecs, const T * A, const V * X, V * Y)
+    {
+        matvecs<N,N>(n_vecs, A, X, Y);
+    }
+
+    // Z += X*Y for R by K block X and K by C block Y
+    template <class I, class T>
+    static void gemm(const I R, const I C, const I K, const T * X, const T * Y, T * Z)
+    {
+        matmat<N,N,N>(X, Y, Z);
+    }
+
+    // Z = op(X,Y) elementwise
+    template <class I, class T, class bin_op>
+    static void binop(const I RC, const T * X, const T * Y, T * Z, const bin_op& op)
+    {
+        vec_binop_vec<N*N>(X, Y, Z, op);
+    }
+};
+
+template <>
+struct bsr_block<0>
+{
+    template <class I>
+    static I size(const I R, const I C) { return R*C; }
+
+    template <class I, class T, class V>
+    static void gemv(const I R, const I C, const T * A, const V * x, V * y)
+    {
+        ::gemv(R, C, A, x, y);
+    }
+
+    template <class I, class T, class V>
+    static void gemvs(const I R, const I C, const I n_vecs, const T * A, const V * X, V * Y)
+    {
+        ::gemm(R, n_vecs, C, A, X, Y);
+    }
+
+    template <class I, class T>
+    static void gemm(const I R, const I C, const I K, const T * X, const T * Y, T * Z)
+    {
+        ::gemm(R, C, K, X, Y, Z);
+    }
+
+    template <class I, class T, class bin_op>
+    static void binop(const I RC, const T * X, const T * Y, T * Z, const bin_op& op)
+    {
+        vector_binop(RC, X, Y, Z, op);
+    }
+};
+
+
+/*
+ * Knob for the unrolled block kernels
+ *
+ *   set_bsr_unrolled(0) - always use the generic kernels, e.g. to
+ *                         compare timings
+ *   set_bsr_unrolled(1) - use the unrolled kernels for square blocks
+ *                         of size 2 to 8 (default)
+ *
+ * Results of the two paths may differ in the last bits because the
+ * products of a block row are summed in a different order.
+ */
+inline int& bsr_unrolled_setting()
+{
+    static int unrolled = 1;
+    return unrolled;
+}
+
+inline int get_bsr_unrolled()
+{
+    return bsr_unrolled_setting();
+}
+
+inline void set_bsr_unrolled(const int unrolled)
+{
+    bsr_unrolled_setting() = (unrolled != 0) ? 1 : 0;
+}
+
+/*
+ * Size N of the bsr_block<N> to use for R by C blocks, or 0 for
+ * the generic kernels
+ */
+template <class I>
+int bsr_fixed_block_size(const I R, const I C)
+{
+    if (!get_bsr_unrolled() || R != C || R < 2 || R > 8)
+        return 0;
+    return (int) R;
+}
 
 
 template <class I, class T>
@@ -185,6 +306,35 @@ void bsr_sort_indices(const I n_brow,
 }
 
 
+/*
+ * Copy the blocks of block rows [start, end) of B = transpose(A),
+ * transposing each block
+ */
+template <class I, class T>
+struct bsr_transpose_kernel
+{
+    I R;
+    I C;
+    const I * Bp;
+    const I * perm;
+    const T * Ax;
+          T * Bx;
+
+    void operator()(const I start, const I end)
+    {
+        const I RC = R*C;
+        for(I i = Bp[start]; i < Bp[end]; i++){
+            const T * Ax_blk = Ax + RC * perm[i];
+                  T * Bx_blk = Bx + RC * i;
+            for(I r = 0; r < R; r++){
+                for(I c = 0; c < C; c++){
+                    Bx_blk[c * R + r] = Ax_blk[r * C + c];
+                }
+            }
+        }
+    }
+};
+
 /*
  * Compute transpose(A) BSR matrix A
  *
@@ -210,6 +360,9 @@ void bsr_sort_indices(const I n_brow,
  *   Output: row indices *will be* in sorted order
  *
  *   Complexity: Linear.  Specifically O(nnz(A) + max(n_row,n_col))
+ *
+ *   The block permutation comes from csr_tocsc() and the blocks are
+ *   copied in parallel for large matrices.
  * 
  */
 template <class I, class T>
@@ -236,35 +389,20 @@ void bsr_transpose(const I n_brow,
 
     csr_tocsc(n_brow, n_bcol, Ap, Aj, &perm_in[0], Bp, Bj, &perm_out[0]);
 
-    for(I i = 0; i < nblks; i++){
-        const T * Ax_blk = Ax + RC * perm_out[i];
-              T * Bx_blk = Bx + RC * i;
-        for(I r = 0; r < R; r++){
-            for(I c = 0; c < C; c++){
-                Bx_blk[c * R + r] = Ax_blk[r * C + c];
-            }
-        }
-    }
+    bsr_transpose_kernel<I,T> kernel = {R, C, Bp, &perm_out[0], Ax, Bx};
+    parallel_for_rows(n_bcol, Bp, kernel, (double) RC);
 }
 
 
 
-template <class I, class T>
-void bsr_matmat_pass2(const I n_brow,  const I n_bcol, 
-                      const I R,       const I C,       const I N,
-      	              const I Ap[],    const I Aj[],    const T Ax[],
-      	              const I Bp[],    const I Bj[],    const T Bx[],
-      	                    I Cp[],          I Cj[],          T Cx[])
+template <class block_ops, class I, class T>
+void bsr_matmat_pass2_impl(const I n_brow,  const I n_bcol, 
+                           const I R,       const I C,       const I N,
+                           const I Ap[],    const I Aj[],    const T Ax[],
+                           const I Bp[],    const I Bj[],    const T Bx[],
+                                 I Cp[],          I Cj[],          T Cx[])
 {
-    assert(R > 0 && C > 0 && N > 0);
-
-    if( R == 1 && N == 1 && C == 1 ){
-        // Use CSR for 1x1 blocksize
-        csr_matmat_pass2(n_brow, n_bcol, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
-        return;
-    }
-
-    const I RC = R*C;
+    const I RC = block_ops::size(R,C);
     const I RN = R*N;
     const I NC = N*C;
 
@@ -302,7 +440,7 @@ void bsr_matmat_pass2(const I n_brow,  const I n_bcol,
                 const T * A = Ax + jj*RN;
                 const T * B = Bx + kk*NC;
 
-                gemm(R, C, N, A, B, mats[k]);
+                block_ops::gemm(R, C, N, A, B, mats[k]);
             }
         }         
 
@@ -315,6 +453,37 @@ void bsr_matmat_pass2(const I n_brow,  const I n_bcol,
     }
 }
 
+template <class I, class T>
+void bsr_matmat_pass2(const I n_brow,  const I n_bcol, 
+                      const I R,       const I C,       const I N,
+      	              const I Ap[],    const I Aj[],    const T Ax[],
+      	              const I Bp[],    const I Bj[],    const T Bx[],
+      	                    I Cp[],          I Cj[],          T Cx[])
+{
+    assert(R > 0 && C > 0 && N > 0);
+
+    if( R == 1 && N == 1 && C == 1 ){
+        // Use CSR for 1x1 blocksize
+        csr_matmat_pass2(n_brow, n_bcol, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
+        return;
+    }
+
+    // unrolled kernels need square blocks in A, B and C
+    const int fixed = (N == R) ? bsr_fixed_block_size(R, C) : 0;
+
+    switch(fixed){
+        case 2: bsr_matmat_pass2_impl< bsr_block<2> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 3: bsr_matmat_pass2_impl< bsr_block<3> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 4: bsr_matmat_pass2_impl< bsr_block<4> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 5: bsr_matmat_pass2_impl< bsr_block<5> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 6: bsr_matmat_pass2_impl< bsr_block<6> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 7: bsr_matmat_pass2_impl< bsr_block<7> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        case 8: bsr_matmat_pass2_impl< bsr_block<8> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx); break;
+        default:
+                bsr_matmat_pass2_impl< bsr_block<0> >(n_brow, n_bcol, R, C, N, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx);
+    }
+}
+
 
 
 
@@ -349,7 +518,7 @@ bool is_nonzero_block(const T block[], const I blocksize){
  *           C will not contain any duplicate entries or explicit zeros.
  *
  */
-template <class I, class T, class bin_op>
+template <class block_ops, class I, class T, class bin_op>
 void bsr_binop_bsr_general(const I n_brow, const I n_bcol,
                            const I R,      const I C,
                            const I Ap[],  const I Aj[],  const T Ax[],
@@ -358,7 +527,7 @@ void bsr_binop_bsr_general(const I n_brow, const I n_bcol,
                            const bin_op& op)
 {
     //Method that works for duplicate and/or unsorted indices
-    const I RC = R*C;
+    const I RC = block_ops::size(R,C);
 
     Cp[0] = 0;
     I nnz = 0;
@@ -402,8 +571,7 @@ void bsr_binop_bsr_general(const I n_brow, const I n_bcol,
 
         for(I jj = 0; jj < length; jj++){
             // compute op(block_A, block_B)
-            for(I n = 0; n < RC; n++)
-                Cx[RC * nnz + n] = op(A_row[RC*head + n], B_row[RC*head + n]);
+            block_ops::binop(RC, &A_row[RC*head], &B_row[RC*head], Cx + RC*nnz, op);
 
             // advance counter if block is nonzero
             if( is_nonzero_block(Cx + (RC * nnz), RC) )
@@ -439,7 +607,7 @@ void bsr_binop_bsr_general(const I n_brow, const I n_bcol,
  *           Cx will not contain any zero entries
  *
  */
-template <class I, class T, class bin_op>
+template <class block_ops, class I, class T, class bin_op>
 void bsr_binop_bsr_canonical(const I n_brow, const I n_bcol, 
                              const I R,      const I C, 
                              const I Ap[],  const I Aj[],  const T Ax[],
@@ -447,7 +615,7 @@ void bsr_binop_bsr_canonical(const I n_brow, const I n_bcol,
                                    I Cp[],        I Cj[],        T Cx[],
                              const bin_op& op)
 {
-    const I RC = R*C;
+    const I RC = block_ops::size(R,C);
     T * result = Cx;
 
     Cp[0] = 0;
@@ -465,9 +633,7 @@ void bsr_binop_bsr_canonical(const I n_brow, const I n_bcol,
             I B_j = Bj[B_pos];
 
             if(A_j == B_j){
-                for(I n = 0; n < RC; n++){
-                    result[n] = op(Ax[RC*A_pos + n], Bx[RC*B_pos + n]);
-                }
+                block_ops::binop(RC, Ax + RC*A_pos, Bx + RC*B_pos, result, op);
 
                 if( is_nonzero_block(result,RC) ){
                     Cj[nnz] = A_j;
@@ -537,6 +703,25 @@ void bsr_binop_bsr_canonical(const I n_brow, const I n_bcol,
 }
 
 
+template <class block_ops, class I, class T, class bin_op>
+void bsr_binop_bsr_impl(const I n_brow, const I n_bcol, 
+                        const I R,     const I C, 
+                        const I Ap[],  const I Aj[],  const T Ax[],
+                        const I Bp[],  const I Bj[],  const T Bx[],
+                              I Cp[],        I Cj[],        T Cx[],
+                        const bin_op& op)
+{
+    if ( csr_has_canonical_format(n_brow, Ap, Aj) && csr_has_canonical_format(n_brow, Bp, Bj) ){
+        // prefer faster implementation
+        bsr_binop_bsr_canonical<block_ops>(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
+    }
+    else {
+        // slower fallback method
+        bsr_binop_bsr_general<block_ops>(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
+    }
+}
+
+
 /*
  * Compute C = A (binary_op) B for CSR matrices A,B where the column 
  * indices with the rows of A and B are known to be sorted.
@@ -581,14 +766,19 @@ void bsr_binop_bsr(const I n_brow, const I n_bcol,
     if( R == 1 && C == 1 ){
         //use CSR for 1x1 blocksize
         csr_binop_csr(n_brow, n_bcol, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
+        return;
     }
-    else if ( csr_has_canonical_format(n_brow, Ap, Aj) && csr_has_canonical_format(n_brow, Bp, Bj) ){
-        // prefer faster implementation
-        bsr_binop_bsr_canonical(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
-    }
-    else {
-        // slower fallback method
-        bsr_binop_bsr_general(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
+
+    switch(bsr_fixed_block_size(R, C)){
+        case 2: bsr_binop_bsr_impl< bsr_block<2> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 3: bsr_binop_bsr_impl< bsr_block<3> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 4: bsr_binop_bsr_impl< bsr_block<4> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 5: bsr_binop_bsr_impl< bsr_block<5> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 6: bsr_binop_bsr_impl< bsr_block<6> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 7: bsr_binop_bsr_impl< bsr_block<7> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        case 8: bsr_binop_bsr_impl< bsr_block<8> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op); break;
+        default:
+                bsr_binop_bsr_impl< bsr_block<0> >(n_brow, n_bcol, R, C, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op);
     }
 }
 
@@ -657,6 +847,82 @@ void bsr_minus_bsr(const I n_row, const I n_col, const I R, const I C,
 //}
 
 
+template <class I, class T, class V, class block_ops>
+struct bsr_matvec_kernel
+{
+    I R;
+    I C;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const V * Xx;
+          V * Yx;
+
+    void operator()(const I brow_start, const I brow_end)
+    {
+        const I RC = block_ops::size(R,C);
+        for(I i = brow_start; i < brow_end; i++){
+            V * y = Yx + R * i;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                const T * A = Ax + RC * jj;
+                const V * x = Xx + C * j;
+                block_ops::gemv(R, C, A, x, y); // y += A*x
+            }
+        }
+    }
+};
+
+template <class block_ops, class I, class T, class V>
+void bsr_matvec_impl(const I n_brow,
+                     const I R,
+                     const I C,
+                     const I Ap[],
+                     const I Aj[],
+                     const T Ax[],
+                     const V Xx[],
+                           V Yx[])
+{
+    bsr_matvec_kernel<I,T,V,block_ops> kernel = {R, C, Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_brow, Ap, kernel, (double) (R*C));
+}
+
+/*
+ * bsr_matvec_mixed() allows nonzeros Ax[] of type T with vectors of a
+ * wider type V, see csr_matvec_mixed()
+ */
+template <class I, class T, class V>
+void bsr_matvec_mixed(const I n_brow,
+	                  const I n_bcol, 
+	                  const I R, 
+	                  const I C, 
+	                  const I Ap[], 
+	                  const I Aj[], 
+	                  const T Ax[],
+	                  const V Xx[],
+	                        V Yx[])
+{
+    assert(R > 0 && C > 0);
+
+    if( R == 1 && C == 1 ){
+        //use CSR for 1x1 blocksize 
+        csr_matvec_mixed(n_brow, n_bcol, Ap, Aj, Ax, Xx, Yx);
+        return;
+    }
+
+    switch(bsr_fixed_block_size(R, C)){
+        case 2: bsr_matvec_impl< bsr_block<2> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 3: bsr_matvec_impl< bsr_block<3> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 4: bsr_matvec_impl< bsr_block<4> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 5: bsr_matvec_impl< bsr_block<5> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 6: bsr_matvec_impl< bsr_block<6> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 7: bsr_matvec_impl< bsr_block<7> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 8: bsr_matvec_impl< bsr_block<8> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        default:
+                bsr_matvec_impl< bsr_block<0> >(n_brow, R, C, Ap, Aj, Ax, Xx, Yx);
+    }
+}
+
 template <class I, class T>
 void bsr_matvec(const I n_brow,
 	            const I n_bcol, 
@@ -668,24 +934,7 @@ void bsr_matvec(const I n_brow,
 	            const T Xx[],
 	                  T Yx[])
 {
-    assert(R > 0 && C > 0);
-
-    if( R == 1 && C == 1 ){
-        //use CSR for 1x1 blocksize 
-        csr_matvec(n_brow, n_bcol, Ap, Aj, Ax, Xx, Yx);
-        return;
-    }
-
-    const I RC = R*C;
-    for(I i = 0; i < n_brow; i++){
-        T * y = Yx + R * i;
-        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
-            const I j = Aj[jj];
-            const T * A = Ax + RC * jj;
-            const T * x = Xx + C * j;
-            gemv(R, C, A, x, y); // y += A*x
-        }
-    }
+    bsr_matvec_mixed(n_brow, n_bcol, R, C, Ap, Aj, Ax, Xx, Yx);
 }
 
 
@@ -708,6 +957,88 @@ void bsr_matvec(const I n_brow,
  *   T  Yx[R*n_brow,n_vecs] - output vector
  *
  */
+template <class I, class T, class V, class block_ops>
+struct bsr_matvecs_kernel
+{
+    I n_vecs;
+    I R;
+    I C;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const V * Xx;
+          V * Yx;
+
+    void operator()(const I brow_start, const I brow_end)
+    {
+        const I A_bs = block_ops::size(R,C); //Ax blocksize
+        const I Y_bs = n_vecs*R;             //Yx blocksize
+        const I X_bs = C*n_vecs;             //Xx blocksize
+
+        for(I i = brow_start; i < brow_end; i++){
+            V * y = Yx + Y_bs * i;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                const T * A = Ax + A_bs * jj;
+                const V * x = Xx + X_bs * j;
+                block_ops::gemvs(R, C, n_vecs, A, x, y); // y += A*x
+            }
+        }
+    }
+};
+
+template <class block_ops, class I, class T, class V>
+void bsr_matvecs_impl(const I n_brow,
+                      const I n_vecs,
+                      const I R,
+                      const I C,
+                      const I Ap[],
+                      const I Aj[],
+                      const T Ax[],
+                      const V Xx[],
+                            V Yx[])
+{
+    bsr_matvecs_kernel<I,T,V,block_ops> kernel = {n_vecs, R, C, Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_brow, Ap, kernel, (double) (R*C*n_vecs));
+}
+
+/*
+ * bsr_matvecs_mixed() allows nonzeros Ax[] of type T with vectors of
+ * a wider type V, see csr_matvec_mixed()
+ */
+template <class I, class T, class V>
+void bsr_matvecs_mixed(const I n_brow,
+	                   const I n_bcol, 
+                       const I n_vecs,
+	                   const I R, 
+	                   const I C, 
+	                   const I Ap[], 
+	                   const I Aj[], 
+	                   const T Ax[],
+	                   const V Xx[],
+	                         V Yx[])
+{
+    assert(R > 0 && C > 0);
+
+    if( R == 1 && C == 1 ){
+        //use CSR for 1x1 blocksize 
+        csr_matvecs_mixed(n_brow, n_bcol, n_vecs, Ap, Aj, Ax, Xx, Yx);
+        return;
+    }
+
+    switch(bsr_fixed_block_size(R, C)){
+        case 2: bsr_matvecs_impl< bsr_block<2> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 3: bsr_matvecs_impl< bsr_block<3> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 4: bsr_matvecs_impl< bsr_block<4> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 5: bsr_matvecs_impl< bsr_block<5> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 6: bsr_matvecs_impl< bsr_block<6> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 7: bsr_matvecs_impl< bsr_block<7> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        case 8: bsr_matvecs_impl< bsr_block<8> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx); break;
+        default:
+                bsr_matvecs_impl< bsr_block<0> >(n_brow, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx);
+    }
+}
+
 template <class I, class T>
 void bsr_matvecs(const I n_brow,
 	             const I n_bcol, 
@@ -720,27 +1051,7 @@ void bsr_matvecs(const I n_brow,
 	             const T Xx[],
 	                   T Yx[])
 {
-    assert(R > 0 && C > 0);
-
-    if( R == 1 && C == 1 ){
-        //use CSR for 1x1 blocksize 
-        csr_matvecs(n_brow, n_bcol, n_vecs, Ap, Aj, Ax, Xx, Yx);
-        return;
-    }
-
-    const I A_bs = R*C;      //Ax blocksize
-    const I Y_bs = n_vecs*R; //Yx blocksize
-    const I X_bs = C*n_vecs; //Xx blocksize
-
-    for(I i = 0; i < n_brow; i++){
-        T * y = Yx + Y_bs * i;
-        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
-            const I j = Aj[jj];
-            const T * A = Ax + A_bs * jj;
-            const T * x = Xx + X_bs * j;
-            gemm(R, n_vecs, C, A, x, y); // y += A*x
-        }
-    }
+    bsr_matvecs_mixed(n_brow, n_bcol, n_vecs, R, C, Ap, Aj, Ax, Xx, Yx);
 }
 
 
@@ -6,8 +6,14 @@
 #include "bsr.h"
 %}
 
+%ignore bsr_unrolled_setting;
+
 %include "bsr.h" 
 
+ /* accumulator knob of the SpGEMM kernels in csr.h */
+int  get_matmat_accumulator();
+void set_matmat_accumulator(const int accumulator);
+
 
 INSTANTIATE_ALL(bsr_diagonal)
 INSTANTIATE_ALL(bsr_scale_rows)
@@ -22,4 +28,5 @@ INSTANTIATE_ALL(bsr_plus_bsr)
 INSTANTIATE_ALL(bsr_minus_bsr)
 INSTANTIATE_ALL(bsr_sort_indices)
 
-
+INSTANTIATE_MIXED(bsr_matvec_mixed)
+INSTANTIATE_MIXED(bsr_matvecs_mixed)
@@ -67,6 +67,46 @@ except AttributeError:
 
 
 
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _bsr.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _bsr.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _bsr.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _bsr.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _bsr.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _bsr.clear_workspaces(*args)
+
+def get_bsr_unrolled(*args):
+  """get_bsr_unrolled() -> int"""
+  return _bsr.get_bsr_unrolled(*args)
+
+def set_bsr_unrolled(*args):
+  """set_bsr_unrolled(int unrolled)"""
+  return _bsr.set_bsr_unrolled(*args)
+
+def get_matmat_accumulator(*args):
+  """get_matmat_accumulator() -> int"""
+  return _bsr.get_matmat_accumulator(*args)
+
+def set_matmat_accumulator(*args):
+  """set_matmat_accumulator(int accumulator)"""
+  return _bsr.set_matmat_accumulator(*args)
+
 
 def bsr_diagonal(*args):
   """
@@ -98,6 +138,48 @@ def bsr_diagonal(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
     bsr_diagonal(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        signed char Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        short Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        int Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        long long Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        float Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        double Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        long double Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Yx)
+    bsr_diagonal(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_diagonal(*args)
 
@@ -131,6 +213,48 @@ def bsr_scale_rows(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
     bsr_scale_rows(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        signed char Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        short Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        int Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        long long Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        float Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        double Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        long double Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx)
+    bsr_scale_rows(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx)
     """
   return _bsr.bsr_scale_rows(*args)
 
@@ -164,6 +288,48 @@ def bsr_scale_columns(*args):
         npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
     bsr_scale_columns(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        signed char Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        short Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        int Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        long long Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        float Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        double Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        long double Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx)
+    bsr_scale_columns(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx)
     """
   return _bsr.bsr_scale_columns(*args)
 
@@ -198,6 +364,52 @@ def bsr_transpose(*args):
     bsr_transpose(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        unsigned long long Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_cfloat_wrapper Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_cdouble_wrapper Bx)
+    bsr_transpose(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
     """
   return _bsr.bsr_transpose(*args)
 
@@ -247,6 +459,72 @@ def bsr_matmat_pass2(*args):
         int Aj, npy_clongdouble_wrapper Ax, int Bp, 
         int Bj, npy_clongdouble_wrapper Bx, int Cp, 
         int Cj, npy_clongdouble_wrapper Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned short Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, int Bx, 
+        npy_int64 Cp, npy_int64 Cj, int Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, npy_int64 Bj, 
+        npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    bsr_matmat_pass2(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 N, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_matmat_pass2(*args)
 
@@ -284,6 +562,49 @@ def bsr_matvec(*args):
     bsr_matvec(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        short Xx, short Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        int Xx, int Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        long long Xx, long long Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        float Xx, float Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        double Xx, double Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        long double Xx, long double Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    bsr_matvec(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_matvec(*args)
 
@@ -326,6 +647,55 @@ def bsr_matvecs(*args):
     bsr_matvecs(int n_brow, int n_bcol, int n_vecs, int R, int C, int Ap, 
         int Aj, npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Xx, signed char Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Xx, short Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Xx, int Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Xx, long long Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Xx, float Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Xx, double Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Xx, long double Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    bsr_matvecs(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _bsr.bsr_matvecs(*args)
 
@@ -373,6 +743,66 @@ def bsr_elmul_bsr(*args):
     bsr_elmul_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx, 
+        npy_int64 Cp, npy_int64 Cj, signed char Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned char Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx, npy_int64 Cp, 
+        npy_int64 Cj, short Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned short Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx, npy_int64 Cp, 
+        npy_int64 Cj, int Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned int Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, long long Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        unsigned long long Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx, npy_int64 Cp, 
+        npy_int64 Cj, float Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx, npy_int64 Cp, 
+        npy_int64 Cj, double Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx, 
+        npy_int64 Cp, npy_int64 Cj, long double Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_elmul_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_elmul_bsr(*args)
 
@@ -420,6 +850,66 @@ def bsr_eldiv_bsr(*args):
     bsr_eldiv_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx, 
+        npy_int64 Cp, npy_int64 Cj, signed char Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned char Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx, npy_int64 Cp, 
+        npy_int64 Cj, short Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned short Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx, npy_int64 Cp, 
+        npy_int64 Cj, int Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned int Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, long long Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        unsigned long long Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx, npy_int64 Cp, 
+        npy_int64 Cj, float Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx, npy_int64 Cp, 
+        npy_int64 Cj, double Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx, 
+        npy_int64 Cp, npy_int64 Cj, long double Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_eldiv_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_eldiv_bsr(*args)
 
@@ -467,6 +957,66 @@ def bsr_plus_bsr(*args):
     bsr_plus_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx, 
+        npy_int64 Cp, npy_int64 Cj, signed char Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned char Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx, npy_int64 Cp, 
+        npy_int64 Cj, short Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned short Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx, npy_int64 Cp, 
+        npy_int64 Cj, int Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned int Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, long long Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        unsigned long long Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx, npy_int64 Cp, 
+        npy_int64 Cj, float Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx, npy_int64 Cp, 
+        npy_int64 Cj, double Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx, 
+        npy_int64 Cp, npy_int64 Cj, long double Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_plus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_plus_bsr(*args)
 
@@ -514,6 +1064,66 @@ def bsr_minus_bsr(*args):
     bsr_minus_bsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx, int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx, 
+        npy_int64 Cp, npy_int64 Cj, signed char Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned char Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx, npy_int64 Cp, 
+        npy_int64 Cj, short Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned short Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx, npy_int64 Cp, 
+        npy_int64 Cj, int Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx, 
+        npy_int64 Cp, npy_int64 Cj, unsigned int Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, long long Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        unsigned long long Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx, npy_int64 Cp, 
+        npy_int64 Cj, float Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx, npy_int64 Cp, 
+        npy_int64 Cj, double Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx, 
+        npy_int64 Cp, npy_int64 Cj, long double Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cfloat_wrapper Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, 
+        npy_cdouble_wrapper Cx)
+    bsr_minus_bsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _bsr.bsr_minus_bsr(*args)
 
@@ -547,6 +1157,67 @@ def bsr_sort_indices(*args):
         npy_cdouble_wrapper Ax)
     bsr_sort_indices(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax)
+    bsr_sort_indices(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax)
     """
   return _bsr.bsr_sort_indices(*args)
 
+def bsr_matvec_mixed(*args):
+  """
+    bsr_matvec_mixed(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
+        float Ax, double Xx, double Yx)
+    bsr_matvec_mixed(int n_brow, int n_bcol, int R, int C, int Ap, int Aj, 
+        npy_cfloat_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    bsr_matvec_mixed(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        double Xx, double Yx)
+    bsr_matvec_mixed(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    """
+  return _bsr.bsr_matvec_mixed(*args)
+
+def bsr_matvecs_mixed(*args):
+  """
+    bsr_matvecs_mixed(int n_brow, int n_bcol, int n_vecs, int R, int C, int Ap, 
+        int Aj, float Ax, double Xx, double Yx)
+    bsr_matvecs_mixed(int n_brow, int n_bcol, int n_vecs, int R, int C, int Ap, 
+        int Aj, npy_cfloat_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    bsr_matvecs_mixed(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, double Xx, double Yx)
+    bsr_matvecs_mixed(npy_int64 n_brow, npy_int64 n_bcol, npy_int64 n_vecs, 
+        npy_int64 R, npy_int64 C, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    """
+  return _bsr.bsr_matvecs_mixed(*args)
+
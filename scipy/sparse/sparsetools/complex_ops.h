@@ -18,6 +18,12 @@ class complex_wrapper : public npy_type {
             npy_type::real = r;
             npy_type::imag = i;
         }
+        // convert between precisions, e.g. npy_cfloat to npy_cdouble
+        template <class c_type2, class npy_type2>
+        explicit complex_wrapper( const complex_wrapper<c_type2,npy_type2>& B ){
+            npy_type::real = B.real;
+            npy_type::imag = B.imag;
+        }
         complex_wrapper operator-() const {
           return complex_wrapper(-npy_type::real,-npy_type::imag);
         }
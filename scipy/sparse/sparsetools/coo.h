@@ -4,6 +4,9 @@
 #include <algorithm>
 #include <set>
 
+#include "csr.h"
+#include "transpose.h"
+
 /*
  * Compute B = A for COO matrix A, CSR matrix B
  *
@@ -29,6 +32,9 @@
  *   Note: duplicate entries are carried over to the CSR represention
  *
  *   Complexity: Linear.  Specifically O(nnz(A) + max(n_row,n_col))
+ *
+ *   Within each row the entries keep their input order.  Large
+ *   matrices are converted in parallel (see transpose.h).
  * 
  */
 template <class I, class T>
@@ -42,37 +48,8 @@ void coo_tocsr(const I n_row,
                      I Bj[],
                      T Bx[])
 {
-    //compute number of non-zero entries per row of A 
-    std::fill(Bp, Bp + n_row, 0);
-
-    for (I n = 0; n < nnz; n++){            
-        Bp[Ai[n]]++;
-    }
-
-    //cumsum the nnz per row to get Bp[]
-    for(I i = 0, cumsum = 0; i < n_row; i++){     
-        I temp = Bp[i];
-        Bp[i] = cumsum;
-        cumsum += temp;
-    }
-    Bp[n_row] = nnz; 
-
-    //write Aj,Ax into Bj,Bx
-    for(I n = 0; n < nnz; n++){
-        I row  = Ai[n];
-        I dest = Bp[row];
-
-        Bj[dest] = Aj[n];
-        Bx[dest] = Ax[n];
-
-        Bp[row]++;
-    }
-
-    for(I i = 0, last = 0; i <= n_row; i++){
-        I temp = Bp[i];
-        Bp[i]  = last;
-        last   = temp;
-    }
+    coo_entries<I,T> src = {nnz, Ai, Aj, Ax};
+    bucket_scatter(n_row, src, Bp, Bj, Bx);
 
     //now Bp,Bj,Bx form a CSR representation (with possible duplicates)
 }
@@ -89,6 +66,41 @@ void coo_tocsc(const I n_row,
       	             T Bx[])
 { coo_tocsr<I,T>(n_col, n_row, nnz, Aj, Ai, Ax, Bp, Bi, Bx); }
 
+/*
+ * Compute B = A for COO matrix A, canonical CSR matrix B
+ *
+ * Input and output arguments are the same as for coo_tocsr.
+ *
+ * Note:
+ *   Output arrays Bp, Bj, and Bx must be preallocated with room
+ *   for nnz entries.  On return Bp[n_row] holds the number of entries
+ *   of B, which is at most nnz.
+ *
+ * Note:
+ *   The column indices of each row are sorted and duplicate entries
+ *   are summed, so this replaces coo_tocsr followed by
+ *   csr_sort_indices and csr_sum_duplicates.  Explicit zeros are kept.
+ *
+ *   The entries are bucketed by row as in coo_tocsr, then every row
+ *   is sorted (see csr_sort_row) and merged while it is still in
+ *   cache.  Both steps run in parallel for large matrices.
+ *
+ */
+template <class I, class T>
+void coo_tocsr_canonical(const I n_row,
+                         const I n_col,
+                         const I nnz,
+                         const I Ai[],
+                         const I Aj[],
+                         const T Ax[],
+                               I Bp[],
+                               I Bj[],
+                               T Bx[])
+{
+    coo_tocsr(n_row, n_col, nnz, Ai, Aj, Ax, Bp, Bj, Bx);
+    csr_canonicalize(n_row, Bp, Bj, Bx);
+}
+
 /*
  * Compute B += A for COO matrix A, dense matrix B
  *
@@ -10,6 +10,7 @@
 
 INSTANTIATE_ALL(coo_tocsr)
 INSTANTIATE_ALL(coo_tocsc)
+INSTANTIATE_ALL(coo_tocsr_canonical)
 INSTANTIATE_ALL(coo_todense)
 
 INSTANTIATE_ALL(coo_matvec)
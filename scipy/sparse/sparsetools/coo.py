@@ -67,9 +67,29 @@ except AttributeError:
 
 
 
-def coo_count_diagonals(*args):
-  """coo_count_diagonals(int nnz, int Ai, int Aj) -> int"""
-  return _coo.coo_count_diagonals(*args)
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _coo.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _coo.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _coo.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _coo.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _coo.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _coo.clear_workspaces(*args)
 
 
 def coo_tocsr(*args):
@@ -102,6 +122,48 @@ def coo_tocsr(*args):
         int Bp, int Bj, npy_cdouble_wrapper Bx)
     coo_tocsr(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, signed char Ax, npy_int64 Bp, 
+        npy_int64 Bj, signed char Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned char Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned char Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, short Ax, npy_int64 Bp, 
+        npy_int64 Bj, short Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, int Ax, npy_int64 Bp, 
+        npy_int64 Bj, int Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned int Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned int Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, long long Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, float Ax, npy_int64 Bp, 
+        npy_int64 Bj, float Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, double Ax, npy_int64 Bp, 
+        npy_int64 Bj, double Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long double Ax, npy_int64 Bp, 
+        npy_int64 Bj, long double Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    coo_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_tocsr(*args)
 
@@ -135,9 +197,126 @@ def coo_tocsc(*args):
         int Bp, int Bi, npy_cdouble_wrapper Bx)
     coo_tocsc(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, signed char Ax, npy_int64 Bp, 
+        npy_int64 Bi, signed char Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned char Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned char Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, short Ax, npy_int64 Bp, 
+        npy_int64 Bi, short Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bi, unsigned short Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, int Ax, npy_int64 Bp, 
+        npy_int64 Bi, int Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned int Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned int Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, long long Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bi, unsigned long long Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, float Ax, npy_int64 Bp, 
+        npy_int64 Bi, float Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, double Ax, npy_int64 Bp, 
+        npy_int64 Bi, double Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long double Ax, npy_int64 Bp, 
+        npy_int64 Bi, long double Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bi, npy_cfloat_wrapper Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bi, npy_cdouble_wrapper Bx)
+    coo_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bi, npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_tocsc(*args)
 
+def coo_tocsr_canonical(*args):
+  """
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, signed char Ax, 
+        int Bp, int Bj, signed char Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, short Ax, 
+        int Bp, int Bj, short Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, int Ax, 
+        int Bp, int Bj, int Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long long Ax, 
+        int Bp, int Bj, long long Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, float Ax, 
+        int Bp, int Bj, float Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, double Ax, 
+        int Bp, int Bj, double Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, long double Ax, 
+        int Bp, int Bj, long double Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx)
+    coo_tocsr_canonical(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, signed char Ax, npy_int64 Bp, 
+        npy_int64 Bj, signed char Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned char Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned char Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, short Ax, npy_int64 Bp, 
+        npy_int64 Bj, short Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, int Ax, npy_int64 Bp, 
+        npy_int64 Bj, int Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned int Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned int Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, long long Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, float Ax, npy_int64 Bp, 
+        npy_int64 Bj, float Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, double Ax, npy_int64 Bp, 
+        npy_int64 Bj, double Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long double Ax, npy_int64 Bp, 
+        npy_int64 Bj, long double Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    coo_tocsr_canonical(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_clongdouble_wrapper Bx)
+    """
+  return _coo.coo_tocsr_canonical(*args)
+
 def coo_todense(*args):
   """
     coo_todense(int n_row, int n_col, int nnz, int Ai, int Aj, signed char Ax, 
@@ -168,6 +347,39 @@ def coo_todense(*args):
         npy_cdouble_wrapper Bx)
     coo_todense(int n_row, int n_col, int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, signed char Ax, signed char Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned char Ax, unsigned char Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, short Ax, short Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned short Ax, 
+        unsigned short Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, int Ax, int Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned int Ax, unsigned int Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long long Ax, long long Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, float Ax, float Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, double Ax, double Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, long double Ax, long double Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Bx)
+    coo_todense(npy_int64 n_row, npy_int64 n_col, npy_int64 nnz, npy_int64 Ai, 
+        npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Bx)
     """
   return _coo.coo_todense(*args)
 
@@ -197,6 +409,42 @@ def coo_matvec(*args):
         npy_cdouble_wrapper Yx)
     coo_matvec(int nnz, int Ai, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, short Ax, 
+        short Xx, short Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, int Ax, 
+        int Xx, int Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, long long Ax, 
+        long long Xx, long long Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, float Ax, 
+        float Xx, float Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, double Ax, 
+        double Xx, double Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, long double Ax, 
+        long double Xx, long double Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    coo_matvec(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _coo.coo_matvec(*args)
 
+def coo_count_diagonals(*args):
+  """
+    coo_count_diagonals(int nnz, int Ai, int Aj) -> int
+    coo_count_diagonals(npy_int64 nnz, npy_int64 Ai, npy_int64 Aj) -> npy_int64
+    """
+  return _coo.coo_count_diagonals(*args)
+
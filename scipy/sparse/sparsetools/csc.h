@@ -26,14 +26,18 @@
  *   Complexity: Linear.  Specifically O(nnz(A) + n_col)
  * 
  */
-template <class I, class T>
-void csc_matvec(const I n_row,
-	            const I n_col, 
-	            const I Ap[], 
-	            const I Ai[], 
-	            const T Ax[],
-	            const T Xx[],
-	                  T Yx[])
+/*
+ * csc_matvec_mixed() allows nonzeros Ax[] of type T with vectors of a
+ * wider type V, see csr_matvec_mixed()
+ */
+template <class I, class T, class V>
+void csc_matvec_mixed(const I n_row,
+	                  const I n_col, 
+	                  const I Ap[], 
+	                  const I Ai[], 
+	                  const T Ax[],
+	                  const V Xx[],
+	                        V Yx[])
 { 
     for(I j = 0; j < n_col; j++){
         I col_start = Ap[j];
@@ -41,11 +45,23 @@ void csc_matvec(const I n_row,
 
         for(I ii = col_start; ii < col_end; ii++){
             I i    = Ai[ii];
-            Yx[i] += Ax[ii] * Xx[j];
+            Yx[i] += V(Ax[ii]) * Xx[j];
         }
     }
 }
 
+template <class I, class T>
+void csc_matvec(const I n_row,
+	            const I n_col, 
+	            const I Ap[], 
+	            const I Ai[], 
+	            const T Ax[],
+	            const T Xx[],
+	                  T Yx[])
+{ 
+    csc_matvec_mixed(n_row, n_col, Ap, Ai, Ax, Xx, Yx);
+}
+
 
 /*
  * Compute Y += A*X for CSC matrix A and dense block vectors X,Y
@@ -65,8 +81,28 @@ void csc_matvec(const I n_row,
  *
  * Note:
  *   Output array Yx must be preallocated
+ *
+ *   csc_matvecs_mixed() allows vectors of a wider type V than Ax[]
  * 
  */
+template <class I, class T, class V>
+void csc_matvecs_mixed(const I n_row,
+	                   const I n_col, 
+                       const I n_vecs,
+	                   const I Ap[], 
+	                   const I Ai[], 
+	                   const T Ax[],
+	                   const V Xx[],
+	                         V Yx[])
+{
+    for(I j = 0; j < n_col; j++){
+        for(I ii = Ap[j]; ii < Ap[j+1]; ii++){
+            const I i = Ai[ii];
+            axpy(n_vecs, Ax[ii], Xx + n_vecs * j, Yx + n_vecs * i);
+        }
+    }
+}
+
 template <class I, class T>
 void csc_matvecs(const I n_row,
 	             const I n_col, 
@@ -77,17 +113,11 @@ void csc_matvecs(const I n_row,
 	             const T Xx[],
 	                   T Yx[])
 {
-    for(I j = 0; j < n_col; j++){
-        for(I ii = Ap[j]; ii < Ap[j+1]; ii++){
-            const I i = Ai[ii];
-            axpy(n_vecs, Ax[ii], Xx + n_vecs * j, Yx + n_vecs * i);
-        }
-    }
+    csc_matvecs_mixed(n_row, n_col, n_vecs, Ap, Ai, Ax, Xx, Yx);
 }
 
 
 
-
 /*
  * Derived methods
  */
@@ -137,6 +167,20 @@ void csc_matmat_pass2(const I n_row,
       	                    T Cx[])
 { csr_matmat_pass2(n_col, n_row, Bp, Bi, Bx, Ap, Ai, Ax, Cp, Ci, Cx); }
 
+template <class I, class T>
+void csc_matmat_pass2_sorted(const I n_row,
+      	                     const I n_col, 
+      	                     const I Ap[], 
+      	                     const I Ai[], 
+      	                     const T Ax[],
+      	                     const I Bp[],
+      	                     const I Bi[],
+      	                     const T Bx[],
+      	                           I Cp[],
+      	                           I Ci[],
+      	                           T Cx[])
+{ csr_matmat_pass2_sorted(n_col, n_row, Bp, Bi, Bx, Ap, Ai, Ax, Cp, Ci, Cx); }
+
 
 
 
@@ -8,11 +8,16 @@
 
 %include "csc.h" 
 
+ /* accumulator knob of the SpGEMM kernels in csr.h */
+int  get_matmat_accumulator();
+void set_matmat_accumulator(const int accumulator);
+
 INSTANTIATE_INDEX(csc_matmat_pass1);
 
 INSTANTIATE_ALL(csc_diagonal)
 INSTANTIATE_ALL(csc_tocsr)
 INSTANTIATE_ALL(csc_matmat_pass2)
+INSTANTIATE_ALL(csc_matmat_pass2_sorted)
 INSTANTIATE_ALL(csc_matvec)
 INSTANTIATE_ALL(csc_matvecs)
 INSTANTIATE_ALL(csc_elmul_csc)
@@ -20,4 +25,5 @@ INSTANTIATE_ALL(csc_eldiv_csc)
 INSTANTIATE_ALL(csc_plus_csc)
 INSTANTIATE_ALL(csc_minus_csc)
 
-
+INSTANTIATE_MIXED(csc_matvec_mixed)
+INSTANTIATE_MIXED(csc_matvecs_mixed)
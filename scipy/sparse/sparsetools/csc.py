@@ -67,14 +67,48 @@ except AttributeError:
 
 
 
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _csc.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _csc.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _csc.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _csc.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _csc.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _csc.clear_workspaces(*args)
+
+def get_matmat_accumulator(*args):
+  """get_matmat_accumulator() -> int"""
+  return _csc.get_matmat_accumulator(*args)
+
+def set_matmat_accumulator(*args):
+  """set_matmat_accumulator(int accumulator)"""
+  return _csc.set_matmat_accumulator(*args)
+
+
 def csc_matmat_pass1(*args):
   """
     csc_matmat_pass1(int n_row, int n_col, int Ap, int Ai, int Bp, int Bi, 
         int Cp)
+    csc_matmat_pass1(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_int64 Bp, npy_int64 Bi, npy_int64 Cp)
     """
   return _csc.csc_matmat_pass1(*args)
 
-
 def csc_diagonal(*args):
   """
     csc_diagonal(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -101,6 +135,34 @@ def csc_diagonal(*args):
         npy_cdouble_wrapper Yx)
     csc_diagonal(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
+    csc_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_diagonal(*args)
 
@@ -134,6 +196,48 @@ def csc_tocsr(*args):
         int Bp, int Bj, npy_cdouble_wrapper Bx)
     csc_tocsr(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csc_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx)
     """
   return _csc.csc_tocsr(*args)
 
@@ -177,9 +281,156 @@ def csc_matmat_pass2(*args):
     csc_matmat_pass2(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_matmat_pass2(*args)
 
+def csc_matmat_pass2_sorted(*args):
+  """
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
+        int Bp, int Bi, signed char Bx, int Cp, int Ci, 
+        signed char Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, unsigned char Ax, 
+        int Bp, int Bi, unsigned char Bx, int Cp, 
+        int Ci, unsigned char Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, short Ax, int Bp, 
+        int Bi, short Bx, int Cp, int Ci, short Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, unsigned short Ax, 
+        int Bp, int Bi, unsigned short Bx, int Cp, 
+        int Ci, unsigned short Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, int Ax, int Bp, 
+        int Bi, int Bx, int Cp, int Ci, int Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, unsigned int Ax, 
+        int Bp, int Bi, unsigned int Bx, int Cp, 
+        int Ci, unsigned int Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, long long Ax, 
+        int Bp, int Bi, long long Bx, int Cp, int Ci, 
+        long long Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, unsigned long long Ax, 
+        int Bp, int Bi, unsigned long long Bx, 
+        int Cp, int Ci, unsigned long long Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, float Ax, int Bp, 
+        int Bi, float Bx, int Cp, int Ci, float Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, double Ax, int Bp, 
+        int Bi, double Bx, int Cp, int Ci, double Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, long double Ax, 
+        int Bp, int Bi, long double Bx, int Cp, int Ci, 
+        long double Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        int Bp, int Bi, npy_cfloat_wrapper Bx, 
+        int Cp, int Ci, npy_cfloat_wrapper Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, npy_cdouble_wrapper Ax, 
+        int Bp, int Bi, npy_cdouble_wrapper Bx, 
+        int Cp, int Ci, npy_cdouble_wrapper Cx)
+    csc_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bi, npy_clongdouble_wrapper Bx, 
+        int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
+    """
+  return _csc.csc_matmat_pass2_sorted(*args)
+
 def csc_matvec(*args):
   """
     csc_matvec(int n_row, int n_col, int Ap, int Ai, signed char Ax, 
@@ -210,6 +461,41 @@ def csc_matvec(*args):
         npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
     csc_matvec(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, signed char Xx, signed char Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, short Xx, short Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, int Xx, int Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, long long Xx, long long Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, float Xx, float Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, double Xx, double Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, long double Xx, long double Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csc_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_matvec(*args)
 
@@ -247,6 +533,48 @@ def csc_matvecs(*args):
     csc_matvecs(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, signed char Ax, 
+        signed char Xx, signed char Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, short Ax, short Xx, 
+        short Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, int Ax, int Xx, 
+        int Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, long long Ax, long long Xx, 
+        long long Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, float Ax, float Xx, 
+        float Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, double Ax, double Xx, 
+        double Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, long double Ax, 
+        long double Xx, long double Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csc_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
     """
   return _csc.csc_matvecs(*args)
 
@@ -290,6 +618,58 @@ def csc_elmul_csc(*args):
     csc_elmul_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_elmul_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_elmul_csc(*args)
 
@@ -333,6 +713,58 @@ def csc_eldiv_csc(*args):
     csc_eldiv_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_eldiv_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_eldiv_csc(*args)
 
@@ -376,6 +808,58 @@ def csc_plus_csc(*args):
     csc_plus_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_plus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_plus_csc(*args)
 
@@ -419,6 +903,88 @@ def csc_minus_csc(*args):
     csc_minus_csc(int n_row, int n_col, int Ap, int Ai, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx, 
         int Cp, int Ci, npy_clongdouble_wrapper Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx, npy_int64 Cp, npy_int64 Ci, 
+        signed char Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned char Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx, npy_int64 Cp, npy_int64 Ci, short Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned short Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx, npy_int64 Cp, npy_int64 Ci, int Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Ci, 
+        unsigned int Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx, npy_int64 Cp, npy_int64 Ci, 
+        long long Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Ci, unsigned long long Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx, npy_int64 Cp, npy_int64 Ci, float Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx, npy_int64 Cp, npy_int64 Ci, double Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx, npy_int64 Cp, npy_int64 Ci, 
+        long double Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cfloat_wrapper Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Ci, npy_cdouble_wrapper Cx)
+    csc_minus_csc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Ci, npy_clongdouble_wrapper Cx)
     """
   return _csc.csc_minus_csc(*args)
 
+def csc_matvec_mixed(*args):
+  """
+    csc_matvec_mixed(int n_row, int n_col, int Ap, int Ai, float Ax, double Xx, 
+        double Yx)
+    csc_matvec_mixed(int n_row, int n_col, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csc_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        float Ax, double Xx, double Yx)
+    csc_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Ai, 
+        npy_cfloat_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    """
+  return _csc.csc_matvec_mixed(*args)
+
+def csc_matvecs_mixed(*args):
+  """
+    csc_matvecs_mixed(int n_row, int n_col, int n_vecs, int Ap, int Ai, float Ax, 
+        double Xx, double Yx)
+    csc_matvecs_mixed(int n_row, int n_col, int n_vecs, int Ap, int Ai, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csc_matvecs_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, float Ax, double Xx, 
+        double Yx)
+    csc_matvecs_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Ai, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    """
+  return _csc.csc_matvecs_mixed(*args)
+
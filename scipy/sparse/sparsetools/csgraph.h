@@ -2,23 +2,44 @@
 #define __CSGRAPH_H__
 
 #include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "parallel.h"
 
 /*
- * Determine connected compoments of a compressed sparse graph.
- * Note:
- *   Output array flag must be preallocated
+ * Algorithms of cs_graph_components
+ *
+ *   GRAPH_COMPONENTS_BFS        - breadth first search from one seed
+ *                                 per component (serial)
+ *   GRAPH_COMPONENTS_UNION_FIND - lock-free union-find over the edges
+ *                                 (parallel)
+ *   GRAPH_COMPONENTS_AUTO       - union-find when the graph is large
+ *                                 enough to use several threads, BFS
+ *                                 otherwise
+ *
+ * Both give the same labels for symmetric matrices.
+ *
+ */
+enum { GRAPH_COMPONENTS_AUTO = 0,
+       GRAPH_COMPONENTS_BFS = 1,
+       GRAPH_COMPONENTS_UNION_FIND = 2 };
+
+
+/*
+ * Breadth first search version of cs_graph_components
  */
 template <class I>
-I cs_graph_components(const I n_nod,
-		      const I Ap[],
-		      const I Aj[],
-		            I flag[])
+I cs_graph_components_bfs(const I n_nod,
+                          const I Ap[],
+                          const I Aj[],
+                                I flag[])
 {
   // pos is a work array: list of nodes (rows) to process.
   std::vector<I> pos(n_nod,01);
   I n_comp = 0;
   I n_tot, n_pos, n_pos_new, n_pos0, n_new, n_stop;
-  I icomp, ii, ir, ic;
+  I icomp, ii, ir, ic, seed;
 
   n_stop = n_nod;
   for (ir = 0; ir < n_nod; ir++) {
@@ -29,20 +50,25 @@ I cs_graph_components(const I n_nod,
     }
   }
 
+  if (n_stop == 0) {
+    return 0;
+  }
+
   n_tot = 0;
+  seed = 0;
   for (icomp = 0; icomp < n_nod; icomp++) {
-    // Find seed.
-    ii = 0;
-    while ((flag[ii] >= 0) || (flag[ii] == -2)) {
-      ii++;
-      if (ii >= n_nod) {
+    // Find seed.  Nodes before the previous seed are all labeled,
+    // so the search continues from there.
+    while ((flag[seed] >= 0) || (flag[seed] == -2)) {
+      seed++;
+      if (seed >= n_nod) {
 	/* Sanity check, if this happens, the graph is corrupted. */
 	return -1;
       }
     }
 
-    flag[ii] = icomp;
-    pos[0] = ii;
+    flag[seed] = icomp;
+    pos[0] = seed;
     n_pos0 = 0;
     n_pos_new = n_pos = 1;
 
@@ -73,76 +99,718 @@ I cs_graph_components(const I n_nod,
   return n_comp;
 }
 
+
+/*
+ * Union-find forest for cs_graph_components_union_find
+ *
+ * parent[i] is the parent of node i, or i itself if i is a root.
+ * Roots are always linked below smaller roots, so parent[i] <= i and
+ * the root of every tree is the smallest node of its component.  The
+ * links are made with compare-and-swap, so several threads may join
+ * trees at the same time, and every other access to parent[] while
+ * threads run is a relaxed atomic load or store.
+ */
+template <class I>
+struct graph_forest
+{
+    I * parent;
+
+    I find(I i) const
+    {
+        for(;;){
+            const I p = atomic_load_relaxed(parent + i);
+            if (p == i)
+                return i;
+            // path halving: any ancestor is a valid parent, so a
+            // racing update only makes the path shorter
+            const I grandparent = atomic_load_relaxed(parent + p);
+            atomic_store_relaxed(parent + i, grandparent);
+            i = grandparent;
+        }
+    }
+
+    void join(const I a, const I b) const
+    {
+        for(;;){
+            I ra = find(a);
+            I rb = find(b);
+            if (ra == rb)
+                return;
+            if (ra < rb){
+                const I temp = ra;
+                ra = rb;
+                rb = temp;
+            }
+            // link the larger root below the smaller one, unless
+            // another thread has linked it in the meantime
+            if (atomic_compare_and_swap(parent + ra, ra, rb))
+                return;
+        }
+    }
+};
+
+template <class I>
+struct graph_forest_init_kernel
+{
+    I * parent;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            parent[i] = i;
+        }
+    }
+};
+
+template <class I>
+struct graph_forest_join_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    graph_forest<I> forest;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                // nodes with empty rows are not part of any component
+                if (j != i && Ap[j+1] != Ap[j])
+                    forest.join(i, j);
+            }
+        }
+    }
+};
+
+template <class I>
+struct graph_forest_compress_kernel
+{
+    graph_forest<I> forest;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            atomic_store_relaxed(forest.parent + i, forest.find(i));
+        }
+    }
+};
+
+/*
+ * Union-find version of cs_graph_components
+ *
+ * The forest is built in flag[] itself.  Without atomic operations
+ * (see parallel.h) it runs on one thread.
+ */
+template <class I>
+I cs_graph_components_union_find(const I n_nod,
+                                 const I Ap[],
+                                 const I Aj[],
+                                       I flag[])
+{
+    graph_forest<I> forest = {flag};
+
+    graph_forest_init_kernel<I> init = {flag};
+    parallel_for_rows(n_nod, Ap, init);
+
+    graph_forest_join_kernel<I> join = {Ap, Aj, forest};
+#ifdef SPARSETOOLS_HAVE_ATOMICS
+    parallel_for_rows(n_nod, Ap, join);
+#else
+    join((I) 0, n_nod);
 #endif
-#ifndef __CSGRAPH_H__
-#define __CSGRAPH_H__
 
-#include <vector>
+    graph_forest_compress_kernel<I> compress = {forest};
+    parallel_for_rows(n_nod, Ap, compress);
+
+    // number the components in the order of their smallest node,
+    // which is the root and precedes the other nodes
+    I n_comp = 0;
+    for(I i = 0; i < n_nod; i++){
+        if (Ap[i+1] == Ap[i])
+            flag[i] = -2;
+        else if (flag[i] == i)
+            flag[i] = n_comp++;
+        else
+            flag[i] = flag[flag[i]];
+    }
+
+    return n_comp;
+}
+
 
 /*
  * Determine connected compoments of a compressed sparse graph.
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   int algorithm      - one of the GRAPH_COMPONENTS_* values above
+ *
+ * Output Arguments:
+ *   I  flag[n_nod]     - component of each node, -2 for nodes with
+ *                        empty rows
+ *
+ * Returns the number of components, or -1 if the graph is corrupted.
+ *
  * Note:
  *   Output array flag must be preallocated
+ *   The matrix is assumed to be symmetric.
  */
 template <class I>
 I cs_graph_components(const I n_nod,
 		      const I Ap[],
 		      const I Aj[],
-		            I flag[])
+		            I flag[],
+		      const int algorithm)
 {
-  // pos is a work array: list of nodes (rows) to process.
-  std::vector<I> pos(n_nod,01);
-  I n_comp;
-  I n_tot, n_pos, n_pos_new, n_pos0, n_new, n_stop;
-  I icomp, ii, ir, ic;
+    int method = algorithm;
+    if (method != GRAPH_COMPONENTS_BFS && method != GRAPH_COMPONENTS_UNION_FIND){
+        const double work = (double) Ap[n_nod] + (double) n_nod;
+        if (parallel_num_chunks(work) > 1)
+            method = GRAPH_COMPONENTS_UNION_FIND;
+        else
+            method = GRAPH_COMPONENTS_BFS;
+    }
 
-  n_stop = n_nod;
-  for (ir = 0; ir < n_nod; ir++) {
-    flag[ir] = -1;
-    if ((Ap[ir+1] - Ap[ir]) == 0) n_stop--;
-  }
+    if (method == GRAPH_COMPONENTS_UNION_FIND)
+        return cs_graph_components_union_find(n_nod, Ap, Aj, flag);
+    else
+        return cs_graph_components_bfs(n_nod, Ap, Aj, flag);
+}
 
-  n_tot = 0;
-  for (icomp = 0; icomp < n_nod; icomp++) {
-    // Find seed.
-    ii = 0;
-    while (flag[ii] >= 0) {
-      ii++;
-      if (ii >= n_nod) {
-	/* Sanity check, if this happens, the graph is corrupted. */
-	return -1;
-      }
+
+/*
+ * Breadth first search that records the level structure rooted at a
+ * node.  Visited nodes are marked with a stamp that changes with
+ * every search, so the marks never have to be cleared.
+ */
+template <class I>
+struct graph_level_search
+{
+    const I * Ap;
+    const I * Aj;
+    std::vector<I> stamp;
+    std::vector<I> order;
+    I current;
+
+    graph_level_search(const I n_nod, const I Ap_[], const I Aj_[])
+        : Ap(Ap_), Aj(Aj_), stamp(n_nod, 0), order(n_nod), current(0) {}
+
+    I degree(const I i) const { return Ap[i+1] - Ap[i]; }
+
+    // Visit the component of root by levels.  The nodes are stored
+    // in order[0:n_visited].  Returns the number of levels and the
+    // start of the last level in last_level.
+    I search(const I root, I& n_visited, I& last_level)
+    {
+        current++;
+        stamp[root] = current;
+        order[0] = root;
+
+        I head = 0, tail = 1, n_levels = 0;
+        last_level = 0;
+        while (head < tail){
+            const I level_end = tail;
+            last_level = head;
+            n_levels++;
+            for(; head < level_end; head++){
+                const I i = order[head];
+                for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                    const I j = Aj[jj];
+                    if (stamp[j] != current){
+                        stamp[j] = current;
+                        order[tail++] = j;
+                    }
+                }
+            }
+        }
+        n_visited = tail;
+        return n_levels;
     }
-    flag[ii] = icomp;
-    pos[0] = ii;
-    n_pos0 = 0;
-    n_pos_new = n_pos = 1;
 
-    for (ii = 0; ii < n_nod; ii++) {
-      n_new = 0;
-      for (ir = n_pos0; ir < n_pos; ir++) {
-	for (ic = Ap[pos[ir]]; ic < Ap[pos[ir]+1]; ic++) {
-	  if (flag[Aj[ic]] == -1) {
-	    flag[Aj[ic]] = icomp;
-	    pos[n_pos_new] = Aj[ic];
-	    n_pos_new++;
-	    n_new++;
-	  }
-	}
-      }
-      n_pos0 = n_pos;
-      n_pos = n_pos_new;
-      if (n_new == 0) break;
+    // Pseudo-peripheral node of the component of start (George and
+    // Liu): move to a node of minimum degree in the last level for as
+    // long as that increases the number of levels.
+    I pseudo_peripheral(const I start)
+    {
+        I root = start, n_visited, last_level;
+        I n_levels = search(root, n_visited, last_level);
+        for(;;){
+            I candidate = order[last_level];
+            for(I k = last_level + 1; k < n_visited; k++){
+                if (degree(order[k]) < degree(candidate))
+                    candidate = order[k];
+            }
+            const I candidate_levels = search(candidate, n_visited, last_level);
+            if (candidate_levels <= n_levels)
+                return root;
+            root = candidate;
+            n_levels = candidate_levels;
+        }
     }
-    n_tot += n_pos;
+};
 
-    if (n_tot == n_stop) {
-      n_comp = icomp + 1;
-      break;
+
+template <class I>
+struct graph_degree_less
+{
+    const I * Ap;
+
+    bool operator()(const I a, const I b) const
+    {
+        return Ap[a+1] - Ap[a] < Ap[b+1] - Ap[b];
     }
-  }
+};
 
-  return n_comp;
+/*
+ * Compute the reverse Cuthill-McKee ordering of a compressed sparse
+ * graph.
+ *
+ * Each component is numbered by a breadth first search from a
+ * pseudo-peripheral node, visiting the neighbors of a node by
+ * increasing degree, and the resulting order is reversed.  Applied
+ * to a matrix with csr_permute_symmetric() it reduces the bandwidth
+ * and profile.
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *
+ * Output Arguments:
+ *   I  perm[n_nod]     - node placed at position k of the ordering
+ *
+ * Note:
+ *   Output array perm must be preallocated
+ *   The matrix is assumed to have a symmetric sparsity structure.
+ *   Other structures still give a permutation, but not one that
+ *   reduces the bandwidth.
+ *
+ *   Complexity: O(nnz(A) * number of pseudo-peripheral searches)
+ */
+template <class I>
+void cs_graph_rcm(const I n_nod,
+                  const I Ap[],
+                  const I Aj[],
+                        I perm[])
+{
+    graph_level_search<I> levels(n_nod, Ap, Aj);
+    graph_degree_less<I> by_degree = {Ap};
+
+    std::vector<char> visited(n_nod, 0);
+    I n_ordered = 0;
+
+    I seed = 0;
+    while (n_ordered < n_nod){
+        // with a non-symmetric structure the search from a seed need
+        // not reach it, or can end on a node that is already ordered,
+        // so the seed only advances once it is ordered
+        while (visited[seed])
+            seed++;
+
+        I root = levels.pseudo_peripheral(seed);
+        if (visited[root])
+            root = seed;
+
+        visited[root] = 1;
+        perm[n_ordered] = root;
+        I head = n_ordered;
+        n_ordered++;
+
+        while (head < n_ordered){
+            const I i = perm[head++];
+            const I first = n_ordered;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                if (!visited[j]){
+                    visited[j] = 1;
+                    perm[n_ordered++] = j;
+                }
+            }
+            std::stable_sort(perm + first, perm + n_ordered, by_degree);
+        }
+    }
+
+    std::reverse(perm, perm + n_nod);
+}
+
+
+/*
+ * Graph with node and edge weights used by the multilevel bisection
+ * of cs_graph_nested_dissection.  Self loops are not stored.
+ */
+template <class I>
+struct nd_graph
+{
+    std::vector<I> p, j, edge_w, node_w;
+
+    I n_nod() const { return (I) node_w.size(); }
+
+    const I * row_pointer() const { return &p[0]; }
+    const I * columns() const { return j.empty() ? (const I *) 0 : &j[0]; }
+};
+
+/*
+ * Subgraph of A on nodes[], with local[] mapping the nodes of A to
+ * their position in nodes[] and -1 elsewhere
+ */
+template <class I>
+void nd_subgraph(const I Ap[],
+                 const I Aj[],
+                 const std::vector<I>& nodes,
+                 const std::vector<I>& local,
+                 nd_graph<I>& G)
+{
+    const I n = (I) nodes.size();
+
+    G.p.assign(1, 0);
+    G.j.clear();
+    G.edge_w.clear();
+    G.node_w.assign(n, 1);
+
+    for(I k = 0; k < n; k++){
+        const I i = nodes[k];
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I l = local[Aj[jj]];
+            if (l >= 0 && l != k){
+                G.j.push_back(l);
+                G.edge_w.push_back(1);
+            }
+        }
+        G.p.push_back((I) G.j.size());
+    }
+}
+
+/*
+ * Coarsen G by heavy edge matching.  Every node is merged with the
+ * unmatched neighbor it shares the heaviest edge with, if any, and
+ * cmap[] receives the node of C that each node of G belongs to.
+ */
+template <class I>
+void nd_coarsen(const nd_graph<I>& G, nd_graph<I>& C, std::vector<I>& cmap)
+{
+    const I n = G.n_nod();
+
+    cmap.assign(n, -1);
+    std::vector<I> first, second;
+
+    for(I u = 0; u < n; u++){
+        if (cmap[u] >= 0)
+            continue;
+
+        I match = -1, match_w = 0;
+        for(I jj = G.p[u]; jj < G.p[u+1]; jj++){
+            const I v = G.j[jj];
+            if (cmap[v] < 0 && G.edge_w[jj] > match_w){
+                match = v;
+                match_w = G.edge_w[jj];
+            }
+        }
+
+        cmap[u] = (I) first.size();
+        if (match >= 0)
+            cmap[match] = (I) first.size();
+        first.push_back(u);
+        second.push_back(match);
+    }
+
+    const I n_coarse = (I) first.size();
+
+    C.p.assign(1, 0);
+    C.j.clear();
+    C.edge_w.clear();
+    C.node_w.assign(n_coarse, 0);
+
+    // position of each coarse neighbor in the current row of C
+    std::vector<I> pos(n_coarse, -1);
+
+    for(I c = 0; c < n_coarse; c++){
+        const I row_start = (I) C.j.size();
+        const I members[2] = {first[c], second[c]};
+
+        for(int m = 0; m < 2 && members[m] >= 0; m++){
+            const I u = members[m];
+            C.node_w[c] += G.node_w[u];
+            for(I jj = G.p[u]; jj < G.p[u+1]; jj++){
+                const I d = cmap[G.j[jj]];
+                if (d == c)
+                    continue;
+                if (pos[d] >= row_start){
+                    C.edge_w[pos[d]] += G.edge_w[jj];
+                } else {
+                    pos[d] = (I) C.j.size();
+                    C.j.push_back(d);
+                    C.edge_w.push_back(G.edge_w[jj]);
+                }
+            }
+        }
+        C.p.push_back((I) C.j.size());
+    }
+}
+
+/*
+ * Initial bisection of the coarsest graph: grow part 0 breadth first
+ * from a pseudo-peripheral node until it holds half of the weight
+ */
+template <class I>
+void nd_grow_partition(const nd_graph<I>& G, std::vector<char>& part, I part_w[2])
+{
+    const I n = G.n_nod();
+
+    I total_w = 0;
+    for(I u = 0; u < n; u++)
+        total_w += G.node_w[u];
+
+    part.assign(n, 1);
+    part_w[0] = 0;
+    part_w[1] = total_w;
+
+    graph_level_search<I> levels(n, G.row_pointer(), G.columns());
+    const I root = levels.pseudo_peripheral(0);
+
+    std::vector<char> queued(n, 0);
+    std::vector<I> queue;
+    queue.reserve(n);
+    queue.push_back(root);
+    queued[root] = 1;
+
+    I head = 0, seed = 0;
+    while (2*part_w[0] < total_w){
+        if (head == (I) queue.size()){
+            // the component is exhausted, continue in the next one
+            while (queued[seed])
+                seed++;
+            queue.push_back(seed);
+            queued[seed] = 1;
+        }
+
+        const I u = queue[head++];
+        part[u] = 0;
+        part_w[0] += G.node_w[u];
+        part_w[1] -= G.node_w[u];
+
+        for(I jj = G.p[u]; jj < G.p[u+1]; jj++){
+            const I v = G.j[jj];
+            if (!queued[v]){
+                queued[v] = 1;
+                queue.push_back(v);
+            }
+        }
+    }
+}
+
+/*
+ * Greedy refinement of a bisection.  Nodes move to the other part
+ * when that reduces the weight of the cut edges, or keeps it and
+ * improves the balance, as long as the destination stays below
+ * max_w.  Each move decreases the cut or the imbalance, so the
+ * passes terminate.
+ */
+template <class I>
+void nd_refine(const nd_graph<I>& G, std::vector<char>& part, I part_w[2], const I max_w)
+{
+    const I n = G.n_nod();
+
+    for(int pass = 0; pass < 8; pass++){
+        bool moved = false;
+
+        for(I u = 0; u < n; u++){
+            const int from = part[u], to = 1 - from;
+            const I w = G.node_w[u];
+
+            I gain = 0;
+            bool boundary = false;
+            for(I jj = G.p[u]; jj < G.p[u+1]; jj++){
+                if (part[G.j[jj]] == from){
+                    gain -= G.edge_w[jj];
+                } else {
+                    gain += G.edge_w[jj];
+                    boundary = true;
+                }
+            }
+
+            if (!boundary || part_w[to] + w > max_w)
+                continue;
+
+            if (gain > 0 || (gain == 0 && part_w[from] > part_w[to] + w)){
+                part[u] = (char) to;
+                part_w[from] -= w;
+                part_w[to] += w;
+                moved = true;
+            }
+        }
+
+        if (!moved)
+            break;
+    }
+}
+
+/*
+ * Multilevel bisection of G: coarsen, bisect the coarsest graph and
+ * refine the bisection on the way back to G
+ */
+const int nd_coarsest_size = 64;
+const int nd_max_levels = 40;
+
+template <class I>
+void nd_bisect(const nd_graph<I>& G, std::vector<char>& part)
+{
+    std::vector< nd_graph<I> > coarse;
+    std::vector< std::vector<I> > cmaps;
+    coarse.reserve(nd_max_levels);
+    cmaps.reserve(nd_max_levels);
+
+    const nd_graph<I> * fine = &G;
+    while (fine->n_nod() > nd_coarsest_size && (int) coarse.size() < nd_max_levels){
+        coarse.push_back(nd_graph<I>());
+        cmaps.push_back(std::vector<I>());
+        nd_coarsen(*fine, coarse.back(), cmaps.back());
+
+        // stop when the matching no longer shrinks the graph
+        if (10 * coarse.back().n_nod() > 9 * fine->n_nod()){
+            fine = &coarse.back();
+            break;
+        }
+        fine = &coarse.back();
+    }
+
+    I total_w = 0;
+    for(I u = 0; u < G.n_nod(); u++)
+        total_w += G.node_w[u];
+    const I max_w = total_w - total_w / 2 + total_w / 20;
+
+    I part_w[2];
+    nd_grow_partition(*fine, part, part_w);
+    nd_refine(*fine, part, part_w, max_w);
+
+    for(int level = (int) coarse.size() - 1; level >= 0; level--){
+        const nd_graph<I>& finer = (level == 0) ? G : coarse[level - 1];
+        const std::vector<I>& cmap = cmaps[level];
+
+        std::vector<char> finer_part(finer.n_nod());
+        for(I u = 0; u < finer.n_nod(); u++)
+            finer_part[u] = part[cmap[u]];
+        part.swap(finer_part);
+
+        nd_refine(finer, part, part_w, max_w);
+    }
+}
+
+/*
+ * Order nodes[] and append them to perm: both halves of a bisection
+ * recursively, then the vertex separator between them.  Small
+ * subgraphs are ordered by reverse Cuthill-McKee.
+ */
+const int nd_leaf_size = 64;
+
+template <class I>
+void nd_dissect(const I Ap[],
+                const I Aj[],
+                std::vector<I>& nodes,
+                std::vector<I>& local,
+                I perm[],
+                I& n_ordered)
+{
+    const I n = (I) nodes.size();
+    if (n == 0)
+        return;
+
+    for(I k = 0; k < n; k++)
+        local[nodes[k]] = k;
+
+    std::vector<I> halves[2], separator;
+    {
+        nd_graph<I> G;
+        nd_subgraph(Ap, Aj, nodes, local, G);
+
+        std::vector<char> part;
+        if (n > nd_leaf_size)
+            nd_bisect(G, part);
+
+        // the boundary of the part with the smaller boundary
+        // separates the two parts
+        I n_boundary[2] = {0, 0};
+        std::vector<char> boundary(n, 0);
+        for(I u = 0; u < n && !part.empty(); u++){
+            for(I jj = G.p[u]; jj < G.p[u+1]; jj++){
+                if (part[G.j[jj]] != part[u]){
+                    boundary[u] = 1;
+                    n_boundary[(int) part[u]]++;
+                    break;
+                }
+            }
+        }
+        const int cut_side = (n_boundary[1] < n_boundary[0]) ? 1 : 0;
+
+        for(I u = 0; u < n && !part.empty(); u++){
+            if (part[u] == cut_side && boundary[u])
+                separator.push_back(nodes[u]);
+            else
+                halves[(int) part[u]].push_back(nodes[u]);
+        }
+
+        if (part.empty() || (I) halves[0].size() == n || (I) halves[1].size() == n){
+            // leaf: order by reverse Cuthill-McKee, which accepts the
+            // non-symmetric subgraphs of non-symmetric structures
+            std::vector<I> order(n);
+            cs_graph_rcm(n, G.row_pointer(), G.columns(), &order[0]);
+            for(I k = 0; k < n; k++)
+                perm[n_ordered++] = nodes[order[k]];
+            halves[0].clear();
+            halves[1].clear();
+            separator.clear();
+        }
+    }
+
+    for(I k = 0; k < n; k++)
+        local[nodes[k]] = -1;
+    std::vector<I>().swap(nodes);
+
+    nd_dissect(Ap, Aj, halves[0], local, perm, n_ordered);
+    nd_dissect(Ap, Aj, halves[1], local, perm, n_ordered);
+    for(size_t k = 0; k < separator.size(); k++)
+        perm[n_ordered++] = separator[k];
+}
+
+/*
+ * Compute a nested dissection ordering of a compressed sparse graph.
+ *
+ * The graph is split by a small vertex separator into two parts that
+ * are ordered first, recursively, followed by the separator.  Each
+ * bisection is computed with a multilevel scheme: the graph is
+ * coarsened by heavy edge matching, the coarsest graph is bisected
+ * by breadth first growth and the bisection is refined greedily on
+ * every level back to the original graph.  Eliminating the nodes in
+ * this order, e.g. in a sparse LU factorization, produces little
+ * fill-in on mesh-like graphs.
+ *
+ * Input Arguments:
+ *   I  n_nod           - number of nodes
+ *   I  Ap[n_nod+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *
+ * Output Arguments:
+ *   I  perm[n_nod]     - node placed at position k of the ordering
+ *
+ * Note:
+ *   Output array perm must be preallocated
+ *   The matrix is assumed to have a symmetric sparsity structure.
+ *
+ *   Complexity: about O(nnz(A) log(n_nod))
+ */
+template <class I>
+void cs_graph_nested_dissection(const I n_nod,
+                                const I Ap[],
+                                const I Aj[],
+                                      I perm[])
+{
+    std::vector<I> nodes(n_nod), local(n_nod, -1);
+    for(I i = 0; i < n_nod; i++)
+        nodes[i] = i;
+
+    I n_ordered = 0;
+    nd_dissect(Ap, Aj, nodes, local, perm, n_ordered);
 }
 
 #endif
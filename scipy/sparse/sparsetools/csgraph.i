@@ -7,9 +7,15 @@
 #include "csgraph.h"
 %}
 
+%ignore nd_coarsest_size;
+%ignore nd_max_levels;
+%ignore nd_leaf_size;
+
 %include "csgraph.h" 
 
 INSTANTIATE_INDEX(cs_graph_components)
+INSTANTIATE_INDEX(cs_graph_rcm)
+INSTANTIATE_INDEX(cs_graph_nested_dissection)
 /* -*- C -*- */
 %module csgraph
 
@@ -22,3 +28,5 @@ INSTANTIATE_INDEX(cs_graph_components)
 %include "csgraph.h" 
 
 INSTANTIATE_INDEX(cs_graph_components)
+INSTANTIATE_INDEX(cs_graph_rcm)
+INSTANTIATE_INDEX(cs_graph_nested_dissection)
@@ -67,8 +67,53 @@ except AttributeError:
 
 
 
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _csgraph.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _csgraph.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _csgraph.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _csgraph.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _csgraph.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _csgraph.clear_workspaces(*args)
+
+GRAPH_COMPONENTS_AUTO = _csgraph.GRAPH_COMPONENTS_AUTO
+GRAPH_COMPONENTS_BFS = _csgraph.GRAPH_COMPONENTS_BFS
+GRAPH_COMPONENTS_UNION_FIND = _csgraph.GRAPH_COMPONENTS_UNION_FIND
+
 def cs_graph_components(*args):
-  """cs_graph_components(int n_nod, int Ap, int Aj, int flag) -> int"""
+  """
+    cs_graph_components(int n_nod, int Ap, int Aj, int flag, int algorithm) -> int
+    cs_graph_components(npy_int64 n_nod, npy_int64 Ap, npy_int64 Aj, npy_int64 flag, 
+        int algorithm) -> npy_int64
+    """
   return _csgraph.cs_graph_components(*args)
 
+def cs_graph_rcm(*args):
+  """
+    cs_graph_rcm(int n_nod, int Ap, int Aj, int perm)
+    cs_graph_rcm(npy_int64 n_nod, npy_int64 Ap, npy_int64 Aj, npy_int64 perm)
+    """
+  return _csgraph.cs_graph_rcm(*args)
+
+def cs_graph_nested_dissection(*args):
+  """
+    cs_graph_nested_dissection(int n_nod, int Ap, int Aj, int perm)
+    cs_graph_nested_dissection(npy_int64 n_nod, npy_int64 Ap, npy_int64 Aj, npy_int64 perm)
+    """
+  return _csgraph.cs_graph_nested_dissection(*args)
 
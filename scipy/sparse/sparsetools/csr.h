@@ -7,6 +7,10 @@
 #include <functional>
 
 #include "dense.h"
+#include "parallel.h"
+#include "sell.h"
+#include "transpose.h"
+#include "workspace.h"
 
 /*
  * Extract main diagonal of CSR matrix A
@@ -305,6 +309,166 @@ bool kv_pair_less(const std::pair<T1,T2>& x, const std::pair<T1,T2>& y){
     return x.first < y.first;
 }
 
+/*
+ * Remove the gaps left in Cj, Cx by entries that were dropped from
+ * the rows of C (zeros or merged duplicates), and update Cp[] accordingly
+ */
+template <class I, class T>
+void csr_compact_rows(const I n_row,
+                            I Cp[],
+                            I Cj[],
+                            T Cx[],
+                      const I row_nnz[])
+{
+    bool has_gaps = false;
+    for(I i = 0; i < n_row; i++){
+        if(row_nnz[i] != Cp[i+1] - Cp[i]){
+            has_gaps = true;
+            break;
+        }
+    }
+    if(!has_gaps)
+        return;
+
+    I nnz = 0;
+    for(I i = 0; i < n_row; i++){
+        const I row_start = Cp[i];
+        const I length    = row_nnz[i];
+
+        if(row_start != nnz){
+            // destination precedes source, so a forward copy is safe
+            std::copy(Cj + row_start, Cj + row_start + length, Cj + nnz);
+            std::copy(Cx + row_start, Cx + row_start + length, Cx + nnz);
+        }
+
+        Cp[i] = nnz;
+        nnz += length;
+    }
+    Cp[n_row] = nnz;
+}
+
+/*
+ * Sort the entries of one row by column index, without building pairs
+ *
+ * Short rows use insertion sort.  Longer rows use an LSD radix sort on
+ * the column offsets from the smallest column of the row, one byte per
+ * pass, with tj and tx as scratch arrays.  Rows that are already
+ * sorted are left alone.
+ */
+template <class I, class T>
+void csr_sort_row(const I length,
+                        I Aj[],
+                        T Ax[],
+                  std::vector<I>& tj,
+                  std::vector<T>& tx)
+{
+    I lo = 0, hi = 0;
+    bool sorted = true;
+    if (length > 0){
+        lo = hi = Aj[0];
+    }
+    for(I n = 1; n < length; n++){
+        const I j = Aj[n];
+        if (j < Aj[n-1])
+            sorted = false;
+        if (j < lo) lo = j;
+        if (j > hi) hi = j;
+    }
+    if (sorted)
+        return;
+
+    if (length <= 32){
+        for(I n = 1; n < length; n++){
+            const I j = Aj[n];
+            const T x = Ax[n];
+            I m = n;
+            while (m > 0 && Aj[m-1] > j){
+                Aj[m] = Aj[m-1];
+                Ax[m] = Ax[m-1];
+                m--;
+            }
+            Aj[m] = j;
+            Ax[m] = x;
+        }
+        return;
+    }
+
+    I * src_j = Aj;
+    T * src_x = Ax;
+    I * dst_j = workspace_array(tj, length);
+    T * dst_x = workspace_array(tx, length);
+
+    // the offsets are non-negative, so shifting them is well defined
+    const I span = hi - lo;
+    for(int shift = 0; shift < (int) (8*sizeof(I)) && (span >> shift) != 0; shift += 8){
+        I count[257] = {0};
+        for(I n = 0; n < length; n++){
+            count[1 + (((src_j[n] - lo) >> shift) & 0xff)]++;
+        }
+        for(int b = 0; b < 256; b++){
+            count[b+1] += count[b];
+        }
+        for(I n = 0; n < length; n++){
+            const I dest = count[((src_j[n] - lo) >> shift) & 0xff]++;
+            dst_j[dest] = src_j[n];
+            dst_x[dest] = src_x[n];
+        }
+        std::swap(src_j, dst_j);
+        std::swap(src_x, dst_x);
+    }
+
+    if (src_j != Aj){
+        std::copy(src_j, src_j + length, Aj);
+        std::copy(src_x, src_x + length, Ax);
+    }
+}
+
+/*
+ * Sort the rows of A and, if merge is set, sum the duplicate entries
+ * of each row into its leading row_nnz[i] positions
+ */
+template <class I, class T>
+struct csr_sort_rows_kernel
+{
+    const I * Ap;
+          I * Aj;
+          T * Ax;
+          I * row_nnz;
+    bool merge;
+    workspace< csr_buffers<I,T> > * ws;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        workspace_lease< csr_buffers<I,T> > lease(*ws);
+
+        for(I i = row_start; i < row_end; i++){
+            const I start  = Ap[i];
+            const I length = Ap[i+1] - start;
+            I * Rj = Aj + start;
+            T * Rx = Ax + start;
+
+            csr_sort_row(length, Rj, Rx, lease->scratch_keys, lease->scratch_values);
+
+            if (!merge)
+                continue;
+
+            I nnz = 0;
+            for(I n = 0; n < length; nnz++){
+                const I j = Rj[n];
+                T x = Rx[n];
+                for(n++; n < length && Rj[n] == j; n++){
+                    x += Rx[n];
+                }
+                Rj[nnz] = j;
+                Rx[nnz] = x;
+            }
+            row_nnz[i] = nnz;
+        }
+
+        lease.done();
+    }
+};
+
 /*
  * Sort CSR column indices inplace
  *
@@ -314,6 +478,8 @@ bool kv_pair_less(const std::pair<T1,T2>& x, const std::pair<T1,T2>& y){
  *   I  Aj[nnz(A)]      - column indices
  *   T  Ax[nnz(A)]      - nonzeros 
  *
+ * Rows are sorted in parallel (see csr_sort_row).
+ *
  */
 template<class I, class T>
 void csr_sort_indices(const I n_row,
@@ -321,25 +487,40 @@ void csr_sort_indices(const I n_row,
                             I Aj[], 
                             T Ax[])
 {
-    std::vector< std::pair<I,T> > temp;
-
-    for(I i = 0; i < n_row; i++){
-        I row_start = Ap[i];
-        I row_end   = Ap[i+1];
+    csr_sort_rows_kernel<I,T> kernel = {Ap, Aj, Ax, 0, false,
+                                        &default_workspace< csr_buffers<I,T> >()};
+    parallel_for_rows(n_row, Ap, kernel);
+}
 
-        temp.clear();
+/*
+ * Sort CSR column indices and sum duplicate entries inplace
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros 
+ *
+ * On return A is in canonical format and Ap[n_row] holds its new
+ * number of nonzeros.  Explicit zeros are kept.
+ *
+ */
+template<class I, class T>
+void csr_canonicalize(const I n_row,
+                            I Ap[], 
+                            I Aj[], 
+                            T Ax[])
+{
+    workspace< csr_buffers<I,T> >& ws = default_workspace< csr_buffers<I,T> >();
+    workspace_lease< csr_buffers<I,T> > lease(ws);
+    I * row_nnz = workspace_array(lease->row_nnz, n_row);
 
-        for(I jj = row_start; jj < row_end; jj++){
-            temp.push_back(std::make_pair(Aj[jj],Ax[jj]));
-        }
+    csr_sort_rows_kernel<I,T> kernel = {Ap, Aj, Ax, row_nnz, true, &ws};
+    parallel_for_rows(n_row, Ap, kernel);
 
-        std::sort(temp.begin(),temp.end(),kv_pair_less<I,T>);
+    csr_compact_rows(n_row, Ap, Aj, Ax, row_nnz);
 
-        for(I jj = row_start, n = 0; jj < row_end; jj++, n++){
-            Aj[jj] = temp[n].first;
-            Ax[jj] = temp[n].second;
-        }
-    }    
+    lease.done();
 }
 
 
@@ -373,6 +554,9 @@ void csr_sort_indices(const I n_row,
  *   Output: row indices *will be* in sorted order
  *
  *   Complexity: Linear.  Specifically O(nnz(A) + max(n_row,n_col))
+ *
+ *   Large matrices are transposed in parallel and with many columns
+ *   the scatter is cache blocked (see transpose.h).
  * 
  */
 template <class I, class T>
@@ -385,40 +569,8 @@ void csr_tocsc(const I n_row,
 	                 I Bi[],
 	                 T Bx[])
 {  
-    const I nnz = Ap[n_row];
-
-    //compute number of non-zero entries per column of A 
-    std::fill(Bp, Bp + n_col, 0);
-
-    for (I n = 0; n < nnz; n++){            
-        Bp[Aj[n]]++;
-    }
-
-    //cumsum the nnz per column to get Bp[]
-    for(I col = 0, cumsum = 0; col < n_col; col++){     
-        I temp  = Bp[col];
-        Bp[col] = cumsum;
-        cumsum += temp;
-    }
-    Bp[n_col] = nnz; 
-
-    for(I row = 0; row < n_row; row++){
-        for(I jj = Ap[row]; jj < Ap[row+1]; jj++){
-            I col  = Aj[jj];
-            I dest = Bp[col];
-
-            Bi[dest] = row;
-            Bx[dest] = Ax[jj];
-
-            Bp[col]++;
-        }
-    }  
-
-    for(I col = 0, last = 0; col <= n_col; col++){
-        I temp  = Bp[col];
-        Bp[col] = last;
-        last    = temp;
-    }
+    csr_entries<I,T> src = {n_row, Ap, Aj, Ax};
+    bucket_scatter(n_col, src, Bp, Bi, Bx);
 }   
 
 
@@ -472,6 +624,153 @@ void csr_toell(const I n_row,
 }
 
 
+/*
+ * Compute the row permutation and chunk pointer of the
+ * SELL-C-sigma form of CSR matrix A (see sell.h)
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  C               - chunk height
+ *   I  sigma           - sorting window, in rows
+ *
+ * Output Arguments:
+ *   I  perm[n_row]     - row of A stored in each lane
+ *   I  Bp[n_chunks+1]  - chunk pointer, n_chunks = ceil(n_row / C)
+ *
+ * Note:
+ *   Output arrays perm, Bp must be preallocated
+ *   Bp[n_chunks] is the storage needed for Bj and Bx in csr_tosell().
+ *   Inside each window rows are ordered by decreasing length, rows of
+ *   equal length keep their original order.  sigma <= 1 disables the
+ *   sorting.
+ *
+ *   Complexity: O(n_row * log(sigma))
+ *
+ */
+template <class I>
+struct sell_row_longer
+{
+    const I * Ap;
+
+    bool operator()(const I a, const I b) const
+    {
+        return (Ap[a+1] - Ap[a]) > (Ap[b+1] - Ap[b]);
+    }
+};
+
+template <class I>
+void csr_tosell_pass1(const I n_row,
+                      const I Ap[],
+                      const I C,
+                      const I sigma,
+                            I perm[],
+                            I Bp[])
+{
+    for(I i = 0; i < n_row; i++){
+        perm[i] = i;
+    }
+
+    if(sigma > 1){
+        sell_row_longer<I> longer = {Ap};
+        for(I start = 0; start < n_row; start += sigma){
+            const I end = std::min(n_row, start + sigma);
+            std::stable_sort(perm + start, perm + end, longer);
+        }
+    }
+
+    const I n_chunks = (n_row + C - 1) / C;
+
+    Bp[0] = 0;
+    for(I c = 0; c < n_chunks; c++){
+        const I lanes = std::min(C, n_row - C*c);
+        I width = 0;
+        for(I r = 0; r < lanes; r++){
+            const I i = perm[C*c + r];
+            width = std::max(width, Ap[i+1] - Ap[i]);
+        }
+        Bp[c+1] = Bp[c] + C*width;
+    }
+}
+
+/*
+ * Compute B = A for CSR matrix A, SELL-C-sigma matrix B
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  C               - chunk height
+ *   I  perm[n_row]     - row permutation from csr_tosell_pass1()
+ *   I  Bp[n_chunks+1]  - chunk pointer from csr_tosell_pass1()
+ *
+ * Output Arguments:
+ *   I  Bj[Bp[n_chunks]] - column indices
+ *   T  Bx[Bp[n_chunks]] - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj, Bx must be preallocated
+ *   Duplicate entries in A are not merged.
+ *   Explicit zeros in A are carried over to B.
+ *   Padding entries have column index -1 and value 0.
+ *
+ *   Complexity: Linear.  Specifically O(Bp[n_chunks] + n_row)
+ *
+ */
+template <class I, class T>
+struct csr_tosell_kernel
+{
+    I n_row;
+    I C;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * perm;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I chunk_start, const I chunk_end)
+    {
+        std::fill(Bj + Bp[chunk_start], Bj + Bp[chunk_end], -1);
+        std::fill(Bx + Bp[chunk_start], Bx + Bp[chunk_end], 0);
+
+        for(I c = chunk_start; c < chunk_end; c++){
+            const I lanes = std::min(C, n_row - C*c);
+            for(I r = 0; r < lanes; r++){
+                const I i = perm[C*c + r];
+                I n = Bp[c] + r;
+                for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                    Bj[n] = Aj[jj];
+                    Bx[n] = Ax[jj];
+                    n += C;
+                }
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void csr_tosell(const I n_row,
+                const I n_col,
+                const I Ap[],
+                const I Aj[],
+                const T Ax[],
+                const I C,
+                const I perm[],
+                const I Bp[],
+                      I Bj[],
+                      T Bx[])
+{
+    const I n_chunks = (n_row + C - 1) / C;
+
+    csr_tosell_kernel<I,T> kernel = {n_row, C, Ap, Aj, Ax, perm, Bp, Bj, Bx};
+    parallel_for_rows(n_chunks, Bp, kernel);
+}
+
+
 /*
  * Compute C = A*B for CSR matrices A,B
  *
@@ -493,16 +792,23 @@ void csr_toell(const I n_row,
  * Note:
  *   Output arrays Cp, Cj, and Cx must be preallocated
  *   The value of nnz(C) will be stored in Ap[n_row] after the first pass.
+ *   The second pass requires the Cp[] computed by the first pass.
  *
  * Note: 
  *   Input:  A and B column indices *are not* assumed to be in sorted order 
  *   Output: C column indices *are not* assumed to be in sorted order
+ *           (use csr_matmat_pass2_sorted() to obtain sorted indices)
  *           Cx will not contain any zero entries
  *
  *   Complexity: O(n_row*K^2 + max(n_row,n_col)) 
  *                 where K is the maximum nnz in a row of A
  *                 and column of B.
  *
+ *   For large products both passes run in parallel.  The rows of C
+ *   are split into ranges with equal numbers of multiply-adds and each
+ *   thread uses its own workspace.  Pass 2 accumulates each row with
+ *   the method given by set_matmat_accumulator() (see MATMAT_AUTO).
+ *
  *
  *  This is an implementation of the SMMP algorithm:
  *
@@ -515,10 +821,156 @@ void csr_toell(const I n_row,
  */
 
 
+/*
+ * Number of multiply-adds for each row of C = A*B
+ *
+ * Output Arguments:
+ *   double  Wp[n_row+1] - cumulative work, row i of C needs
+ *                         Wp[i+1] - Wp[i] multiply-adds
+ */
+template <class I>
+struct csr_matmat_work_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const I * Bp;
+    double  * Wp;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            double work = 0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                work += Bp[j+1] - Bp[j];
+            }
+            Wp[i+1] = work;
+        }
+    }
+};
+
+template <class I>
+void csr_matmat_work(const I n_row,
+                     const I Ap[],
+                     const I Aj[],
+                     const I Bp[],
+                           double Wp[])
+{
+    csr_matmat_work_kernel<I> kernel = {Ap, Aj, Bp, Wp};
+    parallel_for_rows(n_row, Ap, kernel);
+
+    Wp[0] = 0;
+    for(I i = 0; i < n_row; i++){
+        Wp[i+1] += Wp[i];
+    }
+}
+
+
+/*
+ * Apply a row kernel of the matrix product C = A*B to all rows,
+ * balancing the number of multiply-adds between the threads.
+ * The work estimate is stored in the scratch array work.  Products
+ * that are small even if every row of B had n_col entries run
+ * serially without it.
+ */
+template <class I, class kernel_type>
+void csr_matmat_for_rows(const I n_row,
+                         const I n_col,
+                         const I Ap[],
+                         const I Aj[],
+                         const I Bp[],
+                         kernel_type& kernel,
+                         std::vector<double>& work)
+{
+    const double max_work = (double) Ap[n_row] * (double) n_col + (double) n_row;
+    if (parallel_num_chunks(max_work) <= 1){
+        kernel((I) 0, n_row);
+        return;
+    }
+
+    double * Wp = workspace_array(work, n_row + 1);
+    csr_matmat_work(n_row, Ap, Aj, Bp, Wp);
+    parallel_for_rows(n_row, Wp, kernel);
+}
+
+
 /*
  * Pass 1 computes CSR row pointer for the matrix product C = A * B
  *
+ * The *_impl versions of pass 1 and pass 2 take the workspace that
+ * holds their scratch arrays (see workspace.h), the others use the
+ * default workspace so that repeated products allocate nothing.
+ *
  */
+template <class I>
+struct csr_matmat_pass1_kernel
+{
+    I n_col;
+    const I * Ap;
+    const I * Aj;
+    const I * Bp;
+    const I * Bj;
+          I * Cp;
+    workspace< index_buffers<I> > * ws;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        // method that uses O(n) temp storage, the columns of a row
+        // are linked through next[] and unlinked again afterwards
+        workspace_lease< index_buffers<I> > lease(*ws);
+        I * next = workspace_array(lease->next, n_col, (I) -1);
+
+        for(I i = row_start; i < row_end; i++){
+            I head   = -2;
+            I length =  0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I k = Bj[kk];
+                    if(next[k] == -1){
+                        next[k] = head;
+                        head = k;
+                        length++;
+                    }
+                }
+            }         
+            Cp[i+1] = length;
+
+            for(I jj = 0; jj < length; jj++){
+                I temp = head;
+                head = next[head];
+                next[temp] = -1;
+            }
+        }
+
+        lease.done();
+    }
+};
+
+template <class I>
+void csr_matmat_pass1_impl(const I n_row,
+                           const I n_col, 
+                           const I Ap[], 
+                           const I Aj[], 
+                           const I Bp[],
+                           const I Bj[],
+                                 I Cp[],
+                           workspace< index_buffers<I> >& ws)
+{
+    workspace_lease< index_buffers<I> > lease(ws);
+
+    csr_matmat_pass1_kernel<I> kernel = {n_col, Ap, Aj, Bp, Bj, Cp, &ws};
+    csr_matmat_for_rows(n_row, n_col, Ap, Aj, Bp, kernel, lease->work);
+
+    // cumsum the nnz per row to get Cp[]
+    Cp[0] = 0;
+    for(I i = 0; i < n_row; i++){
+        Cp[i+1] += Cp[i];
+    }
+
+    lease.done();
+}
+
 template <class I>
 void csr_matmat_pass1(const I n_row,
                       const I n_col, 
@@ -528,31 +980,358 @@ void csr_matmat_pass1(const I n_row,
                       const I Bj[],
                             I Cp[])
 {
-    // method that uses O(n) temp storage
-    std::vector<I> mask(n_col, -1);
-    Cp[0] = 0;
+    csr_matmat_pass1_impl(n_row, n_col, Ap, Aj, Bp, Bj, Cp,
+                          default_workspace< index_buffers<I> >());
+}
 
-    I nnz = 0;
-    for(I i = 0; i < n_row; i++){
-        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
-            I j = Aj[jj];
-            for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
-                I k = Bj[kk];
-                if(mask[k] != i){
-                    mask[k] = i;                        
+
+/*
+ * Accumulators for the rows of C = A*B
+ *
+ *   MATMAT_DENSE - SMMP linked list over dense arrays of length n_col
+ *   MATMAT_HASH  - open addressing hash table sized to the row
+ *   MATMAT_ESC   - expand the products, sort them by column, and
+ *                  compress (sum) entries with equal columns
+ *   MATMAT_AUTO  - choose per row from the row counts of pass 1
+ *
+ * The dense accumulator is fastest while its O(n_col) workspace stays
+ * in cache.  When n_col is large and the rows of C are short the hash
+ * table and ESC accumulators only touch O(nnz) memory per row.
+ *
+ */
+enum { MATMAT_AUTO = 0, MATMAT_DENSE = 1, MATMAT_HASH = 2, MATMAT_ESC = 3 };
+
+inline int& matmat_accumulator_setting()
+{
+    static int accumulator = MATMAT_AUTO;
+    return accumulator;
+}
+
+inline int get_matmat_accumulator()
+{
+    return matmat_accumulator_setting();
+}
+
+// unknown values select MATMAT_AUTO
+inline void set_matmat_accumulator(const int accumulator)
+{
+    if (accumulator < MATMAT_AUTO || accumulator > MATMAT_ESC)
+        matmat_accumulator_setting() = MATMAT_AUTO;
+    else
+        matmat_accumulator_setting() = accumulator;
+}
+
+
+/*
+ * SpGEMM accumulators on the buffers of one thread.  Each row of C is
+ * accumulated and then written to Cj[], Cx[] starting at offset nnz,
+ * dropping zero entries.  The number of entries written is returned.
+ *
+ * Buffers are grown on first use and left in their idle state (see
+ * workspace.h) after every row.
+ *
+ */
+template <class I, class T>
+class csr_matmat_accumulator
+{
+    public:
+        csr_matmat_accumulator(const I n_col, const bool sorted,
+                               csr_buffers<I,T>& buffers)
+            : n_col(n_col), sorted(sorted), buffers(buffers), next(0), sums(0) {}
+
+        /*
+         * Choose the accumulator for a row of C with at most
+         * row_bound entries (the row count of pass 1)
+         */
+        int choose(const I row_bound) const
+        {
+            // dense workspace that fits in a typical L2 cache
+            const double dense_bytes = (double) n_col * (sizeof(I) + sizeof(T));
+            if (dense_bytes <= 256.0 * 1024.0 || 16 * (double) row_bound >= (double) n_col)
+                return MATMAT_DENSE;
+            if (row_bound <= 8)
+                return MATMAT_ESC;
+            return MATMAT_HASH;
+        }
+
+        I dense_row(const I i,
+                    const I Ap[], const I Aj[], const T Ax[],
+                    const I Bp[], const I Bj[], const T Bx[],
+                    const I nnz_start, I Cj[], T Cx[])
+        {
+            if (next == 0){
+                next = workspace_array(buffers.next, n_col, (I) -1);
+                sums = workspace_array(buffers.sums, n_col);
+            }
+
+            I head   = -2;
+            I length =  0;
+
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                T v = Ax[jj];
+
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I k = Bj[kk];
+
+                    sums[k] += v*Bx[kk];
+
+                    if(next[k] == -1){
+                        next[k] = head;                        
+                        head  = k;
+                        length++;
+                    }
+                }
+            }         
+
+            I nnz = nnz_start;
+
+            if(sorted){
+                // gather the column indices of the row, sort them,
+                // then write the nonzero values in that order
+                I * row_j = Cj + nnz_start;
+                for(I jj = 0; jj < length; jj++){
+                    row_j[jj] = head;
+
+                    I temp = head;                
+                    head = next[head];
+                    next[temp] = -1;
+                }
+
+                std::sort(row_j, row_j + length);
+
+                for(I jj = 0; jj < length; jj++){
+                    I k = row_j[jj];
+                    if(sums[k] != 0){
+                        Cj[nnz] = k;
+                        Cx[nnz] = sums[k];
+                        nnz++;
+                    }
+                    sums[k] = 0;
+                }
+            } else {
+                for(I jj = 0; jj < length; jj++){
+
+                    if(sums[head] != 0){
+                        Cj[nnz] = head;
+                        Cx[nnz] = sums[head];
+                        nnz++;
+                    }
+
+                    I temp = head;                
+                    head = next[head];
+
+                    next[temp] = -1; //clear arrays
+                    sums[temp] =  0;                              
+                }
+            }
+
+            return nnz - nnz_start;
+        }
+
+        I hash_row(const I i, const I row_bound,
+                   const I Ap[], const I Aj[], const T Ax[],
+                   const I Bp[], const I Bj[], const T Bx[],
+                   const I nnz_start, I Cj[], T Cx[])
+        {
+            // power of two table with load factor <= 1/2
+            std::size_t size = 16;
+            while (size < 2 * (std::size_t) row_bound)
+                size *= 2;
+            I * keys   = workspace_array(buffers.keys, size, (I) -1);
+            T * values = workspace_array(buffers.values, size);
+            const std::size_t mask = size - 1;
+
+            // the occupied slots of the table are recorded in slots[]
+            I * slots = Cj + nnz_start;
+            I length = 0;
+
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                T v = Ax[jj];
+
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    I k = Bj[kk];
+
+                    std::size_t h = ((std::size_t) k * 2654435761UL) & mask;
+                    while (keys[h] != k && keys[h] != -1)
+                        h = (h + 1) & mask;
+
+                    if (keys[h] == -1){
+                        keys[h] = k;
+                        slots[length++] = (I) h;
+                    }
+                    values[h] += v*Bx[kk];
+                }
+            }
+
+            if (sorted){
+                // order the occupied slots by column index
+                for(I n = 0; n < length; n++)
+                    slots[n] = keys[slots[n]];
+                std::sort(slots, slots + length);
+                for(I n = 0; n < length; n++){
+                    std::size_t h = ((std::size_t) slots[n] * 2654435761UL) & mask;
+                    while (keys[h] != slots[n])
+                        h = (h + 1) & mask;
+                    slots[n] = (I) h;
+                }
+            }
+
+            I nnz = nnz_start;
+            for(I n = 0; n < length; n++){
+                const std::size_t h = slots[n];
+                if (values[h] != 0){
+                    Cj[nnz] = keys[h];
+                    Cx[nnz] = values[h];
                     nnz++;
                 }
+                keys[h]   = -1;
+                values[h] = 0;
             }
-        }         
-        Cp[i+1] = nnz;
-    }
-}
+
+            return nnz - nnz_start;
+        }
+
+        I esc_row(const I i,
+                  const I Ap[], const I Aj[], const T Ax[],
+                  const I Bp[], const I Bj[], const T Bx[],
+                  const I nnz_start, I Cj[], T Cx[])
+        {
+            // expand
+            std::size_t n_products = 0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                n_products += Bp[j+1] - Bp[j];
+            }
+            std::pair<I,T> * products = workspace_array(buffers.products, n_products);
+
+            std::size_t n = 0;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                I j = Aj[jj];
+                T v = Ax[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    products[n++] = std::make_pair(Bj[kk], v*Bx[kk]);
+                }
+            }
+
+            // sort
+            std::sort(products, products + n_products, kv_pair_less<I,T>);
+
+            // compress
+            I nnz = nnz_start;
+            n = 0;
+            while (n < n_products){
+                const I k = products[n].first;
+                T sum = products[n].second;
+                n++;
+                while (n < n_products && products[n].first == k){
+                    sum += products[n].second;
+                    n++;
+                }
+                if (sum != 0){
+                    Cj[nnz] = k;
+                    Cx[nnz] = sum;
+                    nnz++;
+                }
+            }
+
+            return nnz - nnz_start;
+        }
+
+    private:
+        const I n_col;
+        const bool sorted;
+        csr_buffers<I,T>& buffers;
+
+        // MATMAT_DENSE
+        I * next;
+        T * sums;
+};
+
 
 /*
  * Pass 2 computes CSR entries for matrix C = A*B using the 
  * row pointer Cp[] computed in Pass 1.
  *
+ * Row i of C is written starting at Cj[Cp[i]], Cx[Cp[i]] and
+ * the number of entries kept (i.e. nonzero) is stored in row_nnz[i].
+ * When sorted is true the column indices of each row are sorted.
+ *
  */
+template <class I, class T>
+struct csr_matmat_pass2_kernel
+{
+    I n_col;
+    bool sorted;
+    int accumulator;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * Bp;
+    const I * Bj;
+    const T * Bx;
+    const I * Cp;
+          I * Cj;
+          T * Cx;
+          I * row_nnz;
+    workspace< csr_buffers<I,T> > * ws;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        workspace_lease< csr_buffers<I,T> > lease(*ws);
+        csr_matmat_accumulator<I,T> acc(n_col, sorted, *lease);
+
+        for(I i = row_start; i < row_end; i++){
+            const I row_bound = Cp[i+1] - Cp[i];
+
+            int method = accumulator;
+            if (method == MATMAT_AUTO)
+                method = acc.choose(row_bound);
+
+            if (method == MATMAT_DENSE)
+                row_nnz[i] = acc.dense_row(i, Ap, Aj, Ax, Bp, Bj, Bx, Cp[i], Cj, Cx);
+            else if (method == MATMAT_HASH)
+                row_nnz[i] = acc.hash_row(i, row_bound, Ap, Aj, Ax, Bp, Bj, Bx, Cp[i], Cj, Cx);
+            else
+                row_nnz[i] = acc.esc_row(i, Ap, Aj, Ax, Bp, Bj, Bx, Cp[i], Cj, Cx);
+        }
+
+        lease.done();
+    }
+};
+
+template <class I, class T>
+void csr_matmat_pass2_impl(const I n_row,
+                           const I n_col, 
+                           const I Ap[], 
+                           const I Aj[], 
+                           const T Ax[],
+                           const I Bp[],
+                           const I Bj[],
+                           const T Bx[],
+                                 I Cp[],
+                                 I Cj[],
+                                 T Cx[],
+                           const bool sorted,
+                           workspace< csr_buffers<I,T> >& ws)
+{
+    workspace_lease< csr_buffers<I,T> > lease(ws);
+    I * row_nnz = workspace_array(lease->row_nnz, n_row);
+
+    csr_matmat_pass2_kernel<I,T> kernel = {n_col, sorted,
+                                           get_matmat_accumulator(),
+                                           Ap, Aj, Ax,
+                                           Bp, Bj, Bx,
+                                           Cp, Cj, Cx,
+                                           row_nnz, &ws};
+    csr_matmat_for_rows(n_row, n_col, Ap, Aj, Bp, kernel, lease->work);
+
+    csr_compact_rows(n_row, Cp, Cj, Cx, row_nnz);
+
+    lease.done();
+}
+
 template <class I, class T>
 void csr_matmat_pass2(const I n_row,
       	              const I n_col, 
@@ -566,55 +1345,254 @@ void csr_matmat_pass2(const I n_row,
       	                    I Cj[],
       	                    T Cx[])
 {
-    std::vector<I> next(n_col,-1);
-    std::vector<T> sums(n_col, 0);
+    csr_matmat_pass2_impl(n_row, n_col, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, false,
+                          default_workspace< csr_buffers<I,T> >());
+}
 
-    I nnz = 0;
+/*
+ * Same as csr_matmat_pass2() except that the column indices
+ * of each row of C will be in sorted order.
+ *
+ */
+template <class I, class T>
+void csr_matmat_pass2_sorted(const I n_row,
+      	                     const I n_col, 
+      	                     const I Ap[], 
+      	                     const I Aj[], 
+      	                     const T Ax[],
+      	                     const I Bp[],
+      	                     const I Bj[],
+      	                     const T Bx[],
+      	                           I Cp[],
+      	                           I Cj[],
+      	                           T Cx[])
+{
+    csr_matmat_pass2_impl(n_row, n_col, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, true,
+                          default_workspace< csr_buffers<I,T> >());
+}
 
-    Cp[0] = 0;
 
-    for(I i = 0; i < n_row; i++){
-        I head   = -2;
-        I length =  0;
+/*
+ * Symbolic and numeric phases of C = A*B
+ *
+ * When A and B keep their sparsity patterns and only their values
+ * change, the pattern of C and the place in Cx where each product
+ * Ax[jj]*Bx[kk] is summed can be computed once (symbolic phase) and
+ * reused by every later product (numeric phase).
+ *
+ * The products of row i of A are numbered in the order
+ *
+ *   for jj in Ap[i] .. Ap[i+1]-1:
+ *       for kk in Bp[Aj[jj]] .. Bp[Aj[jj]+1]-1
+ *
+ * starting at Pp[i], and Pm[n] is the index in Cj, Cx of the n-th
+ * product.  Pp[n_row] is the total number of products.
+ *
+ * Unlike csr_matmat_pass2, C has the full structural pattern of the
+ * product, i.e. entries that happen to sum to zero are kept.
+ *
+ */
 
-        I jj_start = Ap[i];
-        I jj_end   = Ap[i+1];
-        for(I jj = jj_start; jj < jj_end; jj++){
-            I j = Aj[jj];
-            T v = Ax[jj];
+/*
+ * Product pointer Pp of the symbolic phase
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  Ap[n_row+1]     - row pointer of A
+ *   I  Aj[nnz(A)]      - column indices of A
+ *   I  Bp[?]           - row pointer of B
+ *
+ * Output Arguments:
+ *   I  Pp[n_row+1]     - product pointer
+ *
+ */
+template <class I>
+void csr_matmat_products(const I n_row,
+                         const I Ap[],
+                         const I Aj[],
+                         const I Bp[],
+                               I Pp[])
+{
+    Pp[0] = 0;
+    for(I i = 0; i < n_row; i++){
+        I n_products = Pp[i];
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            const I j = Aj[jj];
+            n_products += Bp[j+1] - Bp[j];
+        }
+        Pp[i+1] = n_products;
+    }
+}
 
-            I kk_start = Bp[j];
-            I kk_end   = Bp[j+1];
-            for(I kk = kk_start; kk < kk_end; kk++){
-                I k = Bj[kk];
+template <class I>
+struct csr_matmat_symbolic_kernel
+{
+    I n_col;
+    const I * Ap;
+    const I * Aj;
+    const I * Bp;
+    const I * Bj;
+    const I * Cp;
+          I * Cj;
+    const I * Pp;
+          I * Pm;
+    workspace< index_buffers<I> > * ws;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        // next[k] is -1 or the position of column k in the row of C
+        workspace_lease< index_buffers<I> > lease(*ws);
+        I * next = workspace_array(lease->next, n_col, (I) -1);
 
-                sums[k] += v*Bx[kk];
+        for(I i = row_start; i < row_end; i++){
+            I * row_j = Cj + Cp[i];
+            I length = 0;
 
-                if(next[k] == -1){
-                    next[k] = head;                        
-                    head  = k;
-                    length++;
+            // columns of the row, sorted
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    const I k = Bj[kk];
+                    if(next[k] == -1){
+                        next[k] = 0;
+                        row_j[length++] = k;
+                    }
                 }
             }
-        }         
+            std::sort(row_j, row_j + length);
 
-        for(I jj = 0; jj < length; jj++){
+            for(I n = 0; n < length; n++){
+                next[row_j[n]] = Cp[i] + n;
+            }
 
-            if(sums[head] != 0){
-                Cj[nnz] = head;
-                Cx[nnz] = sums[head];
-                nnz++;
+            // position of each product
+            I * row_m = Pm + Pp[i];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    *row_m++ = next[Bj[kk]];
+                }
             }
 
-            I temp = head;                
-            head = next[head];
+            for(I n = 0; n < length; n++){
+                next[row_j[n]] = -1;
+            }
+        }
+
+        lease.done();
+    }
+};
+
+/*
+ * Symbolic phase of C = A*B
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in B
+ *   I  Ap[n_row+1]     - row pointer of A
+ *   I  Aj[nnz(A)]      - column indices of A
+ *   I  Bp[?]           - row pointer of B
+ *   I  Bj[nnz(B)]      - column indices of B
+ *   I  Cp[n_row+1]     - row pointer of C (from csr_matmat_pass1)
+ *   I  Pp[n_row+1]     - product pointer (from csr_matmat_products)
+ *
+ * Output Arguments:
+ *   I  Cj[nnz(C)]      - column indices of C, sorted within each row
+ *   I  Pm[Pp[n_row]]   - position in Cj, Cx of each product
+ *
+ * Note:
+ *   Output arrays Cj and Pm must be preallocated
+ *
+ *   Complexity: O(Pp[n_row] + nnz(C) log(K)) where K is the
+ *               maximum nnz in a row of C
+ *
+ */
+template <class I>
+void csr_matmat_symbolic(const I n_row,
+                         const I n_col,
+                         const I Ap[],
+                         const I Aj[],
+                         const I Bp[],
+                         const I Bj[],
+                         const I Cp[],
+                               I Cj[],
+                         const I Pp[],
+                               I Pm[])
+{
+    csr_matmat_symbolic_kernel<I> kernel = {n_col, Ap, Aj, Bp, Bj, Cp, Cj, Pp, Pm,
+                                            &default_workspace< index_buffers<I> >()};
+    parallel_for_rows(n_row, Pp, kernel);
+}
+
+template <class I, class T>
+struct csr_matmat_numeric_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * Bp;
+    const T * Bx;
+    const I * Cp;
+    const I * Pp;
+    const I * Pm;
+          T * Cx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        std::fill(Cx + Cp[row_start], Cx + Cp[row_end], T(0));
 
-            next[temp] = -1; //clear arrays
-            sums[temp] =  0;                              
+        for(I i = row_start; i < row_end; i++){
+            const I * row_m = Pm + Pp[i];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                const T v = Ax[jj];
+                for(I kk = Bp[j]; kk < Bp[j+1]; kk++){
+                    Cx[*row_m++] += v*Bx[kk];
+                }
+            }
         }
-
-        Cp[i+1] = nnz;
     }
+};
+
+/*
+ * Numeric phase of C = A*B
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in B
+ *   I  Ap[n_row+1]     - row pointer of A
+ *   I  Aj[nnz(A)]      - column indices of A
+ *   T  Ax[nnz(A)]      - nonzeros of A
+ *   I  Bp[?]           - row pointer of B
+ *   T  Bx[nnz(B)]      - nonzeros of B
+ *   I  Cp[n_row+1]     - row pointer of C
+ *   I  Pp[n_row+1]     - product pointer
+ *   I  Pm[Pp[n_row]]   - position of each product (csr_matmat_symbolic)
+ *
+ * Output Arguments:
+ *   T  Cx[nnz(C)]      - nonzeros of C
+ *
+ * Note:
+ *   A and B must have the patterns used by the symbolic phase
+ *
+ *   Complexity: O(Pp[n_row] + nnz(C))
+ *
+ */
+template <class I, class T>
+void csr_matmat_numeric(const I n_row,
+                        const I n_col,
+                        const I Ap[],
+                        const I Aj[],
+                        const T Ax[],
+                        const I Bp[],
+                        const T Bx[],
+                        const I Cp[],
+                        const I Pp[],
+                        const I Pm[],
+                              T Cx[])
+{
+    csr_matmat_numeric_kernel<I,T> kernel = {Ap, Aj, Ax, Bp, Bx, Cp, Pp, Pm, Cx};
+    parallel_for_rows(n_row, Pp, kernel);
 }
 
 
@@ -636,19 +1614,24 @@ void csr_matmat_pass2(const I n_row,
  *   Output: C column indices are not generally in sorted order
  *           C will not contain any duplicate entries or explicit zeros.
  *
+ *   The scratch rows of length n_col are taken from workspace ws
+ *   (see workspace.h), by default the one shared by all calls.
+ *
  */
 template <class I, class T, class binary_op>
 void csr_binop_csr_general(const I n_row, const I n_col, 
                            const I Ap[], const I Aj[], const T Ax[],
                            const I Bp[], const I Bj[], const T Bx[],
                                  I Cp[],       I Cj[],       T Cx[],
-                           const binary_op& op)
+                           const binary_op& op,
+                           workspace< csr_buffers<I,T> >& ws)
 {
     //Method that works for duplicate and/or unsorted indices
 
-    std::vector<I>  next(n_col,-1);
-    std::vector<T> A_row(n_col, 0);
-    std::vector<T> B_row(n_col, 0);
+    workspace_lease< csr_buffers<I,T> > lease(ws);
+    I * next  = workspace_array(lease->next,  n_col, (I) -1);
+    T * A_row = workspace_array(lease->sums,  n_col);
+    T * B_row = workspace_array(lease->sums2, n_col);
 
     I nnz = 0;
     Cp[0] = 0;
@@ -709,6 +1692,19 @@ void csr_binop_csr_general(const I n_row, const I n_col,
 
         Cp[i + 1] = nnz;
     }
+
+    lease.done();
+}
+
+template <class I, class T, class binary_op>
+void csr_binop_csr_general(const I n_row, const I n_col, 
+                           const I Ap[], const I Aj[], const T Ax[],
+                           const I Bp[], const I Bj[], const T Bx[],
+                                 I Cp[],       I Cj[],       T Cx[],
+                           const binary_op& op)
+{
+    csr_binop_csr_general(n_row, n_col, Ap, Aj, Ax, Bp, Bj, Bx, Cp, Cj, Cx, op,
+                          default_workspace< csr_buffers<I,T> >());
 }
 
 
@@ -1004,8 +2000,32 @@ void csr_eliminate_zeros(const I n_row,
  *   Output array Yx must be preallocated
  *
  *   Complexity: Linear.  Specifically O(nnz(A) + n_row)
+ *
+ *   Large matrices are processed in parallel by splitting the rows
+ *   into ranges with equal numbers of nonzeros (see parallel.h).
  * 
  */
+template <class I, class T, class V>
+struct csr_matvec_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const V * Xx;
+          V * Yx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            V sum = Yx[i];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                sum += V(Ax[jj]) * Xx[Aj[jj]];
+            }
+            Yx[i] = sum;
+        }
+    }
+};
+
 template <class I, class T>
 void csr_matvec(const I n_row,
 	            const I n_col, 
@@ -1015,13 +2035,27 @@ void csr_matvec(const I n_row,
 	            const T Xx[],
 	                  T Yx[])
 {
-    for(I i = 0; i < n_row; i++){
-        T sum = Yx[i];
-        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
-            sum += Ax[jj] * Xx[Aj[jj]];
-        }
-        Yx[i] = sum;
-    }
+    csr_matvec_kernel<I,T,T> kernel = {Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_row, Ap, kernel);
+}
+
+/*
+ * Compute Y += A*X as in csr_matvec() for nonzeros Ax[] of type T and
+ * vectors Xx[], Yx[] of a wider type V, e.g. float and double.  The
+ * products and sums are formed in type V, so A can be stored in half
+ * the memory without losing accuracy in the accumulation.
+ */
+template <class I, class T, class V>
+void csr_matvec_mixed(const I n_row,
+	                  const I n_col, 
+	                  const I Ap[], 
+	                  const I Aj[], 
+	                  const T Ax[],
+	                  const V Xx[],
+	                        V Yx[])
+{
+    csr_matvec_kernel<I,T,V> kernel = {Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_row, Ap, kernel);
 }
 
 
@@ -1041,7 +2075,34 @@ void csr_matvec(const I n_row,
  * Output Arguments:
  *   T  Yx[n_row,n_vecs] - output vector
  *
+ * Note:
+ *   Rows are processed in parallel as in csr_matvec()
+ *
  */
+template <class I, class T, class V>
+struct csr_matvecs_kernel
+{
+    I n_vecs;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const V * Xx;
+          V * Yx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            V * y = Yx + n_vecs * i;
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                const T a = Ax[jj];
+                const V * x = Xx + n_vecs * j;
+                axpy(n_vecs, a, x, y);
+            }
+        }
+    }
+};
+
 template <class I, class T>
 void csr_matvecs(const I n_row,
 	             const I n_col, 
@@ -1052,15 +2113,26 @@ void csr_matvecs(const I n_row,
 	             const T Xx[],
 	                   T Yx[])
 {
-    for(I i = 0; i < n_row; i++){
-        T * y = Yx + n_vecs * i;
-        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
-            const I j = Aj[jj];
-            const T a = Ax[jj];
-            const T * x = Xx + n_vecs * j;
-            axpy(n_vecs, a, x, y);
-        }
-    }
+    csr_matvecs_kernel<I,T,T> kernel = {n_vecs, Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_row, Ap, kernel, (double) n_vecs);
+}
+
+/*
+ * Compute Y += A*X as in csr_matvecs() with nonzeros of type T and
+ * vectors of type V, see csr_matvec_mixed()
+ */
+template <class I, class T, class V>
+void csr_matvecs_mixed(const I n_row,
+	                   const I n_col, 
+                       const I n_vecs,
+	                   const I Ap[], 
+	                   const I Aj[], 
+	                   const T Ax[],
+	                   const V Xx[],
+	                         V Yx[])
+{
+    csr_matvecs_kernel<I,T,V> kernel = {n_vecs, Ap, Aj, Ax, Xx, Yx};
+    parallel_for_rows(n_row, Ap, kernel, (double) n_vecs);
 }
 
 
@@ -1120,6 +2192,442 @@ void get_csr_submatrix(const I n_row,
 }
 
 
+/*
+ * Count the entries of B = A[ir0:ir1, ic0:ic1] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   I  ir0, ir1        - range of rows
+ *   I  ic0, ic1        - range of columns
+ *
+ * Output Arguments:
+ *   I  Bp[ir1-ir0+1]   - row pointer of B
+ *
+ * Note:
+ *   Output array Bp must be preallocated
+ *
+ *   Together with csr_submatrix this replaces get_csr_submatrix, but
+ *   writes into arrays allocated by the caller and counts and copies
+ *   the rows in parallel.  A row range with all columns needs neither
+ *   function: Aj and Ax can be shared and only Ap has to be shifted.
+ *
+ */
+template <class I>
+struct csr_submatrix_count_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    I ir0, ic0, ic1;
+          I * Bp;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            I row_nnz = 0;
+            for(I jj = Ap[ir0 + i]; jj < Ap[ir0 + i + 1]; jj++){
+                if (Aj[jj] >= ic0 && Aj[jj] < ic1)
+                    row_nnz++;
+            }
+            Bp[i + 1] = row_nnz;
+        }
+    }
+};
+
+template <class I>
+void csr_submatrix_count(const I Ap[],
+                         const I Aj[],
+                         const I ir0,
+                         const I ir1,
+                         const I ic0,
+                         const I ic1,
+                               I Bp[])
+{
+    const I new_n_row = ir1 - ir0;
+
+    csr_submatrix_count_kernel<I> kernel = {Ap, Aj, ir0, ic0, ic1, Bp};
+    parallel_for_rows(new_n_row, Ap + ir0, kernel);
+
+    Bp[0] = 0;
+    for(I i = 0; i < new_n_row; i++)
+        Bp[i + 1] += Bp[i];
+}
+
+/*
+ * Compute B = A[ir0:ir1, ic0:ic1] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  ir0, ir1        - range of rows
+ *   I  ic0, ic1        - range of columns
+ *   I  Bp[ir1-ir0+1]   - row pointer of B (see csr_submatrix_count)
+ *
+ * Output Arguments:
+ *   I  Bj[nnz(B)]      - column indices
+ *   T  Bx[nnz(B)]      - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj and Bx must be preallocated
+ *
+ */
+template <class I, class T>
+struct csr_submatrix_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    I ir0, ic0, ic1;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            I nnz = Bp[i];
+            for(I jj = Ap[ir0 + i]; jj < Ap[ir0 + i + 1]; jj++){
+                if (Aj[jj] >= ic0 && Aj[jj] < ic1){
+                    Bj[nnz] = Aj[jj] - ic0;
+                    Bx[nnz] = Ax[jj];
+                    nnz++;
+                }
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void csr_submatrix(const I Ap[],
+                   const I Aj[],
+                   const T Ax[],
+                   const I ir0,
+                   const I ir1,
+                   const I ic0,
+                   const I ic1,
+                   const I Bp[],
+                         I Bj[],
+                         T Bx[])
+{
+    csr_submatrix_kernel<I,T> kernel = {Ap, Aj, Ax, ir0, ic0, ic1, Bp, Bj, Bx};
+    parallel_for_rows(ir1 - ir0, Ap + ir0, kernel);
+}
+
+
+/*
+ * Count the entries of B = A[rows, :] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_idx           - number of selected rows
+ *   I  rows[n_idx]     - selected rows, any order and with repeats
+ *   I  Ap[n_row+1]     - row pointer
+ *
+ * Output Arguments:
+ *   I  Bp[n_idx+1]     - row pointer of B
+ *
+ * Note:
+ *   Output array Bp must be preallocated.  The indices in rows must be
+ *   in range.
+ *
+ */
+template <class I>
+struct csr_row_index_count_kernel
+{
+    const I * rows;
+    const I * Ap;
+          I * Bp;
+
+    void operator()(const I start, const I end)
+    {
+        for(I k = start; k < end; k++)
+            Bp[k + 1] = Ap[rows[k] + 1] - Ap[rows[k]];
+    }
+};
+
+template <class I>
+void csr_row_index_count(const I n_idx,
+                         const I rows[],
+                         const I Ap[],
+                               I Bp[])
+{
+    csr_row_index_count_kernel<I> kernel = {rows, Ap, Bp};
+    parallel_for_range(n_idx, kernel);
+
+    Bp[0] = 0;
+    for(I k = 0; k < n_idx; k++)
+        Bp[k + 1] += Bp[k];
+}
+
+/*
+ * Compute B = A[rows, :] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_idx           - number of selected rows
+ *   I  rows[n_idx]     - selected rows
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  Bp[n_idx+1]     - row pointer of B (see csr_row_index_count)
+ *
+ * Output Arguments:
+ *   I  Bj[nnz(B)]      - column indices
+ *   T  Bx[nnz(B)]      - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj and Bx must be preallocated
+ *
+ */
+template <class I, class T>
+struct csr_row_index_kernel
+{
+    const I * rows;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I start, const I end)
+    {
+        for(I k = start; k < end; k++){
+            const I row_start = Ap[rows[k]];
+            const I row_end   = Ap[rows[k] + 1];
+            std::copy(Aj + row_start, Aj + row_end, Bj + Bp[k]);
+            std::copy(Ax + row_start, Ax + row_end, Bx + Bp[k]);
+        }
+    }
+};
+
+template <class I, class T>
+void csr_row_index(const I n_idx,
+                   const I rows[],
+                   const I Ap[],
+                   const I Aj[],
+                   const T Ax[],
+                   const I Bp[],
+                         I Bj[],
+                         T Bx[])
+{
+    csr_row_index_kernel<I,T> kernel = {rows, Ap, Aj, Ax, Bp, Bj, Bx};
+    parallel_for_rows(n_idx, Bp, kernel);
+}
+
+
+/*
+ * Count the entries of B = A[:, cols] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_idx           - number of selected columns
+ *   I  cols[n_idx]     - selected columns, any order and with repeats
+ *   I  n_row           - number of rows in A
+ *   I  n_col           - number of columns in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *
+ * Output Arguments:
+ *   I  col_offsets[n_col+1] - column j of A is column col_order[k] of
+ *                             B for col_offsets[j] <= k < col_offsets[j+1]
+ *   I  col_order[n_idx]     - positions in cols, sorted by column
+ *   I  Bp[n_row+1]          - row pointer of B
+ *
+ * Note:
+ *   Output arrays must be preallocated.  The indices in cols must be
+ *   in range.
+ *
+ *   Complexity: O(n_idx + n_col + nnz(A)), the rows are counted in
+ *   parallel
+ *
+ */
+template <class I>
+struct csr_column_index_count_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const I * col_offsets;
+          I * Bp;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            I row_nnz = 0;
+            for(I jj = Ap[i]; jj < Ap[i + 1]; jj++)
+                row_nnz += col_offsets[Aj[jj] + 1] - col_offsets[Aj[jj]];
+            Bp[i + 1] = row_nnz;
+        }
+    }
+};
+
+template <class I>
+void csr_column_index_count(const I n_idx,
+                            const I cols[],
+                            const I n_row,
+                            const I n_col,
+                            const I Ap[],
+                            const I Aj[],
+                                  I col_offsets[],
+                                  I col_order[],
+                                  I Bp[])
+{
+    // counting sort of the positions in cols
+    std::fill(col_offsets, col_offsets + n_col + 1, 0);
+    for(I k = 0; k < n_idx; k++)
+        col_offsets[cols[k] + 1]++;
+    for(I j = 0; j < n_col; j++)
+        col_offsets[j + 1] += col_offsets[j];
+
+    std::vector<I> next(col_offsets, col_offsets + n_col);
+    for(I k = 0; k < n_idx; k++)
+        col_order[next[cols[k]]++] = k;
+
+    csr_column_index_count_kernel<I> kernel = {Ap, Aj, col_offsets, Bp};
+    parallel_for_rows(n_row, Ap, kernel);
+
+    Bp[0] = 0;
+    for(I i = 0; i < n_row; i++)
+        Bp[i + 1] += Bp[i];
+}
+
+/*
+ * Compute B = A[:, cols] for CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_row                - number of rows in A
+ *   I  Ap[n_row+1]          - row pointer
+ *   I  Aj[nnz(A)]           - column indices
+ *   T  Ax[nnz(A)]           - nonzeros
+ *   I  col_offsets[n_col+1] - see csr_column_index_count
+ *   I  col_order[n_idx]     - see csr_column_index_count
+ *   I  Bp[n_row+1]          - row pointer of B
+ *
+ * Output Arguments:
+ *   I  Bj[nnz(B)]      - column indices
+ *   T  Bx[nnz(B)]      - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj and Bx must be preallocated
+ *
+ *   The entries of a row of B follow the entries of A they come from,
+ *   so B has sorted indices if A has and cols is increasing.
+ *
+ */
+template <class I, class T>
+struct csr_column_index_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * col_offsets;
+    const I * col_order;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I i = row_start; i < row_end; i++){
+            I nnz = Bp[i];
+            for(I jj = Ap[i]; jj < Ap[i + 1]; jj++){
+                const I j = Aj[jj];
+                for(I k = col_offsets[j]; k < col_offsets[j + 1]; k++){
+                    Bj[nnz] = col_order[k];
+                    Bx[nnz] = Ax[jj];
+                    nnz++;
+                }
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void csr_column_index(const I n_row,
+                      const I Ap[],
+                      const I Aj[],
+                      const T Ax[],
+                      const I col_offsets[],
+                      const I col_order[],
+                      const I Bp[],
+                            I Bj[],
+                            T Bx[])
+{
+    csr_column_index_kernel<I,T> kernel = {Ap, Aj, Ax, col_offsets, col_order,
+                                           Bp, Bj, Bx};
+    parallel_for_rows(n_row, Bp, kernel);
+}
+
+
+/*
+ * Compute B = A[perm,:][:,perm] for square CSR matrix A, i.e. apply
+ * the same permutation to the rows and the columns
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows (and columns) in A
+ *   I  Ap[n_row+1]     - row pointer
+ *   I  Aj[nnz(A)]      - column indices
+ *   T  Ax[nnz(A)]      - nonzeros
+ *   I  perm[n_row]     - row (and column) of A that becomes row k of B
+ *
+ * Output Arguments:
+ *   I  Bp[n_row+1]     - row pointer
+ *   I  Bj[nnz(A)]      - column indices
+ *   T  Bx[nnz(A)]      - nonzeros
+ *
+ * Note:
+ *   Output arrays must be preallocated
+ *   perm must be a permutation of 0 .. n_row-1
+ *   The column indices of B are not sorted
+ *
+ */
+template <class I, class T>
+struct csr_permute_symmetric_kernel
+{
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * perm;
+    const I * iperm;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        for(I k = row_start; k < row_end; k++){
+            const I i = perm[k];
+            I nnz = Bp[k];
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                Bj[nnz] = iperm[Aj[jj]];
+                Bx[nnz] = Ax[jj];
+                nnz++;
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void csr_permute_symmetric(const I n_row,
+                           const I Ap[],
+                           const I Aj[],
+                           const T Ax[],
+                           const I perm[],
+                                 I Bp[],
+                                 I Bj[],
+                                 T Bx[])
+{
+    std::vector<I> iperm(n_row + 1);
+
+    Bp[0] = 0;
+    for(I k = 0; k < n_row; k++){
+        iperm[perm[k]] = k;
+        Bp[k + 1] = Bp[k] + Ap[perm[k] + 1] - Ap[perm[k]];
+    }
+
+    csr_permute_symmetric_kernel<I,T> kernel = {Ap, Aj, Ax, perm, &iperm[0],
+                                                Bp, Bj, Bx};
+    parallel_for_rows(n_row, Bp, kernel);
+}
+
 /*
  * Count the number of occupied diagonals in CSR matrix A
  *
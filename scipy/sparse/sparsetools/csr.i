@@ -6,22 +6,35 @@
 #include "csr.h"
 %}
 
+%ignore matmat_accumulator_setting;
+
 %include "csr.h" 
+%include "sell.h"
 
 
 INSTANTIATE_INDEX(expandptr)
 INSTANTIATE_INDEX(csr_matmat_pass1)
 INSTANTIATE_INDEX(csr_count_blocks)
 INSTANTIATE_INDEX(csr_has_sorted_indices)
+INSTANTIATE_INDEX(csr_tosell_pass1)
+INSTANTIATE_INDEX(csr_matmat_products)
+INSTANTIATE_INDEX(csr_matmat_symbolic)
+INSTANTIATE_INDEX(csr_submatrix_count)
+INSTANTIATE_INDEX(csr_row_index_count)
+INSTANTIATE_INDEX(csr_column_index_count)
 
 INSTANTIATE_ALL(csr_diagonal)
 INSTANTIATE_ALL(csr_scale_rows)
 INSTANTIATE_ALL(csr_scale_columns)
 INSTANTIATE_ALL(csr_tocsc)
 INSTANTIATE_ALL(csr_tobsr)
+INSTANTIATE_ALL(csr_tosell)
 INSTANTIATE_ALL(csr_matmat_pass2)
+INSTANTIATE_ALL(csr_matmat_pass2_sorted)
+INSTANTIATE_ALL(csr_matmat_numeric)
 INSTANTIATE_ALL(csr_matvec)
 INSTANTIATE_ALL(csr_matvecs)
+INSTANTIATE_ALL(sell_matvec)
 INSTANTIATE_ALL(csr_elmul_csr)
 INSTANTIATE_ALL(csr_eldiv_csr)
 INSTANTIATE_ALL(csr_plus_csr)
@@ -29,6 +42,89 @@ INSTANTIATE_ALL(csr_minus_csr)
 INSTANTIATE_ALL(csr_sort_indices)
 INSTANTIATE_ALL(csr_eliminate_zeros)
 INSTANTIATE_ALL(csr_sum_duplicates)
+INSTANTIATE_ALL(csr_canonicalize)
 INSTANTIATE_ALL(get_csr_submatrix)
+INSTANTIATE_ALL(csr_submatrix)
+INSTANTIATE_ALL(csr_row_index)
+INSTANTIATE_ALL(csr_column_index)
+INSTANTIATE_ALL(csr_permute_symmetric)
 INSTANTIATE_ALL(csr_sample_values)
 
+INSTANTIATE_MIXED(csr_matvec_mixed)
+INSTANTIATE_MIXED(csr_matvecs_mixed)
+
+
+%pythoncode %{
+import numpy as _np
+
+class csr_matmat_plan(object):
+    """Symbolic phase of the sparse matrix product C = A*B
+
+    The plan records the pattern of C and, for each product of an
+    entry of A and an entry of B, the position in C where it is
+    summed.  As long as A and B keep the patterns the plan was made
+    for, numeric() computes the values of C without repeating the
+    symbolic work.
+
+    Parameters
+    ----------
+    n_row, n_col : int
+        shape of C
+    Ap, Aj : arrays
+        row pointer and column indices of A in CSR format
+    Bp, Bj : arrays
+        row pointer and column indices of B in CSR format
+
+    All index arrays must have the same dtype, which must be large
+    enough to hold the number of products (see products).
+
+    Attributes
+    ----------
+    indptr, indices : arrays
+        pattern of C, with sorted column indices.  Entries whose
+        products sum to zero are kept.
+    products : int
+        number of products of entries of A and B
+
+    """
+    def __init__(self, n_row, n_col, Ap, Aj, Bp, Bj):
+        idx_dtype = Ap.dtype
+
+        self.shape = (n_row, n_col)
+        self._pattern = (Ap.copy(), Aj.copy(), Bp.copy(), Bj.copy())
+
+        self.indptr = _np.empty(n_row + 1, dtype=idx_dtype)
+        csr_matmat_pass1(n_row, n_col, Ap, Aj, Bp, Bj, self.indptr)
+
+        self._Pp = _np.empty(n_row + 1, dtype=idx_dtype)
+        csr_matmat_products(n_row, Ap, Aj, Bp, self._Pp)
+        self.products = int(self._Pp[-1])
+
+        self.indices = _np.empty(self.indptr[-1], dtype=idx_dtype)
+        self._Pm     = _np.empty(self.products,   dtype=idx_dtype)
+        csr_matmat_symbolic(n_row, n_col, Ap, Aj, Bp, Bj,
+                            self.indptr, self.indices, self._Pp, self._Pm)
+
+    def matches(self, Ap, Aj, Bp, Bj):
+        """Return whether A and B have the patterns of the plan"""
+        for old, new in zip(self._pattern, (Ap, Aj, Bp, Bj)):
+            if old.shape != new.shape or not _np.array_equal(old, new):
+                return False
+        return True
+
+    def numeric(self, Ax, Bx, Cx=None):
+        """Compute the values of C = A*B
+
+        Ax and Bx are the values of A and B, whose patterns must be
+        those of the plan.  The values are written to Cx, if given,
+        and returned.
+        """
+        if Cx is None:
+            dtype = _np.find_common_type([Ax.dtype, Bx.dtype], [])
+            Cx = _np.empty(len(self.indices), dtype=dtype)
+
+        Ap, Aj, Bp, Bj = self._pattern
+        csr_matmat_numeric(self.shape[0], self.shape[1], Ap, Aj, Ax, Bp, Bx,
+                           self.indptr, self._Pp, self._Pm, Cx)
+        return Cx
+%}
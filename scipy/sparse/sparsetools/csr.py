@@ -67,25 +67,198 @@ except AttributeError:
 
 
 
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _csr.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _csr.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _csr.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _csr.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _csr.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _csr.clear_workspaces(*args)
+
+MATMAT_AUTO = _csr.MATMAT_AUTO
+MATMAT_DENSE = _csr.MATMAT_DENSE
+MATMAT_HASH = _csr.MATMAT_HASH
+MATMAT_ESC = _csr.MATMAT_ESC
+def get_matmat_accumulator(*args):
+  """get_matmat_accumulator() -> int"""
+  return _csr.get_matmat_accumulator(*args)
+
+def set_matmat_accumulator(*args):
+  """set_matmat_accumulator(int accumulator)"""
+  return _csr.set_matmat_accumulator(*args)
+
+import numpy as _np
+
+class csr_matmat_plan(object):
+    """Symbolic phase of the sparse matrix product C = A*B
+
+    The plan records the pattern of C and, for each product of an
+    entry of A and an entry of B, the position in C where it is
+    summed.  As long as A and B keep the patterns the plan was made
+    for, numeric() computes the values of C without repeating the
+    symbolic work.
+
+    Parameters
+    ----------
+    n_row, n_col : int
+        shape of C
+    Ap, Aj : arrays
+        row pointer and column indices of A in CSR format
+    Bp, Bj : arrays
+        row pointer and column indices of B in CSR format
+
+    All index arrays must have the same dtype, which must be large
+    enough to hold the number of products (see products).
+
+    Attributes
+    ----------
+    indptr, indices : arrays
+        pattern of C, with sorted column indices.  Entries whose
+        products sum to zero are kept.
+    products : int
+        number of products of entries of A and B
+
+    """
+    def __init__(self, n_row, n_col, Ap, Aj, Bp, Bj):
+        idx_dtype = Ap.dtype
+
+        self.shape = (n_row, n_col)
+        self._pattern = (Ap.copy(), Aj.copy(), Bp.copy(), Bj.copy())
+
+        self.indptr = _np.empty(n_row + 1, dtype=idx_dtype)
+        csr_matmat_pass1(n_row, n_col, Ap, Aj, Bp, Bj, self.indptr)
+
+        self._Pp = _np.empty(n_row + 1, dtype=idx_dtype)
+        csr_matmat_products(n_row, Ap, Aj, Bp, self._Pp)
+        self.products = int(self._Pp[-1])
+
+        self.indices = _np.empty(self.indptr[-1], dtype=idx_dtype)
+        self._Pm     = _np.empty(self.products,   dtype=idx_dtype)
+        csr_matmat_symbolic(n_row, n_col, Ap, Aj, Bp, Bj,
+                            self.indptr, self.indices, self._Pp, self._Pm)
+
+    def matches(self, Ap, Aj, Bp, Bj):
+        """Return whether A and B have the patterns of the plan"""
+        for old, new in zip(self._pattern, (Ap, Aj, Bp, Bj)):
+            if old.shape != new.shape or not _np.array_equal(old, new):
+                return False
+        return True
+
+    def numeric(self, Ax, Bx, Cx=None):
+        """Compute the values of C = A*B
+
+        Ax and Bx are the values of A and B, whose patterns must be
+        those of the plan.  The values are written to Cx, if given,
+        and returned.
+        """
+        if Cx is None:
+            dtype = _np.find_common_type([Ax.dtype, Bx.dtype], [])
+            Cx = _np.empty(len(self.indices), dtype=dtype)
+
+        Ap, Aj, Bp, Bj = self._pattern
+        csr_matmat_numeric(self.shape[0], self.shape[1], Ap, Aj, Ax, Bp, Bx,
+                           self.indptr, self._Pp, self._Pm, Cx)
+        return Cx
+
+
 def expandptr(*args):
-  """expandptr(int n_row, int Ap, int Bi)"""
+  """
+    expandptr(int n_row, int Ap, int Bi)
+    expandptr(npy_int64 n_row, npy_int64 Ap, npy_int64 Bi)
+    """
   return _csr.expandptr(*args)
 
 def csr_matmat_pass1(*args):
   """
     csr_matmat_pass1(int n_row, int n_col, int Ap, int Aj, int Bp, int Bj, 
         int Cp)
+    csr_matmat_pass1(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_int64 Bp, npy_int64 Bj, npy_int64 Cp)
     """
   return _csr.csr_matmat_pass1(*args)
 
 def csr_count_blocks(*args):
-  """csr_count_blocks(int n_row, int n_col, int R, int C, int Ap, int Aj) -> int"""
+  """
+    csr_count_blocks(int n_row, int n_col, int R, int C, int Ap, int Aj) -> int
+    csr_count_blocks(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj) -> npy_int64
+    """
   return _csr.csr_count_blocks(*args)
 
 def csr_has_sorted_indices(*args):
-  """csr_has_sorted_indices(int n_row, int Ap, int Aj) -> bool"""
+  """
+    csr_has_sorted_indices(int n_row, int Ap, int Aj) -> bool
+    csr_has_sorted_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj) -> bool
+    """
   return _csr.csr_has_sorted_indices(*args)
 
+def csr_tosell_pass1(*args):
+  """
+    csr_tosell_pass1(int n_row, int Ap, int C, int sigma, int perm, int Bp)
+    csr_tosell_pass1(npy_int64 n_row, npy_int64 Ap, npy_int64 C, npy_int64 sigma, 
+        npy_int64 perm, npy_int64 Bp)
+    """
+  return _csr.csr_tosell_pass1(*args)
+
+def csr_matmat_products(*args):
+  """
+    csr_matmat_products(int n_row, int Ap, int Aj, int Bp, int Pp)
+    csr_matmat_products(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_int64 Bp, 
+        npy_int64 Pp)
+    """
+  return _csr.csr_matmat_products(*args)
+
+def csr_matmat_symbolic(*args):
+  """
+    csr_matmat_symbolic(int n_row, int n_col, int Ap, int Aj, int Bp, int Bj, 
+        int Cp, int Cj, int Pp, int Pm)
+    csr_matmat_symbolic(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_int64 Bp, npy_int64 Bj, npy_int64 Cp, 
+        npy_int64 Cj, npy_int64 Pp, npy_int64 Pm)
+    """
+  return _csr.csr_matmat_symbolic(*args)
+
+def csr_submatrix_count(*args):
+  """
+    csr_submatrix_count(int Ap, int Aj, int ir0, int ir1, int ic0, int ic1, 
+        int Bp)
+    csr_submatrix_count(npy_int64 Ap, npy_int64 Aj, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1, npy_int64 Bp)
+    """
+  return _csr.csr_submatrix_count(*args)
+
+def csr_row_index_count(*args):
+  """
+    csr_row_index_count(int n_idx, int rows, int Ap, int Bp)
+    csr_row_index_count(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Bp)
+    """
+  return _csr.csr_row_index_count(*args)
+
+def csr_column_index_count(*args):
+  """
+    csr_column_index_count(int n_idx, int cols, int n_row, int n_col, int Ap, 
+        int Aj, int col_offsets, int col_order, int Bp)
+    csr_column_index_count(npy_int64 n_idx, npy_int64 cols, npy_int64 n_row, npy_int64 n_col, 
+        npy_int64 Ap, npy_int64 Aj, npy_int64 col_offsets, 
+        npy_int64 col_order, npy_int64 Bp)
+    """
+  return _csr.csr_column_index_count(*args)
 
 def csr_diagonal(*args):
   """
@@ -113,6 +286,34 @@ def csr_diagonal(*args):
         npy_cdouble_wrapper Yx)
     csr_diagonal(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Yx)
+    csr_diagonal(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_diagonal(*args)
 
@@ -142,6 +343,34 @@ def csr_scale_rows(*args):
         npy_cdouble_wrapper Xx)
     csr_scale_rows(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
+    csr_scale_rows(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
     """
   return _csr.csr_scale_rows(*args)
 
@@ -171,6 +400,34 @@ def csr_scale_columns(*args):
         npy_cdouble_wrapper Xx)
     csr_scale_columns(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx)
+    csr_scale_columns(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx)
     """
   return _csr.csr_scale_columns(*args)
 
@@ -204,6 +461,48 @@ def csr_tocsc(*args):
         int Bp, int Bi, npy_cdouble_wrapper Bx)
     csr_tocsc(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bi, npy_clongdouble_wrapper Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bi, 
+        signed char Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned char Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bi, 
+        short Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned short Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bi, 
+        int Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bi, 
+        unsigned int Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bi, 
+        long long Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bi, unsigned long long Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bi, 
+        float Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bi, 
+        double Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bi, 
+        long double Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cfloat_wrapper Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_cdouble_wrapper Bx)
+    csr_tocsc(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bi, npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_tocsc(*args)
 
@@ -238,9 +537,132 @@ def csr_tobsr(*args):
     csr_tobsr(int n_row, int n_col, int R, int C, int Ap, int Aj, 
         npy_clongdouble_wrapper Ax, int Bp, int Bj, 
         npy_clongdouble_wrapper Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csr_tobsr(npy_int64 n_row, npy_int64 n_col, npy_int64 R, npy_int64 C, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_tobsr(*args)
 
+def csr_tosell(*args):
+  """
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int C, int perm, int Bp, int Bj, signed char Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int C, int perm, int Bp, int Bj, unsigned char Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, short Ax, int C, 
+        int perm, int Bp, int Bj, short Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int C, int perm, int Bp, int Bj, unsigned short Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, int Ax, int C, 
+        int perm, int Bp, int Bj, int Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int C, int perm, int Bp, int Bj, unsigned int Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int C, int perm, int Bp, int Bj, long long Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int C, int perm, int Bp, int Bj, unsigned long long Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, float Ax, int C, 
+        int perm, int Bp, int Bj, float Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, double Ax, int C, 
+        int perm, int Bp, int Bj, double Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int C, int perm, int Bp, int Bj, long double Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int C, int perm, int Bp, int Bj, npy_cfloat_wrapper Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int C, int perm, int Bp, int Bj, npy_cdouble_wrapper Bx)
+    csr_tosell(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int C, int perm, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 C, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        unsigned long long Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 C, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        npy_cfloat_wrapper Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 C, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        npy_cdouble_wrapper Bx)
+    csr_tosell(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 C, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_tosell(*args)
+
 def csr_matmat_pass2(*args):
   """
     csr_matmat_pass2(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -281,9 +703,251 @@ def csr_matmat_pass2(*args):
     csr_matmat_pass2(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_matmat_pass2(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_matmat_pass2(*args)
 
+def csr_matmat_pass2_sorted(*args):
+  """
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int Bp, int Bj, signed char Bx, int Cp, int Cj, 
+        signed char Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx, int Cp, 
+        int Cj, unsigned char Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, short Ax, int Bp, 
+        int Bj, short Bx, int Cp, int Cj, short Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx, int Cp, 
+        int Cj, unsigned short Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, int Ax, int Bp, 
+        int Bj, int Bx, int Cp, int Cj, int Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx, int Cp, 
+        int Cj, unsigned int Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int Bp, int Bj, long long Bx, int Cp, int Cj, 
+        long long Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx, 
+        int Cp, int Cj, unsigned long long Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, float Ax, int Bp, 
+        int Bj, float Bx, int Cp, int Cj, float Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, double Ax, int Bp, 
+        int Bj, double Bx, int Cp, int Cj, double Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int Bp, int Bj, long double Bx, int Cp, int Cj, 
+        long double Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx, 
+        int Cp, int Cj, npy_cfloat_wrapper Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx, 
+        int Cp, int Cj, npy_cdouble_wrapper Cx)
+    csr_matmat_pass2_sorted(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx, 
+        int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_matmat_pass2_sorted(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
+    """
+  return _csr.csr_matmat_pass2_sorted(*args)
+
+def csr_matmat_numeric(*args):
+  """
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
+        int Bp, signed char Bx, int Cp, int Pp, int Pm, 
+        signed char Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, unsigned char Ax, 
+        int Bp, unsigned char Bx, int Cp, int Pp, 
+        int Pm, unsigned char Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, short Ax, int Bp, 
+        short Bx, int Cp, int Pp, int Pm, short Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, unsigned short Ax, 
+        int Bp, unsigned short Bx, int Cp, int Pp, 
+        int Pm, unsigned short Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, int Ax, int Bp, 
+        int Bx, int Cp, int Pp, int Pm, int Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, unsigned int Ax, 
+        int Bp, unsigned int Bx, int Cp, int Pp, 
+        int Pm, unsigned int Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, long long Ax, 
+        int Bp, long long Bx, int Cp, int Pp, int Pm, 
+        long long Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, unsigned long long Ax, 
+        int Bp, unsigned long long Bx, int Cp, 
+        int Pp, int Pm, unsigned long long Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, float Ax, int Bp, 
+        float Bx, int Cp, int Pp, int Pm, float Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, double Ax, int Bp, 
+        double Bx, int Cp, int Pp, int Pm, double Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, long double Ax, 
+        int Bp, long double Bx, int Cp, int Pp, int Pm, 
+        long double Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, npy_cfloat_wrapper Bx, int Cp, 
+        int Pp, int Pm, npy_cfloat_wrapper Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, npy_cdouble_wrapper Bx, int Cp, 
+        int Pp, int Pm, npy_cdouble_wrapper Cx)
+    csr_matmat_numeric(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, npy_clongdouble_wrapper Bx, 
+        int Cp, int Pp, int Pm, npy_clongdouble_wrapper Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, signed char Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, 
+        signed char Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, unsigned char Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, 
+        unsigned char Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, short Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, short Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, unsigned short Bx, 
+        npy_int64 Cp, npy_int64 Pp, 
+        npy_int64 Pm, unsigned short Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, int Bx, npy_int64 Cp, 
+        npy_int64 Pp, npy_int64 Pm, int Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, unsigned int Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, 
+        unsigned int Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, long long Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, 
+        long long Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        unsigned long long Bx, npy_int64 Cp, npy_int64 Pp, 
+        npy_int64 Pm, unsigned long long Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, float Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, float Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, double Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, double Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, long double Bx, 
+        npy_int64 Cp, npy_int64 Pp, npy_int64 Pm, 
+        long double Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_cfloat_wrapper Bx, npy_int64 Cp, npy_int64 Pp, 
+        npy_int64 Pm, npy_cfloat_wrapper Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_cdouble_wrapper Bx, npy_int64 Cp, npy_int64 Pp, 
+        npy_int64 Pm, npy_cdouble_wrapper Cx)
+    csr_matmat_numeric(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_clongdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Pp, npy_int64 Pm, npy_clongdouble_wrapper Cx)
+    """
+  return _csr.csr_matmat_numeric(*args)
+
 def csr_matvec(*args):
   """
     csr_matvec(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -314,6 +978,41 @@ def csr_matvec(*args):
         npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
     csr_matvec(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, signed char Xx, signed char Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, unsigned char Xx, 
+        unsigned char Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, short Xx, short Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, unsigned short Xx, 
+        unsigned short Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, int Xx, int Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, unsigned int Xx, 
+        unsigned int Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, long long Xx, long long Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, unsigned long long Xx, 
+        unsigned long long Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, float Xx, float Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, double Xx, double Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, long double Xx, long double Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csr_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_matvec(*args)
 
@@ -351,9 +1050,131 @@ def csr_matvecs(*args):
     csr_matvecs(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        signed char Xx, signed char Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        unsigned char Xx, unsigned char Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, short Ax, short Xx, 
+        short Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        unsigned short Xx, unsigned short Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, int Ax, int Xx, 
+        int Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        unsigned int Xx, unsigned int Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, long long Ax, long long Xx, 
+        long long Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        unsigned long long Xx, unsigned long long Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, float Xx, 
+        float Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, double Ax, double Xx, 
+        double Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        long double Xx, long double Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csr_matvecs(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_clongdouble_wrapper Xx, npy_clongdouble_wrapper Yx)
     """
   return _csr.csr_matvecs(*args)
 
+def sell_matvec(*args):
+  """
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        signed char Bx, signed char Xx, signed char Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        unsigned char Bx, unsigned char Xx, unsigned char Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        short Bx, short Xx, short Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        unsigned short Bx, unsigned short Xx, unsigned short Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        int Bx, int Xx, int Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        unsigned int Bx, unsigned int Xx, unsigned int Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        long long Bx, long long Xx, long long Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        unsigned long long Bx, unsigned long long Xx, 
+        unsigned long long Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        float Bx, float Xx, float Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        double Bx, double Xx, double Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        long double Bx, long double Xx, long double Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        npy_cfloat_wrapper Bx, npy_cfloat_wrapper Xx, 
+        npy_cfloat_wrapper Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        npy_cdouble_wrapper Bx, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    sell_matvec(int n_row, int n_col, int C, int perm, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx, npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx, 
+        signed char Xx, signed char Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx, 
+        unsigned char Xx, unsigned char Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, short Bx, 
+        short Xx, short Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx, 
+        unsigned short Xx, unsigned short Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, int Bx, 
+        int Xx, int Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx, 
+        unsigned int Xx, unsigned int Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx, 
+        long long Xx, long long Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx, 
+        unsigned long long Xx, unsigned long long Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, float Bx, 
+        float Xx, float Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, double Bx, 
+        double Xx, double Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx, 
+        long double Xx, long double Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    sell_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 C, npy_int64 perm, 
+        npy_int64 Bp, npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
+    """
+  return _csr.sell_matvec(*args)
+
 def csr_elmul_csr(*args):
   """
     csr_elmul_csr(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -394,6 +1215,58 @@ def csr_elmul_csr(*args):
     csr_elmul_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_elmul_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_elmul_csr(*args)
 
@@ -437,6 +1310,58 @@ def csr_eldiv_csr(*args):
     csr_eldiv_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_eldiv_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_eldiv_csr(*args)
 
@@ -480,6 +1405,58 @@ def csr_plus_csr(*args):
     csr_plus_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_plus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_plus_csr(*args)
 
@@ -523,6 +1500,58 @@ def csr_minus_csr(*args):
     csr_minus_csr(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int Bp, int Bj, npy_clongdouble_wrapper Bx, 
         int Cp, int Cj, npy_clongdouble_wrapper Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx, npy_int64 Cp, npy_int64 Cj, 
+        signed char Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned char Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx, npy_int64 Cp, npy_int64 Cj, short Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned short Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx, npy_int64 Cp, npy_int64 Cj, int Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx, npy_int64 Cp, npy_int64 Cj, 
+        unsigned int Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx, npy_int64 Cp, npy_int64 Cj, 
+        long long Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx, npy_int64 Cp, 
+        npy_int64 Cj, unsigned long long Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx, npy_int64 Cp, npy_int64 Cj, float Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx, npy_int64 Cp, npy_int64 Cj, double Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx, npy_int64 Cp, npy_int64 Cj, 
+        long double Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cfloat_wrapper Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx, npy_int64 Cp, 
+        npy_int64 Cj, npy_cdouble_wrapper Cx)
+    csr_minus_csr(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx, 
+        npy_int64 Cp, npy_int64 Cj, npy_clongdouble_wrapper Cx)
     """
   return _csr.csr_minus_csr(*args)
 
@@ -542,6 +1571,20 @@ def csr_sort_indices(*args):
     csr_sort_indices(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_sort_indices(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_sort_indices(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, signed char Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned char Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, short Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned short Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, int Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned int Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long long Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned long long Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, float Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, double Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long double Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax)
+    csr_sort_indices(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_sort_indices(*args)
 
@@ -561,6 +1604,34 @@ def csr_eliminate_zeros(*args):
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_eliminate_zeros(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax)
+    csr_eliminate_zeros(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_eliminate_zeros(*args)
 
@@ -580,9 +1651,70 @@ def csr_sum_duplicates(*args):
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax)
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_cdouble_wrapper Ax)
     csr_sum_duplicates(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax)
+    csr_sum_duplicates(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax)
     """
   return _csr.csr_sum_duplicates(*args)
 
+def csr_canonicalize(*args):
+  """
+    csr_canonicalize(int n_row, int Ap, int Aj, signed char Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, unsigned char Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, short Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, unsigned short Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, int Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, unsigned int Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, long long Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, unsigned long long Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, float Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, double Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, long double Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax)
+    csr_canonicalize(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, signed char Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned char Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, short Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned short Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, int Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned int Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long long Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned long long Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, float Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, double Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long double Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax)
+    csr_canonicalize(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax)
+    """
+  return _csr.csr_canonicalize(*args)
+
 def get_csr_submatrix(*args):
   """
     get_csr_submatrix(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -613,9 +1745,359 @@ def get_csr_submatrix(*args):
         int ir0, int ir1, int ic0, int ic1)
     get_csr_submatrix(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int ir0, int ir1, int ic0, int ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 ir0, npy_int64 ir1, 
+        npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1)
+    get_csr_submatrix(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1)
     """
   return _csr.get_csr_submatrix(*args)
 
+def csr_submatrix(*args):
+  """
+    csr_submatrix(int Ap, int Aj, signed char Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, signed char Bx)
+    csr_submatrix(int Ap, int Aj, unsigned char Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, unsigned char Bx)
+    csr_submatrix(int Ap, int Aj, short Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, short Bx)
+    csr_submatrix(int Ap, int Aj, unsigned short Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, unsigned short Bx)
+    csr_submatrix(int Ap, int Aj, int Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, int Bx)
+    csr_submatrix(int Ap, int Aj, unsigned int Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, unsigned int Bx)
+    csr_submatrix(int Ap, int Aj, long long Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, long long Bx)
+    csr_submatrix(int Ap, int Aj, unsigned long long Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, unsigned long long Bx)
+    csr_submatrix(int Ap, int Aj, float Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, float Bx)
+    csr_submatrix(int Ap, int Aj, double Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, double Bx)
+    csr_submatrix(int Ap, int Aj, long double Ax, int ir0, int ir1, int ic0, 
+        int ic1, int Bp, int Bj, long double Bx)
+    csr_submatrix(int Ap, int Aj, npy_cfloat_wrapper Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, npy_cfloat_wrapper Bx)
+    csr_submatrix(int Ap, int Aj, npy_cdouble_wrapper Ax, int ir0, int ir1, 
+        int ic0, int ic1, int Bp, int Bj, npy_cdouble_wrapper Bx)
+    csr_submatrix(int Ap, int Aj, npy_clongdouble_wrapper Ax, int ir0, 
+        int ir1, int ic0, int ic1, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, signed char Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, unsigned char Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, short Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, unsigned short Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, int Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, unsigned int Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, long long Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 ir0, npy_int64 ir1, npy_int64 ic0, 
+        npy_int64 ic1, npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, float Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, double Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, long double Ax, npy_int64 ir0, 
+        npy_int64 ir1, npy_int64 ic0, npy_int64 ic1, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 ir0, npy_int64 ir1, npy_int64 ic0, 
+        npy_int64 ic1, npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 ir0, npy_int64 ir1, npy_int64 ic0, 
+        npy_int64 ic1, npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csr_submatrix(npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 ir0, npy_int64 ir1, npy_int64 ic0, 
+        npy_int64 ic1, npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_submatrix(*args)
+
+def csr_row_index(*args):
+  """
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, signed char Ax, 
+        int Bp, int Bj, signed char Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, unsigned char Ax, 
+        int Bp, int Bj, unsigned char Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, short Ax, int Bp, 
+        int Bj, short Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, unsigned short Ax, 
+        int Bp, int Bj, unsigned short Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, int Ax, int Bp, 
+        int Bj, int Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, unsigned int Ax, 
+        int Bp, int Bj, unsigned int Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, long long Ax, 
+        int Bp, int Bj, long long Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, unsigned long long Ax, 
+        int Bp, int Bj, unsigned long long Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, float Ax, int Bp, 
+        int Bj, float Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, double Ax, int Bp, 
+        int Bj, double Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, long double Ax, 
+        int Bp, int Bj, long double Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int Bp, int Bj, npy_cdouble_wrapper Bx)
+    csr_row_index(int n_idx, int rows, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 Bp, npy_int64 Bj, 
+        short Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 Bp, npy_int64 Bj, 
+        int Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 Bp, npy_int64 Bj, 
+        float Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 Bp, npy_int64 Bj, 
+        double Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csr_row_index(npy_int64 n_idx, npy_int64 rows, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_row_index(*args)
+
+def csr_column_index(*args):
+  """
+    csr_column_index(int n_row, int Ap, int Aj, signed char Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, signed char Bx)
+    csr_column_index(int n_row, int Ap, int Aj, unsigned char Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, unsigned char Bx)
+    csr_column_index(int n_row, int Ap, int Aj, short Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, short Bx)
+    csr_column_index(int n_row, int Ap, int Aj, unsigned short Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, unsigned short Bx)
+    csr_column_index(int n_row, int Ap, int Aj, int Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, int Bx)
+    csr_column_index(int n_row, int Ap, int Aj, unsigned int Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, unsigned int Bx)
+    csr_column_index(int n_row, int Ap, int Aj, long long Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, long long Bx)
+    csr_column_index(int n_row, int Ap, int Aj, unsigned long long Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, 
+        unsigned long long Bx)
+    csr_column_index(int n_row, int Ap, int Aj, float Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, float Bx)
+    csr_column_index(int n_row, int Ap, int Aj, double Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, double Bx)
+    csr_column_index(int n_row, int Ap, int Aj, long double Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, long double Bx)
+    csr_column_index(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax, int col_offsets, 
+        int col_order, int Bp, int Bj, 
+        npy_cfloat_wrapper Bx)
+    csr_column_index(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int col_offsets, int col_order, int Bp, int Bj, 
+        npy_cdouble_wrapper Bx)
+    csr_column_index(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int col_offsets, int col_order, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 col_offsets, npy_int64 col_order, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_cdouble_wrapper Bx)
+    csr_column_index(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 col_offsets, 
+        npy_int64 col_order, npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_column_index(*args)
+
+def csr_permute_symmetric(*args):
+  """
+    csr_permute_symmetric(int n_row, int Ap, int Aj, signed char Ax, int perm, 
+        int Bp, int Bj, signed char Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, unsigned char Ax, int perm, 
+        int Bp, int Bj, unsigned char Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, short Ax, int perm, int Bp, 
+        int Bj, short Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, unsigned short Ax, int perm, 
+        int Bp, int Bj, unsigned short Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, int Ax, int perm, int Bp, 
+        int Bj, int Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, unsigned int Ax, int perm, 
+        int Bp, int Bj, unsigned int Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, long long Ax, int perm, 
+        int Bp, int Bj, long long Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, unsigned long long Ax, int perm, 
+        int Bp, int Bj, unsigned long long Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, float Ax, int perm, int Bp, 
+        int Bj, float Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, double Ax, int perm, int Bp, 
+        int Bj, double Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, long double Ax, int perm, 
+        int Bp, int Bj, long double Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax, int perm, 
+        int Bp, int Bj, npy_cfloat_wrapper Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_cdouble_wrapper Bx)
+    csr_permute_symmetric(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int perm, int Bp, int Bj, npy_clongdouble_wrapper Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        signed char Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        unsigned char Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        short Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        unsigned short Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        int Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        unsigned int Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        long long Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 perm, npy_int64 Bp, 
+        npy_int64 Bj, unsigned long long Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        float Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        double Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 perm, npy_int64 Bp, npy_int64 Bj, 
+        long double Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 perm, npy_int64 Bp, 
+        npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 perm, npy_int64 Bp, 
+        npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csr_permute_symmetric(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 perm, npy_int64 Bp, 
+        npy_int64 Bj, npy_clongdouble_wrapper Bx)
+    """
+  return _csr.csr_permute_symmetric(*args)
+
 def csr_sample_values(*args):
   """
     csr_sample_values(int n_row, int n_col, int Ap, int Aj, signed char Ax, 
@@ -647,6 +2129,78 @@ def csr_sample_values(*args):
     csr_sample_values(int n_row, int n_col, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
         int n_samples, int Bi, int Bj, 
         npy_clongdouble_wrapper Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        signed char Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, signed char Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned char Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, unsigned char Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        short Ax, npy_int64 n_samples, npy_int64 Bi, 
+        npy_int64 Bj, short Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned short Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, unsigned short Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        int Ax, npy_int64 n_samples, npy_int64 Bi, 
+        npy_int64 Bj, int Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned int Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, unsigned int Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long long Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, long long Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        unsigned long long Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, unsigned long long Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, npy_int64 n_samples, npy_int64 Bi, 
+        npy_int64 Bj, float Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        double Ax, npy_int64 n_samples, npy_int64 Bi, 
+        npy_int64 Bj, double Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        long double Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, long double Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cdouble_wrapper Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    csr_sample_values(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_clongdouble_wrapper Ax, npy_int64 n_samples, 
+        npy_int64 Bi, npy_int64 Bj, npy_clongdouble_wrapper Bx)
     """
   return _csr.csr_sample_values(*args)
 
+def csr_matvec_mixed(*args):
+  """
+    csr_matvec_mixed(int n_row, int n_col, int Ap, int Aj, float Ax, double Xx, 
+        double Yx)
+    csr_matvec_mixed(int n_row, int n_col, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    csr_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        float Ax, double Xx, double Yx)
+    csr_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_cfloat_wrapper Ax, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    """
+  return _csr.csr_matvec_mixed(*args)
+
+def csr_matvecs_mixed(*args):
+  """
+    csr_matvecs_mixed(int n_row, int n_col, int n_vecs, int Ap, int Aj, float Ax, 
+        double Xx, double Yx)
+    csr_matvecs_mixed(int n_row, int n_col, int n_vecs, int Ap, int Aj, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    csr_matvecs_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, float Ax, double Xx, 
+        double Yx)
+    csr_matvecs_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_vecs, 
+        npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    """
+  return _csr.csr_matvecs_mixed(*args)
+
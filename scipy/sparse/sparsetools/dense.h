@@ -2,16 +2,21 @@
 #define __DENSE_H__
 
 // Simplified BLAS routines and other dense linear algebra functions
+//
+// Where the matrix (or scalar) has type T and the vectors type V the
+// products are formed in type V, so that values stored in a narrow
+// type can be accumulated in a wider one.
 
 /*
  * Level 1
  */
 
 // y += a*x
-template <class I, class T>
-void axpy(const I n, const T a, const T * x, T * y){
+template <class I, class T, class V>
+void axpy(const I n, const T a, const V * x, V * y){
+    const V b(a);
     for(I i = 0; i < n; i++){
-        y[i] += a * x[i];
+        y[i] += b * x[i];
     }
 }
 
@@ -54,25 +59,25 @@ void vector_binop(const I n, const T * x, const T * y, T * z,
 
 
 // Level 2
-template <class I, class T>
-void gemv(const I m, const I n, const T * A, const T * x, T * y){
+template <class I, class T, class V>
+void gemv(const I m, const I n, const T * A, const V * x, V * y){
     for(I i = 0; i < m; i++){
-        T dot = y[i];
+        V dot = y[i];
         for(I j = 0; j < n; j++){
-            dot += A[n * i + j] * x[j];
+            dot += V(A[n * i + j]) * x[j];
         }
         y[i] = dot;
     }
 }
 
 // Level 3
-template <class I, class T>
-void gemm(const I m, const I n, const I k, const T * A, const T * B, T * C){
+template <class I, class T, class V>
+void gemm(const I m, const I n, const I k, const T * A, const V * B, V * C){
     for(I i = 0; i < m; i++){
         for(I j = 0; j < n; j++){
-            T dot = C[n * i + j];
+            V dot = C[n * i + j];
             for(I _d = 0; _d < k; _d++){
-                dot += A[k * i + _d] * B[n * _d + j];
+                dot += V(A[k * i + _d]) * B[n * _d + j];
             }
             C[n * i + j] = dot;
         }
@@ -1,8 +1,12 @@
 #ifndef __DIA_H__
 #define __DIA_H__
 
+#include <vector>
+#include <utility>
 #include <algorithm>
 
+#include "parallel.h"
+
 
 /*
  * Compute Y += A*X for DIA matrix A and dense vectors X,Y
@@ -25,7 +29,71 @@
  *   Negative offsets correspond to lower diagonals
  *   Positive offsets correspond to upper diagonals
  *
+ *   dia_matvec_mixed() allows diagonals of type T with vectors of a
+ *   wider type V, e.g. float and double.  Products and sums are then
+ *   formed in type V.
+ *
+ *   The rows are processed in tiles of dia_row_tile rows and all
+ *   diagonals are applied to a tile before moving on, so that the
+ *   tile of Yx stays in cache instead of being streamed once per
+ *   diagonal.  Tiles are distributed over the threads.
+ *
  */
+const int dia_row_tile = 1024;
+
+template <class I, class T, class V>
+struct dia_matvec_kernel
+{
+    I n_col, n_diags, L;
+    const I * offsets;
+    const T * diags;
+    const V * Xx;
+          V * Yx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        const I j_max = std::min<I>(n_col, L);
+
+        for(I r0 = row_start; r0 < row_end; r0 += dia_row_tile){
+            const I r1 = std::min<I>(r0 + dia_row_tile, row_end);
+
+            for(I d = 0; d < n_diags; d++){
+                const I k = offsets[d];  //diagonal offset
+
+                const I i_start = std::max<I>(r0, -k);
+                const I i_end   = std::min<I>(r1, j_max - k);
+
+                if (i_start >= i_end)
+                    continue;
+
+                const I N = i_end - i_start;  //number of elements to process
+
+                const T * diag = diags + d*L + i_start + k;
+                const V * x = Xx + i_start + k;
+                      V * y = Yx + i_start;
+
+                for(I n = 0; n < N; n++){
+                    y[n] += V(diag[n]) * x[n]; 
+                }
+            }
+        }
+    }
+};
+
+template <class I, class T, class V>
+void dia_matvec_mixed(const I n_row,
+                      const I n_col,
+                      const I n_diags,
+                      const I L,
+	                  const I offsets[], 
+	                  const T diags[], 
+	                  const V Xx[],
+	                        V Yx[])
+{
+    dia_matvec_kernel<I,T,V> kernel = {n_col, n_diags, L, offsets, diags, Xx, Yx};
+    parallel_for_range(n_row, kernel, (double) n_diags);
+}
+
 template <class I, class T>
 void dia_matvec(const I n_row,
                 const I n_col,
@@ -36,23 +104,251 @@ void dia_matvec(const I n_row,
 	            const T Xx[],
 	                  T Yx[])
 {
-    for(I i = 0; i < n_diags; i++){
-        const I k = offsets[i];  //diagonal offset
+    dia_matvec_mixed(n_row, n_col, n_diags, L, offsets, diags, Xx, Yx);
+}
 
-        const I i_start = std::max(0,-k);
-        const I j_start = std::max(0, k);
-        const I j_end   = std::min(std::min(n_row + k, n_col),L);
 
-        const I N = j_end - j_start;  //number of elements to process
+/*
+ * Count the nonzeros in each row of DIA matrix A
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  n_diags          - number of diagonals
+ *   I  L                - length of each diagonal
+ *   I  offsets[n_diags] - diagonal offsets
+ *   T  diags[n_diags,L] - nonzeros
+ *
+ * Output Arguments:
+ *   I  Bp[n_row+1]      - row pointer of A in CSR format
+ *
+ * Note:
+ *   Output array Bp must be preallocated
+ *   Explicit zeros in diags are not counted
+ *
+ */
+template <class I, class T>
+struct dia_tocsr_count_kernel
+{
+    I n_col, n_diags, L;
+    const I * offsets;
+    const T * diags;
+          I * Bp;
 
-        const T * diag = diags + i*L + j_start;
-        const T * x = Xx + j_start;
-              T * y = Yx + i_start;
+    void operator()(const I row_start, const I row_end)
+    {
+        const I j_max = std::min<I>(n_col, L);
 
-        for(I n = 0; n < N; n++){
-            y[n] += diag[n] * x[n]; 
+        for(I i = row_start; i < row_end; i++){
+            I row_nnz = 0;
+            for(I d = 0; d < n_diags; d++){
+                const I j = i + offsets[d];
+                if (j >= 0 && j < j_max && diags[d*L + j] != 0)
+                    row_nnz++;
+            }
+            Bp[i + 1] = row_nnz;
         }
     }
+};
+
+template <class I, class T>
+void dia_tocsr_count(const I n_row,
+                     const I n_col,
+                     const I n_diags,
+                     const I L,
+                     const I offsets[],
+                     const T diags[],
+                           I Bp[])
+{
+    dia_tocsr_count_kernel<I,T> kernel = {n_col, n_diags, L, offsets, diags, Bp};
+    parallel_for_range(n_row, kernel, (double) n_diags);
+
+    Bp[0] = 0;
+    for(I i = 0; i < n_row; i++)
+        Bp[i + 1] += Bp[i];
+}
+
+/*
+ * Convert DIA matrix A to CSR format
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  n_diags          - number of diagonals
+ *   I  L                - length of each diagonal
+ *   I  offsets[n_diags] - diagonal offsets
+ *   T  diags[n_diags,L] - nonzeros
+ *   I  Bp[n_row+1]      - row pointer (see dia_tocsr_count)
+ *
+ * Output Arguments:
+ *   I  Bj[nnz(B)]       - column indices
+ *   T  Bx[nnz(B)]       - nonzeros
+ *
+ * Note:
+ *   Output arrays Bj and Bx must be preallocated
+ *   The output has sorted column indices and no duplicates
+ *
+ */
+template <class I, class T>
+struct dia_tocsr_kernel
+{
+    I n_col, n_diags, L;
+    const I * offsets;
+    const I * order;
+    const T * diags;
+    const I * Bp;
+          I * Bj;
+          T * Bx;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        const I j_max = std::min<I>(n_col, L);
+
+        for(I i = row_start; i < row_end; i++){
+            I nnz = Bp[i];
+            for(I n = 0; n < n_diags; n++){
+                const I d = order[n];
+                const I j = i + offsets[d];
+                if (j < 0 || j >= j_max)
+                    continue;
+                const T x = diags[d*L + j];
+                if (x != 0){
+                    Bj[nnz] = j;
+                    Bx[nnz] = x;
+                    nnz++;
+                }
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void dia_tocsr(const I n_row,
+               const I n_col,
+               const I n_diags,
+               const I L,
+               const I offsets[],
+               const T diags[],
+               const I Bp[],
+                     I Bj[],
+                     T Bx[])
+{
+    // visit the diagonals by increasing offset to sort each row
+    std::vector< std::pair<I,I> > sorted(n_diags);
+    for(I d = 0; d < n_diags; d++)
+        sorted[d] = std::make_pair(offsets[d], d);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<I> order(n_diags + 1);
+    for(I d = 0; d < n_diags; d++)
+        order[d] = sorted[d].second;
+
+    dia_tocsr_kernel<I,T> kernel = {n_col, n_diags, L, offsets, &order[0],
+                                    diags, Bp, Bj, Bx};
+    parallel_for_rows(n_row, Bp, kernel, (double) n_diags);
+}
+
+
+/*
+ * Find the occupied diagonals of CSR matrix A
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  n_col            - number of columns in A
+ *   I  Ap[n_row+1]      - row pointer
+ *   I  Aj[nnz(A)]       - column indices
+ *
+ * Output Arguments:
+ *   I  diag_map[n_row+n_col-1] - position of diagonal k among the
+ *                                occupied diagonals, sorted by offset,
+ *                                in diag_map[k + n_row - 1], or -1
+ *
+ * Returns:
+ *   number of occupied diagonals
+ *
+ * Note:
+ *   Output array diag_map must be preallocated
+ *
+ *   Complexity: O(nnz(A) + n_row + n_col)
+ *
+ */
+template <class I>
+I csr_todia_offsets(const I n_row,
+                    const I n_col,
+                    const I Ap[],
+                    const I Aj[],
+                          I diag_map[])
+{
+    const I n_map = n_row + n_col - 1;
+
+    std::fill(diag_map, diag_map + n_map, -1);
+    for(I i = 0; i < n_row; i++){
+        for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+            diag_map[Aj[jj] - i + n_row - 1] = 0;
+        }
+    }
+
+    I n_diags = 0;
+    for(I k = 0; k < n_map; k++){
+        if (diag_map[k] == 0)
+            diag_map[k] = n_diags++;
+    }
+    return n_diags;
+}
+
+/*
+ * Convert CSR matrix A to DIA format
+ *
+ * Input Arguments:
+ *   I  n_row            - number of rows in A
+ *   I  Ap[n_row+1]      - row pointer
+ *   I  Aj[nnz(A)]       - column indices
+ *   T  Ax[nnz(A)]       - nonzeros
+ *   I  diag_map[]       - see csr_todia_offsets
+ *   I  L                - length of each diagonal, at least n_col
+ *
+ * Output Arguments:
+ *   T  diags[n_diags,L] - nonzeros
+ *
+ * Note:
+ *   Output array diags must be preallocated and zeroed
+ *   Duplicate entries are summed
+ *
+ */
+template <class I, class T>
+struct csr_todia_kernel
+{
+    I n_row, L;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+    const I * diag_map;
+          T * diags;
+
+    void operator()(const I row_start, const I row_end)
+    {
+        // entry (i,j) goes to position j of diagonal j - i, so
+        // different rows never write to the same location
+        for(I i = row_start; i < row_end; i++){
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                const I j = Aj[jj];
+                diags[diag_map[j - i + n_row - 1]*L + j] += Ax[jj];
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void csr_todia(const I n_row,
+               const I Ap[],
+               const I Aj[],
+               const T Ax[],
+               const I diag_map[],
+               const I L,
+                     T diags[])
+{
+    csr_todia_kernel<I,T> kernel = {n_row, L, Ap, Aj, Ax, diag_map, diags};
+    parallel_for_rows(n_row, Ap, kernel);
 }
 
 
@@ -6,7 +6,15 @@
 #include "dia.h"
 %}
 
+%ignore dia_row_tile;
+
 %include "dia.h" 
 
+INSTANTIATE_INDEX(csr_todia_offsets)
+
 INSTANTIATE_ALL(dia_matvec)
+INSTANTIATE_ALL(dia_tocsr_count)
+INSTANTIATE_ALL(dia_tocsr)
+INSTANTIATE_ALL(csr_todia)
 
+INSTANTIATE_MIXED(dia_matvec_mixed)
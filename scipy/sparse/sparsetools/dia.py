@@ -67,6 +67,38 @@ except AttributeError:
 
 
 
+def get_num_threads(*args):
+  """get_num_threads() -> int"""
+  return _dia.get_num_threads(*args)
+
+def set_num_threads(*args):
+  """set_num_threads(int n_threads)"""
+  return _dia.set_num_threads(*args)
+
+def get_parallel_threshold(*args):
+  """get_parallel_threshold() -> long"""
+  return _dia.get_parallel_threshold(*args)
+
+def set_parallel_threshold(*args):
+  """set_parallel_threshold(long threshold)"""
+  return _dia.set_parallel_threshold(*args)
+
+def get_workspace_allocations(*args):
+  """get_workspace_allocations() -> long"""
+  return _dia.get_workspace_allocations(*args)
+
+def clear_workspaces(*args):
+  """clear_workspaces()"""
+  return _dia.clear_workspaces(*args)
+
+
+def csr_todia_offsets(*args):
+  """
+    csr_todia_offsets(int n_row, int n_col, int Ap, int Aj, int diag_map) -> int
+    csr_todia_offsets(npy_int64 n_row, npy_int64 n_col, npy_int64 Ap, npy_int64 Aj, 
+        npy_int64 diag_map) -> npy_int64
+    """
+  return _dia.csr_todia_offsets(*args)
 
 def dia_matvec(*args):
   """
@@ -103,6 +135,287 @@ def dia_matvec(*args):
     dia_matvec(int n_row, int n_col, int n_diags, int L, int offsets, 
         npy_clongdouble_wrapper diags, npy_clongdouble_wrapper Xx, 
         npy_clongdouble_wrapper Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, signed char diags, 
+        signed char Xx, signed char Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned char diags, 
+        unsigned char Xx, unsigned char Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, short diags, 
+        short Xx, short Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned short diags, 
+        unsigned short Xx, unsigned short Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, int diags, 
+        int Xx, int Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned int diags, 
+        unsigned int Xx, unsigned int Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long long diags, 
+        long long Xx, long long Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned long long diags, 
+        unsigned long long Xx, unsigned long long Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, float diags, 
+        float Xx, float Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, double diags, 
+        double Xx, double Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long double diags, 
+        long double Xx, long double Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cfloat_wrapper diags, 
+        npy_cfloat_wrapper Xx, npy_cfloat_wrapper Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cdouble_wrapper diags, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    dia_matvec(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_clongdouble_wrapper diags, 
+        npy_clongdouble_wrapper Xx, 
+        npy_clongdouble_wrapper Yx)
     """
   return _dia.dia_matvec(*args)
 
+def dia_tocsr_count(*args):
+  """
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        signed char diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned char diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        short diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned short diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        int diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned int diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long long diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned long long diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        float diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        double diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long double diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cfloat_wrapper diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cdouble_wrapper diags, int Bp)
+    dia_tocsr_count(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_clongdouble_wrapper diags, int Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, signed char diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned char diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, short diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned short diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, int diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned int diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long long diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned long long diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, float diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, double diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long double diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cfloat_wrapper diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cdouble_wrapper diags, 
+        npy_int64 Bp)
+    dia_tocsr_count(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_clongdouble_wrapper diags, 
+        npy_int64 Bp)
+    """
+  return _dia.dia_tocsr_count(*args)
+
+def dia_tocsr(*args):
+  """
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        signed char diags, int Bp, int Bj, signed char Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned char diags, int Bp, int Bj, unsigned char Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        short diags, int Bp, int Bj, short Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned short diags, int Bp, int Bj, unsigned short Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        int diags, int Bp, int Bj, int Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned int diags, int Bp, int Bj, unsigned int Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long long diags, int Bp, int Bj, long long Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        unsigned long long diags, int Bp, int Bj, 
+        unsigned long long Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        float diags, int Bp, int Bj, float Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        double diags, int Bp, int Bj, double Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        long double diags, int Bp, int Bj, long double Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cfloat_wrapper diags, int Bp, int Bj, 
+        npy_cfloat_wrapper Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cdouble_wrapper diags, int Bp, int Bj, 
+        npy_cdouble_wrapper Bx)
+    dia_tocsr(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_clongdouble_wrapper diags, int Bp, int Bj, 
+        npy_clongdouble_wrapper Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, signed char diags, 
+        npy_int64 Bp, npy_int64 Bj, signed char Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned char diags, 
+        npy_int64 Bp, npy_int64 Bj, unsigned char Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, short diags, 
+        npy_int64 Bp, npy_int64 Bj, short Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned short diags, 
+        npy_int64 Bp, npy_int64 Bj, unsigned short Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, int diags, 
+        npy_int64 Bp, npy_int64 Bj, int Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned int diags, 
+        npy_int64 Bp, npy_int64 Bj, unsigned int Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long long diags, 
+        npy_int64 Bp, npy_int64 Bj, long long Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, unsigned long long diags, 
+        npy_int64 Bp, npy_int64 Bj, unsigned long long Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, float diags, 
+        npy_int64 Bp, npy_int64 Bj, float Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, double diags, 
+        npy_int64 Bp, npy_int64 Bj, double Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, long double diags, 
+        npy_int64 Bp, npy_int64 Bj, long double Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cfloat_wrapper diags, 
+        npy_int64 Bp, npy_int64 Bj, npy_cfloat_wrapper Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cdouble_wrapper diags, 
+        npy_int64 Bp, npy_int64 Bj, npy_cdouble_wrapper Bx)
+    dia_tocsr(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_clongdouble_wrapper diags, 
+        npy_int64 Bp, npy_int64 Bj, 
+        npy_clongdouble_wrapper Bx)
+    """
+  return _dia.dia_tocsr(*args)
+
+def csr_todia(*args):
+  """
+    csr_todia(int n_row, int Ap, int Aj, signed char Ax, int diag_map, 
+        int L, signed char diags)
+    csr_todia(int n_row, int Ap, int Aj, unsigned char Ax, int diag_map, 
+        int L, unsigned char diags)
+    csr_todia(int n_row, int Ap, int Aj, short Ax, int diag_map, 
+        int L, short diags)
+    csr_todia(int n_row, int Ap, int Aj, unsigned short Ax, int diag_map, 
+        int L, unsigned short diags)
+    csr_todia(int n_row, int Ap, int Aj, int Ax, int diag_map, int L, 
+        int diags)
+    csr_todia(int n_row, int Ap, int Aj, unsigned int Ax, int diag_map, 
+        int L, unsigned int diags)
+    csr_todia(int n_row, int Ap, int Aj, long long Ax, int diag_map, 
+        int L, long long diags)
+    csr_todia(int n_row, int Ap, int Aj, unsigned long long Ax, int diag_map, 
+        int L, unsigned long long diags)
+    csr_todia(int n_row, int Ap, int Aj, float Ax, int diag_map, 
+        int L, float diags)
+    csr_todia(int n_row, int Ap, int Aj, double Ax, int diag_map, 
+        int L, double diags)
+    csr_todia(int n_row, int Ap, int Aj, long double Ax, int diag_map, 
+        int L, long double diags)
+    csr_todia(int n_row, int Ap, int Aj, npy_cfloat_wrapper Ax, int diag_map, 
+        int L, npy_cfloat_wrapper diags)
+    csr_todia(int n_row, int Ap, int Aj, npy_cdouble_wrapper Ax, 
+        int diag_map, int L, npy_cdouble_wrapper diags)
+    csr_todia(int n_row, int Ap, int Aj, npy_clongdouble_wrapper Ax, 
+        int diag_map, int L, npy_clongdouble_wrapper diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, signed char Ax, 
+        npy_int64 diag_map, npy_int64 L, signed char diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned char Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        unsigned char diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, short Ax, 
+        npy_int64 diag_map, npy_int64 L, short diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned short Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        unsigned short diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, int Ax, 
+        npy_int64 diag_map, npy_int64 L, int diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned int Ax, 
+        npy_int64 diag_map, npy_int64 L, unsigned int diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long long Ax, 
+        npy_int64 diag_map, npy_int64 L, long long diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, unsigned long long Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        unsigned long long diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, float Ax, 
+        npy_int64 diag_map, npy_int64 L, float diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, double Ax, 
+        npy_int64 diag_map, npy_int64 L, double diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, long double Ax, 
+        npy_int64 diag_map, npy_int64 L, long double diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cfloat_wrapper Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        npy_cfloat_wrapper diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_cdouble_wrapper Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        npy_cdouble_wrapper diags)
+    csr_todia(npy_int64 n_row, npy_int64 Ap, npy_int64 Aj, npy_clongdouble_wrapper Ax, 
+        npy_int64 diag_map, npy_int64 L, 
+        npy_clongdouble_wrapper diags)
+    """
+  return _dia.csr_todia(*args)
+
+def dia_matvec_mixed(*args):
+  """
+    dia_matvec_mixed(int n_row, int n_col, int n_diags, int L, int offsets, 
+        float diags, double Xx, double Yx)
+    dia_matvec_mixed(int n_row, int n_col, int n_diags, int L, int offsets, 
+        npy_cfloat_wrapper diags, npy_cdouble_wrapper Xx, 
+        npy_cdouble_wrapper Yx)
+    dia_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, float diags, 
+        double Xx, double Yx)
+    dia_matvec_mixed(npy_int64 n_row, npy_int64 n_col, npy_int64 n_diags, 
+        npy_int64 L, npy_int64 offsets, npy_cfloat_wrapper diags, 
+        npy_cdouble_wrapper Xx, npy_cdouble_wrapper Yx)
+    """
+  return _dia.dia_matvec_mixed(*args)
+
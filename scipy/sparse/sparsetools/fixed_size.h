@@ -10,78 +10,109 @@
 
 /*
  *  Dot Product
+ *
+ *  X may have a narrower type T than Y, the products are formed in
+ *  the type V of Y.
  * 
  */
-template<int N, int SX, int SY, class T>
+template<int N, int SX, int SY, class T, class V>
 class _dot
 {
     public:
-        inline T operator()(const T * X, const T * Y)
+        inline V operator()(const T * X, const V * Y)
         {
-            _dot<N-1,SX,SY,T> d;
-            return (*X) * (*Y) + d(X + SX, Y + SY);
+            _dot<N-1,SX,SY,T,V> d;
+            return V(*X) * (*Y) + d(X + SX, Y + SY);
         }
 };
-template<int SX, int SY, class T>
-class _dot<1,SX,SY,T>
+template<int SX, int SY, class T, class V>
+class _dot<1,SX,SY,T,V>
 {
     public:
-        inline T operator()(const T * X, const T * Y)
+        inline V operator()(const T * X, const V * Y)
         {
-            return (*X) * (*Y);
+            return V(*X) * (*Y);
         }
 };
 
-template<int N, int SX, int SY, class T>
-inline T dot(const T * X, const T * Y)
+template<int N, int SX, int SY, class T, class V>
+inline V dot(const T * X, const V * Y)
 {
-    _dot<N,SX,SY,T> d;
+    _dot<N,SX,SY,T,V> d;
     return d(X, Y);
 }
 
 
 
 /*
- *  Matrix Vector Product Y = A*X
+ *  Matrix Vector Product Y += A*X
  * 
  */
-template<int M, int N, int SX, int SY, class T>
+template<int M, int N, int SX, int SY, class T, class V>
 class _matvec
 {
     public:
-        inline void operator()(const T * A, const T * X, T * Y)
+        inline void operator()(const T * A, const V * X, V * Y)
         {
-            *Y += dot<N,1,SX,T>(A,X);
-            _matvec<M-1,N,SX,SY,T> d;
+            *Y += dot<N,1,SX>(A,X);
+            _matvec<M-1,N,SX,SY,T,V> d;
             d(A + N, X, Y + SY);
         }
 };
 
-template<int N, int SX, int SY, class T>
-class _matvec<1,N,SX,SY,T>
+template<int N, int SX, int SY, class T, class V>
+class _matvec<1,N,SX,SY,T,V>
 {
     public:
-        inline void operator()(const T * A, const T * X, T * Y)
+        inline void operator()(const T * A, const V * X, V * Y)
         {
-            *Y += dot<N,1,SX,T>(A,X);
+            *Y += dot<N,1,SX>(A,X);
         }
 };
 
-template<int M, int N, int SX, int SY, class T>
-inline void matvec(const T * A, const T * X, T * Y)
+template<int M, int N, int SX, int SY, class T, class V>
+inline void matvec(const T * A, const V * X, V * Y)
 {
-    _matvec<M,N,SX,SY,T> d;
+    _matvec<M,N,SX,SY,T,V> d;
     d(A,X,Y);
 }
 
 
 /*
- *  Matrix Matrix Product C = A*B
+ *  Matrix Multivector Product Y += A*X
+ *
+ *  A is M*N
+ *  X is N*K
+ *  Y is M*K
+ *
+ *  where only the number of vectors K is a runtime value.  The loop
+ *  over a row of A has a constant trip count and is unrolled by the
+ *  compiler.
+ *
+ */
+template<int M, int N, class I, class T, class V>
+inline void matvecs(const I K, const T * A, const V * X, V * Y)
+{
+    for(int i = 0; i < M; i++){
+        const T * a = A + N*i;
+        for(I k = 0; k < K; k++){
+            V sum = Y[K*i + k];
+            for(int j = 0; j < N; j++){
+                sum += V(a[j]) * X[K*j + k];
+            }
+            Y[K*i + k] = sum;
+        }
+    }
+}
+
+
+/*
+ *  Matrix Matrix Product C += A*B
  *
  *  C is L*N
  *  A is L*M
  *  B is M*N
- * 
+ *
  */
 template<int L, int M, int N, int U, class T>
 class _matmat
@@ -572,6 +572,7 @@ INSTANTIATE_TYPEMAPS(unsigned int,            PyArray_UINT       )
 INSTANTIATE_TYPEMAPS(long,                    PyArray_LONG       )
 INSTANTIATE_TYPEMAPS(long long,               PyArray_LONGLONG   )
 INSTANTIATE_TYPEMAPS(unsigned long long,      PyArray_ULONGLONG  )
+INSTANTIATE_TYPEMAPS(npy_int64,               NPY_INT64          )
 INSTANTIATE_TYPEMAPS(float,                   PyArray_FLOAT      )
 INSTANTIATE_TYPEMAPS(double,                  PyArray_DOUBLE     )
 INSTANTIATE_TYPEMAPS(long double,             PyArray_LONGDOUBLE )
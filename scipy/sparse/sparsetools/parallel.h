@@ -0,0 +1,697 @@
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+/*
+ * parallel.h
+ *   A small persistent thread pool for the sparsetools kernels.
+ *
+ * Work is expressed as a set of independent chunks numbered
+ * 0 .. n_chunks-1.  The calling thread and the pool workers take
+ * chunks from a shared counter until every chunk has been processed.
+ * Workers are created on first use and then sleep between calls,
+ * so repeated products do not pay for thread creation.
+ *
+ * Threads are implemented with pthreads.  Define SPARSETOOLS_NO_THREADS
+ * (or build on a platform without pthreads) to get a serial build in
+ * which every parallel loop simply runs on the calling thread.
+ *
+ * Every extension module that includes this header gets its own copy
+ * of the pool and the settings below.  Modules other than
+ * scipy.sparse.sparsetools._parallel therefore call import_parallel()
+ * when they are initialized, after which the settings and parallel_run
+ * are forwarded to the pool of _parallel (see parallel_api.h).
+ *
+ */
+
+#include <vector>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "parallel_api.h"
+
+#if !defined(SPARSETOOLS_NO_THREADS) && !defined(_WIN32)
+#define SPARSETOOLS_HAVE_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+/*
+ * Interface for work that can be split into independent chunks
+ */
+class parallel_task
+{
+    public:
+        virtual ~parallel_task() {}
+        virtual void operator()(const int chunk) = 0;
+};
+
+
+/*
+ * Number of processors available to this process
+ */
+inline int hardware_num_threads()
+{
+#if defined(SPARSETOOLS_HAVE_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int) n : 1;
+#else
+    return 1;
+#endif
+}
+
+/*
+ * Initial thread count.  The environment variable
+ * SCIPY_SPARSE_NUM_THREADS overrides the processor count.
+ */
+inline int default_num_threads()
+{
+    const char * env = std::getenv("SCIPY_SPARSE_NUM_THREADS");
+    if (env != 0){
+        int n = std::atoi(env);
+        if (n > 0)
+            return n;
+    }
+    return hardware_num_threads();
+}
+
+inline int& num_threads_setting()
+{
+    static int n_threads = default_num_threads();
+    return n_threads;
+}
+
+inline long& parallel_threshold_setting()
+{
+    static long threshold = 1L << 16;
+    return threshold;
+}
+
+
+/*
+ * The settings of this module.  Only the module that owns the pool
+ * (scipy.sparse.sparsetools._parallel) uses these directly, the other
+ * modules go through the knobs below.
+ */
+inline int local_get_num_threads()
+{
+#ifdef SPARSETOOLS_HAVE_THREADS
+    return num_threads_setting();
+#else
+    return 1;
+#endif
+}
+
+inline void local_set_num_threads(const int n_threads)
+{
+    num_threads_setting() = (n_threads > 0) ? n_threads : hardware_num_threads();
+}
+
+inline long local_get_parallel_threshold()
+{
+    return parallel_threshold_setting();
+}
+
+inline void local_set_parallel_threshold(const long threshold)
+{
+    parallel_threshold_setting() = (threshold > 0) ? threshold : 0;
+}
+
+
+/*
+ * The pool shared by all extension modules, or 0 to use the pool and
+ * settings of this module
+ */
+inline const parallel_api *& shared_parallel_api()
+{
+    static const parallel_api * api = 0;
+    return api;
+}
+
+
+/*
+ * Thread count and size threshold knobs
+ *
+ *   set_num_threads(n)        - use n threads (n <= 0 selects one
+ *                               thread per processor)
+ *   set_parallel_threshold(w) - operations whose work estimate (roughly
+ *                               the number of nonzeros touched) is
+ *                               below w run serially
+ *
+ */
+inline int get_num_threads()
+{
+    if (shared_parallel_api() != 0)
+        return shared_parallel_api()->get_num_threads();
+    return local_get_num_threads();
+}
+
+inline void set_num_threads(const int n_threads)
+{
+    if (shared_parallel_api() != 0)
+        shared_parallel_api()->set_num_threads(n_threads);
+    else
+        local_set_num_threads(n_threads);
+}
+
+inline long get_parallel_threshold()
+{
+    if (shared_parallel_api() != 0)
+        return shared_parallel_api()->get_parallel_threshold();
+    return local_get_parallel_threshold();
+}
+
+inline void set_parallel_threshold(const long threshold)
+{
+    if (shared_parallel_api() != 0)
+        shared_parallel_api()->set_parallel_threshold(threshold);
+    else
+        local_set_parallel_threshold(threshold);
+}
+
+
+/*
+ * Compare-and-swap: if *ptr equals old_value, replace it by new_value
+ * and return true, otherwise return false.
+ *
+ * The update is atomic when SPARSETOOLS_HAVE_ATOMICS is defined (GCC
+ * compatible compilers).  Kernels that need atomicity must otherwise
+ * run serially.
+ */
+#if defined(SPARSETOOLS_HAVE_THREADS) && defined(__GNUC__)
+#define SPARSETOOLS_HAVE_ATOMICS
+#endif
+
+template <class I>
+inline bool atomic_compare_and_swap(I * ptr, const I old_value, const I new_value)
+{
+#ifdef SPARSETOOLS_HAVE_ATOMICS
+    return __sync_bool_compare_and_swap(ptr, old_value, new_value);
+#else
+    if (*ptr != old_value)
+        return false;
+    *ptr = new_value;
+    return true;
+#endif
+}
+
+/*
+ * Relaxed atomic load and store, for locations that other threads
+ * update concurrently (e.g. with atomic_compare_and_swap) where no
+ * ordering with other memory accesses is needed
+ */
+template <class I>
+inline I atomic_load_relaxed(const I * ptr)
+{
+#if defined(SPARSETOOLS_HAVE_ATOMICS) && defined(__ATOMIC_RELAXED)
+    return __atomic_load_n(ptr, __ATOMIC_RELAXED);
+#else
+    return *(const volatile I *) ptr;
+#endif
+}
+
+template <class I>
+inline void atomic_store_relaxed(I * ptr, const I value)
+{
+#if defined(SPARSETOOLS_HAVE_ATOMICS) && defined(__ATOMIC_RELAXED)
+    __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+#else
+    *(volatile I *) ptr = value;
+#endif
+}
+
+
+/*
+ * Mutex for state shared by the threads of the pool, a no-op in the
+ * serial build
+ */
+class parallel_mutex
+{
+    public:
+#ifdef SPARSETOOLS_HAVE_THREADS
+        parallel_mutex()  { pthread_mutex_init(&mutex, 0); }
+        ~parallel_mutex() { pthread_mutex_destroy(&mutex); }
+        void lock()       { pthread_mutex_lock(&mutex); }
+        void unlock()     { pthread_mutex_unlock(&mutex); }
+#else
+        void lock()       {}
+        void unlock()     {}
+#endif
+
+    private:
+#ifdef SPARSETOOLS_HAVE_THREADS
+        pthread_mutex_t mutex;
+#endif
+        parallel_mutex(const parallel_mutex&);
+        parallel_mutex& operator=(const parallel_mutex&);
+};
+
+// holds a parallel_mutex for the lifetime of the object
+class parallel_lock
+{
+    public:
+        explicit parallel_lock(parallel_mutex& mutex) : mutex(mutex) { mutex.lock(); }
+        ~parallel_lock() { mutex.unlock(); }
+
+    private:
+        parallel_mutex& mutex;
+        parallel_lock(const parallel_lock&);
+        parallel_lock& operator=(const parallel_lock&);
+};
+
+
+#ifdef SPARSETOOLS_HAVE_THREADS
+
+class thread_pool
+{
+    public:
+        static thread_pool& instance()
+        {
+            // never destroyed: the workers sleep until the process exits
+            static thread_pool * pool = new thread_pool();
+            return *pool;
+        }
+
+        /*
+         * Process chunks 0 .. n_chunks-1 of task using at most
+         * n_threads threads (including the calling thread).
+         *
+         * If the pool is already busy (e.g. a kernel running on a
+         * worker starts a nested parallel loop) the chunks are
+         * processed serially by the calling thread.
+         */
+        void run(parallel_task& task, const int n_chunks, const int n_threads)
+        {
+            if (n_chunks <= 0)
+                return;
+
+            if (n_threads <= 1 || n_chunks == 1 || pthread_mutex_trylock(&run_lock) != 0){
+                for(int n = 0; n < n_chunks; n++)
+                    task(n);
+                return;
+            }
+
+            pthread_mutex_lock(&lock);
+            spawn_workers(n_threads - 1);
+
+            current     = &task;
+            total       = n_chunks;
+            next_chunk  = 0;
+            pending     = n_chunks;
+            n_active    = n_threads - 1;
+            failed      = false;
+            generation++;
+            pthread_cond_broadcast(&work_ready);
+
+            process_chunks();
+
+            while (pending > 0)
+                pthread_cond_wait(&work_done, &lock);
+
+            current = 0;
+            bool had_failure = failed;
+            pthread_mutex_unlock(&lock);
+            pthread_mutex_unlock(&run_lock);
+
+            if (had_failure)
+                throw std::runtime_error("sparsetools: parallel kernel failed");
+        }
+
+    private:
+        struct worker_args {
+            thread_pool * pool;
+            int id;
+            unsigned long generation;  // last job the worker may ignore
+        };
+
+        thread_pool() : current(0), total(0), next_chunk(0), pending(0),
+                        n_active(0), generation(0), failed(false)
+        {
+            pthread_mutex_init(&lock, 0);
+            pthread_mutex_init(&run_lock, 0);
+            pthread_cond_init(&work_ready, 0);
+            pthread_cond_init(&work_done, 0);
+        }
+
+        // start workers until at least n exist (lock must be held)
+        void spawn_workers(const int n)
+        {
+            while ((int) workers.size() < n){
+                worker_args * args = new worker_args;
+                args->pool = this;
+                args->id   = (int) workers.size();
+                args->generation = generation;
+
+                pthread_t thread;
+                if (pthread_create(&thread, 0, &thread_pool::worker_main, args) != 0){
+                    delete args;
+                    break;  // run with the workers we have
+                }
+                pthread_detach(thread);
+                workers.push_back(thread);
+            }
+        }
+
+        // take chunks until none are left (lock must be held)
+        void process_chunks()
+        {
+            while (next_chunk < total){
+                const int chunk = next_chunk++;
+                parallel_task * task = current;
+
+                pthread_mutex_unlock(&lock);
+                bool ok = true;
+                try {
+                    (*task)(chunk);
+                } catch (...) {
+                    ok = false;
+                }
+                pthread_mutex_lock(&lock);
+
+                if (!ok)
+                    failed = true;
+                if (--pending == 0)
+                    pthread_cond_signal(&work_done);
+            }
+        }
+
+        static void * worker_main(void * arg)
+        {
+            worker_args * args = static_cast<worker_args *>(arg);
+            thread_pool * pool = args->pool;
+            const int id = args->id;
+            unsigned long seen = args->generation;
+            delete args;
+
+            pthread_mutex_lock(&pool->lock);
+            for(;;){
+                while (pool->generation == seen)
+                    pthread_cond_wait(&pool->work_ready, &pool->lock);
+                seen = pool->generation;
+
+                if (id < pool->n_active)
+                    pool->process_chunks();
+            }
+            return 0;
+        }
+
+        pthread_mutex_t lock;        // protects everything below
+        pthread_mutex_t run_lock;    // held by the thread that owns the pool
+        pthread_cond_t  work_ready;
+        pthread_cond_t  work_done;
+
+        std::vector<pthread_t> workers;
+
+        parallel_task * current;
+        int total;
+        int next_chunk;
+        int pending;
+        int n_active;
+        unsigned long generation;
+        bool failed;
+};
+
+#endif
+
+
+/*
+ * Process chunks 0 .. n_chunks-1 of task on the pool of this module
+ */
+inline void local_parallel_run(parallel_task& task, const int n_chunks)
+{
+#ifdef SPARSETOOLS_HAVE_THREADS
+    thread_pool::instance().run(task, n_chunks, local_get_num_threads());
+#else
+    for(int n = 0; n < n_chunks; n++)
+        task(n);
+#endif
+}
+
+// parallel_chunk_function that runs a chunk of a parallel_task
+inline int parallel_task_chunk(void * arg, int chunk)
+{
+    try {
+        (*static_cast<parallel_task *>(arg))(chunk);
+    } catch (...) {
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Process chunks 0 .. n_chunks-1 of task on the thread pool
+ */
+inline void parallel_run(parallel_task& task, const int n_chunks)
+{
+    if (shared_parallel_api() == 0){
+        local_parallel_run(task, n_chunks);
+        return;
+    }
+    if (shared_parallel_api()->run(&parallel_task_chunk, &task, n_chunks) != 0)
+        throw std::runtime_error("sparsetools: parallel kernel failed");
+}
+
+
+/*
+ * parallel_api::run of the module that owns the pool
+ */
+class chunk_function_task : public parallel_task
+{
+    public:
+        chunk_function_task(parallel_chunk_function function, void * arg)
+            : function(function), arg(arg) {}
+
+        void operator()(const int chunk)
+        {
+            if (function(arg, chunk) != 0)
+                throw std::runtime_error("sparsetools: parallel kernel failed");
+        }
+
+    private:
+        parallel_chunk_function function;
+        void * arg;
+};
+
+inline int local_parallel_run_chunks(parallel_chunk_function function,
+                                     void * arg,
+                                     int n_chunks)
+{
+    chunk_function_task task(function, arg);
+    try {
+        local_parallel_run(task, n_chunks);
+    } catch (...) {
+        return -1;
+    }
+    return 0;
+}
+
+
+#ifdef Py_PYTHON_H
+/*
+ * Use the pool of scipy.sparse.sparsetools._parallel.  Returns 0 on
+ * success and -1 with a Python exception set on failure.  Call it
+ * through the macro import_parallel() in the initialization function
+ * of an extension module, after import_array().
+ */
+inline int parallel_import()
+{
+    PyObject * module = PyImport_ImportModule("scipy.sparse.sparsetools._parallel");
+    if (module == NULL)
+        return -1;
+
+    PyObject * c_api = PyObject_GetAttrString(module, "_C_API");
+    Py_DECREF(module);
+    if (c_api == NULL)
+        return -1;
+
+    const parallel_api * api = (const parallel_api *) PARALLEL_API_FROM_C_API(c_api);
+    Py_DECREF(c_api);
+    if (api == NULL)
+        return -1;
+
+    if (api->version != PARALLEL_API_VERSION){
+        PyErr_SetString(PyExc_ImportError,
+                        "scipy.sparse.sparsetools._parallel has the wrong version");
+        return -1;
+    }
+
+    shared_parallel_api() = api;
+    return 0;
+}
+
+#define import_parallel()                                                \
+    {                                                                    \
+        if (parallel_import() < 0) {                                     \
+            PyErr_Print();                                               \
+            PyErr_SetString(PyExc_ImportError,                           \
+                "scipy.sparse.sparsetools._parallel failed to import");  \
+            return NUMPY_IMPORT_ARRAY_RETVAL;                            \
+        }                                                                \
+    }
+#endif
+
+
+/*
+ * Split the rows of a compressed matrix into n_parts contiguous
+ * ranges of roughly equal work.  The work of row i is taken to be
+ * (Wp[i+1] - Wp[i]) + 1 so that long runs of empty rows are also
+ * distributed.  Normally Wp is the row pointer Ap, but any
+ * nondecreasing cumulative work estimate may be used.
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows
+ *   W  Wp[n_row+1]     - cumulative work (e.g. row pointer)
+ *   I  n_parts         - number of ranges
+ *
+ * Output Arguments:
+ *   I  parts[n_parts+1] - range boundaries, rows of part k are
+ *                         parts[k] <= i < parts[k+1]
+ *
+ * Note:
+ *   Complexity: O(n_parts * log(n_row))
+ *
+ */
+template <class I, class W>
+void partition_rows(const I n_row,
+                    const W Wp[],
+                    const I n_parts,
+                          I parts[])
+{
+    const double total = (double) (Wp[n_row] - Wp[0]) + (double) n_row;
+
+    parts[0] = 0;
+    for(I k = 1; k < n_parts; k++){
+        const double target = total * k / n_parts;
+
+        // smallest i with (Wp[i] - Wp[0]) + i >= target
+        I lo = parts[k-1];
+        I hi = n_row;
+        while (lo < hi){
+            I mid = lo + (hi - lo) / 2;
+            if ((double) (Wp[mid] - Wp[0]) + (double) mid < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        parts[k] = lo;
+    }
+    parts[n_parts] = n_row;
+}
+
+
+/*
+ * Adapts a row kernel, i.e. a functor with
+ *   void operator()(const I row_start, const I row_end)
+ * to the parallel_task interface
+ */
+template <class I, class kernel_type>
+class row_range_task : public parallel_task
+{
+    public:
+        row_range_task(const I * parts, kernel_type& kernel)
+            : parts(parts), kernel(kernel) {}
+
+        void operator()(const int chunk)
+        {
+            kernel(parts[chunk], parts[chunk + 1]);
+        }
+
+    private:
+        const I * parts;
+        kernel_type& kernel;
+};
+
+
+/*
+ * Number of chunks to use for an operation with the given work
+ * estimate, or 1 if the operation should run serially
+ */
+inline int parallel_num_chunks(const double work)
+{
+    const int n_threads = get_num_threads();
+    if (n_threads <= 1 || work < (double) get_parallel_threshold())
+        return 1;
+    return n_threads;
+}
+
+
+/*
+ * Apply a row kernel to rows [0, n_row) of a compressed matrix.
+ *
+ * The rows are split into nnz-balanced ranges, one per thread, and
+ * each range is processed by exactly one call to kernel.  Kernels
+ * must therefore only write to output locations owned by their rows,
+ * but may allocate per-call scratch space.  Small problems (see
+ * set_parallel_threshold) are handled by a single serial call
+ * kernel(0, n_row).
+ *
+ * Input Arguments:
+ *   I  n_row           - number of rows
+ *   W  Wp[n_row+1]     - row pointer (or other cumulative work)
+ *   kernel             - row kernel
+ *   nnz_cost           - work per unit of Wp relative to a scalar
+ *                        multiply-add (e.g. R*C for BSR blocks)
+ *
+ */
+template <class I, class W, class kernel_type>
+void parallel_for_rows(const I n_row,
+                       const W Wp[],
+                       kernel_type& kernel,
+                       const double nnz_cost = 1.0)
+{
+    const double work = nnz_cost * (double) (Wp[n_row] - Wp[0]) + (double) n_row;
+
+    I n_parts = (I) parallel_num_chunks(work);
+    if (n_parts > n_row)
+        n_parts = n_row;
+
+    if (n_parts <= 1){
+        kernel((I) 0, n_row);
+        return;
+    }
+
+    std::vector<I> parts(n_parts + 1);
+    partition_rows(n_row, Wp, n_parts, &parts[0]);
+
+    row_range_task<I, kernel_type> task(&parts[0], kernel);
+    parallel_run(task, (int) n_parts);
+}
+
+/*
+ * Apply a range kernel, i.e. a functor with
+ *   void operator()(const I start, const I end)
+ * to [0, n) split into parts of equal length, one per thread.  For
+ * loops whose iterations have about the same cost, e.g. one per entry
+ * of an index array.
+ *
+ * Input Arguments:
+ *   I  n               - number of iterations
+ *   kernel             - range kernel
+ *   cost               - work per iteration relative to a scalar
+ *                        multiply-add
+ *
+ */
+template <class I, class kernel_type>
+void parallel_for_range(const I n,
+                        kernel_type& kernel,
+                        const double cost = 1.0)
+{
+    I n_parts = (I) parallel_num_chunks(cost * (double) n);
+    if (n_parts > n)
+        n_parts = n;
+
+    if (n_parts <= 1){
+        kernel((I) 0, n);
+        return;
+    }
+
+    std::vector<I> parts(n_parts + 1);
+    for(I k = 0; k < n_parts; k++)
+        parts[k] = (I) (((double) n * k) / n_parts);
+    parts[n_parts] = n;
+
+    row_range_task<I, kernel_type> task(&parts[0], kernel);
+    parallel_run(task, (int) n_parts);
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __PARALLEL_API_H__
+#define __PARALLEL_API_H__
+
+/*
+ * parallel_api.h
+ *   C interface to the thread pool of parallel.h
+ *
+ * The extension module scipy.sparse.sparsetools._parallel owns the
+ * thread pool and its settings and exports a parallel_api structure
+ * as the capsule _parallel._C_API.  The other extension modules that
+ * run parallel kernels use it, so that a process has one set of worker
+ * threads and one thread count.
+ *
+ * This header is plain C.  Included after Python.h, it also provides
+ * PARALLEL_API_FROM_C_API, which reads the structure from the capsule.
+ */
+
+#define PARALLEL_API_VERSION 1
+
+/*
+ * A chunk of work: called with arg and a chunk number, returns 0 on
+ * success and nonzero on failure
+ */
+typedef int (*parallel_chunk_function)(void * arg, int chunk);
+
+typedef struct {
+    int  version;   /* PARALLEL_API_VERSION */
+
+    int  (*get_num_threads)(void);
+    void (*set_num_threads)(int n_threads);
+    long (*get_parallel_threshold)(void);
+    void (*set_parallel_threshold)(long threshold);
+
+    /* process chunks 0 .. n_chunks-1 on the pool, returns 0 on
+       success and -1 if a chunk failed */
+    int  (*run)(parallel_chunk_function function, void * arg, int n_chunks);
+} parallel_api;
+
+/*
+ * The parallel_api in the capsule _C_API, or NULL with an exception set.
+ * The capsule is a PyCObject before Python 3.1.
+ */
+#ifdef Py_PYTHON_H
+#if PY_VERSION_HEX < 0x03010000
+#define PARALLEL_API_FROM_C_API(c_api) PyCObject_AsVoidPtr(c_api)
+#else
+#define PARALLEL_API_FROM_C_API(c_api) PyCapsule_GetPointer(c_api, 0)
+#endif
+#endif
+
+#endif
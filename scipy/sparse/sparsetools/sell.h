@@ -0,0 +1,290 @@
+#ifndef __SELL_H__
+#define __SELL_H__
+
+/*
+ * sell.h
+ *   Kernels for the SELL-C-sigma (sliced ELLPACK) format.
+ *
+ * The rows of an n_row by n_col matrix are first sorted by decreasing
+ * length inside windows of sigma consecutive rows.  The sorted rows
+ * are then cut into chunks of C rows and each chunk is stored as a
+ * dense C by width(chunk) ELLPACK block in column-major order, so that
+ * the k-th entries of the C rows of a chunk are adjacent in memory:
+ *
+ *   perm[n_row]          - perm[C*c + r] is the row of A stored in
+ *                          lane r of chunk c
+ *   Bp[n_chunks+1]       - chunk c occupies Bj[Bp[c]:Bp[c+1]],
+ *                          so width(c) = (Bp[c+1] - Bp[c]) / C
+ *   Bj[Bp[n_chunks]]     - column indices, entry k of lane r of chunk
+ *                          c is stored at Bp[c] + C*k + r
+ *   Bx[Bp[n_chunks]]     - nonzeros
+ *
+ * where n_chunks = ceil(n_row / C).  Lanes shorter than the chunk width
+ * are padded with column index -1 and value 0.  Sorting keeps rows of
+ * similar length in the same chunk, so the padding stays small even
+ * when the row lengths vary a lot, while C adjacent rows can be
+ * processed by one SIMD instruction.  See
+ *
+ *   "A unified sparse matrix data format for efficient general sparse
+ *    matrix-vector multiplication on modern processors with wide SIMD
+ *    units", M. Kreutzer et al., SIAM J. Sci. Comput. 36(5), 2014
+ *
+ * On x86 the SpMV kernel uses AVX-512 or AVX2 gathers when the
+ * processor supports them, the indices are int and C is a multiple of
+ * the vector length.  Define SPARSETOOLS_NO_SIMD to always use the
+ * portable kernel.
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "parallel.h"
+
+#if !defined(SPARSETOOLS_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define SPARSETOOLS_HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+
+/*
+ * Compute the partial products of one chunk
+ *
+ *   acc[r] = sum_k Bx[C*k + r] * Xx[Bj[C*k + r]]   for 0 <= r < C
+ *
+ * skipping padding entries.  sell_chunk<I,T>::product() is specialized
+ * below to use SIMD gathers where available.
+ */
+template <class I, class T>
+void sell_chunk_product(const I C,
+                        const I width,
+                        const I Bj[],
+                        const T Bx[],
+                        const T Xx[],
+                              T acc[])
+{
+    for(I r = 0; r < C; r++){
+        acc[r] = 0;
+    }
+    for(I k = 0; k < width; k++){
+        const I * j = Bj + C*k;
+        const T * x = Bx + C*k;
+        for(I r = 0; r < C; r++){
+            if(j[r] >= 0){
+                acc[r] += x[r] * Xx[j[r]];
+            }
+        }
+    }
+}
+
+template <class I, class T>
+struct sell_chunk
+{
+    static void product(const I C, const I width, const I Bj[],
+                        const T Bx[], const T Xx[], T acc[])
+    {
+        sell_chunk_product(C, width, Bj, Bx, Xx, acc);
+    }
+};
+
+
+#ifdef SPARSETOOLS_HAVE_X86_SIMD
+
+inline bool cpu_has_avx2()
+{
+    static const bool avx2 = (__builtin_cpu_init(),
+                              __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"));
+    return avx2;
+}
+
+inline bool cpu_has_avx512()
+{
+    static const bool avx512 = (__builtin_cpu_init(), __builtin_cpu_supports("avx512f"));
+    return avx512;
+}
+
+/*
+ * The SIMD kernels take the lanes of a chunk a vector at a time and
+ * gather Xx through a mask that excludes the padding (Bj < 0).
+ * Results may differ from csr_matvec() in the last bits because the
+ * products are accumulated with fused multiply-adds.
+ */
+__attribute__((target("avx2,fma")))
+inline void sell_chunk_avx2(const int C, const int width, const int Bj[],
+                            const double Bx[], const double Xx[], double acc[])
+{
+    const __m128i none = _mm_set1_epi32(-1);
+    for(int r = 0; r < C; r += 4){
+        __m256d sum = _mm256_setzero_pd();
+        for(int k = 0; k < width; k++){
+            const int n = C*k + r;
+            const __m128i j    = _mm_loadu_si128((const __m128i *) (Bj + n));
+            const __m256d mask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpgt_epi32(j, none)));
+            const __m256d x    = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), Xx, j, mask, 8);
+            sum = _mm256_fmadd_pd(_mm256_loadu_pd(Bx + n), x, sum);
+        }
+        _mm256_storeu_pd(acc + r, sum);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+inline void sell_chunk_avx2(const int C, const int width, const int Bj[],
+                            const float Bx[], const float Xx[], float acc[])
+{
+    const __m256i none = _mm256_set1_epi32(-1);
+    for(int r = 0; r < C; r += 8){
+        __m256 sum = _mm256_setzero_ps();
+        for(int k = 0; k < width; k++){
+            const int n = C*k + r;
+            const __m256i j    = _mm256_loadu_si256((const __m256i *) (Bj + n));
+            const __m256  mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(j, none));
+            const __m256  x    = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), Xx, j, mask, 4);
+            sum = _mm256_fmadd_ps(_mm256_loadu_ps(Bx + n), x, sum);
+        }
+        _mm256_storeu_ps(acc + r, sum);
+    }
+}
+
+__attribute__((target("avx512f")))
+inline void sell_chunk_avx512(const int C, const int width, const int Bj[],
+                              const double Bx[], const double Xx[], double acc[])
+{
+    const __m512i none = _mm512_set1_epi32(-1);
+    for(int r = 0; r < C; r += 8){
+        __m512d sum = _mm512_setzero_pd();
+        for(int k = 0; k < width; k++){
+            const int n = C*k + r;
+            const __m256i   j    = _mm256_loadu_si256((const __m256i *) (Bj + n));
+            const __mmask8  mask = (__mmask8) _mm512_cmpgt_epi32_mask(_mm512_castsi256_si512(j), none);
+            const __m512d   x    = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, j, Xx, 8);
+            sum = _mm512_fmadd_pd(_mm512_loadu_pd(Bx + n), x, sum);
+        }
+        _mm512_storeu_pd(acc + r, sum);
+    }
+}
+
+__attribute__((target("avx512f")))
+inline void sell_chunk_avx512(const int C, const int width, const int Bj[],
+                              const float Bx[], const float Xx[], float acc[])
+{
+    const __m512i none = _mm512_set1_epi32(-1);
+    for(int r = 0; r < C; r += 16){
+        __m512 sum = _mm512_setzero_ps();
+        for(int k = 0; k < width; k++){
+            const int n = C*k + r;
+            const __m512i   j    = _mm512_loadu_si512((const void *) (Bj + n));
+            const __mmask16 mask = _mm512_cmpgt_epi32_mask(j, none);
+            const __m512    x    = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, j, Xx, 4);
+            sum = _mm512_fmadd_ps(_mm512_loadu_ps(Bx + n), x, sum);
+        }
+        _mm512_storeu_ps(acc + r, sum);
+    }
+}
+
+template <>
+struct sell_chunk<int, double>
+{
+    static void product(const int C, const int width, const int Bj[],
+                        const double Bx[], const double Xx[], double acc[])
+    {
+        if(C % 8 == 0 && cpu_has_avx512())
+            sell_chunk_avx512(C, width, Bj, Bx, Xx, acc);
+        else if(C % 4 == 0 && cpu_has_avx2())
+            sell_chunk_avx2(C, width, Bj, Bx, Xx, acc);
+        else
+            sell_chunk_product(C, width, Bj, Bx, Xx, acc);
+    }
+};
+
+template <>
+struct sell_chunk<int, float>
+{
+    static void product(const int C, const int width, const int Bj[],
+                        const float Bx[], const float Xx[], float acc[])
+    {
+        if(C % 16 == 0 && cpu_has_avx512())
+            sell_chunk_avx512(C, width, Bj, Bx, Xx, acc);
+        else if(C % 8 == 0 && cpu_has_avx2())
+            sell_chunk_avx2(C, width, Bj, Bx, Xx, acc);
+        else
+            sell_chunk_product(C, width, Bj, Bx, Xx, acc);
+    }
+};
+
+#endif
+
+
+
+/*
+ * Compute Y += A*X for SELL-C-sigma matrix A and dense vectors X,Y
+ *
+ *
+ * Input Arguments:
+ *   I  n_row                 - number of rows in A
+ *   I  n_col                 - number of columns in A
+ *   I  C                     - chunk height
+ *   I  perm[n_row]           - row of A stored in each lane
+ *   I  Bp[n_chunks+1]        - chunk pointer
+ *   I  Bj[Bp[n_chunks]]      - column indices
+ *   T  Bx[Bp[n_chunks]]      - nonzeros
+ *   T  Xx[n_col]             - input vector
+ *
+ * Output Arguments:
+ *   T  Yx[n_row]             - output vector
+ *
+ * Note:
+ *   Output array Yx must be preallocated
+ *
+ *   Complexity: Linear.  Specifically O(Bp[n_chunks] + n_row)
+ *
+ *   Large matrices are processed in parallel by splitting the chunks
+ *   into ranges of equal storage (see parallel.h).
+ *
+ */
+template <class I, class T>
+struct sell_matvec_kernel
+{
+    I n_row;
+    I C;
+    const I * perm;
+    const I * Bp;
+    const I * Bj;
+    const T * Bx;
+    const T * Xx;
+          T * Yx;
+
+    void operator()(const I chunk_start, const I chunk_end)
+    {
+        std::vector<T> acc(C);
+
+        for(I c = chunk_start; c < chunk_end; c++){
+            const I width = (Bp[c+1] - Bp[c]) / C;
+            sell_chunk<I,T>::product(C, width, Bj + Bp[c], Bx + Bp[c], Xx, &acc[0]);
+
+            const I lanes = std::min(C, n_row - C*c);
+            for(I r = 0; r < lanes; r++){
+                Yx[perm[C*c + r]] += acc[r];
+            }
+        }
+    }
+};
+
+template <class I, class T>
+void sell_matvec(const I n_row,
+	             const I n_col,
+                 const I C,
+	             const I perm[],
+	             const I Bp[],
+	             const I Bj[],
+	             const T Bx[],
+	             const T Xx[],
+	                   T Yx[])
+{
+    const I n_chunks = (n_row + C - 1) / C;
+
+    sell_matvec_kernel<I,T> kernel = {n_row, C, perm, Bp, Bj, Bx, Xx, Yx};
+    parallel_for_rows(n_chunks, Bp, kernel);
+}
+
+#endif
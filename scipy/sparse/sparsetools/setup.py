@@ -1,18 +1,38 @@
 #!/usr/bin/env python
 
 def configuration(parent_package='',top_path=None):
+    import sys
     import numpy
     from numpy.distutils.misc_util import Configuration
 
     config = Configuration('sparsetools',parent_package,top_path)
 
+    # the parallel kernels (parallel.h) use pthreads where available
+    if sys.platform == 'win32':
+        libraries = []
+    else:
+        libraries = ['pthread']
+
     for fmt in ['csr','csc','coo','bsr','dia','csgraph']:
         sources = [ fmt + '_wrap.cxx' ]
-        depends = [ fmt + '.h' ]
+        depends = [ fmt + '.h', 'parallel.h', 'parallel_api.h', 'sell.h',
+                    'transpose.h', 'workspace.h' ]
         config.add_extension('_' + fmt, sources=sources,
             define_macros=[('__STDC_FORMAT_MACROS', 1)],
+            libraries=libraries,
             depends=depends)
 
+    # owner of the thread pool that the other modules share (parallel_api.h)
+    config.add_extension('_parallel', sources=['_parallel.cxx'],
+        libraries=libraries,
+        depends=['parallel.h', 'parallel_api.h'])
+
+    config.add_extension('_assembler', sources=['_assembler.cxx'],
+        define_macros=[('__STDC_FORMAT_MACROS', 1)],
+        libraries=libraries,
+        depends=['assemble.h', 'complex_ops.h', 'parallel.h',
+                 'parallel_api.h', 'transpose.h', 'workspace.h'])
+
     return config
 
 if __name__ == '__main__':
@@ -19,9 +19,34 @@
 
 %init %{
     import_array();
+    import_parallel();
 %}
 
 
+%{
+#include "parallel.h"
+%}
+
+ /*
+  * Thread count and size threshold of the parallel kernels (parallel.h)
+  */
+int  get_num_threads();
+void set_num_threads(const int n_threads);
+long get_parallel_threshold();
+void set_parallel_threshold(const long threshold);
+
+
+%{
+#include "workspace.h"
+%}
+
+ /*
+  * Scratch arrays kept between calls (workspace.h)
+  */
+long get_workspace_allocations();
+void clear_workspaces();
+
+
 
  /*
   * IN types
@@ -37,7 +62,15 @@
     const ctype Cp [ ],
     const ctype Ci [ ],	
     const ctype Cj [ ],
-    const ctype offsets [ ]
+    const ctype offsets [ ],
+    const ctype perm [ ],
+    const ctype Pp [ ],
+    const ctype Pm [ ],
+    const ctype rows [ ],
+    const ctype cols [ ],
+    const ctype col_offsets [ ],
+    const ctype col_order [ ],
+    const ctype diag_map [ ]
 };
 %enddef
 
@@ -103,7 +136,13 @@
   ctype Cp [ ],
   ctype Ci [ ],
   ctype Cj [ ],
-  ctype flag [ ]
+  ctype flag [ ],
+  ctype perm [ ],
+  ctype Pp [ ],
+  ctype Pm [ ],
+  ctype col_offsets [ ],
+  ctype col_order [ ],
+  ctype diag_map [ ]
 };
 %enddef
 
@@ -118,7 +157,8 @@
 
 %define T_INPLACE_ARRAY2( ctype )
 %apply ctype * INPLACE_ARRAY2 {
-  ctype Mx [ ]
+  ctype Mx    [ ],
+  ctype diags [ ]
 };
 %enddef
 
@@ -143,8 +183,16 @@ T_INPLACE_ARRAY2( ctype )
 
 /*
  * Create all desired index and data types here
+ *
+ * npy_int64 is a typedef that SWIG does not see, so its scalars are
+ * converted like long long.  The 32-bit instantiations come first and
+ * int64 arrays cannot be cast safely to int, so the overload dispatch
+ * picks the 64-bit kernels exactly when the index arrays are int64.
  */
+%apply long long { npy_int64 };
+
 DECLARE_INDEX_TYPE( int       )
+DECLARE_INDEX_TYPE( npy_int64 )
 
 DECLARE_DATA_TYPE( signed char             )
 DECLARE_DATA_TYPE( unsigned char           )
@@ -187,13 +235,43 @@ DECLARE_DATA_TYPE( npy_clongdouble_wrapper )
 %template(f_name)   f_name<int,npy_cfloat_wrapper>;
 %template(f_name)   f_name<int,npy_cdouble_wrapper>;
 %template(f_name)   f_name<int,npy_clongdouble_wrapper>;
-/* 64-bit indices would go here */
+/* 64-bit indices */
+%template(f_name)   f_name<npy_int64,signed char>;
+%template(f_name)   f_name<npy_int64,unsigned char>;
+%template(f_name)   f_name<npy_int64,short>;
+%template(f_name)   f_name<npy_int64,unsigned short>;
+%template(f_name)   f_name<npy_int64,int>;
+%template(f_name)   f_name<npy_int64,unsigned int>;
+%template(f_name)   f_name<npy_int64,long long>;
+%template(f_name)   f_name<npy_int64,unsigned long long>;
+%template(f_name)   f_name<npy_int64,float>;
+%template(f_name)   f_name<npy_int64,double>;
+%template(f_name)   f_name<npy_int64,long double>;
+%template(f_name)   f_name<npy_int64,npy_cfloat_wrapper>;
+%template(f_name)   f_name<npy_int64,npy_cdouble_wrapper>;
+%template(f_name)   f_name<npy_int64,npy_clongdouble_wrapper>;
 %enddef
 
 
 %define INSTANTIATE_INDEX( f_name )
 /* 32-bit indices */
 %template(f_name)   f_name<int>;
-/* 64-bit indices would go here */
+/* 64-bit indices */
+%template(f_name)   f_name<npy_int64>;
+%enddef
+
+
+ /*
+  * Kernels with values of type T and vectors of a wider type V, used
+  * by the Python side when the upcast of the matrix and vector types
+  * differs from the matrix type (see sputils.mixed_dtypes)
+  */
+%define INSTANTIATE_MIXED( f_name )
+/* 32-bit indices */
+%template(f_name)   f_name<int,float,double>;
+%template(f_name)   f_name<int,npy_cfloat_wrapper,npy_cdouble_wrapper>;
+/* 64-bit indices */
+%template(f_name)   f_name<npy_int64,float,double>;
+%template(f_name)   f_name<npy_int64,npy_cfloat_wrapper,npy_cdouble_wrapper>;
 %enddef
 
@@ -0,0 +1,335 @@
+#ifndef __TRANSPOSE_H__
+#define __TRANSPOSE_H__
+
+/*
+ * transpose.h
+ *   Parallel bucket scatter used to transpose compressed matrices
+ *   (csr_tocsc, bsr_transpose) and to compress COO matrices
+ *   (coo_tocsr, coo_tocsc).
+ *
+ * Every entry of the input has a key, the row it belongs to in the
+ * output, and is moved to the bucket of that key in input order:
+ *
+ *   1. The input is split into one part per thread and each part
+ *      counts its entries per bucket.
+ *   2. A prefix sum over (bucket, part) gives each part its own write
+ *      position in every bucket, so the parts scatter independently
+ *      and the result is identical to a serial stable scatter.
+ *
+ * A direct scatter writes to as many places as there are keys.  With
+ * many keys these writes miss the caches and the TLB, so the keys are
+ * grouped into blocks of consecutive keys and the scatter is done in
+ * two rounds: first by block into a temporary buffer, then within
+ * each block to the final place.  Each round writes to about
+ * sqrt(n_keys) places at a time, which stay in L2.  The temporary
+ * buffer holds a copy of the entries, so this is only done for more
+ * than about a million keys, where the direct scatter is slower.
+ *
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "parallel.h"
+
+
+/*
+ * Entry sources
+ *
+ * A source describes the entries of the input:
+ *   size()               - number of entries
+ *   split(n, parts)      - cut the input into n ranges with roughly
+ *                          equal numbers of entries
+ *   visit(s, e, v)       - call v(key, index, value) for each entry
+ *                          of range [s, e) in input order
+ *
+ * The index is stored in the output next to the value.
+ */
+
+// entries (column, row, value) of a CSR matrix
+template <class I, class T>
+struct csr_entries
+{
+    I n_row;
+    const I * Ap;
+    const I * Aj;
+    const T * Ax;
+
+    I size() const { return Ap[n_row]; }
+
+    void split(const I n_parts, I parts[]) const
+    {
+        partition_rows(n_row, Ap, n_parts, parts);
+    }
+
+    template <class visitor>
+    void visit(const I start, const I end, visitor& v) const
+    {
+        for(I i = start; i < end; i++){
+            for(I jj = Ap[i]; jj < Ap[i+1]; jj++){
+                v(Aj[jj], i, Ax[jj]);
+            }
+        }
+    }
+};
+
+// entries (row, column, value) of a COO matrix
+template <class I, class T>
+struct coo_entries
+{
+    I nnz;
+    const I * Ai;
+    const I * Aj;
+    const T * Ax;
+
+    I size() const { return nnz; }
+
+    void split(const I n_parts, I parts[]) const
+    {
+        for(I k = 0; k <= n_parts; k++){
+            parts[k] = (I) ((double) nnz * k / n_parts);
+        }
+        parts[n_parts] = nnz;
+    }
+
+    template <class visitor>
+    void visit(const I start, const I end, visitor& v) const
+    {
+        for(I n = start; n < end; n++){
+            v(Ai[n], Aj[n], Ax[n]);
+        }
+    }
+};
+
+
+/*
+ * Visitors
+ */
+template <class I>
+struct bucket_counter
+{
+    I shift;
+    I * count;
+
+    template <class T>
+    void operator()(const I key, const I, const T&)
+    {
+        count[key >> shift]++;
+    }
+};
+
+template <class I, class T>
+struct bucket_writer
+{
+    I   shift;
+    I * next;
+    I * Bk;    // keys, or 0 if not needed
+    I * Bi;
+    T * Bx;
+
+    void operator()(const I key, const I index, const T& value)
+    {
+        const I dest = next[key >> shift]++;
+        if (Bk != 0)
+            Bk[dest] = key;
+        Bi[dest] = index;
+        Bx[dest] = value;
+    }
+};
+
+
+/*
+ * Run one visitor per part of a source on the thread pool
+ */
+template <class I, class source_type, class visitor_type>
+class bucket_visit_task : public parallel_task
+{
+    public:
+        bucket_visit_task(const source_type& src, const I * parts, visitor_type * visitors)
+            : src(src), parts(parts), visitors(visitors) {}
+
+        void operator()(const int chunk)
+        {
+            src.visit(parts[chunk], parts[chunk + 1], visitors[chunk]);
+        }
+
+    private:
+        const source_type& src;
+        const I * parts;
+        visitor_type * visitors;
+};
+
+
+/*
+ * Second round of the blocked scatter: move the entries of each
+ * block of keys from the temporary buffer to their final place and
+ * fill in the bucket pointer of the keys of the block
+ */
+template <class I, class T>
+class bucket_block_task : public parallel_task
+{
+    public:
+        bucket_block_task(const I n_keys, const I shift, const I * block_ptr,
+                          const I * Tk, const I * Ti, const T * Tx,
+                          I * Bp, I * Bi, T * Bx)
+            : n_keys(n_keys), shift(shift), block_ptr(block_ptr),
+              Tk(Tk), Ti(Ti), Tx(Tx), Bp(Bp), Bi(Bi), Bx(Bx) {}
+
+        void operator()(const int chunk)
+        {
+            const I block = (I) chunk;
+            const I k_start = block << shift;
+            const I k_end   = std::min(n_keys, k_start + ((I) 1 << shift));
+            const I start   = block_ptr[block];
+            const I end     = block_ptr[block + 1];
+
+            std::vector<I> next(k_end - k_start + 1, 0);
+            for(I n = start; n < end; n++){
+                next[Tk[n] - k_start]++;
+            }
+            for(I k = k_start, cumsum = start; k < k_end; k++){
+                const I temp = next[k - k_start];
+                next[k - k_start] = cumsum;
+                Bp[k] = cumsum;
+                cumsum += temp;
+            }
+            for(I n = start; n < end; n++){
+                const I dest = next[Tk[n] - k_start]++;
+                Bi[dest] = Ti[n];
+                Bx[dest] = Tx[n];
+            }
+        }
+
+    private:
+        const I n_keys;
+        const I shift;
+        const I * block_ptr;
+        const I * Tk;
+        const I * Ti;
+        const T * Tx;
+        I * Bp;
+        I * Bi;
+        T * Bx;
+};
+
+
+/*
+ * Keys per block of the blocked scatter, as a power of two, or 0 if
+ * the keys can be scattered directly.  Blocks of about sqrt(n_keys)
+ * keys balance the number of places written by the two rounds.
+ */
+template <class I>
+I bucket_block_shift(const I n_keys, const I nnz)
+{
+    // direct scatter while the keys fit in the caches, or with too
+    // few entries to amortize the extra copy
+    if (n_keys <= (1 << 20) || nnz < n_keys)
+        return 0;
+
+    // smallest shift with 4^shift >= n_keys, computed without
+    // shifting past the width of I
+    I shift = 0;
+    for(size_t rest = (size_t) n_keys - 1; rest > 0; rest >>= 2)
+        shift++;
+    return shift;
+}
+
+
+/*
+ * Stable scatter of the entries of src into buckets by key
+ *
+ * Input Arguments:
+ *   I  n_keys          - number of buckets
+ *   src                - entry source (see above)
+ *
+ * Output Arguments:
+ *   I  Bp[n_keys+1]    - bucket pointer
+ *   I  Bi[size]        - indices of the entries
+ *   T  Bx[size]        - values of the entries
+ *
+ * Note:
+ *   Output arrays Bp, Bi, Bx must be preallocated
+ *   Within each bucket the entries keep their input order.
+ *
+ *   Complexity: Linear.  Specifically O(size + n_keys)
+ *
+ *   Inputs with fewer entries than keys (e.g. a tall, very sparse
+ *   matrix) are scattered serially.
+ *
+ */
+template <class I, class T, class source_type>
+void bucket_scatter(const I n_keys,
+                    const source_type& src,
+                          I Bp[],
+                          I Bi[],
+                          T Bx[])
+{
+    const I nnz   = src.size();
+    const I shift = bucket_block_shift(n_keys, nnz);
+    const I n_buckets = (n_keys == 0) ? 0 : ((n_keys - 1) >> shift) + 1;
+
+    // each part counts into its own n_buckets counters, so with fewer
+    // entries than keys the counters and their prefix sum would cost
+    // more than a serial counting sort
+    I n_parts = (nnz < n_keys) ? 1 : (I) parallel_num_chunks((double) nnz);
+    std::vector<I> parts(n_parts + 1);
+    src.split(n_parts, &parts[0]);
+
+    // 1. count entries per (part, bucket)
+    std::vector<I> count((size_t) n_parts * n_buckets + 1, 0);
+    {
+        std::vector< bucket_counter<I> > counters(n_parts);
+        for(I p = 0; p < n_parts; p++){
+            counters[p].shift = shift;
+            counters[p].count = &count[(size_t) p * n_buckets];
+        }
+        bucket_visit_task< I, source_type, bucket_counter<I> > task(src, &parts[0], &counters[0]);
+        parallel_run(task, (int) n_parts);
+    }
+
+    // 2. prefix sum in (bucket, part) order
+    std::vector<I> bucket_ptr(n_buckets + 1);
+    I cumsum = 0;
+    for(I b = 0; b < n_buckets; b++){
+        bucket_ptr[b] = cumsum;
+        for(I p = 0; p < n_parts; p++){
+            const I temp = count[(size_t) p * n_buckets + b];
+            count[(size_t) p * n_buckets + b] = cumsum;
+            cumsum += temp;
+        }
+    }
+    bucket_ptr[n_buckets] = cumsum;
+
+    // 3. scatter by bucket
+    std::vector<I> Tk, Ti;
+    std::vector<T> Tx;
+    if (shift > 0){
+        Tk.resize(nnz + 1);
+        Ti.resize(nnz + 1);
+        Tx.resize(nnz + 1);
+    }
+    {
+        std::vector< bucket_writer<I,T> > writers(n_parts);
+        for(I p = 0; p < n_parts; p++){
+            writers[p].shift = shift;
+            writers[p].next  = &count[(size_t) p * n_buckets];
+            writers[p].Bk    = (shift > 0) ? &Tk[0] : 0;
+            writers[p].Bi    = (shift > 0) ? &Ti[0] : Bi;
+            writers[p].Bx    = (shift > 0) ? &Tx[0] : Bx;
+        }
+        bucket_visit_task< I, source_type, bucket_writer<I,T> > task(src, &parts[0], &writers[0]);
+        parallel_run(task, (int) n_parts);
+    }
+
+    if (shift == 0){
+        std::copy(bucket_ptr.begin(), bucket_ptr.end(), Bp);
+    } else {
+        // 4. scatter each block of keys, blocks are taken dynamically
+        bucket_block_task<I,T> task(n_keys, shift, &bucket_ptr[0],
+                                    &Tk[0], &Ti[0], &Tx[0], Bp, Bi, Bx);
+        parallel_run(task, (nnz < get_parallel_threshold()) ? 1 : (int) n_buckets);
+    }
+    Bp[n_keys] = nnz;
+}
+
+#endif
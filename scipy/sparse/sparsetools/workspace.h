@@ -0,0 +1,260 @@
+#ifndef __WORKSPACE_H__
+#define __WORKSPACE_H__
+
+/*
+ * workspace.h
+ *   Scratch arrays of the sparsetools kernels that are kept between
+ *   calls.
+ *
+ * Kernels such as csr_matmat_pass2 and csr_binop_csr_general need
+ * scratch arrays of length n_col.  Allocating and initializing them on
+ * every call is a large part of the cost when many products of
+ * moderately sized matrices are formed, e.g. in a time stepping loop.
+ *
+ * A workspace keeps sets of buffers between calls.  Each thread that
+ * runs a kernel leases one set for the duration of its rows and then
+ * returns it.  Buffers only grow, so once they are large enough for
+ * the matrices at hand repeated calls allocate nothing.
+ *
+ * To bound the memory held between calls, a workspace keeps at most
+ * workspace_max_bytes() bytes of idle buffers.  A set that is returned
+ * when the pool is full, e.g. after a product of unusually large
+ * matrices, is freed instead.
+ *
+ * Buffers are handed out in their idle state: index arrays (next,
+ * keys) are filled with -1 and value arrays (sums, sums2, values) with
+ * 0.  Kernels must restore that state before they return a lease with
+ * workspace_lease::done(); a lease that is dropped without done(),
+ * e.g. because of an exception, destroys its buffers instead.
+ *
+ * The kernels exposed to Python use one default workspace per buffer
+ * type.  C++ callers may keep their own workspace and pass it to the
+ * *_impl functions.
+ *
+ */
+
+#include <vector>
+#include <utility>
+
+#include "parallel.h"
+
+
+/*
+ * Allocation count and reset of the workspaces
+ *
+ *   get_workspace_allocations() - number of times a workspace buffer
+ *                                 was allocated or grown
+ *   clear_workspaces()          - drop the idle buffers of all
+ *                                 workspaces, each workspace frees
+ *                                 them the next time it is used
+ *   workspace_max_bytes()       - bytes of idle buffers kept by each
+ *                                 workspace (default 64 MB)
+ *
+ */
+inline parallel_mutex& workspace_mutex()
+{
+    static parallel_mutex mutex;
+    return mutex;
+}
+
+inline long& workspace_allocations_setting()
+{
+    static long n_allocations = 0;
+    return n_allocations;
+}
+
+inline unsigned long& workspace_generation_setting()
+{
+    static unsigned long generation = 0;
+    return generation;
+}
+
+inline std::size_t& workspace_max_bytes()
+{
+    static std::size_t max_bytes = (std::size_t) 64 << 20;
+    return max_bytes;
+}
+
+inline long get_workspace_allocations()
+{
+    parallel_lock lock(workspace_mutex());
+    return workspace_allocations_setting();
+}
+
+inline void clear_workspaces()
+{
+    parallel_lock lock(workspace_mutex());
+    workspace_generation_setting()++;
+}
+
+
+/*
+ * Return buf with at least n elements.  New elements are set to idle.
+ */
+template <class X>
+X * workspace_array(std::vector<X>& buf, const std::size_t n, const X& idle = X())
+{
+    if (buf.size() < n){
+        {
+            parallel_lock lock(workspace_mutex());
+            workspace_allocations_setting()++;
+        }
+        buf.resize(n, idle);
+    }
+    return buf.empty() ? 0 : &buf[0];
+}
+
+
+/*
+ * Buffers of the kernels that only need index arrays
+ */
+template <class X>
+inline std::size_t workspace_bytes(const std::vector<X>& buf)
+{
+    return buf.capacity() * sizeof(X);
+}
+
+template <class I>
+struct index_buffers
+{
+    std::vector<I>      next;      // -1 when idle
+    std::vector<I>      row_nnz;
+    std::vector<double> work;
+
+    std::size_t bytes() const
+    {
+        return workspace_bytes(next) + workspace_bytes(row_nnz) +
+               workspace_bytes(work);
+    }
+};
+
+/*
+ * Buffers of the CSR products and binary operations
+ */
+template <class I, class T>
+struct csr_buffers : public index_buffers<I>
+{
+    std::vector<T> sums;           // 0 when idle
+    std::vector<T> sums2;          // 0 when idle
+    std::vector<I> keys;           // -1 when idle
+    std::vector<T> values;         // 0 when idle
+    std::vector< std::pair<I,T> > products;
+    std::vector<I> scratch_keys;   // no idle state
+    std::vector<T> scratch_values; // no idle state
+
+    std::size_t bytes() const
+    {
+        return index_buffers<I>::bytes() +
+               workspace_bytes(sums) + workspace_bytes(sums2) +
+               workspace_bytes(keys) + workspace_bytes(values) +
+               workspace_bytes(products) + workspace_bytes(scratch_keys) +
+               workspace_bytes(scratch_values);
+    }
+};
+
+
+/*
+ * Pool of buffer sets of type B, which must provide
+ *   std::size_t bytes() const
+ * returning the memory held by the set
+ */
+template <class B>
+class workspace
+{
+    public:
+        typedef B buffers_type;
+
+        workspace() : idle_bytes(0), generation(workspace_generation_setting()) {}
+
+        ~workspace()
+        {
+            for(std::size_t n = 0; n < idle.size(); n++)
+                delete idle[n];
+        }
+
+        B * acquire()
+        {
+            parallel_lock lock(workspace_mutex());
+
+            if (generation != workspace_generation_setting()){
+                for(std::size_t n = 0; n < idle.size(); n++)
+                    delete idle[n];
+                idle.clear();
+                idle_bytes = 0;
+                generation = workspace_generation_setting();
+            }
+
+            if (idle.empty()){
+                workspace_allocations_setting()++;
+                return new B();
+            }
+
+            B * buffers = idle.back();
+            idle.pop_back();
+            idle_bytes -= buffers->bytes();
+            return buffers;
+        }
+
+        void release(B * buffers, const bool is_idle)
+        {
+            if (is_idle){
+                const std::size_t bytes = buffers->bytes();
+                parallel_lock lock(workspace_mutex());
+                if (idle_bytes + bytes <= workspace_max_bytes()){
+                    idle.push_back(buffers);
+                    idle_bytes += bytes;
+                    return;
+                }
+            }
+            delete buffers;
+        }
+
+    private:
+        std::vector<B *> idle;
+        std::size_t idle_bytes;
+        unsigned long generation;
+
+        workspace(const workspace&);
+        workspace& operator=(const workspace&);
+};
+
+/*
+ * Workspace used when the caller does not provide one
+ */
+template <class B>
+workspace<B>& default_workspace()
+{
+    static workspace<B> ws;
+    return ws;
+}
+
+
+/*
+ * A set of buffers leased from a workspace for the lifetime of the
+ * object
+ */
+template <class B>
+class workspace_lease
+{
+    public:
+        explicit workspace_lease(workspace<B>& ws)
+            : ws(ws), buffers(ws.acquire()), is_idle(false) {}
+
+        ~workspace_lease() { ws.release(buffers, is_idle); }
+
+        B& operator*()  const { return *buffers; }
+        B* operator->() const { return buffers; }
+
+        // the buffers have been restored to their idle state
+        void done() { is_idle = true; }
+
+    private:
+        workspace<B>& ws;
+        B * buffers;
+        bool is_idle;
+
+        workspace_lease(const workspace_lease&);
+        workspace_lease& operator=(const workspace_lease&);
+};
+
+#endif
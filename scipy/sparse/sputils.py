@@ -2,7 +2,7 @@
 """
 
 __all__ = ['upcast','getdtype','isscalarlike','isintlike',
-            'isshape','issequence','isdense']
+            'isshape','issequence','isdense','get_index_dtype']
 
 import numpy as np
 
@@ -47,6 +47,73 @@ def upcast(*args):
     raise TypeError('no supported conversion for types: %s' % args)
 
 
+# (value, vector) type pairs of the *_mixed matvec kernels in sparsetools,
+# which multiply a matrix of the first type by vectors of the second type
+# without converting the matrix
+mixed_dtypes = [ (np.dtype(np.float32),   np.dtype(np.float64)),
+                 (np.dtype(np.complex64), np.dtype(np.complex128)) ]
+
+def has_mixed_kernel(data_dtype, vector_dtype):
+    """Is there a *_matvec_mixed kernel for a matrix of type data_dtype
+    and vectors of type vector_dtype?
+    """
+    return (np.dtype(data_dtype), np.dtype(vector_dtype)) in mixed_dtypes
+
+
+def get_index_dtype(arrays=(), maxval=None, check_contents=False):
+    """Returns the index dtype to use with sparsetools
+
+    The index dtype is np.intc, unless maxval or the integer arrays in
+    arrays need 64 bits, in which case it is np.int64.  The sparsetools
+    routines are instantiated for both types, but all index arrays
+    passed to one call must have the same type.
+
+    Parameters
+    ----------
+    arrays : array or tuple of arrays
+        index arrays that will be used together
+    maxval : int, optional
+        largest value the indices must hold, e.g. the number of rows,
+        columns or nonzeros
+    check_contents : bool, optional
+        if True, 64-bit arrays whose values fit in 32 bits do not
+        require 64-bit indices.  Use this for arrays that come from
+        the user, such as lists of python ints.
+
+    Examples
+    --------
+
+    >>> get_index_dtype(maxval=10)
+    <type 'numpy.int32'>
+    >>> get_index_dtype(maxval=2**40)
+    <type 'numpy.int64'>
+
+    """
+    int32min = np.iinfo(np.int32).min
+    int32max = np.iinfo(np.int32).max
+
+    if maxval is not None and maxval > int32max:
+        return np.int64
+
+    if isinstance(arrays, np.ndarray):
+        arrays = (arrays,)
+
+    for arr in arrays:
+        arr = np.asarray(arr)
+        if np.can_cast(arr.dtype, np.int32):
+            continue
+        if check_contents:
+            if arr.size == 0:
+                continue
+            if arr.dtype.kind in 'iu' and \
+                    arr.min() >= int32min and arr.max() <= int32max:
+                continue
+        if arr.dtype.kind in 'iu':
+            return np.int64
+
+    return np.intc
+
+
 def to_native(A):
     return np.asarray(A,dtype=A.dtype.newbyteorder('native'))
 
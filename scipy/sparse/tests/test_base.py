@@ -27,7 +27,7 @@ from numpy.testing import assert_raises, assert_equal, assert_array_equal, \
 
 import scipy.sparse as sparse
 from scipy.sparse import csc_matrix, csr_matrix, dok_matrix, \
-        coo_matrix, lil_matrix, dia_matrix, bsr_matrix, \
+        coo_matrix, lil_matrix, dia_matrix, bsr_matrix, sell_matrix, \
         eye, isspmatrix, SparseEfficiencyWarning
 from scipy.sparse.sputils import supported_dtypes
 from scipy.sparse.linalg import splu
@@ -1635,6 +1635,440 @@ class TestBSR(_TestCommon, _TestArithmetic, _TestInplaceArithmetic, TestCase):
         x = arange(A.shape[1]*6).reshape(-1,6)
         assert_equal(A*x, A.todense()*x)
 
+    def test_unrolled_kernels(self):
+        """unrolled and generic kernels agree for every block size"""
+        from scipy.sparse import sparsetools
+        saved = sparsetools.get_bsr_unrolled()
+        try:
+            for R in range(1,10):
+                A = kron([[1,0,2,0],[0,3,0,0],[4,0,0,5]], arange(R*R).reshape(R,R) - 3)
+                B = kron([[0,1,0],[2,0,0],[0,0,3],[1,1,0]], arange(R*R).reshape(R,R))
+                x = arange(A.shape[1]) % 5 - 2
+                X = arange(A.shape[1]*3).reshape(-1,3) % 7
+
+                results = []
+                for unrolled in [False,True]:
+                    sparsetools.set_bsr_unrolled(unrolled)
+                    Asp = bsr_matrix(A, blocksize=(R,R))
+                    Bsp = bsr_matrix(B, blocksize=(R,R))
+                    results.append( (Asp*x, Asp*X, (Asp*Bsp).todense(),
+                                     (Asp+Asp).todense(), (Asp-Asp*2).todense()) )
+
+                for generic,unrolled in zip(*results):
+                    assert_equal(generic, unrolled)
+                assert_equal(results[1][0], dot(A,x))
+                assert_equal(results[1][1], dot(A,X))
+                assert_equal(results[1][2], dot(A,B))
+                assert_equal(results[1][4], -A)
+        finally:
+            sparsetools.set_bsr_unrolled(saved)
+
+
+class TestSELL(_TestCommon, _TestArithmetic, TestCase):
+    spmatrix = sell_matrix
+
+    def test_constructor1(self):
+        """check native SELL format constructor"""
+        D = matrix([[1,0,2],
+                    [0,0,3],
+                    [4,5,6]])
+
+        indptr  = array([0,4,10])
+        indices = array([0,2,2,-1,0,-1,1,-1,2,-1])
+        data    = array([1,3,2,0,4,0,5,0,6,0])
+        perm    = array([0,1,2])
+
+        Asp = sell_matrix((data,indices,indptr,perm), shape=(3,3), C=2)
+        assert_equal(Asp.todense(),D)
+        assert_equal(Asp.nnz,6)
+
+        Asp = csr_matrix(D).tosell(C=2, sigma=1)
+        assert_array_equal(Asp.indptr,indptr)
+        assert_array_equal(Asp.indices,indices)
+        assert_array_equal(Asp.data,data)
+        assert_array_equal(Asp.perm,perm)
+
+        # longest rows first inside each window
+        Asp = csr_matrix(D).tosell(C=2, sigma=4)
+        assert_array_equal(Asp.perm,[2,0,1])
+        assert_equal(Asp.todense(),D)
+
+    def test_sell_matvec(self):
+        np.random.seed(0)
+        M,N = 103,57
+        lengths = np.random.randint(0, 20, size=M)
+        lengths[::17] = N
+        row = np.repeat(arange(M), lengths)
+        col = np.random.randint(0, N, size=len(row))
+        val = np.random.randint(-5, 5, size=len(row))
+        A = coo_matrix((val,(row,col)), shape=(M,N)).tocsr()
+
+        for dtype in ['int32','float32','float64','complex128']:
+            B = A.astype(dtype)
+            x = (arange(N) % 7 - 3).astype(dtype)
+            for C in [1,3,4,8,16]:
+                for sigma in [1,5,256]:
+                    S = B.tosell(C=C, sigma=sigma)
+                    assert_equal(S.C,C)
+                    assert_equal(S.nnz,B.nnz)
+                    assert_array_equal(S * x, B * x)
+                    assert_array_equal(S.tocsr().todense(), B.todense())
+
+
+
+class TestParallelKernels(TestCase):
+    """run the sparsetools kernels with the thread pool forced on"""
+
+    def setUp(self):
+        from scipy.sparse import sparsetools
+        self.sparsetools = sparsetools
+        self.saved = (sparsetools.get_num_threads(),
+                      sparsetools.get_parallel_threshold())
+        sparsetools.set_num_threads(4)
+        sparsetools.set_parallel_threshold(0)
+
+    def tearDown(self):
+        n_threads, threshold = self.saved
+        self.sparsetools.set_num_threads(n_threads)
+        self.sparsetools.set_parallel_threshold(threshold)
+
+    def test_thread_knob(self):
+        assert_equal(self.sparsetools.get_parallel_threshold(), 0)
+        assert_(self.sparsetools.get_num_threads() >= 1)
+
+    def test_set_num_threads(self):
+        sparsetools = self.sparsetools
+        for n_threads in [1, 3]:
+            sparsetools.set_num_threads(n_threads)
+            assert_equal(sparsetools.get_num_threads(), n_threads)
+            for module in sparsetools._modules:
+                assert_equal(module.get_num_threads(), n_threads)
+
+        # the modules share one pool and setting
+        sparsetools.csr.set_num_threads(2)
+        assert_equal(sparsetools.get_num_threads(), 2)
+        assert_equal(sparsetools._assembler.get_num_threads(), 2)
+
+    def test_csr_matvec(self):
+        np.random.seed(0)
+        D = np.random.rand(50,40) * (np.random.rand(50,40) > 0.8)
+        D[7] = 1   # one dense row to unbalance the partition
+        A = csr_matrix(D)
+        x = np.random.rand(40)
+        X = np.random.rand(40,3)
+        assert_array_almost_equal(A*x, dot(D,x))
+        assert_array_almost_equal(A*X, dot(D,X))
+
+    def test_csr_matmat(self):
+        np.random.seed(0)
+        D = np.random.rand(60,50) * (np.random.rand(60,50) > 0.8)
+        E = np.random.rand(50,70) * (np.random.rand(50,70) > 0.8)
+        D[3] = 1
+        for spmatrix in [csr_matrix, csc_matrix]:
+            A, B = spmatrix(D), spmatrix(E)
+            C = A * B
+            assert_array_almost_equal(C.todense(), dot(D,E))
+            # sorted inputs give sorted output
+            fn = self.sparsetools.csr_has_sorted_indices
+            assert_(fn(len(C.indptr) - 1, C.indptr, C.indices))
+
+            # unsorted inputs
+            A = spmatrix(D)
+            for i in range(len(A.indptr) - 1):
+                s = slice(A.indptr[i], A.indptr[i+1])
+                A.indices[s] = A.indices[s][::-1]
+                A.data[s] = A.data[s][::-1]
+            A.has_sorted_indices = False
+            assert_(not fn(len(A.indptr) - 1, A.indptr, A.indices))
+            C = A * B
+            assert_array_almost_equal(C.todense(), dot(D,E))
+
+    def test_matmat_accumulators(self):
+        np.random.seed(0)
+        D = np.random.rand(40,30) * (np.random.rand(40,30) > 0.8)
+        E = np.random.rand(30,50) * (np.random.rand(30,50) > 0.8)
+        saved = self.sparsetools.get_matmat_accumulator()
+        try:
+            for method in ['dense','hash','esc','auto']:
+                self.sparsetools.set_matmat_accumulator(method)
+                assert_equal(self.sparsetools.get_matmat_accumulator(), method)
+                for spmatrix in [csr_matrix, csc_matrix, bsr_matrix]:
+                    C = spmatrix(D) * spmatrix(E)
+                    assert_array_almost_equal(C.todense(), dot(D,E))
+        finally:
+            self.sparsetools.set_matmat_accumulator(saved)
+
+        assert_raises(ValueError, self.sparsetools.set_matmat_accumulator, 'foo')
+
+    def test_workspace_reuse(self):
+        np.random.seed(0)
+        D = np.random.rand(60,50) * (np.random.rand(60,50) > 0.8)
+        E = np.random.rand(50,70) * (np.random.rand(50,70) > 0.8)
+        A, B = csr_matrix(D), csr_matrix(E)
+        U = A.copy()
+        U.indices[:2] = U.indices[1::-1]   # unsorted
+
+        # serial, so that the number of buffer sets in use is fixed
+        self.sparsetools.set_num_threads(1)
+        for i in range(3):
+            if i == 2:
+                n_allocs = self.sparsetools.get_workspace_allocations()
+            assert_array_almost_equal((A*B).todense(), dot(D,E))
+            assert_array_almost_equal((U+U).todense(), 2*D)
+        assert_equal(self.sparsetools.get_workspace_allocations(), n_allocs)
+
+        self.sparsetools.clear_workspaces()
+        assert_array_almost_equal((A*B).todense(), dot(D,E))
+        assert_(self.sparsetools.get_workspace_allocations() > n_allocs)
+
+    def test_product_plan(self):
+        np.random.seed(0)
+        D = np.random.rand(60,50) * (np.random.rand(60,50) > 0.8)
+        E = np.random.rand(50,70) * (np.random.rand(50,70) > 0.8)
+        A, B = csr_matrix(D), csr_matrix(E)
+        A.reuse_product_pattern = True
+
+        C = A*B
+        assert_array_almost_equal(C.todense(), dot(D,E))
+        plan = A._product_plan
+
+        # new values, same patterns: the plan is reused
+        A.data[:] = np.random.rand(A.nnz)
+        B.data[:] = np.random.rand(B.nnz)
+        C = A*B
+        assert_(A._product_plan is plan)
+        assert_array_almost_equal(C.todense(), dot(A.todense(),B.todense()))
+        assert_(C.has_sorted_indices)
+
+        # products that cancel are kept as explicit zeros
+        B.data[:] = 0
+        assert_equal((A*B).nnz, C.nnz)
+
+        # a new pattern makes a new plan
+        B = csr_matrix(E.T.copy()[:50,:60])
+        C = A*B
+        assert_(A._product_plan is not plan)
+        assert_array_almost_equal(C.todense(), dot(A.todense(),B.todense()))
+
+    def test_bsr_matvec(self):
+        np.random.seed(0)
+        D = kron(np.random.rand(10,6) > 0.6, np.random.rand(2,3))
+        A = bsr_matrix(D, blocksize=(2,3))
+        x = np.random.rand(18)
+        X = np.random.rand(18,4)
+        assert_array_almost_equal(A*x, dot(D,x))
+        assert_array_almost_equal(A*X, dot(D,X))
+
+    def test_transpose(self):
+        np.random.seed(0)
+        D = np.random.rand(60,50) * (np.random.rand(60,50) > 0.8)
+        D[5] = 1
+
+        A = csr_matrix(D)
+        B = A.tocsc()
+        assert_array_equal(B.todense(), D)
+        fn = self.sparsetools.csr_has_sorted_indices
+        assert_(fn(len(B.indptr) - 1, B.indptr, B.indices))
+        assert_array_equal(B.tocsr().todense(), D)
+
+        # duplicates are kept in input order and summed later
+        row = np.array([3,1,3,0,3,1])
+        col = np.array([2,0,2,1,4,0])
+        data = np.array([1.,2.,3.,4.,5.,6.])
+        C = coo_matrix((data,(row,col)), shape=(5,6))
+        E = np.zeros((5,6))
+        for i,j,v in zip(row,col,data):
+            E[i,j] += v
+        assert_array_equal(C.tocsr().todense(), E)
+        assert_array_equal(C.tocsc().todense(), E)
+
+        D = kron(np.random.rand(10,6) > 0.6, np.random.rand(2,3))
+        A = bsr_matrix(D, blocksize=(2,3))
+        assert_array_equal(A.transpose().todense(), D.T)
+
+    def test_transpose_blocked(self):
+        # more than 2**20 keys and entries take the two round scatter
+        np.random.seed(0)
+        n = 2**20 + 7
+        D = np.random.rand(3,n) * (np.random.rand(3,n) > 0.3)
+        D[:,-1] = 1
+        A = csr_matrix(D)
+        row = np.repeat(np.arange(3), np.diff(A.indptr))
+        order = np.argsort(A.indices, kind='mergesort')
+
+        C = coo_matrix((A.data,(A.indices,row)), shape=(n,3))
+        for B in [A.tocsc(), C.tocsr()]:
+            assert_array_equal(B.indptr[1:], np.cumsum(np.bincount(A.indices)))
+            assert_array_equal(B.indices, row[order])
+            assert_array_equal(B.data, A.data[order])
+
+    def test_coo_tocsr_canonical(self):
+        np.random.seed(0)
+        # long rows take the radix sort, short ones insertion sort
+        row = np.random.randint(0, 40, 4000)
+        col = np.random.randint(0, 3000, 4000)
+        row[:300] = 7
+        data = np.random.rand(4000)
+        E = np.zeros((40,3000))
+        for i,j,v in zip(row,col,data):
+            E[i,j] += v
+
+        C = coo_matrix((data,(row,col)), shape=(40,3000))
+        fn = self.sparsetools.csr_has_canonical_format
+        for A in [C.tocsr(), C.tocsc()]:
+            assert_(A.has_sorted_indices)
+            assert_(fn(len(A.indptr) - 1, A.indptr, A.indices))
+            assert_equal(A.nnz, len(A.indices))
+            assert_array_almost_equal(A.todense(), E)
+
+        # sorting and summing in place
+        A = csr_matrix((data, col, np.arange(0, 4001, 100)), shape=(40,3000))
+        B = A.copy()
+        B.sum_duplicates()
+        assert_(fn(len(B.indptr) - 1, B.indptr, B.indices))
+        assert_array_almost_equal(B.todense(), A.todense())
+
+        # duplicates that cancel are kept as explicit zeros
+        C = coo_matrix(([1.,-1.,2.],([0,0,1],[1,1,0])), shape=(2,2))
+        assert_equal(C.tocsr().nnz, 2)
+
+    def test_assembler(self):
+        np.random.seed(0)
+        row = np.random.randint(0, 30, 3000)
+        col = np.random.randint(0, 20, 3000)
+        data = np.random.rand(3000)
+        row[:200] = 4     # one long row, compacted several times
+
+        E = np.zeros((30,20))
+        A = self.sparsetools.assembler((30,20), np.float64)
+        for k in range(0, 3000, 500):
+            s = slice(k, k + 500)
+            if k % 1000 == 0:
+                A.add(row[s], col[s], data[s])
+                for i,j,v in zip(row[s],col[s],data[s]):
+                    E[i,j] += v
+            else:
+                A.set(row[s], col[s], data[s])
+                for i,j,v in zip(row[s],col[s],data[s]):
+                    E[i,j] = v
+        data, indices, indptr = A.tocsr()
+        B = csr_matrix((data, indices, indptr), shape=(30,20))
+        fn = self.sparsetools.csr_has_canonical_format
+        assert_(fn(len(B.indptr) - 1, B.indptr, B.indices))
+        assert_array_equal(B.todense(), E)
+
+        # entries set to zero are removed, sums that cancel are kept
+        A = self.sparsetools.assembler((3,3), np.complex128)
+        A.add([0,0,1], [1,1,2], [1j,-1j,2])
+        A.set([2,2,1], [0,0,2], [5,0,0])
+        assert_equal(A.getnnz(), 1)
+        data, indices, indptr = A.tocsr()
+        assert_array_equal(indptr, [0,1,1,1])
+        assert_array_equal(indices, [1])
+        assert_raises(IndexError, A.add, [3], [0], [1.0])
+
+        # lil_matrix and dok_matrix convert through the assembler
+        D = np.random.rand(20,30) * (np.random.rand(20,30) > 0.7)
+        for spmatrix in [lil_matrix, dok_matrix]:
+            S = spmatrix(D)
+            B = S.tocsr()
+            assert_(fn(len(B.indptr) - 1, B.indptr, B.indices))
+            assert_array_equal(B.todense(), D)
+
+    def test_gather(self):
+        np.random.seed(0)
+        D = np.random.rand(40,30) * (np.random.rand(40,30) > 0.7)
+        rows = [5,0,39,5,-1,12]
+        cols = [3,29,3,0,-2,17,17]
+        for spmatrix in [csr_matrix, csc_matrix]:
+            A = spmatrix(D)
+            assert_array_equal(A[3:31,2:25].todense(), D[3:31,2:25])
+            assert_array_equal(A[rows,:].todense(), D[rows,:])
+            assert_array_equal(A[:,cols].todense(), D[:,cols])
+            assert_array_equal(A[rows,4:20].todense(), D[rows,4:20])
+            assert_array_equal(A[7,cols].todense(), D[[7]][:,cols])
+            assert_array_equal(A[-3,2:9].todense(), D[[-3],2:9])
+
+        # contiguous row ranges are copied unless copy=False
+        A = csr_matrix(D)
+        B = A.getrows(10, 20)
+        assert_array_equal(B.todense(), D[10:20])
+        B.data[:] = 0
+        assert_array_equal(A.todense(), D)
+        B = A.getrows(10, 20, copy=False)
+        assert_array_equal(B.todense(), D[10:20])
+        B.data[:] = 0
+        assert_array_equal(A[10:20].todense(), np.zeros((10,30)))
+
+        A = csc_matrix(D)
+        assert_array_equal(A.getcols(5, 8).todense(), D[:,5:8])
+
+    def test_dia(self):
+        np.random.seed(0)
+        data = np.random.rand(5,2100) * (np.random.rand(5,2100) > 0.2)
+        offsets = np.array([3,0,-1,-2000,7])
+        A = dia_matrix((data,offsets), shape=(2500,2050))
+        D = A.todense()
+        x = np.random.rand(2050)
+        assert_array_almost_equal(A*x, dot(D,x))
+
+        B = A.tocsr()
+        fn = self.sparsetools.csr_has_canonical_format
+        assert_(fn(len(B.indptr) - 1, B.indptr, B.indices))
+        assert_array_equal(B.todense(), D)
+        assert_array_equal(A.tocsc().todense(), D)
+
+        for spmatrix in [csr_matrix, csc_matrix]:
+            C = spmatrix(D).todia()
+            assert_array_equal(np.sort(C.offsets), [-2000,-1,0,3,7])
+            assert_array_equal(C.todense(), D)
+
+
+class TestIndexDtypes(TestCase):
+    def test_get_index_dtype(self):
+        from scipy.sparse.sputils import get_index_dtype
+        assert_equal(get_index_dtype(maxval=10), np.intc)
+        assert_equal(get_index_dtype(maxval=2**40), np.int64)
+        a = np.array([1,2,3], dtype=np.int64)
+        assert_equal(get_index_dtype(a), np.int64)
+        assert_equal(get_index_dtype(a, check_contents=True), np.intc)
+
+    def test_int64_indices(self):
+        np.random.seed(0)
+        D = np.random.rand(30,20) * (np.random.rand(30,20) > 0.7)
+        E = np.random.rand(20,10) * (np.random.rand(20,10) > 0.7)
+        x = np.random.rand(20)
+        for spmatrix in [csr_matrix, csc_matrix, bsr_matrix]:
+            A = spmatrix(D)
+            A = spmatrix((A.data, A.indices.astype(np.int64),
+                          A.indptr.astype(np.int64)), shape=A.shape)
+            assert_equal(A.indices.dtype, np.int64)
+            assert_equal(A.indptr.dtype, np.int64)
+            assert_array_almost_equal(A*x, dot(D,x))
+            assert_array_almost_equal((A*spmatrix(E)).todense(), dot(D,E))
+            assert_array_almost_equal((A + A).todense(), 2*D)
+            assert_array_equal(A.tocoo().todense(), D)
+            assert_array_equal(A.transpose().todense(), D.T)
+
+    def test_mixed_precision_matvec(self):
+        np.random.seed(0)
+        D = np.random.rand(30,20) * (np.random.rand(30,20) > 0.7)
+        D = D.astype(np.float32)
+        x = np.random.rand(20)
+        X = np.random.rand(20,3)
+        for spmatrix in [csr_matrix, csc_matrix, bsr_matrix, dia_matrix]:
+            A = spmatrix(D)
+            y = A * x
+            assert_equal(y.dtype, np.float64)
+            assert_array_almost_equal(y, dot(D.astype(np.float64), x))
+            Y = A * X
+            assert_equal(Y.dtype, np.float64)
+            assert_array_almost_equal(Y, dot(D.astype(np.float64), X))
+
+        A = csr_matrix(D.astype(np.complex64))
+        z = x + 1j*x
+        assert_array_almost_equal(A*z, dot(D.astype(np.complex128), z))
+
 
 if __name__ == "__main__":
     run_module_suite()
@@ -175,6 +175,43 @@ class TestConstructUtils(TestCase):
 
         #TODO test failure cases
 
+    def test_compressed_blocks(self):
+        # CSR and BSR inputs are assembled without conversion to COO
+        A = array([[1,2,0,0],[3,4,0,5]])
+        B = array([[0,6],[7,0]])
+        C = array([[0,0,8,0],[0,0,0,0]])
+        expected = np.bmat([[A,B],[C,np.zeros((2,2))]])
+        for fmt in ['csr','bsr']:
+            if fmt == 'csr':
+                convert = lambda X: csr_matrix(X)
+            else:
+                convert = lambda X: csr_matrix(X).tobsr(blocksize=(2,2))
+            blocks = [[convert(A), convert(B)], [convert(C), None]]
+            result = construct.bmat(blocks)
+            assert_equal(result.format, fmt)
+            assert_array_equal(result.todense(), expected)
+            assert_equal(construct.bmat(blocks, format='coo').format, 'coo')
+            assert_array_equal(construct.bmat(blocks, dtype=np.float32).todense(),
+                               expected)
+
+        assert_array_equal(construct.hstack([csr_matrix(A), csr_matrix(C)]).todense(),
+                           np.hstack([A,C]))
+        assert_array_equal(construct.vstack([csr_matrix(A), csr_matrix(C)]).todense(),
+                           np.vstack([A,C]))
+
+        # mixed formats take the COO path
+        result = construct.bmat([[csr_matrix(A), coo_matrix(B)]])
+        assert_array_equal(result.todense(), np.hstack([A,B]))
+
+        # kron of sparse CSR matrices
+        A = csr_matrix([[0,2,0],[1,0,0]])
+        B = csr_matrix([[1,0,0,3],[0,0,0,0],[0,4.5,0,0]])
+        result = construct.kron(A, B)
+        assert_equal(result.format, 'csr')
+        assert_array_equal(result.todense(), np.kron(A.todense(), B.todense()))
+        result = construct.kron(A, B, format='coo')
+        assert_array_equal(result.todense(), np.kron(A.todense(), B.todense()))
+
     def test_rand(self):
         # Simple sanity checks for sparse.rand
         for t in [np.float32, np.float64, np.longdouble]:
@@ -1,5 +1,6 @@
 from numpy import array, kron, matrix, diag
-from numpy.testing import TestCase, run_module_suite, assert_, assert_equal
+from numpy.testing import TestCase, run_module_suite, assert_, assert_equal, \
+        assert_raises
 
 from scipy.sparse import spfuncs
 from scipy.sparse import csr_matrix, csc_matrix, bsr_matrix
@@ -119,5 +120,86 @@ class TestSparseFunctions(TestCase):
         assert_(n_comp == 2)
         assert_equal(flag, [0, 0, -2, 1])
 
+        for algorithm in ['bfs', 'union_find', 'auto']:
+            n_comp, flag = cs_graph_components(csr_matrix(D), algorithm)
+            assert_(n_comp == 2)
+            assert_equal(flag, [0, 0, -2, 1])
+
+        assert_raises(ValueError, cs_graph_components, csr_matrix(D), 'foo')
+
+    def test_cs_graph_components_algorithms(self):
+        import numpy as np
+        from scipy.sparse import coo_matrix, cs_graph_components, sparsetools
+
+        # many small components, with the seeds spread over the nodes
+        np.random.seed(0)
+        n = 2000
+        i = np.random.randint(0, n, 600)
+        j = (i + np.random.randint(1, 20, 600)) % n
+        k = np.arange(0, n, 3)
+        row = np.concatenate((i, j, k))
+        col = np.concatenate((j, i, k))
+        A = coo_matrix((np.ones(len(row)), (row, col)), shape=(n,n)).tocsr()
+
+        saved = (sparsetools.get_num_threads(),
+                 sparsetools.get_parallel_threshold())
+        try:
+            sparsetools.set_num_threads(4)
+            sparsetools.set_parallel_threshold(0)
+            n_bfs, flag_bfs = cs_graph_components(A, 'bfs')
+            n_uf,  flag_uf  = cs_graph_components(A, 'union_find')
+        finally:
+            sparsetools.set_num_threads(saved[0])
+            sparsetools.set_parallel_threshold(saved[1])
+
+        assert_equal(n_uf, n_bfs)
+        assert_equal(flag_uf, flag_bfs)
+
+    def test_reordering(self):
+        import numpy as np
+        from scipy.sparse import reverse_cuthill_mckee, nested_dissection, \
+                permute_symmetric
+
+        # 2-d grid numbered at random, plus an isolated node
+        np.random.seed(0)
+        n = 30
+        grid = np.arange(n*n).reshape(n,n)
+        row = np.concatenate((grid[:-1,:].ravel(), grid[:,:-1].ravel()))
+        col = np.concatenate((grid[1:,:].ravel(), grid[:,1:].ravel()))
+        label = np.random.permutation(n*n + 1)
+        row, col = label[row], label[col]
+        A = csr_matrix((np.ones(len(row)), (row, col)), shape=(n*n+1,n*n+1))
+        A = A + A.T + csr_matrix(np.eye(n*n + 1))
+
+        def bandwidth(B):
+            B = B.tocoo()
+            return abs(B.row - B.col).max()
+
+        for symmetric_mode in [False, True]:
+            for order in [reverse_cuthill_mckee, nested_dissection]:
+                perm = order(A, symmetric_mode=symmetric_mode)
+                assert_equal(np.sort(perm), np.arange(n*n + 1))
+
+        perm = reverse_cuthill_mckee(A)
+        B = permute_symmetric(A, perm)
+        assert_equal(B.todense(), A.todense()[perm,:][:,perm])
+        assert_(bandwidth(B) <= 2*n)
+
+        perm = nested_dissection(A)
+        B = permute_symmetric(A, perm).todense()
+        assert_equal(B, A.todense()[perm,:][:,perm])
+
+        assert_raises(ValueError, permute_symmetric, A, perm[:-1])
+        assert_raises(ValueError, permute_symmetric, A, np.zeros(n*n + 1))
+
+        # a non-symmetric structure used as is still gives permutations
+        row = [0, 1, 2, 3, 6, 5, 6, 6, 6, 7]
+        col = [1, 2, 3, 4, 5, 1, 2, 3, 4, 6]
+        A = csr_matrix((np.ones(len(row)), (row, col)), shape=(8,8))
+        for order in [reverse_cuthill_mckee, nested_dissection]:
+            for B in [A, A.T.tocsr()]:
+                perm = order(B, symmetric_mode=True)
+                assert_equal(np.sort(perm), np.arange(8))
+
 if __name__ == "__main__":
     run_module_suite()